@@ -4533,6 +4533,184 @@ TEST_P(GroupBy, FirstLastFixedSizeBinary) {
       /*verbose=*/true);
 }
 
+TEST_P(GroupBy, TopKNumeric) {
+  for (const auto& type : NumericTypes()) {
+    for (bool use_threads : {true, false}) {
+      SCOPED_TRACE(type->ToString());
+      SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+      auto table =
+          TableFromJSON(schema({field("argument", type), field("key", int64())}), {R"([
+    [5,    1],
+    [null, 1],
+    [3,    2]
+])",
+                                                                                   R"([
+    [9,    1],
+    [null, 3],
+    [7,    null],
+    [1,    1]
+])",
+                                                                                   R"([
+    [8,    1],
+    [4,    2],
+    [2,    null],
+    [6,    1]
+])"});
+
+      auto top_k = std::make_shared<SelectKOptions>(SelectKOptions::TopKDefault(3));
+      auto bottom_k = std::make_shared<SelectKOptions>(SelectKOptions::BottomKDefault(3));
+      ASSERT_OK_AND_ASSIGN(
+          Datum aggregated_and_grouped,
+          GroupByTest(
+              {table->GetColumnByName("argument"), table->GetColumnByName("argument")},
+              {table->GetColumnByName("key")},
+              {{"hash_top_k", top_k}, {"hash_top_k", bottom_k}}, use_threads));
+      ValidateOutput(aggregated_and_grouped);
+      SortBy({"key_0"}, &aggregated_and_grouped);
+
+      AssertDatumsEqual(
+          ArrayFromJSON(struct_({field("key_0", int64()), field("hash_top_k", list(type)),
+                                 field("hash_top_k", list(type))}),
+                        R"([
+    [1,    [9, 8, 6], [1, 5, 6]],
+    [2,    [4, 3],    [3, 4]],
+    [3,    [],        []],
+    [null, [7, 2],    [2, 7]]
+  ])"),
+          aggregated_and_grouped,
+          /*verbose=*/true);
+    }
+  }
+}
+
+TEST_P(GroupBy, TopKBinary) {
+  for (const auto& type : BaseBinaryTypes()) {
+    for (bool use_threads : {true, false}) {
+      SCOPED_TRACE(type->ToString());
+      SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+      auto table = TableFromJSON(schema({field("argument", type), field("key", int64())}),
+                                 {R"([
+    ["bc",  1],
+    [null,  1],
+    ["aaa", 2]
+])",
+                                  R"([
+    ["d",   1],
+    ["b",   1],
+    ["zz",  null]
+])"});
+
+      auto top_k = std::make_shared<SelectKOptions>(SelectKOptions::TopKDefault(2));
+      auto bottom_k = std::make_shared<SelectKOptions>(SelectKOptions::BottomKDefault(2));
+      ASSERT_OK_AND_ASSIGN(
+          Datum aggregated_and_grouped,
+          GroupByTest(
+              {table->GetColumnByName("argument"), table->GetColumnByName("argument")},
+              {table->GetColumnByName("key")},
+              {{"hash_top_k", top_k}, {"hash_top_k", bottom_k}}, use_threads));
+      ValidateOutput(aggregated_and_grouped);
+      SortBy({"key_0"}, &aggregated_and_grouped);
+
+      AssertDatumsEqual(
+          ArrayFromJSON(struct_({field("key_0", int64()), field("hash_top_k", list(type)),
+                                 field("hash_top_k", list(type))}),
+                        R"([
+    [1,    ["d", "bc"], ["b", "bc"]],
+    [2,    ["aaa"],     ["aaa"]],
+    [null, ["zz"],      ["zz"]]
+  ])"),
+          aggregated_and_grouped,
+          /*verbose=*/true);
+    }
+  }
+}
+
+TEST_P(GroupBy, TopKIgnoresNaN) {
+  auto table =
+      TableFromJSON(schema({field("argument", float64()), field("key", int64())}), {R"([
+    [1.5,   1],
+    [NaN,   1],
+    [-2.0,  1],
+    [0.5,   1]
+])"});
+  auto top_k = std::make_shared<SelectKOptions>(SelectKOptions::TopKDefault(2));
+  ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                       GroupByTest({table->GetColumnByName("argument")},
+                                   {table->GetColumnByName("key")},
+                                   {{"hash_top_k", top_k}}, /*use_threads=*/false));
+  AssertDatumsEqual(
+      ArrayFromJSON(struct_({field("key_0", int64()),
+                             field("hash_top_k", list(float64()))}),
+                    R"([[1, [1.5, 0.5]]])"),
+      aggregated_and_grouped,
+      /*verbose=*/true);
+}
+
+TEST_P(GroupBy, TopKInvalidK) {
+  auto table = TableFromJSON(schema({field("argument", int32()), field("key", int64())}),
+                             {R"([[1, 1]])"});
+  for (const auto& func : {"hash_top_k", "hash_first_k"}) {
+    auto options = std::make_shared<SelectKOptions>(SelectKOptions::TopKDefault(-1));
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        Invalid, ::testing::HasSubstr("nonnegative `k`"),
+        GroupByTest({table->GetColumnByName("argument")},
+                    {table->GetColumnByName("key")}, {{func, options}},
+                    /*use_threads=*/false));
+  }
+}
+
+TEST_P(GroupBy, FirstK) {
+  // First k doesn't support multi threaded execution
+  bool use_threads = false;
+  for (const auto& type : {int32(), float64(), utf8(), large_binary()}) {
+    SCOPED_TRACE(type->ToString());
+    const bool is_binary = is_base_binary_like(type->id());
+    auto table = TableFromJSON(schema({field("argument", type), field("key", int64())}),
+                               {is_binary ? R"([
+    ["5",  1],
+    [null, 1],
+    ["3",  2]
+])"
+                                          : R"([
+    [5,    1],
+    [null, 1],
+    [3,    2]
+])",
+                                is_binary ? R"([
+    ["9",  1],
+    ["7",  null],
+    ["1",  1]
+])"
+                                          : R"([
+    [9,    1],
+    [7,    null],
+    [1,    1]
+])"});
+
+    auto options = std::make_shared<SelectKOptions>(SelectKOptions::TopKDefault(2));
+    ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                         GroupByTest({table->GetColumnByName("argument")},
+                                     {table->GetColumnByName("key")},
+                                     {{"hash_first_k", options}}, use_threads));
+    ValidateOutput(aggregated_and_grouped);
+    SortBy({"key_0"}, &aggregated_and_grouped);
+    AssertDatumsEqual(ArrayFromJSON(struct_({field("key_0", int64()),
+                                             field("hash_first_k", list(type))}),
+                                    is_binary ? R"([
+    [1,    ["5", "9"]],
+    [2,    ["3"]],
+    [null, ["7"]]
+  ])"
+                                              : R"([
+    [1,    [5, 9]],
+    [2,    [3]],
+    [null, [7]]
+  ])"),
+                      aggregated_and_grouped,
+                      /*verbose=*/true);
+  }
+}
+
 TEST_P(GroupBy, SmallChunkSizeSumOnly) {
   auto batch = RecordBatchFromJSON(
       schema({field("argument", float64()), field("key", int64())}), R"([
@@ -228,6 +228,89 @@ struct ArrowDeviceArrayStream {
 
 #endif  // ARROW_C_DEVICE_STREAM_INTERFACE
 
+#ifndef ARROW_C_ASYNC_STREAM_INTERFACE
+#define ARROW_C_ASYNC_STREAM_INTERFACE
+
+// EXPERIMENTAL: a push-based, asynchronous equivalent of ArrowDeviceArrayStream.
+//
+// The producer drives the stream by calling the consumer's
+// ArrowAsyncDeviceStreamHandler callbacks, from any thread. The consumer
+// applies backpressure by requesting data through the ArrowAsyncProducer:
+// the producer never calls `on_next_task` more often than requested.
+
+// A unit of data made available by the producer through `on_next_task`.
+struct ArrowAsyncTask {
+  // Callback to move the available data into `out`.
+  //
+  // It must be called exactly once per task, possibly after `on_next_task`
+  // returned, from another thread, or after the handler was released. It
+  // releases the task's private data. `out` may be NULL to discard the data.
+  //
+  // Return value: 0 if successful, an `errno`-compatible error code otherwise.
+  int (*extract_data)(struct ArrowAsyncTask* self, struct ArrowDeviceArray* out);
+
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+// The producer side of the stream, through which the consumer requests data.
+struct ArrowAsyncProducer {
+  // The device that this stream produces data on.
+  ArrowDeviceType device_type;
+
+  // Callback to allow `n` more calls to `on_next_task`.
+  //
+  // It may be called from any thread, including from within the handler's
+  // callbacks, until the handler is released.
+  void (*request)(struct ArrowAsyncProducer* self, int64_t n);
+
+  // Callback to ask the producer to stop. The producer then releases the
+  // handler without further calls to `on_next_task`.
+  void (*cancel)(struct ArrowAsyncProducer* self);
+
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+// The consumer side of the stream, whose callbacks are called by the producer.
+struct ArrowAsyncDeviceStreamHandler {
+  // Callback receiving the stream schema, called once before any other
+  // callback. `producer` is set beforehand. The consumer takes ownership of
+  // the schema.
+  //
+  // Return value: 0 if successful, an `errno`-compatible error code otherwise,
+  // in which case the producer releases the handler.
+  int (*on_schema)(struct ArrowAsyncDeviceStreamHandler* self,
+                   struct ArrowSchema* stream_schema);
+
+  // Callback receiving the next task, or NULL at the end of the stream.
+  // The consumer may copy the task struct to extract its data later.
+  // `metadata` is an optional, ArrowSchema-encoded set of key-value pairs.
+  //
+  // Return value: 0 if successful, an `errno`-compatible error code otherwise,
+  // in which case the task is not extracted and the producer releases the
+  // handler.
+  int (*on_next_task)(struct ArrowAsyncDeviceStreamHandler* self,
+                      struct ArrowAsyncTask* task, const char* metadata);
+
+  // Callback signalling that the producer failed with an `errno`-compatible
+  // error code and an optional message. Only `release` is called afterwards.
+  void (*on_error)(struct ArrowAsyncDeviceStreamHandler* self, int code,
+                   const char* message, const char* metadata);
+
+  // Release callback, called exactly once by the producer when it is done
+  // with the handler.
+  void (*release)(struct ArrowAsyncDeviceStreamHandler* self);
+
+  // The producer of the stream, valid until `release` is called
+  struct ArrowAsyncProducer* producer;
+
+  // Opaque consumer-specific data
+  void* private_data;
+};
+
+#endif  // ARROW_C_ASYNC_STREAM_INTERFACE
+
 #ifdef __cplusplus
 }
 #endif
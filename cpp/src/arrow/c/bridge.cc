@@ -20,7 +20,9 @@
 #include <algorithm>
 #include <cerrno>
 #include <cstring>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -39,12 +41,14 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/range.h"
 #include "arrow/util/small_vector.h"
 #include "arrow/util/string.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/value_parsing.h"
 #include "arrow/visit_type_inline.h"
 
@@ -2052,6 +2056,21 @@ Status ExportStreamNext(const std::shared_ptr<ChunkedArray>& src, int64_t i,
   }
 }
 
+int ErrnoFromStatus(const Status& status) {
+  switch (status.code()) {
+    case StatusCode::OK:
+      return 0;
+    case StatusCode::IOError:
+      return EIO;
+    case StatusCode::NotImplemented:
+      return ENOSYS;
+    case StatusCode::OutOfMemory:
+      return ENOMEM;
+    default:
+      return EINVAL;  // Fallback for Invalid, TypeError, etc.
+  }
+}
+
 template <typename T>
 class ExportedArrayStream {
  public:
@@ -2130,16 +2149,7 @@ class ExportedArrayStream {
       return 0;
     }
     private_data()->last_error_ = status.ToString();
-    switch (status.code()) {
-      case StatusCode::IOError:
-        return EIO;
-      case StatusCode::NotImplemented:
-        return ENOSYS;
-      case StatusCode::OutOfMemory:
-        return ENOMEM;
-      default:
-        return EINVAL;  // Fallback for Invalid, TypeError, etc.
-    }
+    return ErrnoFromStatus(status);
   }
 
   PrivateData* private_data() {
@@ -2360,4 +2370,446 @@ Result<std::shared_ptr<ChunkedArray>> ImportChunkedArray(
   return ChunkedArray::Make(std::move(chunks), std::move(data_type));
 }
 
+//////////////////////////////////////////////////////////////////////////
+// C async stream export
+
+namespace {
+
+// The producer of an exported async stream. It pulls record batches from the
+// generator as the consumer requests them, and is kept alive by the loop doing
+// so until the handler is released.
+class AsyncStreamProducer : public std::enable_shared_from_this<AsyncStreamProducer> {
+ public:
+  AsyncStreamProducer(AsyncGenerator<std::shared_ptr<RecordBatch>> generator,
+                      DeviceAllocationType device_type,
+                      struct ArrowAsyncDeviceStreamHandler* handler)
+      : generator_(std::move(generator)), handler_(handler) {
+    producer_.device_type = static_cast<ArrowDeviceType>(device_type);
+    producer_.request = StaticRequest;
+    producer_.cancel = StaticCancel;
+    producer_.private_data = this;
+  }
+
+  Future<> Run(const Schema& schema) {
+    handler_->producer = &producer_;
+    struct ArrowSchema c_schema;
+    Status st = ExportSchema(schema, &c_schema);
+    if (!st.ok()) {
+      return Finish(st);
+    }
+    int code = handler_->on_schema(handler_, &c_schema);
+    if (code != 0) {
+      consumer_failed_ = true;
+      return Finish(StatusFromConsumer(code, "on_schema"));
+    }
+    auto self = shared_from_this();
+    return Loop([self] { return self->Next(); })
+        .Then([self] { return self->Finish(Status::OK()); },
+              [self](const Status& st) { return self->Finish(st); });
+  }
+
+ private:
+  Future<ControlFlow<>> Next() {
+    auto self = shared_from_this();
+    return WaitForDemand().Then([self]() -> Future<ControlFlow<>> {
+      if (self->cancelled()) {
+        return Break();
+      }
+      return self->generator_().Then(
+          [self](const std::shared_ptr<RecordBatch>& batch) -> Result<ControlFlow<>> {
+            return self->PushTask(batch);
+          });
+    });
+  }
+
+  Result<ControlFlow<>> PushTask(const std::shared_ptr<RecordBatch>& batch) {
+    if (cancelled()) {
+      return Break();
+    }
+    if (IsIterationEnd(batch)) {
+      handler_->on_next_task(handler_, nullptr, nullptr);
+      return Break();
+    }
+    struct ArrowAsyncTask task;
+    task.extract_data = StaticExtractData;
+    task.private_data = new std::shared_ptr<RecordBatch>(batch);
+    int code = handler_->on_next_task(handler_, &task, nullptr);
+    if (code != 0) {
+      // The consumer rejected the task, release it ourselves
+      StaticExtractData(&task, nullptr);
+      consumer_failed_ = true;
+      return StatusFromConsumer(code, "on_next_task");
+    }
+    return Continue();
+  }
+
+  // Report the end of the stream, then release the handler
+  Status Finish(const Status& st) {
+    if (!st.ok() && !consumer_failed_) {
+      const std::string message = st.ToString();
+      handler_->on_error(handler_, ErrnoFromStatus(st), message.c_str(), nullptr);
+    }
+    handler_->release(handler_);
+    return st;
+  }
+
+  Future<> WaitForDemand() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cancelled_) {
+      return Future<>::MakeFinished();
+    }
+    if (requested_ > 0) {
+      --requested_;
+      return Future<>::MakeFinished();
+    }
+    demand_ = Future<>::Make();
+    return demand_;
+  }
+
+  void Request(int64_t n) {
+    Future<> demand;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (n <= 0) {
+        return;
+      }
+      requested_ += n;
+      if (demand_.is_valid()) {
+        --requested_;
+        demand = std::exchange(demand_, Future<>());
+      }
+    }
+    if (demand.is_valid()) {
+      demand.MarkFinished();
+    }
+  }
+
+  void Cancel() {
+    Future<> demand;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cancelled_ = true;
+      demand = std::exchange(demand_, Future<>());
+    }
+    if (demand.is_valid()) {
+      demand.MarkFinished();
+    }
+  }
+
+  bool cancelled() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cancelled_;
+  }
+
+  static Status StatusFromConsumer(int code, const char* callback) {
+    return Status::Cancelled("ArrowAsyncDeviceStreamHandler::", callback,
+                             " failed with error code ", code);
+  }
+
+  // C-compatible callbacks
+
+  static void StaticRequest(struct ArrowAsyncProducer* producer, int64_t n) {
+    reinterpret_cast<AsyncStreamProducer*>(producer->private_data)->Request(n);
+  }
+
+  static void StaticCancel(struct ArrowAsyncProducer* producer) {
+    reinterpret_cast<AsyncStreamProducer*>(producer->private_data)->Cancel();
+  }
+
+  static int StaticExtractData(struct ArrowAsyncTask* task,
+                               struct ArrowDeviceArray* out) {
+    auto batch = reinterpret_cast<std::shared_ptr<RecordBatch>*>(task->private_data);
+    int code = 0;
+    if (out != nullptr) {
+      code = ErrnoFromStatus(ExportDeviceRecordBatch(**batch, /*sync=*/nullptr, out));
+    }
+    delete batch;
+    task->private_data = nullptr;
+    return code;
+  }
+
+  AsyncGenerator<std::shared_ptr<RecordBatch>> generator_;
+  struct ArrowAsyncDeviceStreamHandler* handler_;
+  struct ArrowAsyncProducer producer_;
+  // Only accessed from the loop
+  bool consumer_failed_ = false;
+
+  std::mutex mutex_;
+  int64_t requested_ = 0;
+  bool cancelled_ = false;
+  // Finished when the consumer requests more data, or cancels
+  Future<> demand_;
+};
+
+}  // namespace
+
+Future<> ExportAsyncRecordBatchReader(
+    std::shared_ptr<Schema> schema,
+    AsyncGenerator<std::shared_ptr<RecordBatch>> generator,
+    DeviceAllocationType device_type, struct ArrowAsyncDeviceStreamHandler* handler) {
+  auto producer = std::make_shared<AsyncStreamProducer>(std::move(generator),
+                                                        device_type, handler);
+  return producer->Run(*schema);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// C async stream import
+
+namespace {
+
+// The consumer of an imported async stream, owned by the handler until it is
+// released and by the generator it yields.
+class AsyncStreamConsumer : public std::enable_shared_from_this<AsyncStreamConsumer> {
+ public:
+  AsyncStreamConsumer(::arrow::internal::Executor* executor, int64_t queue_size,
+                      DeviceMemoryMapper mapper)
+      : executor_(executor),
+        queue_size_(queue_size),
+        mapper_(std::move(mapper)),
+        schema_future_(Future<AsyncRecordBatchGenerator>::Make()) {}
+
+  ~AsyncStreamConsumer() {
+    // Release the data of the tasks that were never consumed
+    for (auto& task : tasks_) {
+      task.extract_data(&task, nullptr);
+    }
+  }
+
+  static Future<AsyncRecordBatchGenerator> Make(
+      struct ArrowAsyncDeviceStreamHandler* handler,
+      ::arrow::internal::Executor* executor, int64_t queue_size,
+      DeviceMemoryMapper mapper) {
+    auto consumer =
+        std::make_shared<AsyncStreamConsumer>(executor, queue_size, std::move(mapper));
+    auto schema_future = consumer->schema_future_;
+    handler->on_schema = StaticOnSchema;
+    handler->on_next_task = StaticOnNextTask;
+    handler->on_error = StaticOnError;
+    handler->release = StaticRelease;
+    handler->producer = nullptr;
+    handler->private_data = new std::shared_ptr<AsyncStreamConsumer>(std::move(consumer));
+    return schema_future;
+  }
+
+ private:
+  int OnSchema(struct ArrowAsyncDeviceStreamHandler* handler,
+               struct ArrowSchema* c_schema) {
+    auto maybe_schema = ImportSchema(c_schema);
+    if (!maybe_schema.ok()) {
+      Fail(maybe_schema.status());
+      return EINVAL;
+    }
+    schema_ = maybe_schema.MoveValueUnsafe();
+
+    AsyncRecordBatchGenerator stream;
+    stream.schema = schema_;
+    stream.device_type =
+        static_cast<DeviceAllocationType>(handler->producer->device_type);
+    stream.generator = [self = shared_from_this()] { return self->Next(); };
+    Future<AsyncRecordBatchGenerator> schema_future;
+    {
+      std::lock_guard<std::recursive_mutex> lock(producer_mutex_);
+      producer_ = handler->producer;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // Don't keep the generator alive from here
+      schema_future = std::exchange(schema_future_, {});
+    }
+    Dispatch([schema_future, stream = std::move(stream)]() mutable {
+      schema_future.MarkFinished(std::move(stream));
+    });
+    Request(queue_size_);
+    return 0;
+  }
+
+  int OnNextTask(struct ArrowAsyncTask* task) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (task == nullptr) {
+      end_of_stream_ = true;
+    } else if (!waiting_.is_valid()) {
+      tasks_.push_back(*task);
+      return 0;
+    }
+    if (waiting_.is_valid()) {
+      auto waiting = std::exchange(waiting_, {});
+      lock.unlock();
+      if (task == nullptr) {
+        Dispatch([waiting]() mutable {
+          waiting.MarkFinished(IterationEnd<std::shared_ptr<RecordBatch>>());
+        });
+      } else {
+        Dispatch([self = shared_from_this(), waiting, task = *task]() mutable {
+          waiting.MarkFinished(self->Extract(task));
+        });
+      }
+    }
+    return 0;
+  }
+
+  void OnRelease() {
+    {
+      std::lock_guard<std::recursive_mutex> lock(producer_mutex_);
+      producer_ = nullptr;
+    }
+    bool finished;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      finished = end_of_stream_ || !error_.ok();
+    }
+    if (!finished) {
+      Fail(Status::Invalid("ArrowAsyncDeviceStreamHandler was released before the end ",
+                           "of the stream"));
+    }
+  }
+
+  Future<std::shared_ptr<RecordBatch>> Next() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!tasks_.empty()) {
+      struct ArrowAsyncTask task = tasks_.front();
+      tasks_.pop_front();
+      lock.unlock();
+      return Extract(task);
+    }
+    if (!error_.ok()) {
+      return error_;
+    }
+    if (end_of_stream_) {
+      return IterationEnd<std::shared_ptr<RecordBatch>>();
+    }
+    waiting_ = Future<std::shared_ptr<RecordBatch>>::Make();
+    return waiting_;
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Extract(struct ArrowAsyncTask task) {
+    struct ArrowDeviceArray c_array;
+    int code = task.extract_data(&task, &c_array);
+    // Keep the same number of record batches requested in advance
+    Request(1);
+    if (code != 0) {
+      return StatusFromProducer(code, "ArrowAsyncTask::extract_data failed");
+    }
+    return ImportDeviceRecordBatch(&c_array, schema_, mapper_);
+  }
+
+  void Request(int64_t n) {
+    std::lock_guard<std::recursive_mutex> lock(producer_mutex_);
+    if (producer_ != nullptr) {
+      producer_->request(producer_, n);
+    }
+  }
+
+  // Fail the stream, waking up any waiting consumer
+  void Fail(const Status& st) {
+    Future<AsyncRecordBatchGenerator> schema_future;
+    Future<std::shared_ptr<RecordBatch>> waiting;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (error_.ok()) {
+        error_ = st;
+      }
+      schema_future = std::exchange(schema_future_, {});
+      waiting = std::exchange(waiting_, {});
+    }
+    if (schema_future.is_valid()) {
+      Dispatch([schema_future, st]() mutable { schema_future.MarkFinished(st); });
+    }
+    if (waiting.is_valid()) {
+      Dispatch([waiting, st]() mutable { waiting.MarkFinished(st); });
+    }
+  }
+
+  // Resume the consumer on the executor, if any, rather than the producer's thread
+  template <typename Function>
+  void Dispatch(Function&& func) {
+    if (executor_ != nullptr && executor_->Spawn(func).ok()) {
+      return;
+    }
+    func();
+  }
+
+  static Status StatusFromProducer(int code, const std::string& message) {
+    StatusCode status_code;
+    switch (code) {
+      case EDOM:
+      case EINVAL:
+      case ERANGE:
+        status_code = StatusCode::Invalid;
+        break;
+      case ENOMEM:
+        status_code = StatusCode::OutOfMemory;
+        break;
+      case ENOSYS:
+        status_code = StatusCode::NotImplemented;
+        break;
+      default:
+        status_code = StatusCode::IOError;
+        break;
+    }
+    return {status_code, message};
+  }
+
+  // C-compatible callbacks
+
+  static AsyncStreamConsumer* FromHandler(struct ArrowAsyncDeviceStreamHandler* handler) {
+    return reinterpret_cast<std::shared_ptr<AsyncStreamConsumer>*>(handler->private_data)
+        ->get();
+  }
+
+  static int StaticOnSchema(struct ArrowAsyncDeviceStreamHandler* handler,
+                            struct ArrowSchema* c_schema) {
+    return FromHandler(handler)->OnSchema(handler, c_schema);
+  }
+
+  static int StaticOnNextTask(struct ArrowAsyncDeviceStreamHandler* handler,
+                              struct ArrowAsyncTask* task, const char* metadata) {
+    return FromHandler(handler)->OnNextTask(task);
+  }
+
+  static void StaticOnError(struct ArrowAsyncDeviceStreamHandler* handler, int code,
+                            const char* message, const char* metadata) {
+    FromHandler(handler)->Fail(StatusFromProducer(
+        code, message != nullptr ? message : "ArrowAsyncDeviceStreamHandler error"));
+  }
+
+  static void StaticRelease(struct ArrowAsyncDeviceStreamHandler* handler) {
+    auto holder =
+        reinterpret_cast<std::shared_ptr<AsyncStreamConsumer>*>(handler->private_data);
+    auto consumer = std::move(*holder);
+    delete holder;
+    handler->release = nullptr;
+    handler->private_data = nullptr;
+    consumer->OnRelease();
+  }
+
+  ::arrow::internal::Executor* executor_;
+  const int64_t queue_size_;
+  const DeviceMemoryMapper mapper_;
+  std::shared_ptr<Schema> schema_;
+
+  // Guards calls to the producer against its release
+  std::recursive_mutex producer_mutex_;
+  struct ArrowAsyncProducer* producer_ = nullptr;
+
+  std::mutex mutex_;
+  Future<AsyncRecordBatchGenerator> schema_future_;
+  // Tasks received before the consumer asked for them
+  std::deque<struct ArrowAsyncTask> tasks_;
+  // The consumer waiting for a task
+  Future<std::shared_ptr<RecordBatch>> waiting_;
+  bool end_of_stream_ = false;
+  Status error_;
+};
+
+}  // namespace
+
+Future<AsyncRecordBatchGenerator> CreateAsyncDeviceStreamHandler(
+    struct ArrowAsyncDeviceStreamHandler* handler, ::arrow::internal::Executor* executor,
+    int64_t queue_size, DeviceMemoryMapper mapper) {
+  if (queue_size < 1) {
+    return Status::Invalid("queue_size must be at least 1, got ", queue_size);
+  }
+  return AsyncStreamConsumer::Make(handler, executor, queue_size, std::move(mapper));
+}
+
 }  // namespace arrow
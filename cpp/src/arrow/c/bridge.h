@@ -26,7 +26,9 @@
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/async_generator_fwd.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -345,4 +347,62 @@ Result<std::shared_ptr<ChunkedArray>> ImportChunkedArray(struct ArrowArrayStream
 
 /// @}
 
+/// \defgroup c-async-stream-interface Functions for working with the async C data
+/// interface.
+///
+/// @{
+
+/// \brief EXPERIMENTAL: A stream of record batches imported from an
+/// ArrowAsyncDeviceStreamHandler
+struct AsyncRecordBatchGenerator {
+  /// The schema of the stream
+  std::shared_ptr<Schema> schema;
+  /// The device the record batches are located on
+  DeviceAllocationType device_type;
+  /// The record batches of the stream
+  AsyncGenerator<std::shared_ptr<RecordBatch>> generator;
+};
+
+/// \brief EXPERIMENTAL: Prepare an ArrowAsyncDeviceStreamHandler for a producer to
+/// push a stream of record batches into.
+///
+/// The handler's callbacks and private data are set; it can then be given to
+/// the producer, which releases it when done. The consumer requests up to
+/// `queue_size` record batches in advance, and one more each time the
+/// generator yields one.
+///
+/// \param[in,out] handler C struct to fill in
+/// \param[in] executor executor on which to resume the consumer when the
+/// producer makes data available, instead of the producer's thread; optional
+/// \param[in] queue_size the number of record batches requested in advance
+/// \param[in] mapper A function to map device + id to memory manager. If not
+/// specified, defaults to map "cpu" to the built-in default memory manager.
+/// \return a future finished with the imported stream once the producer sent
+/// the schema
+ARROW_EXPORT
+Future<AsyncRecordBatchGenerator> CreateAsyncDeviceStreamHandler(
+    struct ArrowAsyncDeviceStreamHandler* handler, internal::Executor* executor,
+    int64_t queue_size = 5, DeviceMemoryMapper mapper = DefaultDeviceMemoryMapper);
+
+/// \brief EXPERIMENTAL: Push a stream of record batches to an
+/// ArrowAsyncDeviceStreamHandler.
+///
+/// The schema is sent to the handler immediately. Record batches are then pulled
+/// from the generator only as requested by the consumer, and the handler is
+/// released at the end of the stream, on error or on cancellation.
+///
+/// \param[in] schema the schema of the stream
+/// \param[in] generator the record batches of the stream
+/// \param[in] device_type the device the record batches are located on
+/// \param[in,out] handler the consumer's handler
+/// \return a future finished once the handler has been released, with the
+/// error that stopped the stream if any
+ARROW_EXPORT
+Future<> ExportAsyncRecordBatchReader(
+    std::shared_ptr<Schema> schema,
+    AsyncGenerator<std::shared_ptr<RecordBatch>> generator,
+    DeviceAllocationType device_type, struct ArrowAsyncDeviceStreamHandler* handler);
+
+/// @}
+
 }  // namespace arrow
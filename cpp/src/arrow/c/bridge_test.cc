@@ -38,6 +38,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/binary_view_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/endian.h"
@@ -45,6 +46,7 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/range.h"
+#include "arrow/util/thread_pool.h"
 
 // TODO(GH-37221): Remove these ifdef checks when compute dependency is removed
 #ifdef ARROW_COMPUTE
@@ -4746,4 +4748,104 @@ TEST_F(TestArrayStreamRoundtrip, ChunkedArrayRoundtripEmpty) {
   });
 }
 
+class TestAsyncDeviceArrayStreamRoundtrip : public BaseArrayStreamTest {
+ public:
+  RecordBatchVector MakeIntBatches(const std::shared_ptr<Schema>& schema,
+                                   int num_batches) {
+    ArrayVector arrays;
+    for (int32_t i = 0; i < num_batches; ++i) {
+      std::shared_ptr<Array> array;
+      ArrayFromVector<Int32Type, int32_t>({i, i + 1, i + 2}, &array);
+      arrays.push_back(std::move(array));
+    }
+    return MakeBatches(schema, arrays);
+  }
+};
+
+TEST_F(TestAsyncDeviceArrayStreamRoundtrip, Simple) {
+  auto orig_schema = arrow::schema({field("ints", int32())});
+  auto batches = MakeIntBatches(orig_schema, 10);
+
+  for (auto executor : {static_cast<internal::Executor*>(nullptr),
+                        static_cast<internal::Executor*>(internal::GetCpuThreadPool())}) {
+    struct ArrowAsyncDeviceStreamHandler handler;
+    auto fut_stream =
+        CreateAsyncDeviceStreamHandler(&handler, executor, /*queue_size=*/2);
+    auto fut_export = ExportAsyncRecordBatchReader(
+        orig_schema, MakeVectorGenerator(batches), DeviceAllocationType::kCPU, &handler);
+
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto stream, fut_stream);
+    AssertSchemaEqual(*orig_schema, *stream.schema, /*check_metadata=*/true);
+    ASSERT_EQ(stream.device_type, DeviceAllocationType::kCPU);
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto got_batches,
+                                  CollectAsyncGenerator(stream.generator));
+    ASSERT_EQ(got_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      AssertBatchesEqual(*batches[i], *got_batches[i]);
+    }
+    ASSERT_FINISHES_OK(fut_export);
+    // The handler was released
+    ASSERT_EQ(handler.release, nullptr);
+  }
+}
+
+TEST_F(TestAsyncDeviceArrayStreamRoundtrip, Backpressure) {
+  auto orig_schema = arrow::schema({field("ints", int32())});
+  auto batches = MakeIntBatches(orig_schema, 10);
+  int pulled = 0;
+  auto source = MakeVectorGenerator(batches);
+  AsyncGenerator<std::shared_ptr<RecordBatch>> counting = [&]() {
+    ++pulled;
+    return source();
+  };
+
+  struct ArrowAsyncDeviceStreamHandler handler;
+  auto fut_stream = CreateAsyncDeviceStreamHandler(&handler, /*executor=*/nullptr,
+                                                   /*queue_size=*/3);
+  auto fut_export = ExportAsyncRecordBatchReader(orig_schema, counting,
+                                                 DeviceAllocationType::kCPU, &handler);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto stream, fut_stream);
+  // Only the requested record batches were produced
+  ASSERT_EQ(pulled, 3);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batch, stream.generator());
+  AssertBatchesEqual(*batches[0], *batch);
+  ASSERT_EQ(pulled, 4);
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto got_batches,
+                                CollectAsyncGenerator(stream.generator));
+  ASSERT_EQ(got_batches.size(), batches.size() - 1);
+  ASSERT_FINISHES_OK(fut_export);
+}
+
+TEST_F(TestAsyncDeviceArrayStreamRoundtrip, Errors) {
+  auto orig_schema = arrow::schema({field("ints", int32())});
+  auto batches = MakeIntBatches(orig_schema, 2);
+  auto generator = MakeConcatenatedGenerator(
+      MakeVectorGenerator<AsyncGenerator<std::shared_ptr<RecordBatch>>>(
+          {MakeVectorGenerator(batches),
+           MakeFailingGenerator<std::shared_ptr<RecordBatch>>(
+               Status::IOError("roundtrip error example"))}));
+
+  struct ArrowAsyncDeviceStreamHandler handler;
+  auto fut_stream = CreateAsyncDeviceStreamHandler(&handler, /*executor=*/nullptr);
+  auto fut_export = ExportAsyncRecordBatchReader(orig_schema, std::move(generator),
+                                                 DeviceAllocationType::kCPU, &handler);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto stream, fut_stream);
+  for (const auto& expected : batches) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batch, stream.generator());
+    AssertBatchesEqual(*expected, *batch);
+  }
+  auto next = stream.generator();
+  ASSERT_FINISHES_AND_RAISES(IOError, next);
+  ASSERT_THAT(next.status().message(), ::testing::HasSubstr("roundtrip error example"));
+  ASSERT_FINISHES_AND_RAISES(IOError, fut_export);
+}
+
+TEST_F(TestAsyncDeviceArrayStreamRoundtrip, ReleasedWithoutSchema) {
+  struct ArrowAsyncDeviceStreamHandler handler;
+  auto fut_stream = CreateAsyncDeviceStreamHandler(&handler, /*executor=*/nullptr);
+  handler.release(&handler);
+  ASSERT_FINISHES_AND_RAISES(Invalid, fut_stream);
+}
+
 }  // namespace arrow
@@ -27,14 +27,19 @@
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_primitive.h"
+#include "arrow/array/array_run_end.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/array/data.h"
 #include "arrow/array/util.h"
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/function.h"
 #include "arrow/compute/function_internal.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/ree_util_internal.h"
 #include "arrow/compute/registry.h"
 #include "arrow/datum.h"
 #include "arrow/pretty_print.h"
@@ -1330,6 +1335,297 @@ int64_t InferBatchLength(const std::vector<Datum>& values, bool* all_same) {
   return length;
 }
 
+namespace {
+
+// Execute on the given values, concatenating the output if it was chunked
+Result<std::shared_ptr<ArrayData>> ExecuteToArrayData(KernelExecutor* executor,
+                                                      const std::vector<Datum>& values,
+                                                      int64_t length, ExecContext* ctx) {
+  DatumAccumulator listener;
+  RETURN_NOT_OK(executor->Execute(ExecBatch(values, length), &listener));
+  Datum out = executor->WrapResults(values, listener.values());
+  if (out.is_chunked_array()) {
+    ARROW_ASSIGN_OR_RAISE(auto array,
+                          Concatenate(out.chunked_array()->chunks(), ctx->memory_pool()));
+    return array->data();
+  }
+  return out.array();
+}
+
+Result<Datum> ExecuteOnDictionaryValues(KernelExecutor* executor,
+                                        std::vector<Datum> values, int dict_index,
+                                        const std::vector<TypeHolder>& in_types,
+                                        ExecContext* ctx) {
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (static_cast<int>(i) != dict_index && in_types[i] != values[i].type()) {
+      ARROW_ASSIGN_OR_RAISE(
+          values[i], Cast(values[i], CastOptions::Safe(in_types[i].GetSharedPtr()), ctx));
+    }
+  }
+  const Datum dict_arg = std::move(values[dict_index]);
+  const auto value_type = in_types[dict_index].GetSharedPtr();
+
+  auto execute = [&](Datum arg, int64_t length) {
+    values[dict_index] = std::move(arg);
+    return ExecuteToArrayData(executor, values, length, ctx);
+  };
+
+  // Consecutive chunks often share the same dictionary, so the kernel output
+  // for the last dictionary seen is kept around
+  std::shared_ptr<ArrayData> last_dictionary, last_result;
+  auto execute_chunk =
+      [&](const std::shared_ptr<ArrayData>& chunk) -> Result<std::shared_ptr<ArrayData>> {
+    if (chunk->dictionary != last_dictionary) {
+      if (chunk->dictionary->length >= chunk->length) {
+        // No fewer values to process than by decoding
+        ARROW_ASSIGN_OR_RAISE(Datum decoded,
+                              Cast(chunk, CastOptions::Safe(value_type), ctx));
+        return execute(std::move(decoded), chunk->length);
+      }
+      Datum dictionary(chunk->dictionary);
+      if (!chunk->dictionary->type->Equals(*value_type)) {
+        ARROW_ASSIGN_OR_RAISE(dictionary,
+                              Cast(dictionary, CastOptions::Safe(value_type), ctx));
+      }
+      ARROW_ASSIGN_OR_RAISE(last_result,
+                            execute(std::move(dictionary), chunk->dictionary->length));
+      last_dictionary = chunk->dictionary;
+    }
+    auto indices = chunk->Copy();
+    indices->type = checked_cast<const DictionaryType&>(*chunk->type).index_type();
+    indices->dictionary = nullptr;
+    ARROW_ASSIGN_OR_RAISE(Datum out, Take(last_result, std::move(indices),
+                                          TakeOptions::Defaults(), ctx));
+    return out.array();
+  };
+
+  if (dict_arg.is_array()) {
+    ARROW_ASSIGN_OR_RAISE(auto out, execute_chunk(dict_arg.array()));
+    return out;
+  }
+  ArrayVector out_chunks;
+  for (const auto& chunk : dict_arg.chunked_array()->chunks()) {
+    ARROW_ASSIGN_OR_RAISE(auto out, execute_chunk(chunk->data()));
+    out_chunks.push_back(MakeArray(std::move(out)));
+  }
+  return std::make_shared<ChunkedArray>(std::move(out_chunks));
+}
+
+// Whether some dictionary values are not referenced by any index of `dict_arg`
+Result<bool> HasUnreferencedValues(const Datum& dict_arg, ExecContext* ctx) {
+  auto check_chunk = [&](const ArrayData& chunk) -> Result<bool> {
+    auto indices = chunk.Copy();
+    indices->type = checked_cast<const DictionaryType&>(*chunk.type).index_type();
+    indices->dictionary = nullptr;
+    ARROW_ASSIGN_OR_RAISE(Datum int64_indices,
+                          Cast(std::move(indices), CastOptions::Safe(int64()), ctx));
+    const ArrayData& int64_data = *int64_indices.array();
+    const int64_t dict_length = chunk.dictionary->length;
+    std::vector<bool> referenced(dict_length, false);
+    int64_t num_referenced = 0;
+    const int64_t* values = int64_data.GetValues<int64_t>(1);
+    for (int64_t i = 0; i < int64_data.length; ++i) {
+      if (int64_data.IsValid(i) && !referenced[values[i]]) {
+        referenced[values[i]] = true;
+        ++num_referenced;
+      }
+    }
+    return num_referenced < dict_length;
+  };
+  if (dict_arg.is_array()) {
+    return check_chunk(*dict_arg.array());
+  }
+  for (const auto& chunk : dict_arg.chunked_array()->chunks()) {
+    ARROW_ASSIGN_OR_RAISE(bool unreferenced, check_chunk(*chunk->data()));
+    if (unreferenced) return true;
+  }
+  return false;
+}
+
+Result<std::shared_ptr<ArrayData>> ExecuteOnMergedRuns(
+    KernelExecutor* executor, std::vector<Datum> values,
+    const std::vector<TypeHolder>& in_types, int64_t length, ExecContext* ctx) {
+  std::vector<int> ree_indices;
+  std::vector<std::vector<int64_t>> run_ends;
+  std::vector<std::shared_ptr<ArrayData>> run_values;
+  std::shared_ptr<DataType> run_end_type;
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (values[i].is_scalar()) continue;
+    const ArrayData& ree_array = *values[i].array();
+    if (!run_end_type) {
+      run_end_type =
+          checked_cast<const RunEndEncodedType&>(*ree_array.type).run_end_type();
+    }
+    ree_indices.push_back(static_cast<int>(i));
+    run_ends.emplace_back();
+    const int64_t physical_offset =
+        ::arrow::compute::internal::ree_util::ReadLogicalRunEnds(ArraySpan(ree_array),
+                                                                 &run_ends.back());
+    run_values.push_back(ree_array.child_data[1]->Slice(
+        physical_offset, static_cast<int64_t>(run_ends.back().size())));
+  }
+
+  std::vector<int64_t> merged_run_ends;
+  if (ree_indices.size() == 1) {
+    merged_run_ends = std::move(run_ends[0]);
+    values[ree_indices[0]] = std::move(run_values[0]);
+  } else {
+    // Split runs so that all arguments are constant within each merged run, and
+    // gather the values of each argument for every merged run
+    const size_t num_args = ree_indices.size();
+    std::vector<std::vector<int64_t>> physical_indices(num_args);
+    std::vector<int64_t> runs(num_args, 0);
+    int64_t logical_pos = 0;
+    while (logical_pos < length) {
+      int64_t run_end = length;
+      for (size_t k = 0; k < num_args; ++k) {
+        run_end = std::min(run_end, run_ends[k][runs[k]]);
+      }
+      for (size_t k = 0; k < num_args; ++k) {
+        physical_indices[k].push_back(runs[k]);
+        if (run_ends[k][runs[k]] == run_end) ++runs[k];
+      }
+      merged_run_ends.push_back(run_end);
+      logical_pos = run_end;
+    }
+    for (size_t k = 0; k < num_args; ++k) {
+      const auto num_runs = static_cast<int64_t>(physical_indices[k].size());
+      auto indices_buffer = Buffer::FromVector(std::move(physical_indices[k]));
+      auto indices = ArrayData::Make(int64(), num_runs,
+                                     {nullptr, std::move(indices_buffer)},
+                                     /*null_count=*/0);
+      ARROW_ASSIGN_OR_RAISE(values[ree_indices[k]],
+                            Take(run_values[k], std::move(indices),
+                                 TakeOptions::NoBoundsCheck(), ctx));
+    }
+  }
+
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (in_types[i] != values[i].type()) {
+      ARROW_ASSIGN_OR_RAISE(
+          values[i], Cast(values[i], CastOptions::Safe(in_types[i].GetSharedPtr()), ctx));
+    }
+  }
+  const auto num_runs = static_cast<int64_t>(merged_run_ends.size());
+  ARROW_ASSIGN_OR_RAISE(auto out_values,
+                        ExecuteToArrayData(executor, values, num_runs, ctx));
+  ARROW_ASSIGN_OR_RAISE(auto out_run_ends,
+                        ::arrow::compute::internal::ree_util::MakeRunEndsArray(
+                            run_end_type, merged_run_ends, ctx->memory_pool()));
+  ARROW_ASSIGN_OR_RAISE(auto out,
+                        RunEndEncodedArray::Make(length, MakeArray(out_run_ends),
+                                                 MakeArray(out_values)));
+  return out->data();
+}
+
+Result<Datum> ExecuteOnChunkedRuns(KernelExecutor* executor, std::vector<Datum> values,
+                                   int chunked_index,
+                                   const std::vector<TypeHolder>& in_types,
+                                   ExecContext* ctx) {
+  const auto chunked = values[chunked_index].chunked_array();
+  ArrayVector out_chunks;
+  for (const auto& chunk : chunked->chunks()) {
+    values[chunked_index] = chunk;
+    ARROW_ASSIGN_OR_RAISE(
+        auto out, ExecuteOnMergedRuns(executor, values, in_types, chunk->length(), ctx));
+    out_chunks.push_back(MakeArray(std::move(out)));
+  }
+  return std::make_shared<ChunkedArray>(std::move(out_chunks));
+}
+
+}  // namespace
+
+Result<Datum> ExecuteScalarOnDictionary(KernelExecutor* executor,
+                                        const ScalarKernel& kernel,
+                                        const std::vector<Datum>& args,
+                                        const std::vector<TypeHolder>& in_types,
+                                        ExecContext* ctx) {
+  // Other null handling modes may compute a non-null output for a null index
+  if (kernel.null_handling != NullHandling::INTERSECTION) {
+    return Datum{};
+  }
+  int dict_index = -1;
+  for (size_t i = 0; i < args.size(); ++i) {
+    if (args[i].is_scalar()) continue;
+    if (dict_index >= 0 || args[i].type()->id() != Type::DICTIONARY ||
+        in_types[i].id() == Type::DICTIONARY) {
+      return Datum{};
+    }
+    dict_index = static_cast<int>(i);
+  }
+  if (dict_index < 0) {
+    return Datum{};
+  }
+  const Datum& dict_arg = args[dict_index];
+  if (dict_arg.is_array()) {
+    if (dict_arg.array()->dictionary->length >= dict_arg.length()) {
+      return Datum{};
+    }
+  } else if (dict_arg.chunked_array()->num_chunks() == 0) {
+    return Datum{};
+  }
+  auto maybe_out = ExecuteOnDictionaryValues(executor, args, dict_index, in_types, ctx);
+  if (maybe_out.ok()) {
+    return maybe_out;
+  }
+  const Status& st = maybe_out.status();
+  if (st.IsNotImplemented() || st.IsTypeError()) {
+    return Datum{};
+  }
+  // The kernel also sees dictionary values which are not referenced by any
+  // index; if it rejected one of them, executing on decoded values may succeed
+  if (st.IsInvalid()) {
+    ARROW_ASSIGN_OR_RAISE(bool unreferenced, HasUnreferencedValues(dict_arg, ctx));
+    if (unreferenced) {
+      return Datum{};
+    }
+  }
+  return st;
+}
+
+Result<Datum> ExecuteScalarOnRuns(KernelExecutor* executor,
+                                  const std::vector<Datum>& args,
+                                  const std::vector<TypeHolder>& in_types,
+                                  ExecContext* ctx) {
+  int chunked_index = -1;
+  int num_ree = 0;
+  int64_t length = -1;
+  for (size_t i = 0; i < args.size(); ++i) {
+    if (args[i].is_scalar()) continue;
+    if (args[i].type()->id() != Type::RUN_END_ENCODED ||
+        in_types[i].id() == Type::RUN_END_ENCODED) {
+      return Datum{};
+    }
+    if (args[i].is_chunked_array()) {
+      chunked_index = static_cast<int>(i);
+    } else if (length >= 0 && length != args[i].length()) {
+      return Datum{};
+    }
+    length = args[i].length();
+    ++num_ree;
+  }
+  // Chunk layouts are not aligned, so only a single chunked argument is handled
+  if (num_ree == 0 || (chunked_index >= 0 && num_ree > 1)) {
+    return Datum{};
+  }
+
+  Result<Datum> maybe_out;
+  if (chunked_index < 0) {
+    maybe_out = ExecuteOnMergedRuns(executor, args, in_types, length, ctx);
+  } else if (args[chunked_index].chunked_array()->num_chunks() == 0) {
+    return Datum{};
+  } else {
+    maybe_out = ExecuteOnChunkedRuns(executor, args, chunked_index, in_types, ctx);
+  }
+  // Only the run values are processed, so other errors would also be raised
+  // when executing on decoded values
+  if (!maybe_out.ok() &&
+      (maybe_out.status().IsNotImplemented() || maybe_out.status().IsTypeError())) {
+    return Datum{};
+  }
+  return maybe_out;
+}
+
 }  // namespace detail
 
 ExecContext::ExecContext(MemoryPool* pool, ::arrow::internal::Executor* executor,
@@ -150,6 +150,49 @@ class ARROW_EXPORT KernelExecutor {
 
 int64_t InferBatchLength(const std::vector<Datum>& values, bool* all_same);
 
+/// \brief Execute a scalar kernel over the dictionary of a dictionary-encoded
+/// argument instead of its decoded values
+///
+/// This applies when a single argument is a dictionary-encoded array (or chunked
+/// array) that the kernel takes decoded, the other arguments are scalars, and
+/// the kernel uses NullHandling::INTERSECTION.  The kernel then runs once per
+/// distinct value and the results are gathered using the dictionary indices.
+///
+/// \param[in] executor an executor initialized with `in_types`
+/// \param[in] kernel the kernel `executor` was initialized with
+/// \param[in] args the arguments, with the dictionary-encoded one not yet decoded
+/// \param[in] in_types the argument types expected by the kernel
+/// \param[in] ctx the execution context
+/// \return the result, or a Datum of kind NONE if the caller should instead
+/// decode the dictionary and execute the kernel as usual.  Errors are only
+/// returned when they would also be raised on the decoded values.
+ARROW_EXPORT
+Result<Datum> ExecuteScalarOnDictionary(KernelExecutor* executor,
+                                        const ScalarKernel& kernel,
+                                        const std::vector<Datum>& args,
+                                        const std::vector<TypeHolder>& in_types,
+                                        ExecContext* ctx);
+
+/// \brief Execute a scalar kernel once per run of run-end encoded arguments
+///
+/// This applies when all array arguments are run-end encoded (and taken decoded
+/// by the kernel) while the other arguments are scalars.  The run boundaries of
+/// several arguments are merged, then the kernel runs over one value per merged
+/// run.  The result is run-end encoded, with the run end type of the first
+/// run-end encoded argument and the kernel output type as value type.
+///
+/// \param[in] executor an executor initialized with `in_types`
+/// \param[in] args the arguments, with the run-end encoded ones not yet decoded
+/// \param[in] in_types the argument types expected by the kernel
+/// \param[in] ctx the execution context
+/// \return the result, or a Datum of kind NONE if the caller should instead
+/// decode the arguments and execute the kernel as usual
+ARROW_EXPORT
+Result<Datum> ExecuteScalarOnRuns(KernelExecutor* executor,
+                                  const std::vector<Datum>& args,
+                                  const std::vector<TypeHolder>& in_types,
+                                  ExecContext* ctx);
+
 /// \brief Populate validity bitmap with the intersection of the nullity of the
 /// arguments. If a preallocated bitmap is not provided, then one will be
 /// allocated if needed (in some cases a bitmap can be zero-copied from the
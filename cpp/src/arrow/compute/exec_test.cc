@@ -25,6 +25,8 @@
 #include "arrow/testing/random.h"
 
 #include "arrow/array/array_base.h"
+#include "arrow/array/array_dict.h"
+#include "arrow/array/array_run_end.h"
 #include "arrow/array/data.h"
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
@@ -1396,6 +1398,168 @@ TEST_F(TestCallScalarFunctionScalarFunction, ExecCall) {
   TestCallScalarFunctionScalarFunction::DoTest(ExecFunctionCaller::Maker);
 }
 
+TEST(ExecuteScalarOnDictionary, Basics) {
+  auto ty = dictionary(int32(), utf8());
+  auto arr = DictArrayFromJSON(ty, "[0, 1, null, 0, 2, 1, 0]", R"(["foo", "bar", null])");
+  auto decoded =
+      ArrayFromJSON(utf8(), R"(["foo", "bar", null, "foo", null, "bar", "foo"])");
+
+  for (const auto& func_name : {"equal", "binary_length"}) {
+    ARROW_SCOPED_TRACE(func_name);
+    std::vector<Datum> args = {arr}, decoded_args = {decoded};
+    if (std::string(func_name) == "equal") {
+      args.push_back(MakeScalar("foo"));
+      decoded_args.push_back(MakeScalar("foo"));
+    }
+    ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(func_name, args));
+    ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(func_name, decoded_args));
+    ASSERT_OK(actual.make_array()->ValidateFull());
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+}
+
+TEST(ExecuteScalarOnDictionary, ChunkedArray) {
+  auto ty = dictionary(int8(), utf8());
+  auto dict = ArrayFromJSON(utf8(), R"(["a", "b"])");
+  auto other_dict = ArrayFromJSON(utf8(), R"(["b", "c", "d", "e"])");
+  ASSERT_OK_AND_ASSIGN(auto chunk1, DictionaryArray::FromArrays(
+                                        ty, ArrayFromJSON(int8(), "[0, 1, 1, 0]"), dict));
+  ASSERT_OK_AND_ASSIGN(auto chunk2, DictionaryArray::FromArrays(
+                                        ty, ArrayFromJSON(int8(), "[1, null, 1]"), dict));
+  // Not worth going through the dictionary
+  ASSERT_OK_AND_ASSIGN(auto chunk3, DictionaryArray::FromArrays(
+                                        ty, ArrayFromJSON(int8(), "[3, 0]"), other_dict));
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{chunk1, chunk2, chunk3});
+
+  ASSERT_OK_AND_ASSIGN(Datum actual,
+                       CallFunction("not_equal", {chunked, MakeScalar("b")}));
+  ASSERT_OK(actual.chunked_array()->ValidateFull());
+  AssertDatumsEqual(ChunkedArrayFromJSON(boolean(), {"[true, false, false, true]",
+                                                      "[false, null, false]",
+                                                      "[true, false]"}),
+                    actual, /*verbose=*/true);
+}
+
+TEST(ExecuteScalarOnDictionary, UnreferencedValueError) {
+  // 127 + 1 overflows, but is never referenced by an index
+  auto arr = DictArrayFromJSON(dictionary(int32(), int8()), "[0, 0, 0]", "[5, 127]");
+  ASSERT_OK_AND_ASSIGN(Datum actual,
+                       CallFunction("add_checked", {arr, MakeScalar(int8_t(1))}));
+  AssertDatumsEqual(ArrayFromJSON(int8(), "[6, 6, 6]"), actual, /*verbose=*/true);
+}
+
+// Negates int32 values, recording the length of each batch in the kernel's
+// data and failing on 13
+struct BatchLengths : public KernelState {
+  std::vector<int64_t> lengths;
+};
+
+Status ExecNegateRecordingLengths(KernelContext* ctx, const ExecSpan& batch,
+                                  ExecResult* out) {
+  checked_cast<BatchLengths*>(ctx->kernel()->data.get())->lengths.push_back(batch.length);
+  const int32_t* in_data = batch[0].array.GetValues<int32_t>(1);
+  int32_t* out_data = out->array_span_mutable()->GetValues<int32_t>(1);
+  for (int64_t i = 0; i < batch.length; ++i) {
+    if (in_data[i] == 13) {
+      return Status::IOError("unlucky value");
+    }
+    out_data[i] = -in_data[i];
+  }
+  return Status::OK();
+}
+
+TEST(ExecuteScalarOnDictionary, ExecutesOnDictionaryValues) {
+  auto registry = FunctionRegistry::Make(GetFunctionRegistry());
+  auto func = std::make_shared<ScalarFunction>("test_negate_recording", Arity::Unary(),
+                                               /*doc=*/FunctionDoc::Empty());
+  auto batch_lengths = std::make_shared<BatchLengths>();
+  ScalarKernel kernel({int32()}, int32(), ExecNegateRecordingLengths);
+  kernel.data = batch_lengths;
+  ASSERT_OK(func->AddKernel(std::move(kernel)));
+  ASSERT_OK(registry->AddFunction(func));
+  ExecContext ctx(default_memory_pool(), /*executor=*/nullptr, registry.get());
+
+  auto ty = dictionary(int8(), int32());
+  auto arr = DictArrayFromJSON(ty, "[0, 1, null, 1, 0, 0]", "[5, 7]");
+  ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction("test_negate_recording", {arr}, &ctx));
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[-5, -7, null, -7, -5, -5]"), actual,
+                    /*verbose=*/true);
+  ASSERT_EQ(batch_lengths->lengths, std::vector<int64_t>{2});
+
+  // Errors are propagated without executing again on the decoded values
+  batch_lengths->lengths.clear();
+  arr = DictArrayFromJSON(ty, "[0, 1, null, 1, 0, 0]", "[5, 13]");
+  ASSERT_RAISES_WITH_MESSAGE(IOError, "IOError: unlucky value",
+                             CallFunction("test_negate_recording", {arr}, &ctx));
+  ASSERT_EQ(batch_lengths->lengths, std::vector<int64_t>{2});
+}
+
+TEST(ExecuteScalarOnRuns, Basics) {
+  auto ree = RunEndEncodedArrayFromJSON(10, int32(), "[3, 4, 9, 10]", int32(),
+                                        "[1, null, 3, 1]");
+
+  ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction("add", {ree, MakeScalar(5)}));
+  ASSERT_OK(actual.make_array()->ValidateFull());
+  AssertDatumsEqual(RunEndEncodedArrayFromJSON(10, int32(), "[3, 4, 9, 10]", int32(),
+                                               "[6, null, 8, 6]"),
+                    actual, /*verbose=*/true);
+
+  // Kernels computing their own nulls see every run
+  auto bools = RunEndEncodedArrayFromJSON(10, int32(), "[3, 4, 9, 10]", boolean(),
+                                          "[true, null, false, true]");
+  ASSERT_OK_AND_ASSIGN(
+      actual, CallFunction("and_kleene", {bools->Slice(2, 6), MakeScalar(false)}));
+  AssertDatumsEqual(RunEndEncodedArrayFromJSON(6, int32(), "[1, 2, 6]", boolean(),
+                                               "[false, false, false]"),
+                    actual, /*verbose=*/true);
+
+  // Arguments are promoted as for decoded values
+  ASSERT_OK_AND_ASSIGN(actual, CallFunction("multiply", {ree, MakeScalar(2.5)}));
+  AssertDatumsEqual(RunEndEncodedArrayFromJSON(10, int32(), "[3, 4, 9, 10]", float64(),
+                                               "[2.5, null, 7.5, 2.5]"),
+                    actual, /*verbose=*/true);
+}
+
+TEST(ExecuteScalarOnRuns, MergedRuns) {
+  auto left = RunEndEncodedArrayFromJSON(8, int32(), "[3, 4, 8]", int32(), "[1, 2, 3]");
+  auto right =
+      RunEndEncodedArrayFromJSON(8, int32(), "[2, 6, 8]", int32(), "[1, 2, null]");
+
+  ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction("less", {left, right}));
+  ASSERT_OK(actual.make_array()->ValidateFull());
+  AssertDatumsEqual(RunEndEncodedArrayFromJSON(8, int32(), "[2, 3, 4, 6, 8]", boolean(),
+                                               "[false, true, false, false, null]"),
+                    actual, /*verbose=*/true);
+
+  // Sliced inputs with different offsets
+  ASSERT_OK_AND_ASSIGN(actual,
+                       CallFunction("subtract", {left->Slice(1, 6), right->Slice(2, 6)}));
+  AssertDatumsEqual(
+      RunEndEncodedArrayFromJSON(6, int32(), "[2, 3, 4, 6]", int32(), "[-1, 0, 1, null]"),
+      actual, /*verbose=*/true);
+
+  // Not applicable: mixed run-end encoded and plain arrays
+  auto plain = ArrayFromJSON(int32(), "[1, 1, 1, 1, 1, 1, 1, 1]");
+  ASSERT_OK_AND_ASSIGN(actual, CallFunction("add", {left, plain}));
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[2, 2, 2, 3, 4, 4, 4, 4]"), actual,
+                    /*verbose=*/true);
+}
+
+TEST(ExecuteScalarOnRuns, ChunkedArray) {
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{RunEndEncodedArrayFromJSON(5, int32(), "[2, 5]", int32(), "[1, 2]"),
+                  RunEndEncodedArrayFromJSON(3, int32(), "[3]", int32(), "[7]")});
+  ASSERT_OK_AND_ASSIGN(Datum actual,
+                       CallFunction("greater", {chunked, MakeScalar(int32_t(1))}));
+  ASSERT_TRUE(actual.is_chunked_array());
+  ASSERT_EQ(actual.chunked_array()->num_chunks(), 2);
+  AssertDatumsEqual(
+      std::make_shared<ChunkedArray>(ArrayVector{
+          RunEndEncodedArrayFromJSON(5, int32(), "[2, 5]", boolean(), "[false, true]"),
+          RunEndEncodedArrayFromJSON(3, int32(), "[3]", boolean(), "[true]")}),
+      actual, /*verbose=*/true);
+}
+
 TEST(Ordering, IsSuborderOf) {
   Ordering a{{SortKey{3}, SortKey{1}, SortKey{7}}};
   Ordering b{{SortKey{3}, SortKey{1}}};
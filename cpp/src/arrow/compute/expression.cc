@@ -23,6 +23,7 @@
 #include <unordered_set>
 
 #include "arrow/chunked_array.h"
+#include "arrow/compute/api_scalar.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/expression_internal.h"
@@ -716,6 +717,27 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const Schema& full
   return ExecuteScalarExpression(expr, input, exec_context);
 }
 
+namespace {
+
+// Whether `expr` is a cast of a dictionary-encoded or run-end encoded value to
+// its value type
+bool IsDecodingCast(const Expression& expr) {
+  auto call = expr.call();
+  if (call == nullptr || call->function_name != "cast") return false;
+  const TypeHolder& from = call->arguments[0].type();
+  if (from.id() == Type::DICTIONARY) {
+    return checked_cast<const DictionaryType&>(*from.type).value_type()->Equals(
+        *expr.type());
+  }
+  if (from.id() == Type::RUN_END_ENCODED) {
+    return checked_cast<const RunEndEncodedType&>(*from.type).value_type()->Equals(
+        *expr.type());
+  }
+  return false;
+}
+
+}  // namespace
+
 Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& input,
                                       compute::ExecContext* exec_context) {
   if (exec_context == nullptr) {
@@ -756,13 +778,31 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& i
   }
 
   auto call = CallNotNull(expr);
+  const auto* kernel = static_cast<const ScalarKernel*>(call->kernel);
 
   std::vector<Datum> arguments(call->arguments.size());
+  std::vector<TypeHolder> types(call->arguments.size());
+
+  // Implicit casts decoding a dictionary-encoded or run-end encoded argument are
+  // deferred, so that the kernel may run over the dictionary or run values only
+  std::vector<const Expression::Call*> deferred_casts(arguments.size(), nullptr);
+  bool any_deferred = false;
 
   bool all_scalar = true;
   for (size_t i = 0; i < arguments.size(); ++i) {
-    ARROW_ASSIGN_OR_RAISE(
-        arguments[i], ExecuteScalarExpression(call->arguments[i], input, exec_context));
+    const Expression* argument = &call->arguments[i];
+    if (IsDecodingCast(*argument)) {
+      deferred_casts[i] = argument->call();
+      argument = &deferred_casts[i]->arguments[0];
+      any_deferred = true;
+    }
+    ARROW_ASSIGN_OR_RAISE(arguments[i],
+                          ExecuteScalarExpression(*argument, input, exec_context));
+    if (deferred_casts[i]) {
+      types[i] = call->arguments[i].type();
+    } else {
+      types[i] = arguments[i].type();
+    }
     if (arguments[i].is_array()) {
       all_scalar = false;
     }
@@ -782,11 +822,35 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& i
   compute::KernelContext kernel_context(exec_context, call->kernel);
   kernel_context.SetState(call->kernel_state.get());
 
-  const Kernel* kernel = call->kernel;
-  std::vector<TypeHolder> types = GetTypes(arguments);
   auto options = call->options.get();
   RETURN_NOT_OK(executor->Init(&kernel_context, {kernel, types, options}));
 
+  if (any_deferred) {
+    ARROW_ASSIGN_OR_RAISE(Datum out,
+                          compute::detail::ExecuteScalarOnDictionary(
+                              executor.get(), *kernel, arguments, types, exec_context));
+    if (out.kind() == Datum::NONE) {
+      ARROW_ASSIGN_OR_RAISE(out, compute::detail::ExecuteScalarOnRuns(
+                                     executor.get(), arguments, types, exec_context));
+      if (out.kind() != Datum::NONE) {
+        // Only the output of the kernel needs decoding then
+        ARROW_ASSIGN_OR_RAISE(
+            out, compute::Cast(out, CastOptions::Safe(call->type.GetSharedPtr()),
+                               exec_context));
+      }
+    }
+    if (out.kind() != Datum::NONE) {
+      return out;
+    }
+    for (size_t i = 0; i < arguments.size(); ++i) {
+      if (deferred_casts[i] == nullptr) continue;
+      ARROW_ASSIGN_OR_RAISE(
+          arguments[i], compute::CallFunction("cast", {std::move(arguments[i])},
+                                              deferred_casts[i]->options.get(),
+                                              exec_context));
+    }
+  }
+
   compute::detail::DatumAccumulator listener;
   RETURN_NOT_OK(
       executor->Execute(ExecBatch(std::move(arguments), input_length), &listener));
@@ -1053,6 +1117,89 @@ Result<Expression> HandleInconsistentTypes(Expression::Call call,
   return BindNonRecursive(std::move(call), /*insert_implicit_casts=*/false, exec_context);
 }
 
+// Fold the members of a disjunction which match the same string argument against
+// literal substrings or LIKE patterns into a single multi-pattern match, which
+// scans the strings once instead of once per pattern. For example
+//   match_like(s, "%a%") or x or match_like(s, "b%")
+// becomes
+//   match_like_set(s, ["%a%", "b%"]) or x
+// Returns true if any members were folded.
+Result<bool> FoldStringMatchDisjunction(std::vector<Expression>* disjuncts,
+                                        compute::ExecContext* exec_context) {
+  struct PatternSet {
+    size_t index;
+    std::string function_name;
+    bool ignore_case;
+    std::vector<std::string> patterns;
+    // Indices of the other disjuncts to fold into the one at `index`
+    std::vector<size_t> folded_indices;
+  };
+  std::vector<PatternSet> sets;
+
+  for (size_t i = 0; i < disjuncts->size(); ++i) {
+    auto call = (*disjuncts)[i].call();
+    if (!call || !call->options || call->arguments.size() != 1) continue;
+
+    std::string function_name;
+    bool ignore_case;
+    std::vector<std::string> patterns;
+    if (call->function_name == "match_substring" || call->function_name == "match_like") {
+      const auto& options = checked_cast<const MatchSubstringOptions&>(*call->options);
+      // The *_set functions only fold ASCII case
+      if (options.ignore_case) continue;
+      function_name = call->function_name + "_set";
+      ignore_case = false;
+      patterns = {options.pattern};
+    } else if (call->function_name == "match_substring_set" ||
+               call->function_name == "match_like_set") {
+      const auto& options = checked_cast<const MatchSubstringSetOptions&>(*call->options);
+      function_name = call->function_name;
+      ignore_case = options.ignore_case;
+      patterns = options.patterns;
+    } else {
+      continue;
+    }
+
+    auto it = std::find_if(sets.begin(), sets.end(), [&](const PatternSet& set) {
+      return set.function_name == function_name && set.ignore_case == ignore_case &&
+             (*disjuncts)[set.index].call()->arguments[0] == call->arguments[0];
+    });
+    if (it == sets.end()) {
+      sets.push_back({i, std::move(function_name), ignore_case, std::move(patterns), {}});
+      continue;
+    }
+    it->patterns.insert(it->patterns.end(), patterns.begin(), patterns.end());
+    it->folded_indices.push_back(i);
+  }
+
+  std::vector<bool> folded(disjuncts->size(), false);
+  bool any_folded = false;
+  for (auto& set : sets) {
+    if (set.folded_indices.empty()) continue;
+    if (!exec_context->func_registry()->GetFunction(set.function_name).ok()) continue;
+
+    Expression::Call set_call;
+    set_call.function_name = set.function_name;
+    set_call.arguments = {CallNotNull((*disjuncts)[set.index])->arguments[0]};
+    set_call.options = std::make_shared<MatchSubstringSetOptions>(std::move(set.patterns),
+                                                                  set.ignore_case);
+    auto maybe_bound = BindNonRecursive(std::move(set_call),
+                                        /*insert_implicit_casts=*/false, exec_context);
+    if (!maybe_bound.ok()) continue;
+    (*disjuncts)[set.index] = maybe_bound.MoveValueUnsafe();
+    for (size_t i : set.folded_indices) folded[i] = true;
+    any_folded = true;
+  }
+  if (!any_folded) return false;
+
+  std::vector<Expression> remaining;
+  for (size_t i = 0; i < disjuncts->size(); ++i) {
+    if (!folded[i]) remaining.push_back(std::move((*disjuncts)[i]));
+  }
+  *disjuncts = std::move(remaining);
+  return true;
+}
+
 }  // namespace
 
 Result<Expression> Canonicalize(Expression expr, compute::ExecContext* exec_context) {
@@ -1104,7 +1251,14 @@ Result<Expression> Canonicalize(Expression expr, compute::ExecContext* exec_cont
 
           FlattenedAssociativeChain chain(expr);
 
-          if (chain.was_left_folded &&
+          bool folded_string_matches = false;
+          if (call->function_name == "or_kleene" || call->function_name == "or") {
+            ARROW_ASSIGN_OR_RAISE(
+                folded_string_matches,
+                FoldStringMatchDisjunction(&chain.fringe, exec_context));
+          }
+
+          if (!folded_string_matches && chain.was_left_folded &&
               std::is_sorted(chain.fringe.begin(), chain.fringe.end(),
                              CanonicalOrdering)) {
             // fast path for expressions which happen to have arrived in an
@@ -944,6 +944,41 @@ TEST(Expression, ExecuteDictionaryTransparent) {
   ])"));
 }
 
+TEST(Expression, ExecuteDictionaryNative) {
+  // Kernels taking decoded values run over the dictionary values only
+  auto in = ArrayFromJSON(struct_({field("a", dictionary(int32(), utf8()))}), R"([
+    {"a": "hi"},
+    {"a": "bye"},
+    {"a": null},
+    {"a": "hi"},
+    {"a": "hi"}
+  ])");
+  Datum actual;
+  ExpectExecute(equal(field_ref("a"), literal("hi")), in, &actual);
+  AssertDatumsEqual(ArrayFromJSON(boolean(), "[true, false, null, true, true]"), actual);
+
+  ExpectExecute(call("binary_length", {field_ref("a")}), in, &actual);
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[2, 3, null, 2, 2]"), actual);
+
+  // Not applicable: neither argument is a scalar
+  ExpectExecute(equal(field_ref("a"), field_ref("a")), in);
+}
+
+TEST(Expression, ExecuteRunEndEncoded) {
+  // Kernels taking decoded values run once per run, then the output is decoded
+  ASSERT_OK_AND_ASSIGN(
+      auto ree, RunEndEncodedArray::Make(6, ArrayFromJSON(int32(), "[2, 3, 6]"),
+                                         ArrayFromJSON(int64(), "[1, null, 5]")));
+  ASSERT_OK_AND_ASSIGN(auto in, StructArray::Make({ree}, {field("a", ree->type())}));
+  Datum actual;
+  ExpectExecute(add(field_ref("a"), literal(int64_t(2))), in, &actual);
+  AssertDatumsEqual(ArrayFromJSON(int64(), "[3, 3, null, 7, 7, 7]"), actual);
+
+  ExpectExecute(greater(field_ref("a"), field_ref("a")), in, &actual);
+  AssertDatumsEqual(ArrayFromJSON(boolean(), "[false, false, null, false, false, false]"),
+                    actual);
+}
+
 void ExpectIdenticalIfUnchanged(Expression modified, Expression original) {
   if (modified == original) {
     // no change -> must be identical
@@ -1252,6 +1287,54 @@ TEST(Expression, CanonicalizeComparison) {
                         less(field_ref("i32"), literal(1)));
 }
 
+TEST(Expression, CanonicalizeStringMatchDisjunction) {
+  auto str = field_ref("str");
+  auto bin = field_ref("binary");
+  auto b = field_ref("bool");
+  auto match_substring = [](Expression arg, std::string pattern,
+                            bool ignore_case = false) {
+    return call("match_substring", {std::move(arg)},
+                MatchSubstringOptions(std::move(pattern), ignore_case));
+  };
+  auto match_set = [](std::string function, Expression arg,
+                      std::vector<std::string> patterns) {
+    return call(std::move(function), {std::move(arg)},
+                MatchSubstringSetOptions(std::move(patterns)));
+  };
+
+  // no change possible:
+  ExpectCanonicalizesTo(match_substring(str, "a"), match_substring(str, "a"));
+  ExpectCanonicalizesTo(or_(match_substring(str, "a"), b),
+                        or_(match_substring(str, "a"), b));
+  ExpectCanonicalizesTo(or_(match_substring(str, "a"), match_substring(bin, "b")),
+                        or_(match_substring(str, "a"), match_substring(bin, "b")));
+  ExpectCanonicalizesTo(
+      or_(match_substring(str, "a"), match_substring(str, "b", /*ignore_case=*/true)),
+      or_(match_substring(str, "a"), match_substring(str, "b", /*ignore_case=*/true)));
+  ExpectCanonicalizesTo(and_(match_substring(str, "a"), match_substring(str, "b")),
+                        and_(match_substring(str, "a"), match_substring(str, "b")));
+
+  // matches against the same argument are folded into one pattern set
+  ExpectCanonicalizesTo(or_(match_substring(str, "a"), match_substring(str, "b")),
+                        match_set("match_substring_set", str, {"a", "b"}));
+  ExpectCanonicalizesTo(
+      or_({match_substring(str, "a"), b, match_substring(bin, "c"),
+           match_substring(str, "b"), match_substring(bin, "d")}),
+      or_({match_set("match_substring_set", str, {"a", "b"}), b,
+           match_set("match_substring_set", bin, {"c", "d"})}));
+  ExpectCanonicalizesTo(or_(match_set("match_substring_set", str, {"a", "b"}),
+                            match_substring(str, "c")),
+                        match_set("match_substring_set", str, {"a", "b", "c"}));
+  ExpectCanonicalizesTo(or_(match_set("match_like_set", str, {"a%"}),
+                            match_set("match_like_set", str, {"%b", "_c"})),
+                        match_set("match_like_set", str, {"a%", "%b", "_c"}));
+
+  // catches disjunctions even when they're a subexpression
+  ExpectCanonicalizesTo(
+      and_(b, or_(match_substring(str, "a"), match_substring(str, "b"))),
+      and_(b, match_set("match_substring_set", str, {"a", "b"})));
+}
+
 struct Simplify {
   Expression expr;
 
@@ -237,6 +237,24 @@ struct FunctionExecutorImpl : public FunctionExecutor {
       ARROW_RETURN_NOT_OK(Init(NULLPTR, default_exec_context()));
     }
     ExecContext* ctx = kernel_ctx.exec_context();
+    if (func_kind == Function::SCALAR) {
+      bool all_same_length = false;
+      if (passed_length == -1 ||
+          passed_length == detail::InferBatchLength(args, &all_same_length)) {
+        // Try to avoid decoding dictionary-encoded or run-end encoded arguments
+        const auto& scalar_kernel = static_cast<const ScalarKernel&>(*kernel);
+        ARROW_ASSIGN_OR_RAISE(Datum out,
+                              detail::ExecuteScalarOnDictionary(
+                                  executor.get(), scalar_kernel, args, in_types, ctx));
+        if (out.kind() == Datum::NONE) {
+          ARROW_ASSIGN_OR_RAISE(
+              out, detail::ExecuteScalarOnRuns(executor.get(), args, in_types, ctx));
+        }
+        if (out.kind() != Datum::NONE) {
+          return out;
+        }
+      }
+    }
     // Cast arguments if necessary
     std::vector<Datum> args_with_cast(args.size());
     for (size_t i = 0; i != args.size(); ++i) {
@@ -309,6 +327,31 @@ Result<const Kernel*> Function::DispatchExact(
 
 Result<const Kernel*> Function::DispatchBest(std::vector<TypeHolder>* values) const {
   // TODO(ARROW-11508) permit generic conversions here
+  if (kind_ == Function::SCALAR) {
+    // Scalar functions accept dictionary-encoded and run-end encoded arguments
+    // by decoding them.  Execution then tries to only process the dictionary
+    // or run values instead (see detail::ExecuteScalarOnDictionary and
+    // detail::ExecuteScalarOnRuns).
+    std::vector<TypeHolder> decoded = *values;
+    bool any_decoded = false;
+    for (auto& type : decoded) {
+      if (type.id() == Type::DICTIONARY) {
+        type = checked_cast<const DictionaryType&>(*type.type).value_type();
+        any_decoded = true;
+      } else if (type.id() == Type::RUN_END_ENCODED) {
+        type = checked_cast<const RunEndEncodedType&>(*type.type).value_type();
+        any_decoded = true;
+      }
+    }
+    if (any_decoded) {
+      RETURN_NOT_OK(CheckArity(values->size()));
+      if (auto kernel = detail::DispatchExactImpl(this, *values)) return kernel;
+      if (auto kernel = detail::DispatchExactImpl(this, decoded)) {
+        *values = std::move(decoded);
+        return kernel;
+      }
+    }
+  }
   return DispatchExact(*values);
 }
 
@@ -78,6 +78,9 @@ TEST(FunctionOptions, Equality) {
   options.emplace_back(new JoinOptions(JoinOptions::REPLACE, "replacement"));
   options.emplace_back(new MatchSubstringOptions("pattern"));
   options.emplace_back(new MatchSubstringOptions("pattern", /*ignore_case=*/true));
+  options.emplace_back(new MatchSubstringSetOptions());
+  options.emplace_back(
+      new MatchSubstringSetOptions({"foo", "bar%"}, /*ignore_case=*/true));
   options.emplace_back(new SplitOptions());
   options.emplace_back(new SplitOptions(/*max_splits=*/2, /*reverse=*/true));
   options.emplace_back(new SplitPatternOptions("pattern"));
@@ -0,0 +1,158 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/aho_corasick_internal.h"
+
+#include <algorithm>
+#include <deque>
+
+#include "arrow/util/logging.h"
+
+namespace arrow::compute::internal {
+
+namespace {
+
+// Beyond this many distinct first bytes, skipping ahead in the initial state
+// rarely pays off and the prefilter is disabled.
+constexpr int kMaxPrefilterBytes = 48;
+
+uint8_t FoldAscii(uint8_t c) { return (c >= 'A' && c <= 'Z') ? (c | 0x20) : c; }
+
+}  // namespace
+
+void AhoCorasickMatcher::AddLiteral(std::string_view literal, int32_t id,
+                                    uint8_t anchor) {
+  DCHECK(transitions_.empty()) << "AddLiteral() called after Compile()";
+  const Output out{id, static_cast<int32_t>(literal.size()), anchor};
+  if (literal.empty()) {
+    empty_outputs_.push_back(out);
+    return;
+  }
+  std::string folded(literal);
+  if (ignore_case_) {
+    for (auto& c : folded) c = static_cast<char>(FoldAscii(static_cast<uint8_t>(c)));
+  }
+  literals_.push_back(std::move(folded));
+  literal_outputs_.push_back(out);
+}
+
+void AhoCorasickMatcher::Compile() {
+  DCHECK(transitions_.empty()) << "Compile() called twice";
+
+  // 1. Compute byte equivalence classes: every byte used by a literal gets its
+  // own class, all other bytes share class 0.
+  std::array<bool, 256> used{};
+  for (const auto& literal : literals_) {
+    for (const char c : literal) used[static_cast<uint8_t>(c)] = true;
+  }
+  byte_classes_.fill(0);
+  num_classes_ = 1;
+  for (int b = 0; b < 256; ++b) {
+    if (used[b]) byte_classes_[b] = static_cast<uint16_t>(num_classes_++);
+  }
+  if (ignore_case_) {
+    for (int b = 'A'; b <= 'Z'; ++b) byte_classes_[b] = byte_classes_[b | 0x20];
+  }
+
+  // 2. Build the trie, with -1 denoting a missing edge
+  std::vector<std::vector<Output>> state_outputs(1);
+  transitions_.assign(num_classes_, -1);
+  num_states_ = 1;
+  for (size_t i = 0; i < literals_.size(); ++i) {
+    int32_t state = 0;
+    for (const char c : literals_[i]) {
+      const int32_t cls = byte_classes_[static_cast<uint8_t>(c)];
+      int32_t next = transitions_[state * num_classes_ + cls];
+      if (next < 0) {
+        next = num_states_++;
+        transitions_.resize(static_cast<size_t>(num_states_) * num_classes_, -1);
+        state_outputs.emplace_back();
+        transitions_[state * num_classes_ + cls] = next;
+      }
+      state = next;
+    }
+    state_outputs[state].push_back(literal_outputs_[i]);
+  }
+  literals_.clear();
+  literal_outputs_.clear();
+
+  // 3. Compute failure links breadth-first and turn the trie into a DFA by
+  // resolving missing edges through the failure links.
+  std::vector<int32_t> failure(num_states_, 0);
+  dictionary_links_.assign(num_states_, 0);
+  std::deque<int32_t> queue;
+  for (int32_t cls = 0; cls < num_classes_; ++cls) {
+    int32_t& next = transitions_[cls];
+    if (next < 0) {
+      next = 0;
+    } else {
+      queue.push_back(next);
+    }
+  }
+  while (!queue.empty()) {
+    const int32_t state = queue.front();
+    queue.pop_front();
+    const int32_t fail = failure[state];
+    dictionary_links_[state] =
+        state_outputs[fail].empty() ? dictionary_links_[fail] : fail;
+    for (int32_t cls = 0; cls < num_classes_; ++cls) {
+      int32_t& next = transitions_[state * num_classes_ + cls];
+      const int32_t fail_next = transitions_[fail * num_classes_ + cls];
+      if (next < 0) {
+        next = fail_next;
+      } else {
+        failure[next] = fail_next;
+        queue.push_back(next);
+      }
+    }
+  }
+
+  // 4. Flatten per-state outputs
+  output_offsets_.resize(num_states_ + 1);
+  reports_.resize(num_states_);
+  outputs_.clear();
+  for (int32_t state = 0; state < num_states_; ++state) {
+    output_offsets_[state] = static_cast<int32_t>(outputs_.size());
+    outputs_.insert(outputs_.end(), state_outputs[state].begin(),
+                    state_outputs[state].end());
+    reports_[state] = state > 0 && (!state_outputs[state].empty() ||
+                                    dictionary_links_[state] > 0);
+  }
+  output_offsets_[num_states_] = static_cast<int32_t>(outputs_.size());
+
+  // 5. Build the first-byte prefilter for the initial state
+  int num_first_bytes = 0;
+  lo_nibble_masks_.fill(0);
+  hi_nibble_masks_.fill(0);
+  for (int b = 0; b < 256; ++b) {
+    first_bytes_[b] = transitions_[byte_classes_[b]] != 0;
+    if (first_bytes_[b]) {
+      ++num_first_bytes;
+      // High nibbles h and h ^ 8 share a bucket; false positives are
+      // filtered out by first_bytes_.
+      const int bucket = (b >> 4) & 7;
+      lo_nibble_masks_[b & 0xf] |= static_cast<uint8_t>(1 << bucket);
+    }
+  }
+  for (int hi = 0; hi < 16; ++hi) {
+    hi_nibble_masks_[hi] = static_cast<uint8_t>(1 << (hi & 7));
+  }
+  // (with no non-empty literal at all, this skips the whole haystack)
+  use_prefilter_ = num_first_bytes <= kMaxPrefilterBytes;
+}
+
+}  // namespace arrow::compute::internal
@@ -0,0 +1,169 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+// Multi-literal string search used by the *_set string matching kernels
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/simd.h"
+
+namespace arrow::compute::internal {
+
+/// \brief Find occurrences of many literals in a single pass over a haystack
+///
+/// This is an Aho-Corasick automaton compiled down to a full DFA.  The input
+/// alphabet is reduced to the byte equivalence classes actually used by the
+/// literals, which keeps the transition table small even for several hundred
+/// literals.  While the automaton sits in its initial state, bytes which cannot
+/// start any literal are skipped using a first-byte prefilter (vectorized with
+/// a nibble lookup when SSE4.2 is available).
+///
+/// Literals may be anchored at the start and/or the end of the haystack, which
+/// allows evaluating prefix, suffix and exact matches with the same automaton.
+class AhoCorasickMatcher {
+ public:
+  enum Anchor : uint8_t {
+    kUnanchored = 0,
+    kAnchorStart = 1,
+    kAnchorEnd = 2,
+    kAnchorBoth = kAnchorStart | kAnchorEnd,
+  };
+
+  /// \param[in] ignore_case whether to fold ASCII letters when matching
+  explicit AhoCorasickMatcher(bool ignore_case = false) : ignore_case_(ignore_case) {}
+
+  /// \brief Register a literal to search for
+  ///
+  /// `id` is passed back to the visitor for every occurrence of the literal.
+  /// Several literals may share the same id.
+  void AddLiteral(std::string_view literal, int32_t id, uint8_t anchor = kUnanchored);
+
+  /// \brief Build the automaton.  Must be called once, after all AddLiteral() calls.
+  void Compile();
+
+  /// \brief Visit the ids of the literals occurring in `haystack`
+  ///
+  /// Occurrences are reported in order of their end position; a literal
+  /// occurring several times is reported several times.  `visit` is called as
+  /// `bool visit(int32_t id)` and may return true to stop the scan early.
+  template <typename Visitor>
+  void Scan(std::string_view haystack, Visitor&& visit) const {
+    const auto* data = reinterpret_cast<const uint8_t*>(haystack.data());
+    const auto length = static_cast<int64_t>(haystack.size());
+
+    for (const Output& out : empty_outputs_) {
+      if (Accepts(out, /*end=*/0, length) && visit(out.id)) return;
+    }
+
+    int32_t state = 0;
+    int64_t pos = 0;
+    while (pos < length) {
+      if (state == 0 && use_prefilter_) {
+        pos = SkipToCandidate(data, pos, length);
+        if (pos == length) break;
+      }
+      state = transitions_[state * num_classes_ + byte_classes_[data[pos]]];
+      ++pos;
+      if (ARROW_PREDICT_FALSE(reports_[state])) {
+        for (int32_t s = state; s > 0; s = dictionary_links_[s]) {
+          for (int32_t k = output_offsets_[s]; k < output_offsets_[s + 1]; ++k) {
+            const Output& out = outputs_[k];
+            if (Accepts(out, pos, length) && visit(out.id)) return;
+          }
+        }
+      }
+    }
+  }
+
+  int32_t num_states() const { return num_states_; }
+
+ private:
+  struct Output {
+    int32_t id;
+    int32_t length;
+    uint8_t anchor;
+  };
+
+  static bool Accepts(const Output& out, int64_t end, int64_t length) {
+    return (!(out.anchor & kAnchorStart) || end == out.length) &&
+           (!(out.anchor & kAnchorEnd) || end == length);
+  }
+
+  // Return the position of the first byte at or after `pos` which may start a
+  // literal, or `length` if there is none.
+  int64_t SkipToCandidate(const uint8_t* data, int64_t pos, int64_t length) const {
+#if defined(ARROW_HAVE_SSE4_2)
+    const __m128i lo_lut =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(lo_nibble_masks_.data()));
+    const __m128i hi_lut =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(hi_nibble_masks_.data()));
+    const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+    const __m128i zero = _mm_setzero_si128();
+    for (; pos + 16 <= length; pos += 16) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+      const __m128i lo = _mm_shuffle_epi8(lo_lut, _mm_and_si128(v, nibble_mask));
+      const __m128i hi =
+          _mm_shuffle_epi8(hi_lut, _mm_and_si128(_mm_srli_epi16(v, 4), nibble_mask));
+      auto candidates = static_cast<uint32_t>(
+          _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi), zero)) ^ 0xffff);
+      // The nibble lookup may have false positives, confirm with the exact table
+      while (candidates != 0) {
+        const int64_t candidate = pos + bit_util::CountTrailingZeros(candidates);
+        if (first_bytes_[data[candidate]]) return candidate;
+        candidates &= candidates - 1;
+      }
+    }
+#endif
+    while (pos < length && !first_bytes_[data[pos]]) ++pos;
+    return pos;
+  }
+
+  bool ignore_case_;
+  std::vector<std::string> literals_;
+  std::vector<Output> literal_outputs_;
+
+  int32_t num_classes_ = 1;
+  int32_t num_states_ = 1;
+  // Up to 257 classes when all bytes are used
+  std::array<uint16_t, 256> byte_classes_{};
+  // Dense DFA: transitions_[state * num_classes_ + byte_class]
+  std::vector<int32_t> transitions_;
+  // Whether reaching a state may report any output
+  std::vector<uint8_t> reports_;
+  // Next state on the failure chain having outputs of its own, or 0 if none
+  std::vector<int32_t> dictionary_links_;
+  // Outputs of state `s` are outputs_[output_offsets_[s]:output_offsets_[s + 1]]
+  std::vector<int32_t> output_offsets_;
+  std::vector<Output> outputs_;
+  // Empty literals, reported once at the start of the haystack
+  std::vector<Output> empty_outputs_;
+
+  bool use_prefilter_ = false;
+  std::array<bool, 256> first_bytes_{};
+  std::array<uint8_t, 16> lo_nibble_masks_{};
+  std::array<uint8_t, 16> hi_nibble_masks_{};
+};
+
+}  // namespace arrow::compute::internal
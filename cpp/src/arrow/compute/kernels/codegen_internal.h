@@ -1314,6 +1314,9 @@ void EnsureDictionaryDecoded(std::vector<TypeHolder>* types);
 ARROW_EXPORT
 void EnsureDictionaryDecoded(TypeHolder* begin, size_t count);
 
+ARROW_EXPORT
+void EnsureRunEndDecoded(std::vector<TypeHolder>* types);
+
 ARROW_EXPORT
 void ReplaceNullWithOtherType(std::vector<TypeHolder>* types);
 
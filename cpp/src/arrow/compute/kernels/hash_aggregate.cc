@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 #include <memory>
@@ -24,6 +25,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_decimal.h"
 #include "arrow/array/builder_nested.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/buffer_builder.h"
@@ -3299,6 +3302,203 @@ struct GroupedListFactory {
   HashAggregateKernel kernel;
   InputType argument_type;
 };
+
+// ----------------------------------------------------------------------
+// Top-k / first-k implementation
+
+// Keeps at most k non-null values per group.  For hash_top_k, each group holds
+// a bounded heap whose front is the worst value kept so far, so that a new
+// value is compared against a single element before being rejected.  For
+// hash_first_k, each group holds the first k values in input order.
+template <typename Type>
+struct GroupedSelectKImpl final : public GroupedAggregator {
+  using Allocator = arrow::stl::allocator<char>;
+  using StringType = std::basic_string<char, std::char_traits<char>, Allocator>;
+  using ViewType = typename GetViewType<Type>::T;
+  using ValueType =
+      typename std::conditional<std::is_same<ViewType, std::string_view>::value,
+                                StringType, ViewType>::type;
+  using BuilderType = typename TypeTraits<Type>::BuilderType;
+
+  Status Init(ExecContext* ctx, const KernelInitArgs& args) override {
+    ctx_ = ctx;
+    allocator_ = Allocator(ctx->memory_pool());
+    // out_type_ and by_value_ initialized by GroupedSelectKInit
+    if (args.options == nullptr) {
+      return Status::Invalid("Selecting k values per group requires SelectKOptions");
+    }
+    const auto& options = checked_cast<const SelectKOptions&>(*args.options);
+    if (options.k < 0) {
+      return Status::Invalid("Selecting k values per group requires a nonnegative `k`, ",
+                             "got ", options.k);
+    }
+    k_ = static_cast<size_t>(options.k);
+    descending_ =
+        !options.sort_keys.empty() && options.sort_keys[0].order == SortOrder::Descending;
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    values_.resize(new_num_groups);
+    return Status::OK();
+  }
+
+  Status Consume(const ExecSpan& batch) override {
+    if (k_ == 0) return Status::OK();
+    return VisitGroupedValues<Type>(
+        batch,
+        [&](uint32_t g, ViewType val) -> Status {
+          if (!IsNaN(val)) Add(&values_[g], val);
+          return Status::OK();
+        },
+        [](uint32_t) { return Status::OK(); });
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    // For hash_first_k, the values of this state precede those of the other
+    // state, as with hash_first.
+    auto other = checked_cast<GroupedSelectKImpl*>(&raw_other);
+    const auto* g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
+      for (const auto& val : other->values_[other_g]) {
+        Add(&values_[*g], View(val));
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    auto value_builder = std::make_shared<BuilderType>(out_type_, ctx_->memory_pool());
+    ListBuilder builder(ctx_->memory_pool(), value_builder, list(out_type_));
+    RETURN_NOT_OK(builder.Reserve(static_cast<int64_t>(values_.size())));
+    for (auto& group_values : values_) {
+      if (by_value_) {
+        std::sort_heap(group_values.begin(), group_values.end(), Before());
+      }
+      RETURN_NOT_OK(builder.Append());
+      for (const auto& val : group_values) {
+        RETURN_NOT_OK(value_builder->Append(View(val)));
+      }
+    }
+    values_.clear();
+    return builder.Finish();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return list(out_type_); }
+
+  // Whether `left` should be kept in preference to `right`
+  struct Comparator {
+    template <typename Left, typename Right>
+    bool operator()(const Left& left, const Right& right) const {
+      return descending ? View(right) < View(left) : View(left) < View(right);
+    }
+    bool descending;
+  };
+
+  Comparator Before() const { return Comparator{descending_}; }
+
+  void Add(std::vector<ValueType>* heap, ViewType val) {
+    if (heap->size() < k_) {
+      heap->push_back(MakeValue(val));
+      if (by_value_) {
+        std::push_heap(heap->begin(), heap->end(), Before());
+      }
+    } else if (by_value_ && Before()(val, heap->front())) {
+      std::pop_heap(heap->begin(), heap->end(), Before());
+      heap->back() = MakeValue(val);
+      std::push_heap(heap->begin(), heap->end(), Before());
+    }
+  }
+
+  template <typename T>
+  static bool IsNaN(const T& val) {
+    if constexpr (std::is_floating_point<T>::value) {
+      return std::isnan(val);
+    } else {
+      return false;
+    }
+  }
+
+  static const ViewType& View(const ViewType& val) { return val; }
+  template <typename T = ValueType>
+  static enable_if_t<!std::is_same<T, ViewType>::value, ViewType> View(const T& val) {
+    return ViewType(val.data(), val.size());
+  }
+
+  ValueType MakeValue(ViewType val) const {
+    if constexpr (std::is_same<ValueType, StringType>::value) {
+      return StringType(val.data(), val.size(), allocator_);
+    } else {
+      return val;
+    }
+  }
+
+  ExecContext* ctx_;
+  Allocator allocator_;
+  size_t k_ = 0;
+  bool descending_ = false;
+  bool by_value_ = true;
+  std::vector<std::vector<ValueType>> values_;
+  std::shared_ptr<DataType> out_type_;
+};
+
+template <typename T, bool by_value>
+Result<std::unique_ptr<KernelState>> GroupedSelectKInit(KernelContext* ctx,
+                                                        const KernelInitArgs& args) {
+  ARROW_ASSIGN_OR_RAISE(auto impl, HashAggregateInit<GroupedSelectKImpl<T>>(ctx, args));
+  auto instance = static_cast<GroupedSelectKImpl<T>*>(impl.get());
+  instance->out_type_ = args.inputs[0].GetSharedPtr();
+  instance->by_value_ = by_value;
+  return std::move(impl);
+}
+
+template <bool by_value>
+struct GroupedSelectKFactory {
+  template <typename T>
+  enable_if_physical_integer<T, Status> Visit(const T&) {
+    using PhysicalType = typename T::PhysicalType;
+    return MakeKernelFor<PhysicalType>();
+  }
+
+  template <typename T>
+  enable_if_t<is_floating_type<T>::value || is_decimal_type<T>::value ||
+                  is_base_binary_type<T>::value,
+              Status>
+  Visit(const T&) {
+    return MakeKernelFor<T>();
+  }
+
+  Status Visit(const FixedSizeBinaryType&) {
+    return MakeKernelFor<FixedSizeBinaryType>();
+  }
+
+  Status Visit(const HalfFloatType& type) {
+    return Status::NotImplemented("Selecting k values of data of type ", type);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Selecting k values of data of type ", type);
+  }
+
+  template <typename T>
+  Status MakeKernelFor() {
+    // hash_first_k depends on the input order, hash_top_k doesn't
+    kernel = MakeKernel(std::move(argument_type), GroupedSelectKInit<T, by_value>,
+                        /*ordered=*/!by_value);
+    return Status::OK();
+  }
+
+  static Result<HashAggregateKernel> Make(const std::shared_ptr<DataType>& type) {
+    GroupedSelectKFactory factory;
+    factory.argument_type = type->id();
+    RETURN_NOT_OK(VisitTypeInline(*type, &factory));
+    return std::move(factory.kernel);
+  }
+
+  HashAggregateKernel kernel;
+  InputType argument_type;
+};
 }  // namespace
 
 namespace {
@@ -3436,6 +3636,26 @@ const FunctionDoc hash_one_doc{"Get one value from each group",
 const FunctionDoc hash_list_doc{"List all values in each group",
                                 ("Null values are also returned."),
                                 {"array", "group_id_array"}};
+
+const FunctionDoc hash_top_k_doc{
+    "Keep the first `k` ordered values in each group",
+    ("Values in each group are ordered according to the order of the first\n"
+     "sort key in SelectKOptions (the other fields of the sort keys are\n"
+     "ignored): use SelectKOptions::TopKDefault for the `k` largest values and\n"
+     "SelectKOptions::BottomKDefault for the `k` smallest values.\n"
+     "Each output list is sorted in that order.\n"
+     "Null values and NaNs are ignored."),
+    {"array", "group_id_array"},
+    "SelectKOptions",
+    /*options_required=*/true};
+
+const FunctionDoc hash_first_k_doc{
+    "Keep the first `k` values in each group, in input order",
+    ("Only the `k` field of SelectKOptions is used.\n"
+     "Null values and NaNs are ignored."),
+    {"array", "group_id_array"},
+    "SelectKOptions",
+    /*options_required=*/true};
 }  // namespace
 
 void RegisterHashAggregateBasic(FunctionRegistry* registry) {
@@ -3685,6 +3905,32 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
                                 GroupedListFactory::Make, func.get()));
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>("hash_top_k", Arity::Binary(),
+                                                        hash_top_k_doc);
+    using Factory = GroupedSelectKFactory</*by_value=*/true>;
+    DCHECK_OK(AddHashAggKernels(NumericTypes(), Factory::Make, func.get()));
+    DCHECK_OK(AddHashAggKernels(TemporalTypes(), Factory::Make, func.get()));
+    DCHECK_OK(AddHashAggKernels(BaseBinaryTypes(), Factory::Make, func.get()));
+    DCHECK_OK(AddHashAggKernels(
+        {decimal128(1, 1), decimal256(1, 1), month_interval(), fixed_size_binary(1)},
+        Factory::Make, func.get()));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>("hash_first_k", Arity::Binary(),
+                                                        hash_first_k_doc);
+    using Factory = GroupedSelectKFactory</*by_value=*/false>;
+    DCHECK_OK(AddHashAggKernels(NumericTypes(), Factory::Make, func.get()));
+    DCHECK_OK(AddHashAggKernels(TemporalTypes(), Factory::Make, func.get()));
+    DCHECK_OK(AddHashAggKernels(BaseBinaryTypes(), Factory::Make, func.get()));
+    DCHECK_OK(AddHashAggKernels(
+        {decimal128(1, 1), decimal256(1, 1), month_interval(), fixed_size_binary(1)},
+        Factory::Make, func.get()));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
 }
 
 }  // namespace internal
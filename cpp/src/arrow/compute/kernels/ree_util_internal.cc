@@ -15,8 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/compute/kernels/ree_util_internal.h"
 
@@ -25,7 +27,9 @@
 #include "arrow/result.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/ree_util.h"
 
 namespace arrow {
 namespace compute {
@@ -136,6 +140,65 @@ Result<std::shared_ptr<ArrayData>> MakeNullREEArray(
                          /*null_count=*/0);
 }
 
+namespace {
+
+template <typename RunEndCType>
+int64_t ReadLogicalRunEndsImpl(const ArraySpan& span, std::vector<int64_t>* run_ends) {
+  const auto [physical_offset, physical_length] =
+      ::arrow::ree_util::FindPhysicalRange(span, span.offset, span.length);
+  const RunEndCType* input = ::arrow::ree_util::RunEnds<RunEndCType>(span);
+  run_ends->resize(physical_length);
+  for (int64_t i = 0; i < physical_length; ++i) {
+    const auto run_end = static_cast<int64_t>(input[physical_offset + i]);
+    (*run_ends)[i] = std::min(run_end - span.offset, span.length);
+  }
+  return physical_offset;
+}
+
+template <typename RunEndCType>
+void WriteRunEnds(const std::vector<int64_t>& run_ends, ArrayData* out) {
+  auto* output = out->GetMutableValues<RunEndCType>(1);
+  for (size_t i = 0; i < run_ends.size(); ++i) {
+    output[i] = static_cast<RunEndCType>(run_ends[i]);
+  }
+}
+
+}  // namespace
+
+int64_t ReadLogicalRunEnds(const ArraySpan& span, std::vector<int64_t>* run_ends) {
+  const auto& ree_type =
+      ::arrow::internal::checked_cast<const RunEndEncodedType&>(*span.type);
+  switch (ree_type.run_end_type()->id()) {
+    case Type::INT16:
+      return ReadLogicalRunEndsImpl<int16_t>(span, run_ends);
+    case Type::INT32:
+      return ReadLogicalRunEndsImpl<int32_t>(span, run_ends);
+    default:
+      DCHECK_EQ(ree_type.run_end_type()->id(), Type::INT64);
+      return ReadLogicalRunEndsImpl<int64_t>(span, run_ends);
+  }
+}
+
+Result<std::shared_ptr<ArrayData>> MakeRunEndsArray(
+    const std::shared_ptr<DataType>& run_end_type, const std::vector<int64_t>& run_ends,
+    MemoryPool* pool) {
+  const auto length = static_cast<int64_t>(run_ends.size());
+  ARROW_ASSIGN_OR_RAISE(auto out, PreallocateRunEndsArray(run_end_type, length, pool));
+  switch (run_end_type->id()) {
+    case Type::INT16:
+      WriteRunEnds<int16_t>(run_ends, out.get());
+      break;
+    case Type::INT32:
+      WriteRunEnds<int32_t>(run_ends, out.get());
+      break;
+    default:
+      DCHECK_EQ(run_end_type->id(), Type::INT64);
+      WriteRunEnds<int64_t>(run_ends, out.get());
+      break;
+  }
+  return out;
+}
+
 }  // namespace ree_util
 }  // namespace internal
 }  // namespace compute
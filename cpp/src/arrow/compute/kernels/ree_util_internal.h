@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include "arrow/array/data.h"
 #include "arrow/compute/exec.h"
@@ -381,6 +382,22 @@ Result<std::shared_ptr<ArrayData>> MakeNullREEArray(
     const std::shared_ptr<DataType>& run_end_type, int64_t logical_length,
     MemoryPool* pool);
 
+/// \brief Read the run ends of a run-end encoded span relative to its offset
+///
+/// The ends of the runs overlapping the logical range of `span` are written to
+/// `run_ends`, shifted by the span offset and with the last one clamped to the
+/// span length.
+///
+/// \return the physical offset of the first run overlapping the span
+int64_t ReadLogicalRunEnds(const ArraySpan& span, std::vector<int64_t>* run_ends);
+
+/// \brief Make a run ends array of the given type from int64 run ends
+///
+/// Pre-condition: the run ends fit in `run_end_type`
+Result<std::shared_ptr<ArrayData>> MakeRunEndsArray(
+    const std::shared_ptr<DataType>& run_end_type, const std::vector<int64_t>& run_ends,
+    MemoryPool* pool);
+
 }  // namespace ree_util
 }  // namespace internal
 }  // namespace compute
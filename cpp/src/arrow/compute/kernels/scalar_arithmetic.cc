@@ -645,6 +645,7 @@ struct ArithmeticFunction : ScalarFunction {
     if (auto kernel = DispatchExactImpl(this, *types)) return kernel;
 
     EnsureDictionaryDecoded(types);
+    EnsureRunEndDecoded(types);
 
     // Only promote types for binary functions
     if (types->size() == 2) {
@@ -700,6 +701,7 @@ struct ArithmeticDecimalToFloatingPointFunction : public ArithmeticFunction {
     if (auto kernel = DispatchExactImpl(this, *types)) return kernel;
 
     EnsureDictionaryDecoded(types);
+    EnsureRunEndDecoded(types);
 
     if (types->size() == 2) {
       ReplaceNullWithOtherType(types);
@@ -732,6 +734,7 @@ struct ArithmeticIntegerToFloatingPointFunction : public ArithmeticFunction {
     if (auto kernel = DispatchExactImpl(this, *types)) return kernel;
 
     EnsureDictionaryDecoded(types);
+    EnsureRunEndDecoded(types);
 
     if (types->size() == 2) {
       ReplaceNullWithOtherType(types);
@@ -763,6 +766,7 @@ struct ArithmeticFloatingPointFunction : public ArithmeticFunction {
     if (auto kernel = DispatchExactImpl(this, *types)) return kernel;
 
     EnsureDictionaryDecoded(types);
+    EnsureRunEndDecoded(types);
 
     if (types->size() == 2) {
       ReplaceNullWithOtherType(types);
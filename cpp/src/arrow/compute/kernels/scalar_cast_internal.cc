@@ -16,8 +16,10 @@
 // under the License.
 
 #include "arrow/compute/kernels/scalar_cast_internal.h"
+#include "arrow/array/builder_base.h"
 #include "arrow/compute/cast_internal.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/kernels/ree_util_internal.h"
 #include "arrow/extension_type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
@@ -210,6 +212,54 @@ Status UnpackDictionary(KernelContext* ctx, const ExecSpan& batch, ExecResult* o
   return Status::OK();
 }
 
+Status DecodeRunEndEncoded(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const CastOptions& options = checked_cast<const CastState&>(*ctx->state()).options;
+  const ArraySpan& input = batch[0].array;
+
+  // Cast the run values before expanding them, so that the conversion itself
+  // only costs O(runs)
+  std::vector<int64_t> run_ends;
+  const int64_t physical_offset = ree_util::ReadLogicalRunEnds(input, &run_ends);
+  const auto num_runs = static_cast<int64_t>(run_ends.size());
+  Datum values = input.child_data[1].ToArrayData()->Slice(physical_offset, num_runs);
+  if (!values.type()->Equals(*options.to_type)) {
+    ARROW_ASSIGN_OR_RAISE(values, Cast(values, options, ctx->exec_context()));
+  }
+
+  // Expand the runs directly, without gathering through per-row indices
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*input.type);
+  ARROW_ASSIGN_OR_RAISE(auto run_ends_data,
+                        ree_util::MakeRunEndsArray(ree_type.run_end_type(), run_ends,
+                                                   ctx->memory_pool()));
+  auto rebased = ArrayData::Make(run_end_encoded(run_ends_data->type, values.type()),
+                                 input.length, {nullptr}, /*null_count=*/0);
+  rebased->child_data = {std::move(run_ends_data), values.array()};
+  auto maybe_decoded =
+      CallFunction("run_end_decode", {std::move(rebased)}, ctx->exec_context());
+  if (maybe_decoded.ok()) {
+    out->value = maybe_decoded->array();
+    return Status::OK();
+  }
+  if (!maybe_decoded.status().IsNotImplemented()) {
+    return maybe_decoded.status();
+  }
+
+  // Value types without a run_end_decode kernel (e.g. nested types)
+  std::unique_ptr<ArrayBuilder> builder;
+  RETURN_NOT_OK(MakeBuilder(ctx->memory_pool(), values.type(), &builder));
+  RETURN_NOT_OK(builder->Reserve(input.length));
+  const ArraySpan values_span(*values.array());
+  int64_t logical_pos = 0;
+  for (int64_t run = 0; run < num_runs; ++run) {
+    for (; logical_pos < run_ends[run]; ++logical_pos) {
+      RETURN_NOT_OK(builder->AppendArraySlice(values_span, run, 1));
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(auto decoded, builder->Finish());
+  out->value = decoded->data();
+  return Status::OK();
+}
+
 Status OutputAllNull(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
   // TODO(wesm): there is no good reason to have to use ArrayData here, so we
   // should clean this up later. This is used in the dict<null>->null cast
@@ -305,6 +355,14 @@ void AddCommonCasts(Type::type out_type_id, OutputType out_ty, CastFunction* fun
                               MemAllocation::NO_PREALLOCATE));
   }
 
+  // From run-end encoded to this type
+  if (out_type_id != Type::RUN_END_ENCODED) {
+    DCHECK_OK(func->AddKernel(Type::RUN_END_ENCODED, {InputType(Type::RUN_END_ENCODED)},
+                              out_ty, DecodeRunEndEncoded,
+                              NullHandling::COMPUTED_NO_PREALLOCATE,
+                              MemAllocation::NO_PREALLOCATE));
+  }
+
   // From extension type to this type
   DCHECK_OK(func->AddKernel(Type::EXTENSION, {InputType(Type::EXTENSION)}, out_ty,
                             CastFromExtension, NullHandling::COMPUTED_NO_PREALLOCATE,
@@ -55,6 +55,11 @@ Status UnpackDictionary(KernelContext* ctx, const ExecSpan& batch, ExecResult* o
 
 Status OutputAllNull(KernelContext* ctx, const ExecSpan& batch, ExecResult* out);
 
+// ----------------------------------------------------------------------
+// Run-end encoded to other things
+
+Status DecodeRunEndEncoded(KernelContext* ctx, const ExecSpan& batch, ExecResult* out);
+
 Status CastFromNull(KernelContext* ctx, const ExecSpan& batch, ExecResult* out);
 
 // Adds a cast function where CastFunctor is specialized and the input and output
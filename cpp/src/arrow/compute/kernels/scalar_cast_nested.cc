@@ -26,6 +26,7 @@
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/kernels/ree_util_internal.h"
 #include "arrow/compute/kernels/scalar_cast_internal.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/int_util.h"
@@ -395,6 +396,44 @@ struct CastStruct {
   }
 };
 
+struct CastRunEndEncoded {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    const CastOptions& options = CastState::Get(ctx);
+    const auto& out_type = checked_cast<const RunEndEncodedType&>(*out->type());
+    const ArraySpan& in_array = batch[0].array;
+
+    const auto& run_end_type = out_type.run_end_type();
+    const int64_t max_run_end =
+        run_end_type->id() == Type::INT16   ? std::numeric_limits<int16_t>::max()
+        : run_end_type->id() == Type::INT32 ? std::numeric_limits<int32_t>::max()
+                                            : std::numeric_limits<int64_t>::max();
+    if (in_array.length > max_run_end) {
+      return Status::Invalid("Cannot cast ", *batch[0].type(), " of length ",
+                             in_array.length, " to ", out_type,
+                             ": run ends would overflow");
+    }
+
+    // Only the runs overlapping the input are cast
+    std::vector<int64_t> run_ends;
+    const int64_t physical_offset =
+        ree_util::ReadLogicalRunEnds(in_array, &run_ends);
+    const auto values = in_array.child_data[1].ToArrayData()->Slice(
+        physical_offset, static_cast<int64_t>(run_ends.size()));
+    ARROW_ASSIGN_OR_RAISE(
+        Datum cast_values,
+        Cast(values, out_type.value_type(), options, ctx->exec_context()));
+    ARROW_ASSIGN_OR_RAISE(
+        auto run_ends_data,
+        ree_util::MakeRunEndsArray(run_end_type, run_ends, ctx->memory_pool()));
+
+    ArrayData* out_array = out->array_data().get();
+    out_array->buffers = {nullptr};
+    out_array->null_count = 0;
+    out_array->child_data = {std::move(run_ends_data), cast_values.array()};
+    return Status::OK();
+  }
+};
+
 template <typename CastFunctor, typename SrcT>
 void AddTypeToTypeCast(CastFunction* func) {
   ScalarKernel kernel;
@@ -523,7 +562,14 @@ std::vector<std::shared_ptr<CastFunction>> GetNestedCasts() {
       std::make_shared<CastFunction>("cast_dictionary", Type::DICTIONARY);
   AddCommonCasts(Type::DICTIONARY, kOutputTargetType, cast_dictionary.get());
 
-  return {cast_list, cast_large_list, cast_map, cast_fsl, cast_struct, cast_dictionary};
+  auto cast_run_end_encoded =
+      std::make_shared<CastFunction>("cast_run_end_encoded", Type::RUN_END_ENCODED);
+  AddCommonCasts(Type::RUN_END_ENCODED, kOutputTargetType, cast_run_end_encoded.get());
+  AddTypeToTypeCast<CastRunEndEncoded, RunEndEncodedType>(cast_run_end_encoded.get());
+
+  return {cast_list,   cast_large_list, cast_map,
+          cast_fsl,    cast_struct,     cast_dictionary,
+          cast_run_end_encoded};
 }
 
 }  // namespace compute::internal
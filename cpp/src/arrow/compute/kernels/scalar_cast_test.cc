@@ -3036,6 +3036,54 @@ TEST(Cast, FromDictionary) {
   }
 }
 
+// ----------------------------------------------------------------------
+// Test casting from RunEndEncodedType
+
+TEST(Cast, FromRunEndEncoded) {
+  for (const auto& run_end_type : {int16(), int32(), int64()}) {
+    ARROW_SCOPED_TRACE("run_end_type = ", *run_end_type);
+    auto ree = RunEndEncodedArrayFromJSON(7, run_end_type, "[2, 3, 6, 7]", int32(),
+                                          "[1, null, 300, 4]");
+    CheckCast(ree, ArrayFromJSON(int32(), "[1, 1, null, 300, 300, 300, 4]"));
+    CheckCast(ree, ArrayFromJSON(int64(), "[1, 1, null, 300, 300, 300, 4]"));
+    CheckCast(ree,
+              ArrayFromJSON(utf8(), R"(["1", "1", null, "300", "300", "300", "4"])"));
+    CheckCastFails(ree, CastOptions::Safe(int8()));
+
+    // Only the runs overlapping the slice are cast
+    CheckCast(ree->Slice(3, 4), ArrayFromJSON(int8(), "[44, 44, 44, 4]"),
+              CastOptions::Unsafe(int8()));
+  }
+
+  // Values without a run_end_decode kernel
+  auto ree = RunEndEncodedArrayFromJSON(5, int32(), "[2, 3, 5]", list(int32()),
+                                        "[[1, 2], null, []]");
+  CheckCast(ree, ArrayFromJSON(list(int32()), "[[1, 2], [1, 2], null, [], []]"));
+  CheckCast(ree->Slice(1, 3), ArrayFromJSON(list(int32()), "[[1, 2], null, []]"));
+}
+
+TEST(Cast, RunEndEncodedToRunEndEncoded) {
+  auto ree =
+      RunEndEncodedArrayFromJSON(7, int32(), "[2, 3, 6, 7]", int32(), "[1, null, 3, 4]");
+  CheckCast(ree, RunEndEncodedArrayFromJSON(7, int16(), "[2, 3, 6, 7]", float64(),
+                                            "[1, null, 3, 4]"));
+  CheckCast(ree, RunEndEncodedArrayFromJSON(7, int64(), "[2, 3, 6, 7]", utf8(),
+                                            R"(["1", null, "3", "4"])"));
+
+  ASSERT_OK_AND_ASSIGN(auto sliced,
+                       Cast(*ree->Slice(1, 4), run_end_encoded(int16(), int64())));
+  ValidateOutput(*sliced);
+  AssertArraysEqual(
+      *RunEndEncodedArrayFromJSON(4, int16(), "[1, 2, 4]", int64(), "[1, null, 3]"),
+      *sliced, /*verbose=*/true);
+
+  // The run end type must be able to represent the length
+  ASSERT_OK_AND_ASSIGN(auto long_ree,
+                       RunEndEncodedArray::Make(40000, ArrayFromJSON(int32(), "[40000]"),
+                                                ArrayFromJSON(int32(), "[1]")));
+  ASSERT_RAISES(Invalid, Cast(*long_ree, run_end_encoded(int16(), int32())));
+}
+
 std::shared_ptr<Array> SmallintArrayFromJSON(const std::string& json_data) {
   auto arr = ArrayFromJSON(int16(), json_data);
   auto ext_data = arr->data()->Copy();
@@ -348,6 +348,7 @@ struct CompareFunction : ScalarFunction {
     if (auto kernel = DispatchExactImpl(this, *types)) return kernel;
 
     EnsureDictionaryDecoded(types);
+    EnsureRunEndDecoded(types);
     ReplaceNullWithOtherType(types);
 
     if (auto type = CommonNumeric(*types)) {
@@ -373,6 +374,7 @@ struct VarArgsCompareFunction : ScalarFunction {
     if (auto kernel = DispatchExactImpl(this, *types)) return kernel;
 
     EnsureDictionaryDecoded(types);
+    EnsureRunEndDecoded(types);
 
     if (auto type = CommonNumeric(*types)) {
       ReplaceTypes(type, types);
@@ -22,11 +22,13 @@
 #include <string>
 
 #include "arrow/array/builder_nested.h"
+#include "arrow/compute/kernels/aho_corasick_internal.h"
 #include "arrow/compute/kernels/scalar_string_internal.h"
 #include "arrow/result.h"
 #include "arrow/util/config.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string.h"
+#include "arrow/util/utf8_internal.h"
 #include "arrow/util/value_parsing.h"
 
 #ifdef ARROW_WITH_RE2
@@ -1663,6 +1665,414 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
 #endif
 }
 
+// ----------------------------------------------------------------------
+// Multi-pattern substring and LIKE matching
+
+// A SQL LIKE pattern, split into the segments separated by '%' wildcards.
+// A segment element is either a literal byte or kAnyChar for a '_' wildcard.
+class LikePattern {
+ public:
+  static constexpr int16_t kAnyChar = -1;
+  using Segment = std::vector<int16_t>;
+
+  explicit LikePattern(std::string_view pattern) {
+    Segment current;
+    bool escaped = false;
+    bool any_percent = false;
+    for (const char c : pattern) {
+      if (!escaped && c == '%') {
+        if (!any_percent && current.empty()) leading_percent_ = true;
+        any_percent = true;
+        if (!current.empty()) segments_.push_back(std::move(current));
+        current.clear();
+        trailing_percent_ = true;
+        continue;
+      }
+      if (!escaped && c == '\\') {
+        escaped = true;
+        continue;
+      }
+      current.push_back((!escaped && c == '_') ? kAnyChar : static_cast<uint8_t>(c));
+      escaped = false;
+      trailing_percent_ = false;
+    }
+    // NOTE: like MakeLikeRegex, a trailing lone backslash is ignored
+    if (!current.empty() || !any_percent) segments_.push_back(std::move(current));
+  }
+
+  // Whether the pattern is a single literal segment, optionally surrounded by '%'
+  bool IsLiteral() const {
+    if (segments_.size() > 1) return false;
+    for (const auto& segment : segments_) {
+      for (const int16_t e : segment) {
+        if (e == kAnyChar) return false;
+      }
+    }
+    return true;
+  }
+
+  // The literal of a pattern for which IsLiteral() is true
+  std::string literal() const {
+    std::string out;
+    if (!segments_.empty()) {
+      for (const int16_t e : segments_[0]) out.push_back(static_cast<char>(e));
+    }
+    return out;
+  }
+
+  uint8_t anchor() const {
+    return (leading_percent_ ? 0 : AhoCorasickMatcher::kAnchorStart) |
+           (trailing_percent_ ? 0 : AhoCorasickMatcher::kAnchorEnd);
+  }
+
+  // The longest run of literal bytes which any matching string must contain
+  std::string RequiredLiteral() const {
+    std::string best, current;
+    for (const auto& segment : segments_) {
+      for (const int16_t e : segment) {
+        if (e == kAnyChar) {
+          if (current.size() > best.size()) best = current;
+          current.clear();
+        } else {
+          current.push_back(static_cast<char>(e));
+        }
+      }
+      if (current.size() > best.size()) best = current;
+      current.clear();
+    }
+    return best;
+  }
+
+  bool Matches(std::string_view s, bool is_utf8, bool ignore_case) const {
+    const auto* data = reinterpret_cast<const uint8_t*>(s.data());
+    const auto length = static_cast<int64_t>(s.size());
+    if (segments_.empty()) {
+      // Only '%' wildcards
+      return true;
+    }
+    size_t first = 0, last = segments_.size();
+    int64_t pos = 0, end = length;
+    if (!leading_percent_) {
+      pos = MatchForward(segments_[0], data, 0, length, is_utf8, ignore_case);
+      if (pos < 0) return false;
+      if (segments_.size() == 1) return trailing_percent_ || pos == length;
+      ++first;
+    }
+    if (!trailing_percent_) {
+      end = MatchBackward(segments_.back(), data, length, is_utf8, ignore_case);
+      if (end < pos) return false;
+      --last;
+    }
+    // Match the remaining segments at their leftmost position; as every segment
+    // spans a fixed number of characters, this never rejects a matching string.
+    for (size_t i = first; i < last; ++i) {
+      int64_t match_end = -1;
+      while (pos < end) {
+        match_end = MatchForward(segments_[i], data, pos, end, is_utf8, ignore_case);
+        if (match_end >= 0) break;
+        pos = NextChar(data, pos, end, is_utf8);
+      }
+      if (match_end < 0) return false;
+      pos = match_end;
+    }
+    return true;
+  }
+
+ private:
+  static bool ElementMatches(int16_t e, uint8_t c, bool ignore_case) {
+    return ignore_case ? ascii_tolower(static_cast<uint8_t>(e)) == ascii_tolower(c)
+                       : e == c;
+  }
+
+  static int64_t NextChar(const uint8_t* data, int64_t pos, int64_t end, bool is_utf8) {
+    ++pos;
+    if (is_utf8) {
+      while (pos < end && arrow::util::Utf8IsContinuation(data[pos])) ++pos;
+    }
+    return pos;
+  }
+
+  // Match `segment` starting at `pos`, returning the end position or -1
+  static int64_t MatchForward(const Segment& segment, const uint8_t* data, int64_t pos,
+                              int64_t end, bool is_utf8, bool ignore_case) {
+    for (const int16_t e : segment) {
+      if (pos >= end) return -1;
+      if (e == kAnyChar) {
+        pos = NextChar(data, pos, end, is_utf8);
+      } else if (ElementMatches(e, data[pos], ignore_case)) {
+        ++pos;
+      } else {
+        return -1;
+      }
+    }
+    return pos;
+  }
+
+  // Match `segment` ending at `end`, returning the start position or -1
+  static int64_t MatchBackward(const Segment& segment, const uint8_t* data, int64_t end,
+                               bool is_utf8, bool ignore_case) {
+    int64_t pos = end;
+    for (auto it = segment.rbegin(); it != segment.rend(); ++it) {
+      if (pos <= 0) return -1;
+      --pos;
+      if (*it == kAnyChar) {
+        if (is_utf8) {
+          while (pos > 0 && arrow::util::Utf8IsContinuation(data[pos])) --pos;
+        }
+      } else if (!ElementMatches(*it, data[pos], ignore_case)) {
+        return -1;
+      }
+    }
+    return pos;
+  }
+
+  std::vector<Segment> segments_;
+  bool leading_percent_ = false;
+  bool trailing_percent_ = false;
+};
+
+// Matches plain substrings, reporting the lowest index of a contained pattern
+struct SubstringSetMatcher {
+  struct Scratch {
+    explicit Scratch(const SubstringSetMatcher&) {}
+  };
+
+  AhoCorasickMatcher automaton_;
+
+  static Result<std::unique_ptr<SubstringSetMatcher>> Make(
+      const MatchSubstringSetOptions& options, bool is_utf8) {
+    auto matcher = std::make_unique<SubstringSetMatcher>(options.ignore_case);
+    for (size_t i = 0; i < options.patterns.size(); ++i) {
+      matcher->automaton_.AddLiteral(options.patterns[i], static_cast<int32_t>(i));
+    }
+    matcher->automaton_.Compile();
+    return std::move(matcher);
+  }
+
+  explicit SubstringSetMatcher(bool ignore_case) : automaton_(ignore_case) {}
+
+  bool Match(std::string_view current, Scratch*) const {
+    bool found = false;
+    automaton_.Scan(current, [&](int32_t) { return found = true; });
+    return found;
+  }
+
+  int32_t MatchIndex(std::string_view current) const {
+    int32_t index = -1;
+    automaton_.Scan(current, [&](int32_t id) {
+      if (index < 0 || id < index) index = id;
+      return index == 0;
+    });
+    return index;
+  }
+};
+
+// Matches SQL LIKE patterns.  Patterns which are a literal surrounded by
+// optional '%' wildcards are decided by the automaton alone.  For the other
+// patterns, the automaton searches their longest literal fragment and the
+// full pattern is only evaluated on strings containing that fragment.
+struct LikeSetMatcher {
+  struct Scratch {
+    explicit Scratch(const LikeSetMatcher& matcher)
+        : visited(matcher.patterns_.size(), 0) {}
+
+    // visited[i] == generation iff pattern i was evaluated on the current string
+    std::vector<uint64_t> visited;
+    uint64_t generation = 0;
+  };
+
+  AhoCorasickMatcher automaton_;
+  std::vector<LikePattern> patterns_;
+  // Whether the pattern must be evaluated after the automaton reported it
+  std::vector<bool> needs_evaluation_;
+  // Patterns without any literal fragment, evaluated on every string
+  std::vector<int32_t> unfiltered_;
+  bool is_utf8_;
+  bool ignore_case_;
+
+  static Result<std::unique_ptr<LikeSetMatcher>> Make(
+      const MatchSubstringSetOptions& options, bool is_utf8) {
+    auto matcher = std::make_unique<LikeSetMatcher>(options.ignore_case, is_utf8);
+    for (size_t i = 0; i < options.patterns.size(); ++i) {
+      const auto id = static_cast<int32_t>(i);
+      const LikePattern& pattern = matcher->patterns_.emplace_back(options.patterns[i]);
+      if (pattern.IsLiteral()) {
+        matcher->automaton_.AddLiteral(pattern.literal(), id, pattern.anchor());
+        matcher->needs_evaluation_.push_back(false);
+        continue;
+      }
+      matcher->needs_evaluation_.push_back(true);
+      const std::string required = pattern.RequiredLiteral();
+      if (required.empty()) {
+        matcher->unfiltered_.push_back(id);
+      } else {
+        matcher->automaton_.AddLiteral(required, id);
+      }
+    }
+    matcher->automaton_.Compile();
+    return std::move(matcher);
+  }
+
+  LikeSetMatcher(bool ignore_case, bool is_utf8)
+      : automaton_(ignore_case), is_utf8_(is_utf8), ignore_case_(ignore_case) {}
+
+  bool Match(std::string_view current, Scratch* scratch) const {
+    const uint64_t generation = ++scratch->generation;
+    bool found = false;
+    automaton_.Scan(current, [&](int32_t id) {
+      if (!needs_evaluation_[id]) return found = true;
+      if (scratch->visited[id] == generation) return false;
+      scratch->visited[id] = generation;
+      return found = patterns_[id].Matches(current, is_utf8_, ignore_case_);
+    });
+    if (found) return true;
+    for (const int32_t id : unfiltered_) {
+      if (patterns_[id].Matches(current, is_utf8_, ignore_case_)) return true;
+    }
+    return false;
+  }
+};
+
+// Kernel state holding the compiled matcher, so that patterns are only
+// compiled once per kernel invocation rather than once per batch
+template <typename Matcher>
+struct MatchSubstringSetState : public KernelState {
+  explicit MatchSubstringSetState(std::unique_ptr<Matcher> matcher)
+      : matcher(std::move(matcher)) {}
+
+  static Result<std::unique_ptr<KernelState>> Init(KernelContext* ctx,
+                                                   const KernelInitArgs& args) {
+    auto options = static_cast<const MatchSubstringSetOptions*>(args.options);
+    if (!options) {
+      return Status::Invalid(
+          "Attempted to initialize KernelState from null FunctionOptions");
+    }
+    ARROW_ASSIGN_OR_RAISE(auto matcher,
+                          Matcher::Make(*options, is_string(args.inputs[0].id())));
+    return std::make_unique<MatchSubstringSetState>(std::move(matcher));
+  }
+
+  static const Matcher& Get(KernelContext* ctx) {
+    const auto& state =
+        ::arrow::internal::checked_cast<const MatchSubstringSetState&>(*ctx->state());
+    return *state.matcher;
+  }
+
+  std::unique_ptr<Matcher> matcher;
+};
+
+template <typename Type, typename Matcher>
+struct MatchSubstringSet {
+  using offset_type = typename Type::offset_type;
+
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    const Matcher& matcher = MatchSubstringSetState<Matcher>::Get(ctx);
+    typename Matcher::Scratch scratch(matcher);
+    StringBoolTransform<Type>(
+        ctx, batch,
+        [&](const void* raw_offsets, const uint8_t* data, int64_t length,
+            int64_t output_offset, uint8_t* output) {
+          const offset_type* offsets = reinterpret_cast<const offset_type*>(raw_offsets);
+          FirstTimeBitmapWriter bitmap_writer(output, output_offset, length);
+          for (int64_t i = 0; i < length; ++i) {
+            const char* current_data = reinterpret_cast<const char*>(data + offsets[i]);
+            int64_t current_length = offsets[i + 1] - offsets[i];
+            if (matcher.Match(std::string_view(current_data, current_length),
+                              &scratch)) {
+              bitmap_writer.Set();
+            }
+            bitmap_writer.Next();
+          }
+          bitmap_writer.Finish();
+        },
+        out);
+    return Status::OK();
+  }
+};
+
+struct MatchSubstringSetIndex {
+  const SubstringSetMatcher* matcher_;
+
+  explicit MatchSubstringSetIndex(const SubstringSetMatcher* matcher)
+      : matcher_(matcher) {}
+
+  template <typename OutValue, typename... Ignored>
+  OutValue Call(KernelContext*, std::string_view val, Status*) const {
+    return matcher_->MatchIndex(val);
+  }
+};
+
+template <typename InputType>
+struct MatchSubstringSetIndexExec {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    const auto& matcher = MatchSubstringSetState<SubstringSetMatcher>::Get(ctx);
+    applicator::ScalarUnaryNotNullStateful<Int32Type, InputType, MatchSubstringSetIndex>
+        kernel{MatchSubstringSetIndex(&matcher)};
+    return kernel.Exec(ctx, batch, out);
+  }
+};
+
+const FunctionDoc match_substring_set_doc(
+    "Match strings against a set of literal patterns",
+    ("For each string in `strings`, emit true iff it contains any of the given\n"
+     "patterns.  All patterns are searched for in a single pass over the data.\n"
+     "Null inputs emit null.\n"
+     "The patterns must be given in MatchSubstringSetOptions.\n"
+     "If ignore_case is set, only ASCII case folding is performed."),
+    {"strings"}, "MatchSubstringSetOptions", /*options_required=*/true);
+
+const FunctionDoc match_substring_set_index_doc(
+    "Find the first of a set of literal patterns contained in strings",
+    ("For each string in `strings`, emit the index in the given patterns of the\n"
+     "first pattern the string contains, or -1 if it contains none of them.\n"
+     "Null inputs emit null.\n"
+     "The patterns must be given in MatchSubstringSetOptions.\n"
+     "If ignore_case is set, only ASCII case folding is performed."),
+    {"strings"}, "MatchSubstringSetOptions", /*options_required=*/true);
+
+const FunctionDoc match_like_set_doc(
+    "Match strings against a set of SQL-style LIKE patterns",
+    ("For each string in `strings`, emit true iff it matches any of the given\n"
+     "LIKE patterns, with the same pattern syntax as \"match_like\".\n"
+     "Null inputs emit null.\n"
+     "The patterns must be given in MatchSubstringSetOptions.\n"
+     "If ignore_case is set, only ASCII case folding is performed."),
+    {"strings"}, "MatchSubstringSetOptions", /*options_required=*/true);
+
+void AddAsciiStringMatchSubstringSet(FunctionRegistry* registry) {
+  {
+    auto func = std::make_shared<ScalarFunction>("match_substring_set", Arity::Unary(),
+                                                 match_substring_set_doc);
+    for (const auto& ty : BaseBinaryTypes()) {
+      auto exec =
+          GenerateVarBinaryToVarBinary<MatchSubstringSet, SubstringSetMatcher>(ty);
+      DCHECK_OK(func->AddKernel({ty}, boolean(), std::move(exec),
+                                MatchSubstringSetState<SubstringSetMatcher>::Init));
+    }
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+  {
+    auto func = std::make_shared<ScalarFunction>(
+        "match_substring_set_index", Arity::Unary(), match_substring_set_index_doc);
+    for (const auto& ty : BaseBinaryTypes()) {
+      auto exec = GenerateVarBinaryToVarBinary<MatchSubstringSetIndexExec>(ty);
+      DCHECK_OK(func->AddKernel({ty}, int32(), std::move(exec),
+                                MatchSubstringSetState<SubstringSetMatcher>::Init));
+    }
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+  {
+    auto func = std::make_shared<ScalarFunction>("match_like_set", Arity::Unary(),
+                                                 match_like_set_doc);
+    for (const auto& ty : BaseBinaryTypes()) {
+      auto exec = GenerateVarBinaryToVarBinary<MatchSubstringSet, LikeSetMatcher>(ty);
+      DCHECK_OK(func->AddKernel({ty}, boolean(), std::move(exec),
+                                MatchSubstringSetState<LikeSetMatcher>::Init));
+    }
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+}
+
 // ----------------------------------------------------------------------
 // Substring find - lfind/index/etc.
 
@@ -3441,6 +3851,7 @@ void RegisterScalarStringAscii(FunctionRegistry* registry) {
   AddAsciiStringTrim(registry);
   AddAsciiStringPad(registry);
   AddAsciiStringMatchSubstring(registry);
+  AddAsciiStringMatchSubstringSet(registry);
   AddAsciiStringFindSubstring(registry);
   AddAsciiStringCountSubstring(registry);
   AddAsciiStringReplaceSubstring(registry);
@@ -30,6 +30,7 @@
 namespace arrow {
 
 using internal::checked_cast;
+using internal::checked_pointer_cast;
 
 namespace compute {
 
@@ -112,6 +113,55 @@ static void MatchLikeSuffix(benchmark::State& state) {
 }
 #endif
 
+static std::vector<std::string> MakeSubstringPatterns(int64_t num_patterns) {
+  random::RandomArrayGenerator rng(kSeed + 1);
+  auto patterns = checked_pointer_cast<StringArray>(
+      rng.String(num_patterns, /*min_length=*/4, /*max_length=*/8,
+                 /*null_probability=*/0));
+  std::vector<std::string> out;
+  for (int64_t i = 0; i < num_patterns; ++i) {
+    out.emplace_back(patterns->GetView(i));
+  }
+  return out;
+}
+
+// Search for all patterns in one pass
+static void MatchSubstringSet(benchmark::State& state) {
+  MatchSubstringSetOptions options(MakeSubstringPatterns(state.range(0)));
+  UnaryStringBenchmark(state, "match_substring_set", &options);
+}
+
+static void MatchLikeSet(benchmark::State& state) {
+  auto patterns = MakeSubstringPatterns(state.range(0));
+  for (auto& pattern : patterns) pattern = "%" + pattern + "%";
+  MatchSubstringSetOptions options(std::move(patterns));
+  UnaryStringBenchmark(state, "match_like_set", &options);
+}
+
+// Baseline for the above: one match_substring call per pattern, OR-ed together
+static void MatchSubstringOrChain(benchmark::State& state) {
+  const int64_t array_length = 1 << 20;
+  random::RandomArrayGenerator rng(kSeed);
+  auto values = rng.String(array_length, /*min_length=*/0, /*max_length=*/32,
+                           /*null_probability=*/0.01);
+  const auto patterns = MakeSubstringPatterns(state.range(0));
+
+  for (auto _ : state) {
+    Datum result;
+    for (const auto& pattern : patterns) {
+      MatchSubstringOptions options(pattern);
+      ASSIGN_OR_ABORT(auto matched, CallFunction("match_substring", {values}, &options));
+      if (result.is_value()) {
+        ASSIGN_OR_ABORT(result, CallFunction("or_kleene", {result, matched}));
+      } else {
+        result = std::move(matched);
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * array_length);
+  state.SetBytesProcessed(state.iterations() * values->data()->buffers[2]->size());
+}
+
 #ifdef ARROW_WITH_UTF8PROC
 static void Utf8Upper(benchmark::State& state) {
   UnaryStringBenchmark(state, "utf8_upper");
@@ -247,6 +297,9 @@ BENCHMARK(MatchLikeSubstring);
 BENCHMARK(MatchLikePrefix);
 BENCHMARK(MatchLikeSuffix);
 #endif
+BENCHMARK(MatchSubstringSet)->RangeMultiplier(8)->Range(1, 512);
+BENCHMARK(MatchLikeSet)->RangeMultiplier(8)->Range(1, 512);
+BENCHMARK(MatchSubstringOrChain)->RangeMultiplier(8)->Range(1, 512);
 #ifdef ARROW_WITH_UTF8PROC
 BENCHMARK(Utf8Lower);
 BENCHMARK(Utf8Upper);
@@ -1709,6 +1709,149 @@ TYPED_TEST(TestBaseBinaryKernels, MatchLikeEscaping) {
 }
 #endif
 
+TYPED_TEST(TestBaseBinaryKernels, MatchSubstringSet) {
+  MatchSubstringSetOptions options{{"abc", "bcd", "xy"}};
+  this->CheckUnary("match_substring_set", "[]", boolean(), "[]", &options);
+  this->CheckUnary("match_substring_set",
+                   R"(["abc", "abd", "zbcdz", null, "", "xxy", "ABC", "ab cd"])",
+                   boolean(), "[true, false, true, null, false, true, false, false]",
+                   &options);
+
+  // Overlapping patterns and patterns which are suffixes of each other
+  MatchSubstringSetOptions overlapping{{"aab", "ab", "bba", "aaaa"}};
+  this->CheckUnary("match_substring_set", R"(["a", "aa", "aab", "bbb", "bb a", "baaa"])",
+                   boolean(), "[false, false, true, false, false, false]", &overlapping);
+
+  // Any string contains the empty pattern
+  MatchSubstringSetOptions with_empty{{"foo", ""}};
+  this->CheckUnary("match_substring_set", R"(["", "bar", null])", boolean(),
+                   "[true, true, null]", &with_empty);
+
+  MatchSubstringSetOptions empty_set{{}};
+  this->CheckUnary("match_substring_set", R"(["", "bar", null])", boolean(),
+                   "[false, false, null]", &empty_set);
+
+  MatchSubstringSetOptions insensitive{{"aBc", "XY"}, /*ignore_case=*/true};
+  this->CheckUnary("match_substring_set", R"(["ABC", "xabcx", "xy", "ab", null])",
+                   boolean(), "[true, true, true, false, null]", &insensitive);
+}
+
+TYPED_TEST(TestBaseBinaryKernels, MatchSubstringSetLongInput) {
+  // Exercise the first-byte prefilter over inputs longer than a SIMD block
+  MatchSubstringSetOptions options{{"needle", "pin"}};
+  const std::string haystack(100, '.');
+  const std::string inputs = "[\"" + haystack + "\", \"" + haystack + "needle\", \"" +
+                             haystack + "pi\", \"" + haystack + "pin" + haystack + "\"]";
+  this->CheckUnary("match_substring_set", inputs, boolean(),
+                   "[false, true, false, true]", &options);
+}
+
+TEST(MatchSubstringSet, AllBytes) {
+  // Every byte value gets its own class, plus the class of unused bytes
+  std::vector<std::string> patterns;
+  BinaryBuilder builder;
+  for (int b = 0; b < 256; ++b) {
+    patterns.emplace_back(1, static_cast<char>(b));
+    ASSERT_OK(builder.Append("x" + patterns.back()));
+  }
+  ASSERT_OK_AND_ASSIGN(auto input, builder.Finish());
+  MatchSubstringSetOptions options{patterns};
+  ASSERT_OK_AND_ASSIGN(Datum out,
+                       CallFunction("match_substring_set_index", {input}, &options));
+  for (int b = 0; b < 256; ++b) {
+    // The lowest index of the matching patterns
+    const int32_t expected = std::min<int32_t>(b, 'x');
+    ASSERT_EQ(::arrow::internal::checked_cast<const Int32Array&>(*out.make_array())
+                  .Value(b),
+              expected)
+        << "byte " << b;
+  }
+}
+
+TYPED_TEST(TestBaseBinaryKernels, MatchSubstringSetIndex) {
+  MatchSubstringSetOptions options{{"bcd", "abc", "c"}};
+  this->CheckUnary("match_substring_set_index", "[]", int32(), "[]", &options);
+  this->CheckUnary("match_substring_set_index",
+                   R"(["abc", "abcd", "c", "xyz", null, "cabc"])", int32(),
+                   "[1, 0, 2, -1, null, 1]", &options);
+}
+
+TYPED_TEST(TestBaseBinaryKernels, MatchSubstringSetNoOptions) {
+  Datum input = ArrayFromJSON(this->type(), "[]");
+  ASSERT_RAISES(Invalid, CallFunction("match_substring_set", {input}));
+  ASSERT_RAISES(Invalid, CallFunction("match_like_set", {input}));
+}
+
+TYPED_TEST(TestBaseBinaryKernels, MatchLikeSet) {
+  auto inputs = R"(["foo", "bar", "foobar", "barfoo", "o", "\nfoo", "foo\n", null, ""])";
+
+  MatchSubstringSetOptions literals{{"foo%", "%bar"}};
+  this->CheckUnary("match_like_set", "[]", boolean(), "[]", &literals);
+  this->CheckUnary("match_like_set", inputs, boolean(),
+                   "[true, true, true, false, false, false, true, null, false]",
+                   &literals);
+
+  MatchSubstringSetOptions exact{{"foo", "o", ""}};
+  this->CheckUnary("match_like_set", inputs, boolean(),
+                   "[true, false, false, false, true, false, false, null, true]", &exact);
+
+  MatchSubstringSetOptions wildcards{{"f_o", "b%r%o", "%\n_%"}};
+  this->CheckUnary("match_like_set", inputs, boolean(),
+                   "[true, false, false, true, false, true, false, null, false]",
+                   &wildcards);
+
+  MatchSubstringSetOptions no_literal{{"___", "%%"}};
+  this->CheckUnary("match_like_set", inputs, boolean(),
+                   "[true, true, true, true, true, true, true, null, true]", &no_literal);
+  MatchSubstringSetOptions single_char{{"_"}};
+  this->CheckUnary("match_like_set", inputs, boolean(),
+                   "[false, false, false, false, true, false, false, null, false]",
+                   &single_char);
+
+  MatchSubstringSetOptions escaping{{"\\%%", "\\____", "\\\\%"}};
+  this->CheckUnary("match_like_set", R"(["%%foo", "_bar", "({", "\\baz", "%", "bar"])",
+                   boolean(), "[true, true, false, true, true, false]", &escaping);
+
+  MatchSubstringSetOptions insensitive{{"FOO%", "%b_R"}, /*ignore_case=*/true};
+  this->CheckUnary("match_like_set", inputs, boolean(),
+                   "[true, true, true, false, false, false, true, null, false]",
+                   &insensitive);
+}
+
+TYPED_TEST(TestStringKernels, MatchLikeSetUnicode) {
+  // '_' matches a single codepoint
+  MatchSubstringSetOptions options{{"_é_", "x_"}};
+  this->CheckUnary("match_like_set", R"(["aéb", "ééé", "aéb!", "xé", "xéé", "x"])",
+                   boolean(), "[true, true, false, true, false, false]", &options);
+}
+
+#ifdef ARROW_WITH_RE2
+TYPED_TEST(TestBaseBinaryKernels, MatchLikeSetMatchesMatchLike) {
+  // Compare against one match_like call per pattern
+  auto inputs = ArrayFromJSON(
+      this->type(),
+      R"(["foo", "bar", "foobar", "barfoo", "o", "fobaro", "ofo", "", null, "baaar"])");
+  std::vector<std::string> patterns = {"%o%a%", "_o%",   "%ar",  "ba%r",  "f%o",
+                                       "%aa%",  "o_o",  "___%", "%b_r%", "x%"};
+  for (size_t num_patterns = 1; num_patterns <= patterns.size(); ++num_patterns) {
+    std::vector<std::string> subset(patterns.begin(), patterns.begin() + num_patterns);
+    Datum expected;
+    for (const auto& pattern : subset) {
+      MatchSubstringOptions options{pattern};
+      ASSERT_OK_AND_ASSIGN(auto matched, CallFunction("match_like", {inputs}, &options));
+      if (expected.is_value()) {
+        ASSERT_OK_AND_ASSIGN(expected, CallFunction("or_kleene", {expected, matched}));
+      } else {
+        expected = matched;
+      }
+    }
+    MatchSubstringSetOptions options{subset};
+    ASSERT_OK_AND_ASSIGN(auto actual, CallFunction("match_like_set", {inputs}, &options));
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+}
+#endif
+
 TYPED_TEST(TestBaseBinaryKernels, SplitBasics) {
   SplitPatternOptions options{" "};
   // basics
@@ -0,0 +1,244 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/compute/kernels/vector_selection_internal.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_reader.h"
+#include "arrow/util/logging.h"
+
+namespace arrow::compute::internal::avx2 {
+
+namespace {
+
+using ::arrow::internal::BitmapUInt64Reader;
+
+// Below this many selected values in a 64-bit filter word, values are copied
+// one by one rather than compressed lane group by lane group
+constexpr int kMaxSparseWordPopCount = 4;
+
+// AVX2 has no compress instruction, so selected lanes are moved to the front
+// of the register with a permutation looked up by the lane mask.  Each entry
+// holds eight 32-bit lane indices, packed as bytes.
+constexpr std::array<uint64_t, 256> MakeCompressLut32() {
+  std::array<uint64_t, 256> lut{};
+  for (int mask = 0; mask < 256; ++mask) {
+    uint64_t entry = 0;
+    int out_lane = 0;
+    for (int lane = 0; lane < 8; ++lane) {
+      if (mask & (1 << lane)) {
+        entry |= static_cast<uint64_t>(lane) << (8 * out_lane++);
+      }
+    }
+    lut[mask] = entry;
+  }
+  return lut;
+}
+
+// Same for four 64-bit lanes, expressed as pairs of 32-bit lane indices
+constexpr std::array<uint64_t, 16> MakeCompressLut64() {
+  std::array<uint64_t, 16> lut{};
+  for (int mask = 0; mask < 16; ++mask) {
+    uint64_t entry = 0;
+    int out_lane = 0;
+    for (int lane = 0; lane < 4; ++lane) {
+      if (mask & (1 << lane)) {
+        entry |= static_cast<uint64_t>(2 * lane) << (8 * out_lane++);
+        entry |= static_cast<uint64_t>(2 * lane + 1) << (8 * out_lane++);
+      }
+    }
+    lut[mask] = entry;
+  }
+  return lut;
+}
+
+constexpr auto kCompressLut32 = MakeCompressLut32();
+constexpr auto kCompressLut64 = MakeCompressLut64();
+
+inline __m256i LoadPermutation(uint64_t entry) {
+  return _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<int64_t>(entry)));
+}
+
+template <typename CType>
+struct CompressTraits;
+
+template <>
+struct CompressTraits<uint32_t> {
+  static constexpr int kLanes = 8;
+  static __m256i Permutation(int mask) { return LoadPermutation(kCompressLut32[mask]); }
+};
+
+template <>
+struct CompressTraits<uint64_t> {
+  static constexpr int kLanes = 4;
+  static __m256i Permutation(int mask) { return LoadPermutation(kCompressLut64[mask]); }
+};
+
+template <typename CType>
+int64_t FilterValuesImpl(const uint8_t* filter_data, const uint8_t* filter_is_valid,
+                         int64_t filter_offset, int64_t length, const CType* values,
+                         CType* out, const CType* out_end) {
+  using Traits = CompressTraits<CType>;
+  constexpr int kLanes = Traits::kLanes;
+  constexpr uint64_t kLaneMask = (uint64_t{1} << kLanes) - 1;
+
+  BitmapUInt64Reader data_reader(filter_data, filter_offset, length);
+  BitmapUInt64Reader valid_reader(filter_is_valid, filter_offset,
+                                  filter_is_valid ? length : 0);
+  CType* out_start = out;
+  for (int64_t position = 0; position < length; position += 64) {
+    uint64_t word = data_reader.NextWord();
+    if (filter_is_valid) {
+      word &= valid_reader.NextWord();
+    }
+    if (word == 0) {
+      continue;
+    }
+    if (word == ~uint64_t{0}) {
+      memcpy(out, values + position, 64 * sizeof(CType));
+      out += 64;
+      continue;
+    }
+    if (bit_util::PopCount(word) <= kMaxSparseWordPopCount) {
+      // Few selected values: extracting them one by one is cheaper
+      do {
+        *out++ = values[position + bit_util::CountTrailingZeros(word)];
+        word &= word - 1;
+      } while (word != 0);
+      continue;
+    }
+    for (int lane = 0; lane < 64; lane += kLanes) {
+      const int mask = static_cast<int>((word >> lane) & kLaneMask);
+      if (mask == 0) {
+        continue;
+      }
+      const __m256i v = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(values + position + lane));
+      const __m256i compressed =
+          _mm256_permutevar8x32_epi32(v, Traits::Permutation(mask));
+      const int num_selected = bit_util::PopCount(static_cast<uint64_t>(mask));
+      if (ARROW_PREDICT_TRUE(out_end - out >= kLanes)) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), compressed);
+      } else {
+        // Don't write past the end of the output
+        alignas(32) CType tmp[kLanes];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(tmp), compressed);
+        memcpy(out, tmp, num_selected * sizeof(CType));
+      }
+      out += num_selected;
+    }
+  }
+  return out - out_start;
+}
+
+// The gather instructions take signed indices; the caller ensures that 32-bit
+// indices are below 2**31.
+
+inline void Gather(const uint32_t* values, const uint32_t* indices, uint32_t* out) {
+  const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices));
+  _mm256_storeu_si256(
+      reinterpret_cast<__m256i*>(out),
+      _mm256_i32gather_epi32(reinterpret_cast<const int*>(values), idx, 4));
+}
+
+inline void Gather(const uint32_t* values, const uint64_t* indices, uint32_t* out) {
+  const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices));
+  _mm_storeu_si128(
+      reinterpret_cast<__m128i*>(out),
+      _mm256_i64gather_epi32(reinterpret_cast<const int*>(values), idx, 4));
+}
+
+inline void Gather(const uint64_t* values, const uint32_t* indices, uint64_t* out) {
+  const __m128i idx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices));
+  _mm256_storeu_si256(
+      reinterpret_cast<__m256i*>(out),
+      _mm256_i32gather_epi64(reinterpret_cast<const long long*>(values), idx, 8));
+}
+
+inline void Gather(const uint64_t* values, const uint64_t* indices, uint64_t* out) {
+  const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices));
+  _mm256_storeu_si256(
+      reinterpret_cast<__m256i*>(out),
+      _mm256_i64gather_epi64(reinterpret_cast<const long long*>(values), idx, 8));
+}
+
+template <typename ValueCType, typename IndexCType>
+void TakeValuesImpl(const ValueCType* values, const IndexCType* indices, int64_t length,
+                    ValueCType* out) {
+  // One gather produces as many values as fit in a 256-bit register of
+  // whichever of the values or indices is wider
+  constexpr int kLanes = 32 / std::max(sizeof(ValueCType), sizeof(IndexCType));
+  int64_t position = 0;
+  for (; position + kLanes <= length; position += kLanes) {
+    Gather(values, indices + position, out + position);
+  }
+  for (; position < length; ++position) {
+    out[position] = values[indices[position]];
+  }
+}
+
+template <typename ValueCType>
+void TakeValuesImpl(int index_width, const uint8_t* values, const uint8_t* indices,
+                    int64_t length, uint8_t* out) {
+  if (index_width == 4) {
+    TakeValuesImpl(reinterpret_cast<const ValueCType*>(values),
+                   reinterpret_cast<const uint32_t*>(indices), length,
+                   reinterpret_cast<ValueCType*>(out));
+  } else {
+    DCHECK_EQ(index_width, 8);
+    TakeValuesImpl(reinterpret_cast<const ValueCType*>(values),
+                   reinterpret_cast<const uint64_t*>(indices), length,
+                   reinterpret_cast<ValueCType*>(out));
+  }
+}
+
+}  // namespace
+
+int64_t FilterValues(int byte_width, const uint8_t* filter_data,
+                     const uint8_t* filter_is_valid, int64_t filter_offset,
+                     int64_t length, const uint8_t* values, uint8_t* out,
+                     const uint8_t* out_end) {
+  if (byte_width == 4) {
+    return FilterValuesImpl(filter_data, filter_is_valid, filter_offset, length,
+                            reinterpret_cast<const uint32_t*>(values),
+                            reinterpret_cast<uint32_t*>(out),
+                            reinterpret_cast<const uint32_t*>(out_end));
+  }
+  DCHECK_EQ(byte_width, 8);
+  return FilterValuesImpl(filter_data, filter_is_valid, filter_offset, length,
+                          reinterpret_cast<const uint64_t*>(values),
+                          reinterpret_cast<uint64_t*>(out),
+                          reinterpret_cast<const uint64_t*>(out_end));
+}
+
+void TakeValues(int value_width, int index_width, const uint8_t* values,
+                const uint8_t* indices, int64_t length, uint8_t* out) {
+  if (value_width == 4) {
+    TakeValuesImpl<uint32_t>(index_width, values, indices, length, out);
+  } else {
+    DCHECK_EQ(value_width, 8);
+    TakeValuesImpl<uint64_t>(index_width, values, indices, length, out);
+  }
+}
+
+}  // namespace arrow::compute::internal::avx2
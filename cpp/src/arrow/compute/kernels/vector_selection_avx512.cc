@@ -0,0 +1,182 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/compute/kernels/vector_selection_internal.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_reader.h"
+#include "arrow/util/logging.h"
+
+namespace arrow::compute::internal::avx512 {
+
+namespace {
+
+using ::arrow::internal::BitmapUInt64Reader;
+
+// Below this many selected values in a 64-bit filter word, values are copied
+// one by one rather than compressed lane group by lane group
+constexpr int kMaxSparseWordPopCount = 4;
+
+// Compress into a register and store with a mask rather than using the
+// compress-store instructions, which are microcoded on some CPUs.
+
+inline void CompressStore(const uint32_t* values, uint64_t mask, uint32_t* out) {
+  const auto lane_mask = static_cast<__mmask16>(mask);
+  const __m512i compressed =
+      _mm512_maskz_compress_epi32(lane_mask, _mm512_loadu_si512(values));
+  const auto store_mask = static_cast<__mmask16>((1u << bit_util::PopCount(mask)) - 1);
+  _mm512_mask_storeu_epi32(out, store_mask, compressed);
+}
+
+inline void CompressStore(const uint64_t* values, uint64_t mask, uint64_t* out) {
+  const auto lane_mask = static_cast<__mmask8>(mask);
+  const __m512i compressed =
+      _mm512_maskz_compress_epi64(lane_mask, _mm512_loadu_si512(values));
+  const auto store_mask = static_cast<__mmask8>((1u << bit_util::PopCount(mask)) - 1);
+  _mm512_mask_storeu_epi64(out, store_mask, compressed);
+}
+
+template <typename CType>
+int64_t FilterValuesImpl(const uint8_t* filter_data, const uint8_t* filter_is_valid,
+                         int64_t filter_offset, int64_t length, const CType* values,
+                         CType* out) {
+  constexpr int kLanes = 64 / sizeof(CType);
+  constexpr uint64_t kLaneMask = (uint64_t{1} << kLanes) - 1;
+
+  BitmapUInt64Reader data_reader(filter_data, filter_offset, length);
+  BitmapUInt64Reader valid_reader(filter_is_valid, filter_offset,
+                                  filter_is_valid ? length : 0);
+  CType* out_start = out;
+  for (int64_t position = 0; position < length; position += 64) {
+    uint64_t word = data_reader.NextWord();
+    if (filter_is_valid) {
+      word &= valid_reader.NextWord();
+    }
+    if (word == 0) {
+      continue;
+    }
+    if (word == ~uint64_t{0}) {
+      memcpy(out, values + position, 64 * sizeof(CType));
+      out += 64;
+      continue;
+    }
+    if (bit_util::PopCount(word) <= kMaxSparseWordPopCount) {
+      // Few selected values: extracting them one by one is cheaper
+      do {
+        *out++ = values[position + bit_util::CountTrailingZeros(word)];
+        word &= word - 1;
+      } while (word != 0);
+      continue;
+    }
+    for (int lane = 0; lane < 64; lane += kLanes) {
+      const uint64_t mask = (word >> lane) & kLaneMask;
+      if (mask == 0) {
+        continue;
+      }
+      CompressStore(values + position + lane, mask, out);
+      out += bit_util::PopCount(mask);
+    }
+  }
+  return out - out_start;
+}
+
+// The gather instructions take signed indices; the caller ensures that 32-bit
+// indices are below 2**31.
+
+inline void Gather(const uint32_t* values, const uint32_t* indices, uint32_t* out) {
+  const __m512i idx = _mm512_loadu_si512(indices);
+  _mm512_storeu_si512(out, _mm512_i32gather_epi32(idx, values, 4));
+}
+
+inline void Gather(const uint32_t* values, const uint64_t* indices, uint32_t* out) {
+  const __m512i idx = _mm512_loadu_si512(indices);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+                      _mm512_i64gather_epi32(idx, values, 4));
+}
+
+inline void Gather(const uint64_t* values, const uint32_t* indices, uint64_t* out) {
+  const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices));
+  _mm512_storeu_si512(out, _mm512_i32gather_epi64(idx, values, 8));
+}
+
+inline void Gather(const uint64_t* values, const uint64_t* indices, uint64_t* out) {
+  const __m512i idx = _mm512_loadu_si512(indices);
+  _mm512_storeu_si512(out, _mm512_i64gather_epi64(idx, values, 8));
+}
+
+template <typename ValueCType, typename IndexCType>
+void TakeValuesImpl(const ValueCType* values, const IndexCType* indices, int64_t length,
+                    ValueCType* out) {
+  // One gather produces as many values as fit in a 512-bit register of
+  // whichever of the values or indices is wider
+  constexpr int kLanes = 64 / std::max(sizeof(ValueCType), sizeof(IndexCType));
+  int64_t position = 0;
+  for (; position + kLanes <= length; position += kLanes) {
+    Gather(values, indices + position, out + position);
+  }
+  for (; position < length; ++position) {
+    out[position] = values[indices[position]];
+  }
+}
+
+template <typename ValueCType>
+void TakeValuesImpl(int index_width, const uint8_t* values, const uint8_t* indices,
+                    int64_t length, uint8_t* out) {
+  if (index_width == 4) {
+    TakeValuesImpl(reinterpret_cast<const ValueCType*>(values),
+                   reinterpret_cast<const uint32_t*>(indices), length,
+                   reinterpret_cast<ValueCType*>(out));
+  } else {
+    DCHECK_EQ(index_width, 8);
+    TakeValuesImpl(reinterpret_cast<const ValueCType*>(values),
+                   reinterpret_cast<const uint64_t*>(indices), length,
+                   reinterpret_cast<ValueCType*>(out));
+  }
+}
+
+}  // namespace
+
+int64_t FilterValues(int byte_width, const uint8_t* filter_data,
+                     const uint8_t* filter_is_valid, int64_t filter_offset,
+                     int64_t length, const uint8_t* values, uint8_t* out) {
+  if (byte_width == 4) {
+    return FilterValuesImpl(filter_data, filter_is_valid, filter_offset, length,
+                            reinterpret_cast<const uint32_t*>(values),
+                            reinterpret_cast<uint32_t*>(out));
+  }
+  DCHECK_EQ(byte_width, 8);
+  return FilterValuesImpl(filter_data, filter_is_valid, filter_offset, length,
+                          reinterpret_cast<const uint64_t*>(values),
+                          reinterpret_cast<uint64_t*>(out));
+}
+
+void TakeValues(int value_width, int index_width, const uint8_t* values,
+                const uint8_t* indices, int64_t length, uint8_t* out) {
+  if (value_width == 4) {
+    TakeValuesImpl<uint32_t>(index_width, values, indices, length, out);
+  } else {
+    DCHECK_EQ(value_width, 8);
+    TakeValuesImpl<uint64_t>(index_width, values, indices, length, out);
+  }
+}
+
+}  // namespace arrow::compute::internal::avx512
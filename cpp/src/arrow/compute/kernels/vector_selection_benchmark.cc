@@ -138,6 +138,11 @@ struct TakeBenchmark {
     Bench(values);
   }
 
+  void Int32() {
+    auto values = rand.Int32(args.size, -100, 100, args.null_proportion);
+    Bench(values);
+  }
+
   void FSLInt64() {
     auto int_array = rand.Int64(args.size, -100, 100, args.null_proportion);
     auto values = std::make_shared<FixedSizeListArray>(
@@ -373,6 +378,28 @@ static void FilterRecordBatchWithNulls(benchmark::State& state) {
   FilterBenchmark(state, true).BenchRecordBatch();
 }
 
+// Filter fixed-width values without nulls across a range of selectivities,
+// where the vectorized filter kernels differ the most from the scalar ones
+template <typename ArrowType>
+static void FilterBySelectivity(benchmark::State& state) {
+  using CType = typename ArrowType::c_type;
+  const int64_t size = state.range(0);
+  const double selected_proportion = static_cast<double>(state.range(1)) / 100;
+  const int64_t array_size = size / sizeof(CType);
+
+  random::RandomArrayGenerator rand(kSeed);
+  auto values = rand.ArrayOf(TypeTraits<ArrowType>::type_singleton(), array_size,
+                             /*null_probability=*/0);
+  auto filter = rand.Boolean(array_size, selected_proportion, /*null_probability=*/0);
+  for (auto _ : state) {
+    ABORT_NOT_OK(Filter(values, filter).status());
+  }
+  state.counters["size"] = static_cast<double>(size);
+  state.counters["select%"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * size);
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
 static void TakeInt64RandomIndicesNoNulls(benchmark::State& state) {
   TakeBenchmark(state, /*indices_with_nulls=*/false).Int64();
 }
@@ -385,6 +412,14 @@ static void TakeInt64MonotonicIndices(benchmark::State& state) {
   TakeBenchmark(state, /*indices_with_nulls=*/false, /*monotonic=*/true).Int64();
 }
 
+static void TakeInt32RandomIndicesNoNulls(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/false).Int32();
+}
+
+static void TakeInt32MonotonicIndices(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/false, /*monotonic=*/true).Int32();
+}
+
 static void TakeFixedSizeBinaryRandomIndicesNoNulls(benchmark::State& state) {
   TakeBenchmark(state, /*indices_with_nulls=*/false).FixedSizeBinary();
 }
@@ -523,6 +558,18 @@ void FilterRecordBatchSetArgs(benchmark::internal::Benchmark* bench) {
 BENCHMARK(FilterRecordBatchNoNulls)->Apply(FilterRecordBatchSetArgs);
 BENCHMARK(FilterRecordBatchWithNulls)->Apply(FilterRecordBatchSetArgs);
 
+void FilterSelectivitySetArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t size : g_data_sizes) {
+    for (int64_t selected_percent : {1, 5, 10, 25, 50, 75, 90, 99, 100}) {
+      bench->Args({static_cast<ArgsType>(size), selected_percent});
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE(FilterBySelectivity, Int32Type)->Apply(FilterSelectivitySetArgs);
+BENCHMARK_TEMPLATE(FilterBySelectivity, Int64Type)->Apply(FilterSelectivitySetArgs);
+BENCHMARK_TEMPLATE(FilterBySelectivity, DoubleType)->Apply(FilterSelectivitySetArgs);
+
 void TakeSetArgs(benchmark::internal::Benchmark* bench) {
   for (int64_t size : g_data_sizes) {
     for (auto nulls : std::vector<ArgsType>({1000, 10, 2, 1, 0})) {
@@ -547,6 +594,8 @@ void TakeFSBSetArgs(benchmark::internal::Benchmark* bench) {
 BENCHMARK(TakeInt64RandomIndicesNoNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeInt64RandomIndicesWithNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeInt64MonotonicIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeInt32RandomIndicesNoNulls)->Apply(TakeSetArgs);
+BENCHMARK(TakeInt32MonotonicIndices)->Apply(TakeSetArgs);
 BENCHMARK(TakeFixedSizeBinaryRandomIndicesNoNulls)->Apply(TakeFSBSetArgs);
 BENCHMARK(TakeFixedSizeBinaryRandomIndicesWithNulls)->Apply(TakeFSBSetArgs);
 BENCHMARK(TakeFixedSizeBinaryMonotonicIndices)->Apply(TakeFSBSetArgs);
@@ -243,11 +243,31 @@ class PrimitiveFilterImpl {
     const auto filter_offset = filter_.offset;
     if (filter_.null_count == 0 && values_null_count_ == 0) {
       // Fast filter when values and filter are not null
+      const int64_t simd_length = ExecSimd(/*filter_is_valid=*/NULLPTR);
       ::arrow::internal::VisitSetBitRunsVoid(
-          filter_data, filter_.offset, values_length_,
-          [&](int64_t position, int64_t length) { WriteValueSegment(position, length); });
+          filter_data, filter_.offset + simd_length, values_length_ - simd_length,
+          [&](int64_t position, int64_t length) {
+            WriteValueSegment(simd_length + position, length);
+          });
       return;
     }
+    if (values_null_count_ == 0 && null_selection_ == FilterOptions::DROP) {
+      // Filter nulls are dropped like false values, so the output is all valid
+      const int64_t simd_length = ExecSimd(filter_is_valid);
+      if (simd_length > 0) {
+        for (int64_t i = simd_length; i < values_length_; ++i) {
+          const int64_t bit_index = filter_offset + i;
+          if (bit_util::GetBit(filter_data, bit_index) &&
+              (!filter_is_valid || bit_util::GetBit(filter_is_valid, bit_index))) {
+            WriteValue(i);
+          }
+        }
+        if (out_is_valid_) {
+          bit_util::SetBitsTo(out_is_valid_, 0, out_length_, true);
+        }
+        return;
+      }
+    }
 
     // Bit counters used for both null_selection behaviors
     DropNullCounter drop_null_counter(filter_is_valid, filter_data, filter_offset,
@@ -370,6 +390,26 @@ class PrimitiveFilterImpl {
     }    // while(in_position < values_length_)
   }
 
+  // Filter the leading multiple of 64 values with a vectorized kernel if one
+  // is available, and return the number of input values consumed
+  int64_t ExecSimd(const uint8_t* filter_is_valid) {
+    if constexpr (!kIsBoolean && (kByteWidth == 4 || kByteWidth == 8)) {
+      const int64_t length = values_length_ - values_length_ % 64;
+      if (length == 0) {
+        return 0;
+      }
+      const int64_t num_written = FilterFixedWidthValuesSimd(
+          kByteWidth, filter_.buffers[1].data, filter_is_valid, filter_.offset, length,
+          values_data_, out_data_ + out_position_ * kByteWidth,
+          out_data_ + out_length_ * kByteWidth);
+      if (num_written >= 0) {
+        out_position_ += num_written;
+        return length;
+      }
+    }
+    return 0;
+  }
+
   // Write the next out_position given the selected in_position for the input
   // data and advance out_position
   void WriteValue(int64_t in_position) {
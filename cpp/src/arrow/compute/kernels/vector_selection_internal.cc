@@ -37,6 +37,7 @@
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ree_util.h"
@@ -44,6 +45,7 @@
 namespace arrow {
 
 using internal::CheckIndexBounds;
+using internal::CpuInfo;
 
 namespace compute::internal {
 
@@ -83,6 +85,54 @@ Status PreallocatePrimitiveArrayData(KernelContext* ctx, int64_t length, int bit
   return Status::OK();
 }
 
+int64_t FilterFixedWidthValuesSimd(int byte_width, const uint8_t* filter_data,
+                                   const uint8_t* filter_is_valid, int64_t filter_offset,
+                                   int64_t length, const uint8_t* values, uint8_t* out,
+                                   const uint8_t* out_end) {
+  DCHECK_EQ(length % 64, 0);
+  if (byte_width != 4 && byte_width != 8) {
+    return -1;
+  }
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX512)) {
+    return avx512::FilterValues(byte_width, filter_data, filter_is_valid, filter_offset,
+                                length, values, out);
+  }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2)) {
+    return avx2::FilterValues(byte_width, filter_data, filter_is_valid, filter_offset,
+                              length, values, out, out_end);
+  }
+#endif
+  return -1;
+}
+
+bool TakeFixedWidthValuesSimd(int value_width, int index_width, const uint8_t* values,
+                              int64_t values_length, const uint8_t* indices,
+                              int64_t length, uint8_t* out) {
+  if ((value_width != 4 && value_width != 8) || (index_width != 4 && index_width != 8)) {
+    return false;
+  }
+  // Gather instructions take signed 32-bit indices
+  if (index_width == 4 && values_length > std::numeric_limits<int32_t>::max()) {
+    return false;
+  }
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX512)) {
+    avx512::TakeValues(value_width, index_width, values, indices, length, out);
+    return true;
+  }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2)) {
+    avx2::TakeValues(value_width, index_width, values, indices, length, out);
+    return true;
+  }
+#endif
+  return false;
+}
+
 namespace {
 
 /// \brief Iterate over a REE filter, emitting ranges of a plain values array that
@@ -70,6 +70,52 @@ void VisitPlainxREEFilterOutputSegments(
     FilterOptions::NullSelectionBehavior null_selection,
     const EmitREEFilterSegment& emit_segment);
 
+/// \brief Filter 4- or 8-byte values with a vectorized kernel, if available
+///
+/// A value is selected if its bit is set in `filter_data` and, if non-null, in
+/// `filter_is_valid`.  Selected values are written contiguously to `out`, which
+/// must not be written past `out_end`.
+///
+/// \param[in] length the number of values to filter, must be a multiple of 64
+/// \return the number of values written, or -1 if no vectorized kernel is
+/// available for this CPU and byte width (in which case nothing is written)
+int64_t FilterFixedWidthValuesSimd(int byte_width, const uint8_t* filter_data,
+                                   const uint8_t* filter_is_valid, int64_t filter_offset,
+                                   int64_t length, const uint8_t* values, uint8_t* out,
+                                   const uint8_t* out_end);
+
+/// \brief Take 4- or 8-byte values by 4- or 8-byte indices with a vectorized
+/// gather kernel, if available
+///
+/// All `length` indices must be non-null and smaller than `values_length`.
+///
+/// \return false if no vectorized kernel is available for this CPU, value
+/// width and index width (in which case nothing is written)
+bool TakeFixedWidthValuesSimd(int value_width, int index_width, const uint8_t* values,
+                              int64_t values_length, const uint8_t* indices,
+                              int64_t length, uint8_t* out);
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+namespace avx2 {
+int64_t FilterValues(int byte_width, const uint8_t* filter_data,
+                     const uint8_t* filter_is_valid, int64_t filter_offset,
+                     int64_t length, const uint8_t* values, uint8_t* out,
+                     const uint8_t* out_end);
+void TakeValues(int value_width, int index_width, const uint8_t* values,
+                const uint8_t* indices, int64_t length, uint8_t* out);
+}  // namespace avx2
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+namespace avx512 {
+int64_t FilterValues(int byte_width, const uint8_t* filter_data,
+                     const uint8_t* filter_is_valid, int64_t filter_offset,
+                     int64_t length, const uint8_t* values, uint8_t* out);
+void TakeValues(int value_width, int index_width, const uint8_t* values,
+                const uint8_t* indices, int64_t length, uint8_t* out);
+}  // namespace avx512
+#endif
+
 Status ListFilterExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status LargeListFilterExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status FSLFilterExec(KernelContext*, const ExecSpan&, ExecResult*);
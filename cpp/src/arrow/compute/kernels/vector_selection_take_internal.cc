@@ -387,6 +387,13 @@ struct PrimitiveTakeImpl {
         if (block.popcount == block.length) {
           // Fastest path: neither values nor index nulls
           bit_util::SetBitsTo(out_is_valid, out_offset + position, block.length, true);
+          if (TakeFixedWidthValuesSimd(
+                  kValueWidth, sizeof(IndexCType), values_data, values.length,
+                  reinterpret_cast<const uint8_t*>(indices_data + position), block.length,
+                  out + position * kValueWidth)) {
+            position += block.length;
+            continue;
+          }
           for (int64_t i = 0; i < block.length; ++i) {
             WriteValue(position);
             ++position;
@@ -582,6 +582,41 @@ TYPED_TEST(TestFilterKernelWithNumeric, ScalarInRangeAndFilterRandomNumeric) {
   }
 }
 
+TYPED_TEST(TestFilterKernelWithNumeric, FilterRandomSelectivities) {
+  // Exercise the vectorized filter paths, which process 64 values at a time,
+  // including a sliced filter and a trailing partial word
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+  using CType = typename TypeTraits<TypeParam>::CType;
+
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  const int64_t length = 1000;
+  auto array = checked_pointer_cast<ArrayType>(
+      rand.Numeric<TypeParam>(length, 0, 100, /*null_probability=*/0.0));
+  for (double selected_proportion : {0.0, 0.01, 0.1, 0.5, 0.9, 0.99, 1.0}) {
+    for (double filter_null_proportion : {0.0, 0.1}) {
+      ARROW_SCOPED_TRACE("selected = ", selected_proportion,
+                         ", filter nulls = ", filter_null_proportion);
+      auto filter = checked_pointer_cast<BooleanArray>(
+          rand.Boolean(length + 3, selected_proportion, filter_null_proportion)
+              ->Slice(3));
+      ASSERT_OK_AND_ASSIGN(Datum filtered, Filter(array, filter, this->drop_));
+      auto filtered_array = filtered.make_array();
+      ValidateOutput(*filtered_array);
+      int64_t i = 0;
+      auto expected =
+          CompareAndFilter<TypeParam>(array->raw_values(), length, [&](CType) {
+            const bool selected = filter->IsValid(i) && filter->Value(i);
+            ++i;
+            return selected;
+          });
+      ASSERT_ARRAYS_EQUAL(*filtered_array, *expected);
+      ASSERT_EQ(filtered_array->null_count(), 0);
+
+      ValidateFilter(array, filter);
+    }
+  }
+}
+
 template <typename ArrowType>
 class TestFilterKernelWithDecimal : public TestFilterKernel {
  protected:
@@ -1292,6 +1327,35 @@ TYPED_TEST(TestTakeKernelWithNumeric, TakeNumeric) {
   this->TestNumericBasics(this->type_singleton());
 }
 
+TYPED_TEST(TestTakeKernelWithNumeric, TakeRandomIndices) {
+  // Exercise the vectorized gather paths with all index widths
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  const int64_t length = 1000;
+  auto values = checked_pointer_cast<ArrayType>(
+      rand.Numeric<TypeParam>(length, 0, 100, /*null_probability=*/0.0));
+  for (const auto& index_type : {int8(), uint16(), int32(), uint32(), int64()}) {
+    ARROW_SCOPED_TRACE("index type = ", *index_type);
+    // int8 indices can only address the first 128 values
+    const int64_t max_index = index_type->id() == Type::INT8 ? 127 : length - 1;
+    ASSERT_OK_AND_ASSIGN(
+        auto indices, Cast(*rand.Int64(length + 5, 0, max_index, /*null_probability=*/0),
+                           index_type));
+    indices = indices->Slice(5);
+    ASSERT_OK_AND_ASSIGN(Datum taken, Take(values, indices));
+    auto taken_array = checked_pointer_cast<ArrayType>(taken.make_array());
+    ValidateOutput(*taken_array);
+    ASSERT_EQ(taken_array->length(), length);
+    ASSERT_EQ(taken_array->null_count(), 0);
+    ASSERT_OK_AND_ASSIGN(auto int64_indices, Cast(*indices, int64()));
+    const auto& raw_indices = checked_cast<const Int64Array&>(*int64_indices);
+    for (int64_t i = 0; i < length; ++i) {
+      ASSERT_EQ(taken_array->Value(i), values->Value(raw_indices.Value(i))) << i;
+    }
+  }
+}
+
 template <typename TypeClass>
 class TestTakeKernelWithString : public TestTakeKernelTyped<TypeClass> {
  public:
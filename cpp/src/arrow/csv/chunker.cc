@@ -23,6 +23,7 @@
 #include <string_view>
 #include <utility>
 
+#include "arrow/buffer.h"
 #include "arrow/csv/lexing_internal.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
@@ -52,7 +53,9 @@ class Lexer {
     DCHECK_EQ(SpecializedOptions::escaping, options_.escaping);
   }
 
-  void Reset() { state_ = FIELD_START; }
+  void Reset(State state = FIELD_START) { state_ = state; }
+
+  State state() const { return state_; }
 
   // Decide whether it's worth using a bulk filter over the given data area
   bool ShouldUseBulkFilter(const char* data, const char* data_end) {
@@ -369,8 +372,130 @@ class LexingBoundaryFinder : public BoundaryFinder {
   Lexer<SpecializedOptions> lexer_;
 };
 
+template <typename SpecializedOptions>
+class SpeculativeLexer {
+ public:
+  using LexerType = Lexer<SpecializedOptions>;
+
+  // The lexer states at the start of a block that are speculated on
+  static constexpr typename LexerType::State kAssumedStates[2] = {
+      LexerType::IN_FIELD, LexerType::IN_QUOTED_FIELD};
+
+  explicit SpeculativeLexer(const ParseOptions& options)
+      : options_(options), lexer_(options_) {}
+
+  SpeculativeBoundaries FindBoundaries(std::string_view block) {
+    SpeculativeBoundaries boundaries;
+    const int num_assumptions = SpecializedOptions::quoting ? 2 : 1;
+    for (int i = 0; i < num_assumptions; ++i) {
+      const char* data = block.data();
+      const char* const data_end = block.data() + block.size();
+      lexer_.Reset(kAssumedStates[i]);
+      while (data < data_end) {
+        const char* line_end = lexer_.ReadLine(data, data_end);
+        if (line_end == nullptr) {
+          break;
+        }
+        if (boundaries.first_pos[i] < 0) {
+          boundaries.first_pos[i] = line_end - block.data();
+        }
+        data = line_end;
+      }
+      if (data != block.data()) {
+        boundaries.last_pos[i] = data - block.data();
+      }
+    }
+    return boundaries;
+  }
+
+  bool Chunk(const SpeculativeBoundaries& boundaries,
+             const std::shared_ptr<Buffer>& partial, const std::shared_ptr<Buffer>& block,
+             std::shared_ptr<Buffer>* completion, std::shared_ptr<Buffer>* whole,
+             std::shared_ptr<Buffer>* next_partial) {
+    if (block->size() == 0) {
+      return false;
+    }
+    lexer_.Reset();
+    if (partial->size() > 0) {
+      const char* data = reinterpret_cast<const char*>(partial->data());
+      const char* line_end = lexer_.ReadLine(data, data + partial->size());
+      DCHECK_EQ(line_end, nullptr);  // Otherwise `partial` is a whole CSV line
+    }
+    auto state = lexer_.state();
+    if (state == LexerType::FIELD_START &&
+        !(SpecializedOptions::quoting && block->data()[0] == options_.quote_char)) {
+      // Same as being in a non-quoted field, as no quoted value can start here
+      state = LexerType::IN_FIELD;
+    }
+    int assumption;
+    if (state == kAssumedStates[0]) {
+      assumption = 0;
+    } else if (SpecializedOptions::quoting && state == kAssumedStates[1]) {
+      assumption = 1;
+    } else {
+      return false;
+    }
+    const int64_t first_pos = boundaries.first_pos[assumption];
+    const int64_t last_pos = boundaries.last_pos[assumption];
+    if (first_pos < 0) {
+      return false;
+    }
+    if (partial->size() == 0) {
+      // As in Chunker::ProcessWithPartial, no completion is needed
+      *completion = SliceBuffer(block, 0, 0);
+      *whole = SliceBuffer(block, 0, last_pos);
+    } else {
+      *completion = SliceBuffer(block, 0, first_pos);
+      *whole = SliceBuffer(block, first_pos, last_pos - first_pos);
+    }
+    *next_partial = SliceBuffer(block, last_pos);
+    return true;
+  }
+
+ protected:
+  ParseOptions options_;
+  LexerType lexer_;
+};
+
+template <typename Visitor>
+decltype(auto) VisitSpecializedOptions(const ParseOptions& options, Visitor&& visit) {
+  if (options.quoting) {
+    if (options.escaping) {
+      return visit(internal::SpecializedOptions<true, true>{});
+    } else {
+      return visit(internal::SpecializedOptions<true, false>{});
+    }
+  } else {
+    if (options.escaping) {
+      return visit(internal::SpecializedOptions<false, true>{});
+    } else {
+      return visit(internal::SpecializedOptions<false, false>{});
+    }
+  }
+}
+
 }  // namespace
 
+SpeculativeBoundaries FindSpeculativeBoundaries(const ParseOptions& options,
+                                                std::string_view block) {
+  return VisitSpecializedOptions(options, [&](auto specialized) {
+    SpeculativeLexer<decltype(specialized)> lexer(options);
+    return lexer.FindBoundaries(block);
+  });
+}
+
+bool ChunkSpeculative(const ParseOptions& options,
+                      const SpeculativeBoundaries& boundaries,
+                      const std::shared_ptr<Buffer>& partial,
+                      const std::shared_ptr<Buffer>& block,
+                      std::shared_ptr<Buffer>* completion, std::shared_ptr<Buffer>* whole,
+                      std::shared_ptr<Buffer>* next_partial) {
+  return VisitSpecializedOptions(options, [&](auto specialized) {
+    SpeculativeLexer<decltype(specialized)> lexer(options);
+    return lexer.Chunk(boundaries, partial, block, completion, whole, next_partial);
+  });
+}
+
 std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options) {
   std::shared_ptr<BoundaryFinder> delimiter;
   if (!options.newlines_in_values) {
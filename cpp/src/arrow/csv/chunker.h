@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string_view>
 
 #include "arrow/csv/options.h"
 #include "arrow/status.h"
@@ -32,5 +33,49 @@ namespace csv {
 ARROW_EXPORT
 std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options);
 
+/// \brief Line boundaries of a CSV block, found without knowing the preceding data
+///
+/// When values may contain newlines, whether a newline ends a line depends on
+/// whether it is inside a quoted value, which is only known after lexing all
+/// the preceding data.  Instead of lexing serially, each block can be lexed
+/// independently (and in parallel) under both possible assumptions about its
+/// start: outside or inside a quoted value.  Once the preceding data is known,
+/// ChunkSpeculative() selects the right interpretation.
+struct SpeculativeBoundaries {
+  /// \brief Positions just after the first and last line separators in the
+  /// block, or -1 if none was found
+  ///
+  /// Index 0 assumes the block starts outside of a quoted value, index 1
+  /// assumes it starts inside of a quoted value.
+  int64_t first_pos[2] = {-1, -1};
+  int64_t last_pos[2] = {-1, -1};
+};
+
+/// \brief Lex a CSV block under both assumptions about its starting state
+///
+/// This doesn't depend on any other block and can therefore be called
+/// concurrently for different blocks.
+ARROW_EXPORT
+SpeculativeBoundaries FindSpeculativeBoundaries(const ParseOptions& options,
+                                                std::string_view block);
+
+/// \brief Chunk a CSV block using its speculative boundaries
+///
+/// This is equivalent to Chunker::ProcessWithPartial() followed by
+/// Chunker::Process() on the remainder, but only `partial` is lexed to
+/// determine the state at the start of `block`.
+///
+/// Returns false if the state after `partial` isn't covered by the speculative
+/// boundaries (for example if `partial` ends with an escape character), or if
+/// `block` contains no line separator.  The caller should then fall back on a
+/// regular Chunker.
+ARROW_EXPORT
+bool ChunkSpeculative(const ParseOptions& options,
+                      const SpeculativeBoundaries& boundaries,
+                      const std::shared_ptr<Buffer>& partial,
+                      const std::shared_ptr<Buffer>& block,
+                      std::shared_ptr<Buffer>* completion, std::shared_ptr<Buffer>* whole,
+                      std::shared_ptr<Buffer>* next_partial);
+
 }  // namespace csv
 }  // namespace arrow
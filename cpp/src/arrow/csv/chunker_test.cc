@@ -379,5 +379,63 @@ TEST_P(BaseChunkerTest, ParseSkip) {
   }
 }
 
+// Chunk `csv` split in buffers of `block_size` bytes, in the same way as the
+// threaded CSV reader, and check that speculative chunking gives the same results
+// as the regular chunker.
+void AssertSpeculativeChunking(const ParseOptions& options, const std::string& csv,
+                               int64_t block_size) {
+  auto buffer = std::make_shared<Buffer>(csv);
+  auto chunker = MakeChunker(options);
+  auto partial = std::make_shared<Buffer>("");
+  int64_t num_speculated = 0;
+  for (int64_t offset = 0; offset + block_size < buffer->size(); offset += block_size) {
+    auto block = SliceBuffer(buffer, offset, block_size);
+    std::shared_ptr<Buffer> completion, whole, next_partial, starts_with_whole;
+    auto st =
+        chunker->ProcessWithPartial(partial, block, &completion, &starts_with_whole);
+    if (!st.ok()) {
+      // Straddling object too large for the block size
+      return;
+    }
+    ASSERT_OK(chunker->Process(starts_with_whole, &whole, &next_partial));
+
+    auto boundaries = FindSpeculativeBoundaries(options, std::string_view(*block));
+    std::shared_ptr<Buffer> spec_completion, spec_whole, spec_next_partial;
+    if (ChunkSpeculative(options, boundaries, partial, block, &spec_completion,
+                         &spec_whole, &spec_next_partial)) {
+      ++num_speculated;
+      AssertBufferEqual(*completion, *spec_completion);
+      AssertBufferEqual(*whole, *spec_whole);
+      AssertBufferEqual(*next_partial, *spec_next_partial);
+      ASSERT_EQ(whole->data(), spec_whole->data());
+    }
+    partial = next_partial;
+  }
+  if (csv.size() > static_cast<size_t>(2 * block_size)) {
+    ASSERT_GT(num_speculated, 0);
+  }
+}
+
+TEST(SpeculativeChunker, Basics) {
+  auto options = ParseOptions::Defaults();
+  options.newlines_in_values = true;
+  std::string csv;
+  for (int i = 0; i < 30; ++i) {
+    csv += "ab,\"c\nd\",\"e,\"\"f\"\"\n\"\n";
+    csv += std::string(i % 7, 'x') + ",\"\",\"\"\"\"\r\n";
+    csv += "\"\"\"g\nh\",i,\"\n\n\"\n";
+  }
+  for (int64_t block_size = 1; block_size < 80; ++block_size) {
+    ARROW_SCOPED_TRACE("block_size = ", block_size);
+    ASSERT_NO_FATAL_FAILURE(AssertSpeculativeChunking(options, csv, block_size));
+  }
+  options.escaping = true;
+  csv += "a\\\n\"b\\\"\n\",c\n";
+  for (int64_t block_size = 1; block_size < 80; ++block_size) {
+    ARROW_SCOPED_TRACE("block_size = ", block_size);
+    ASSERT_NO_FATAL_FAILURE(AssertSpeculativeChunking(options, csv, block_size));
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -18,8 +18,13 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
+#include <string>
 
 #include "arrow/csv/options.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/byte_classifier_internal.h"
+#include "arrow/util/macros.h"
 #include "arrow/util/simd.h"
 
 namespace arrow {
@@ -208,6 +213,164 @@ template <typename SpecializedOptions>
 using PreferredBulkFilterType = BloomFilter4B<SpecializedOptions>;
 #endif
 
+//
+// Structural index: rather than looking for special characters as the parser
+// goes, classify 64 bytes at a time into bitmasks of delimiters, line
+// separators and quotes, from which field boundaries are read with
+// count-trailing-zeros.
+//
+
+// Finds the structural characters of CSV lines, i.e. the delimiters and line
+// separators outside of quoted values.
+//
+// Quoted regions are computed from the parity of the quotes before each
+// character, which only matches the parser's state machine if quotes are used
+// in a well-formed way: opening quotes at the start of a field (or right after a
+// closing quote, for double quoting), closing quotes followed by a delimiter, a
+// line separator or another quote. Other quotes make the indexer give up, so
+// that the line is parsed by the state machine. Escaping is not supported.
+//
+// The masks are computed with the best instruction set available at runtime,
+// see ::arrow::internal::ByteClassifier::IsVectorized().
+template <typename SpecializedOptions>
+class StructuralIndexer {
+ public:
+  static constexpr int64_t kBlockSize = ::arrow::internal::ByteClassifier::kBlockSize;
+
+  explicit StructuralIndexer(const ParseOptions& options)
+      : delimiter_(options.delimiter),
+        quote_char_(options.quote_char),
+        double_quote_(options.double_quote),
+        filler_(MakeFiller(options)),
+        classifier_(MakeClassifier(options)) {}
+
+  // Start indexing `data`, which must be at the start of a line
+  void Reset(const char* data, const char* data_end) {
+    data_end_ = data_end;
+    in_quotes_carry_ = 0;
+    before_opening_carry_ = 1;
+    LoadBlock(data);
+  }
+
+  // Return the first structural character at or after `pos`, or null if
+  // there is none before the end of the data or if quoting is not well-formed.
+  //
+  // Successive calls must be made with non-decreasing positions.
+  ARROW_FORCE_INLINE const char* Next(const char* pos) {
+    const int64_t offset = pos - block_;
+    if (ARROW_PREDICT_TRUE(offset < kBlockSize)) {
+      const uint64_t from_pos = ~uint64_t{0} << offset;
+      const uint64_t structural = structural_ & from_pos;
+      if (ARROW_PREDICT_TRUE(structural != 0)) {
+        // Up to and including the first structural bit
+        const uint64_t up_to = structural ^ (structural - 1);
+        if (ARROW_PREDICT_FALSE((invalid_ & from_pos & up_to) != 0)) {
+          return nullptr;
+        }
+        return block_ + bit_util::CountTrailingZeros(structural);
+      }
+    }
+    return NextInFollowingBlocks(pos);
+  }
+
+ private:
+  ARROW_NOINLINE const char* NextInFollowingBlocks(const char* pos) {
+    while (true) {
+      const int64_t offset = pos - block_;
+      const uint64_t from_pos = offset <= 0 ? ~uint64_t{0}
+                                : offset >= kBlockSize ? 0
+                                                       : ~uint64_t{0} << offset;
+      const uint64_t structural = structural_ & from_pos;
+      const uint64_t invalid = invalid_ & from_pos;
+      if (structural != 0) {
+        if ((invalid & (structural ^ (structural - 1))) != 0) {
+          return nullptr;
+        }
+        return block_ + bit_util::CountTrailingZeros(structural);
+      }
+      if (invalid != 0 || block_ + kBlockSize >= data_end_) {
+        return nullptr;
+      }
+      LoadBlock(block_ + kBlockSize);
+    }
+  }
+
+  // A character that is not special, to pad the last block
+  static char MakeFiller(const ParseOptions& options) {
+    for (char c : {'\0', 'a', 'b', 'c'}) {
+      if (c != options.delimiter && c != options.quote_char) {
+        return c;
+      }
+    }
+    return 'd';
+  }
+
+  // Delimiters, line separators and quotes
+  static ::arrow::internal::ByteClassifier MakeClassifier(const ParseOptions& options) {
+    using ::arrow::internal::ByteClassifier;
+    return ByteClassifier(
+        {ByteClassifier::Chars(std::string(1, options.delimiter)),
+         ByteClassifier::Chars("\r\n"),
+         ByteClassifier::Chars(SpecializedOptions::quoting
+                                   ? std::string(1, options.quote_char)
+                                   : std::string())});
+  }
+
+  void LoadBlock(const char* block) {
+    block_ = block;
+    uint64_t masks[3];
+    if (ARROW_PREDICT_TRUE(data_end_ - block >= kBlockSize)) {
+      classifier_.Classify(block, masks);
+    } else {
+      char padded[kBlockSize];
+      std::memset(padded, filler_, kBlockSize);
+      std::memcpy(padded, block, data_end_ - block);
+      classifier_.Classify(padded, masks);
+    }
+    const uint64_t delimiters = masks[0];
+    const uint64_t newlines = masks[1];
+    const uint64_t quotes = masks[2];
+
+    // Characters preceded by an odd number of quotes are inside quotes
+    const uint64_t in_quotes = classifier_.PrefixXor(quotes) ^ in_quotes_carry_;
+    in_quotes_carry_ = static_cast<uint64_t>(static_cast<int64_t>(in_quotes) >> 63);
+    structural_ = (delimiters | newlines) & ~in_quotes;
+
+    if (SpecializedOptions::quoting) {
+      const uint64_t opening = quotes & in_quotes;
+      const uint64_t closing = quotes & ~in_quotes;
+      const uint64_t before_opening =
+          double_quote_ ? (structural_ | closing) : structural_;
+      uint64_t after_closing = (structural_ | quotes) >> 1;
+      if (block + kBlockSize < data_end_) {
+        const char next = block[kBlockSize];
+        if (next == delimiter_ || next == quote_char_ || next == '\r' || next == '\n') {
+          after_closing |= uint64_t{1} << 63;
+        }
+      }
+      invalid_ = (opening & ~((before_opening << 1) | before_opening_carry_)) |
+                 (closing & ~after_closing);
+      before_opening_carry_ = before_opening >> 63;
+    }
+  }
+
+  const char delimiter_;
+  const char quote_char_;
+  const bool double_quote_;
+  const char filler_;
+  const ::arrow::internal::ByteClassifier classifier_;
+
+  const char* data_end_;
+  // The current block and its masks
+  const char* block_;
+  uint64_t structural_;
+  uint64_t invalid_ = 0;
+  // All ones if the end of the previous block was inside quotes
+  uint64_t in_quotes_carry_;
+  // Whether an opening quote would be valid at the start of the current block
+  uint64_t before_opening_carry_;
+};
+
 }  // namespace internal
 }  // namespace csv
 }  // namespace arrow
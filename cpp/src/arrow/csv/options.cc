@@ -46,7 +46,12 @@ ConvertOptions ConvertOptions::Defaults() {
   return options;
 }
 
-Status ConvertOptions::Validate() const { return Status::OK(); }
+Status ConvertOptions::Validate() const {
+  if (ARROW_PREDICT_FALSE(row_filter && row_filter_columns.empty())) {
+    return Status::Invalid("ConvertOptions: row_filter requires row_filter_columns");
+  }
+  return Status::OK();
+}
 
 ReadOptions ReadOptions::Defaults() { return ReadOptions(); }
 
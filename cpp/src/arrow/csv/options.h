@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -26,7 +27,9 @@
 #include "arrow/csv/invalid_row.h"
 #include "arrow/csv/type_fwd.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -69,6 +72,11 @@ struct ARROW_EXPORT ParseOptions {
   Status Validate() const;
 };
 
+/// \brief A predicate over some converted columns, returning a boolean array
+/// selecting the rows to keep
+using RowFilter = std::function<Result<std::shared_ptr<Array>>(
+    const std::shared_ptr<RecordBatch>&)>;
+
 struct ARROW_EXPORT ConvertOptions {
   // Conversion options
 
@@ -120,6 +128,19 @@ struct ARROW_EXPORT ConvertOptions {
   /// This option is ignored if `include_columns` is empty.
   bool include_missing_columns = false;
 
+  /// \brief Optional predicate selecting rows before the bulk of the conversion
+  ///
+  /// If set, the columns named in `row_filter_columns` are converted first for
+  /// each block and passed to this function, which returns a boolean array with
+  /// one value per row. Only rows for which it is true (not false or null) are
+  /// converted in the other columns and returned by the reader.
+  ///
+  /// Type inference, if any, only sees the selected rows of the other columns.
+  /// This is only supported by the streaming reader.
+  RowFilter row_filter;
+  /// The names of the columns passed to `row_filter`, among the columns read.
+  std::vector<std::string> row_filter_columns;
+
   /// User-defined timestamp parsers, using the virtual parser interface in
   /// arrow/util/value_parsing.h. More than one parser can be specified, and
   /// the CSV conversion logic will try parsing values starting from the
@@ -209,6 +230,13 @@ struct ARROW_EXPORT WriteOptions {
   /// \brief Quoting style
   QuotingStyle quoting_style = QuotingStyle::Needed;
 
+  /// \brief Whether to use the global CPU thread pool
+  ///
+  /// If true, several batches of `batch_size` rows are converted to CSV
+  /// concurrently. Output order is preserved. This is off by default since
+  /// writers are often driven from tasks already running on the CPU thread pool.
+  bool use_threads = false;
+
   /// Create write options with default values
   static WriteOptions Defaults();
 
@@ -22,10 +22,13 @@
 #include <limits>
 #include <utility>
 
+#include "arrow/array/array_primitive.h"
 #include "arrow/csv/lexing_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/simd.h"
 
@@ -88,6 +91,21 @@ class PresizedDataWriter {
     parsed_size_ += sizeof(w);
   }
 
+  // Push `length` bytes; `available` bytes may be read from `data`
+  void PushFieldBytes(const char* data, int64_t length, int64_t available) {
+    DCHECK_GE(parsed_capacity_ - parsed_size_, length);
+    constexpr int64_t kShortCopySize = 16;
+    if (length <= kShortCopySize && available >= kShortCopySize &&
+        parsed_capacity_ - parsed_size_ >= kShortCopySize) {
+      // Most values are short: a fixed-size copy avoids calling memcpy,
+      // and any bytes past `length` are overwritten by the next value.
+      memcpy(parsed_ + parsed_size_, data, kShortCopySize);
+    } else {
+      memcpy(parsed_ + parsed_size_, data, length);
+    }
+    parsed_size_ += length;
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
@@ -196,6 +214,80 @@ class BlockParserImpl {
 
   int64_t first_row_num() const { return first_row_; }
 
+  MemoryPool* pool() const { return pool_; }
+
+  const ParseOptions& options() const { return options_; }
+
+  int32_t max_num_rows() const { return max_num_rows_; }
+
+  // Make the parsed batch a view of the rows of `batch` which are set in the
+  // `selection` bitmap, sharing its parsed data.
+  void InitFiltered(const DataBatch& batch, const uint8_t* selection,
+                    int64_t selection_offset) {
+    const int32_t num_cols = batch.num_cols_;
+    batch_ = DataBatch{num_cols};
+    batch_.parsed_buffer_ = batch.parsed_buffer_;
+    batch_.parsed_ = batch.parsed_;
+    batch_.parsed_size_ = batch.parsed_size_;
+    values_size_ = 0;
+
+    // The first row of each values buffer, and the end of the last one
+    std::vector<int32_t> buffer_rows(1, 0);
+    for (const auto& values_buffer : batch.values_buffers_) {
+      const auto num_values =
+          static_cast<int32_t>(values_buffer->size() / sizeof(ParsedValueDesc) - 1);
+      buffer_rows.push_back(buffer_rows.back() + num_values / num_cols);
+    }
+    DCHECK_EQ(buffer_rows.back(), batch.num_rows_);
+
+    // The rows left out are recorded as skipped, so that errors can be reported
+    // with their original row numbers
+    const bool record_skipped = first_row_ >= 0;
+    auto skipped = batch.skipped_rows_.begin();
+    int32_t row = 0;
+    size_t buffer_index = 0;
+    auto select_rows = [&](int64_t position, int64_t length) {
+      const auto run_start = static_cast<int32_t>(position);
+      const auto run_end = static_cast<int32_t>(position + length);
+      if (record_skipped) {
+        for (; skipped != batch.skipped_rows_.end() && *skipped <= run_start; ++skipped) {
+          batch_.skipped_rows_.push_back(batch_.num_rows_);
+        }
+        batch_.skipped_rows_.insert(batch_.skipped_rows_.end(), run_start - row,
+                                    batch_.num_rows_);
+        for (; skipped != batch.skipped_rows_.end() && *skipped < run_end; ++skipped) {
+          batch_.skipped_rows_.push_back(batch_.num_rows_ + *skipped - run_start);
+        }
+      }
+      // Slice the values of the selected rows, one values buffer at a time
+      row = run_start;
+      while (row < run_end) {
+        while (buffer_rows[buffer_index + 1] <= row) {
+          ++buffer_index;
+        }
+        const int32_t first = row - buffer_rows[buffer_index];
+        const int32_t last = std::min(run_end, buffer_rows[buffer_index + 1]) -
+                             buffer_rows[buffer_index];
+        const int64_t num_values = static_cast<int64_t>(last - first) * num_cols;
+        batch_.values_buffers_.push_back(SliceBuffer(
+            batch.values_buffers_[buffer_index],
+            static_cast<int64_t>(first) * num_cols * sizeof(ParsedValueDesc),
+            (num_values + 1) * sizeof(ParsedValueDesc)));
+        values_size_ += static_cast<int32_t>(num_values);
+        row += last - first;
+      }
+      batch_.num_rows_ += run_end - run_start;
+    };
+    ::arrow::internal::VisitSetBitRunsVoid(selection, selection_offset, batch.num_rows_,
+                                           select_rows);
+    if (record_skipped) {
+      batch_.skipped_rows_.insert(batch_.skipped_rows_.end(),
+                                  (batch.skipped_rows_.end() - skipped) +
+                                      (batch.num_rows_ - row),
+                                  batch_.num_rows_);
+    }
+  }
+
   template <typename ValueDescWriter, typename DataWriter>
   Status HandleInvalidRow(ValueDescWriter* values_writer, DataWriter* parsed_writer,
                           const char* start, const char* data, int32_t num_cols,
@@ -425,6 +517,97 @@ class BlockParserImpl {
     return Status::OK();
   }
 
+  // Parse a line using the field boundaries found by a structural indexer.
+  //
+  // Returns false, with the parser state unchanged, if the line must be parsed
+  // by ParseLine() instead: empty line, unusual quoting, incomplete line at the
+  // end of the block, or wrong number of columns.
+  template <typename SpecializedOptions, typename ValueDescWriter, typename DataWriter>
+  bool ParseLineStructural(ValueDescWriter* values_writer, DataWriter* parsed_writer,
+                           const char* data, const char* data_end,
+                           internal::StructuralIndexer<SpecializedOptions>* indexer,
+                           const char** out_data) {
+    const char c = *data;
+    if (ARROW_PREDICT_FALSE(c == '\r' || c == '\n')) {
+      return false;
+    }
+    values_writer->BeginLine();
+    parsed_writer->BeginLine();
+
+    auto Abort = [&]() {
+      values_writer->RollbackLine();
+      parsed_writer->RollbackLine();
+      return false;
+    };
+
+    int32_t num_cols = 0;
+    while (true) {
+      if (ARROW_PREDICT_FALSE(num_cols == batch_.num_cols_)) {
+        // Too many columns
+        return Abort();
+      }
+      const char* field_end = indexer->Next(data);
+      if (ARROW_PREDICT_FALSE(field_end == nullptr)) {
+        return Abort();
+      }
+      if (SpecializedOptions::quoting && field_end > data &&
+          *data == options_.quote_char) {
+        // The indexer ensures that the field ends with a closing quote
+        // and any other quotes are doubled
+        values_writer->StartField(true /* quoted */);
+        const char* quoted = data + 1;
+        const char* quoted_end = field_end - 1;
+        while (true) {
+          const char* quote = FindQuote(quoted, quoted_end);
+          if (quote == nullptr) {
+            break;
+          }
+          parsed_writer->PushFieldBytes(quoted, quote - quoted + 1, data_end - quoted);
+          quoted = quote + 2;
+        }
+        parsed_writer->PushFieldBytes(quoted, quoted_end - quoted, data_end - quoted);
+      } else {
+        values_writer->StartField(false /* quoted */);
+        parsed_writer->PushFieldBytes(data, field_end - data, data_end - data);
+      }
+      values_writer->FinishField(parsed_writer);
+      ++num_cols;
+      data = field_end + 1;
+      if (*field_end != options_.delimiter) {
+        // End of line
+        if (*field_end == '\r' && data < data_end && *data == '\n') {
+          ++data;
+        }
+        break;
+      }
+      if (ARROW_PREDICT_FALSE(data == data_end)) {
+        return Abort();
+      }
+    }
+
+    if (ARROW_PREDICT_FALSE(num_cols != batch_.num_cols_)) {
+      if (batch_.num_cols_ != -1) {
+        return Abort();
+      }
+      batch_.num_cols_ = num_cols;
+    }
+    ++batch_.num_rows_;
+    *out_data = data;
+    return true;
+  }
+
+  const char* FindQuote(const char* data, const char* data_end) const {
+    if (data_end - data <= 16) {
+      for (; data < data_end; ++data) {
+        if (*data == options_.quote_char) {
+          return data;
+        }
+      }
+      return nullptr;
+    }
+    return static_cast<const char*>(memchr(data, options_.quote_char, data_end - data));
+  }
+
   template <typename DataWriter, typename SpecializedBulkFilter>
   const char* RunBulkFilter(DataWriter* data_writer, const char* data,
                             const char* data_end,
@@ -458,7 +641,32 @@ class BlockParserImpl {
     const int32_t start_num_rows = batch_.num_rows_;
     const int32_t num_rows_deadline = batch_.num_rows_ + rows_in_chunk;
 
-    if (use_bulk_filter_) {
+    // Without SIMD, the structural indexer is slower than the state machine
+    if (!SpecializedOptions::escaping && data < data_end &&
+        ::arrow::internal::ByteClassifier::IsVectorized()) {
+      internal::StructuralIndexer<SpecializedOptions> indexer(options_);
+      indexer.Reset(data, data_end);
+      while (data < data_end && batch_.num_rows_ < num_rows_deadline) {
+        const char* line_end = data;
+        if (ParseLineStructural(values_writer, parsed_writer, data, data_end, &indexer,
+                                &line_end)) {
+          data = line_end;
+          continue;
+        }
+        RETURN_NOT_OK((ParseLine<SpecializedOptions, false>(values_writer, parsed_writer,
+                                                            data, data_end, is_final,
+                                                            &line_end, bulk_filter)));
+        if (line_end == data) {
+          // Cannot parse any further
+          *finished_parsing = true;
+          break;
+        }
+        data = line_end;
+        if (data < data_end) {
+          indexer.Reset(data, data_end);
+        }
+      }
+    } else if (use_bulk_filter_) {
       while (data < data_end && batch_.num_rows_ < num_rows_deadline) {
         const char* line_end = data;
         RETURN_NOT_OK((ParseLine<SpecializedOptions, true>(values_writer, parsed_writer,
@@ -672,6 +880,31 @@ const DataBatch& BlockParser::parsed_batch() const { return impl_->parsed_batch(
 
 int64_t BlockParser::first_row_num() const { return impl_->first_row_num(); }
 
+Result<std::shared_ptr<BlockParser>> BlockParser::Filter(
+    const BooleanArray& selection) const {
+  if (selection.length() != num_rows()) {
+    return Status::Invalid("Row selection has length ", selection.length(),
+                           ", expected ", num_rows());
+  }
+  const uint8_t* selection_bits = selection.values()->data();
+  int64_t selection_offset = selection.offset();
+  std::shared_ptr<Buffer> selected_and_valid;
+  if (selection.null_count() > 0) {
+    ARROW_ASSIGN_OR_RAISE(
+        selected_and_valid,
+        ::arrow::internal::BitmapAnd(impl_->pool(), selection_bits, selection_offset,
+                                     selection.null_bitmap_data(), selection_offset,
+                                     selection.length(), /*out_offset=*/0));
+    selection_bits = selected_and_valid->data();
+    selection_offset = 0;
+  }
+  auto filtered =
+      std::make_shared<BlockParser>(impl_->pool(), impl_->options(), num_cols(),
+                                    first_row_num(), impl_->max_num_rows());
+  filtered->impl_->InitFiltered(parsed_batch(), selection_bits, selection_offset);
+  return filtered;
+}
+
 int32_t SkipRows(const uint8_t* data, uint32_t size, int32_t num_rows,
                  const uint8_t** out_data) {
   const auto end = data + size;
@@ -27,6 +27,7 @@
 #include "arrow/buffer.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/type_fwd.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
@@ -218,6 +219,13 @@ class ARROW_EXPORT BlockParser {
     return parsed_batch().VisitLastRow(std::forward<Visitor>(visit));
   }
 
+  /// \brief Return a parser over the parsed rows selected by a boolean array
+  ///
+  /// Rows whose selection value is false or null are left out. The returned
+  /// parser shares the parsed data with this one and reports the original
+  /// row numbers in errors.
+  Result<std::shared_ptr<BlockParser>> Filter(const BooleanArray& selection) const;
+
  protected:
   std::unique_ptr<BlockParserImpl> impl_;
 
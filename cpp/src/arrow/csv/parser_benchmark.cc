@@ -224,6 +224,41 @@ static void ParseCSVStocksExample(
   BenchmarkCSVParsing(state, stocks_example, ParseOptions::Defaults());
 }
 
+// Rows of `num_cols` values of `value_length` characters, exercising the
+// structural index on long or many fields
+static std::string BuildWideCSVData(int32_t num_cols, int32_t value_length,
+                                    bool quoted) {
+  std::string value(value_length, 'x');
+  if (quoted) {
+    value = "\"" + value + "\"";
+  }
+  std::stringstream ss;
+  for (int32_t i = 0; i < kNumRows; ++i) {
+    for (int32_t j = 0; j < num_cols; ++j) {
+      ss << value << (j + 1 < num_cols ? ',' : '\n');
+    }
+  }
+  return ss.str();
+}
+
+static void ParseCSVLongValues(benchmark::State& state) {  // NOLINT non-const reference
+  const bool quoted = state.range(0) != 0;
+  auto options = ParseOptions::Defaults();
+  options.quoting = quoted;
+  options.escaping = false;
+
+  BenchmarkCSVParsing(state, BuildWideCSVData(4, 100, quoted), kNumRows, options);
+}
+
+static void ParseCSVWideRows(benchmark::State& state) {  // NOLINT non-const reference
+  const bool quoted = state.range(0) != 0;
+  auto options = ParseOptions::Defaults();
+  options.quoting = quoted;
+  options.escaping = false;
+
+  BenchmarkCSVParsing(state, BuildWideCSVData(100, 4, quoted), kNumRows, options);
+}
+
 BENCHMARK(ChunkCSVQuotedBlock);
 BENCHMARK(ChunkCSVEscapedBlock);
 BENCHMARK(ChunkCSVNoNewlinesBlock);
@@ -236,6 +271,8 @@ BENCHMARK(ParseCSVEscapedBlock);
 BENCHMARK(ParseCSVFlightsExample);
 BENCHMARK(ParseCSVVehiclesExample);
 BENCHMARK(ParseCSVStocksExample);
+BENCHMARK(ParseCSVLongValues)->ArgName("quoted")->Arg(0)->Arg(1);
+BENCHMARK(ParseCSVWideRows)->ArgName("quoted")->Arg(0)->Arg(1);
 
 }  // namespace csv
 }  // namespace arrow
@@ -24,13 +24,19 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/builder_primitive.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/csv/test_common.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace csv {
 
 void CheckSkipRows(const std::string& rows, int32_t num_rows,
@@ -586,6 +592,37 @@ TEST(BlockParser, QuotesSpecial) {
   }
 }
 
+TEST(BlockParser, QuotingLongValues) {
+  // Quoted values spanning several 64-byte blocks, mixed with regular and
+  // special quoting, and with line separators on block boundaries
+  const std::string long_value(150, 'x');
+  const std::string long_quoted = long_value + ",\n" + long_value;
+  std::vector<std::string> col1, col2, col3;
+  std::vector<bool> quoted1, quoted2, quoted3;
+  std::string csv;
+  for (int i = 0; i < 20; ++i) {
+    const std::string prefix(i + 1, 'a');
+    csv += prefix + ",\"" + long_value + ",\n" + long_value + "\",\"x\"\"y\"\r\n";
+    col1.push_back(prefix);
+    col2.push_back(long_quoted);
+    col3.push_back("x\"y");
+    quoted1.push_back(false);
+    quoted2.push_back(true);
+    quoted3.push_back(true);
+
+    csv += prefix + "\"b," + long_value + ",\"" + long_value + "\"c\n";
+    col1.push_back(prefix + "\"b");
+    col2.push_back(long_value);
+    col3.push_back(long_value + "c");
+    quoted1.push_back(false);
+    quoted2.push_back(false);
+    quoted3.push_back(true);
+  }
+  BlockParser parser(ParseOptions::Defaults());
+  AssertParseOk(parser, csv);
+  AssertColumnsEq(parser, {col1, col2, col3}, {quoted1, quoted2, quoted3});
+}
+
 TEST(BlockParser, MismatchingNumColumns) {
   uint32_t out_size;
   {
@@ -853,5 +890,69 @@ TEST(BlockParser, RowNumberAppendedToError) {
   }
 }
 
+TEST(BlockParser, Filter) {
+  auto csv = MakeCSVData({"ab,cd\n", "ef,gh\n", "ij,kl\n", "mn,op\n", "qr,st\n"});
+  BlockParser parser(ParseOptions::Defaults(), -1, /*first_row=*/1);
+  ASSERT_NO_FATAL_FAILURE(AssertParseOk(parser, csv));
+  {
+    auto selection = ArrayFromJSON(boolean(), "[true, false, null, true, true]");
+    ASSERT_OK_AND_ASSIGN(auto filtered,
+                         parser.Filter(checked_cast<const BooleanArray&>(*selection)));
+    AssertColumnsEq(*filtered, {{"ab", "mn", "qr"}, {"cd", "op", "st"}});
+    ASSERT_EQ(filtered->total_num_rows(), parser.total_num_rows());
+    ASSERT_EQ(filtered->first_row_num(), parser.first_row_num());
+
+    // Errors report the row numbers of the unfiltered data
+    int row = 0;
+    auto status = filtered->VisitColumn(
+        0, [row](const uint8_t* data, uint32_t size, bool quoted) mutable -> Status {
+          return ++row == 2 ? Status::Invalid("Bad value") : Status::OK();
+        });
+    EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr("Row #4: Bad value"),
+                                    status);
+  }
+  {
+    auto selection = ArrayFromJSON(boolean(), "[false, false, false, false, false]");
+    ASSERT_OK_AND_ASSIGN(auto filtered,
+                         parser.Filter(checked_cast<const BooleanArray&>(*selection)));
+    AssertColumnsEq(*filtered, {{}, {}});
+  }
+  {
+    auto selection = ArrayFromJSON(boolean(), "[true, false]");
+    ASSERT_RAISES(Invalid, parser.Filter(checked_cast<const BooleanArray&>(*selection)));
+  }
+}
+
+TEST(BlockParser, FilterAcrossValuesBuffers) {
+  // Enough rows to fill several values buffers
+  constexpr int32_t kNumCols = 100;
+  constexpr int32_t kNumRows = 2000;
+  std::string csv;
+  std::vector<std::string> expected_first, expected_last;
+  std::vector<bool> selected;
+  for (int32_t row = 0; row < kNumRows; ++row) {
+    for (int32_t col = 0; col < kNumCols; ++col) {
+      csv += std::to_string(row * kNumCols + col);
+      csv += (col == kNumCols - 1) ? "\n" : ",";
+    }
+    selected.push_back(row % 7 == 0 || (row > 400 && row < 1200));
+    if (selected.back()) {
+      expected_first.push_back(std::to_string(row * kNumCols));
+      expected_last.push_back(std::to_string(row * kNumCols + kNumCols - 1));
+    }
+  }
+  BlockParser parser(ParseOptions::Defaults());
+  ASSERT_NO_FATAL_FAILURE(AssertParseOk(parser, csv));
+  ASSERT_EQ(parser.num_rows(), kNumRows);
+
+  BooleanBuilder builder;
+  ASSERT_OK(builder.AppendValues(selected));
+  ASSERT_OK_AND_ASSIGN(auto selection, builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto filtered,
+                       parser.Filter(checked_cast<const BooleanArray&>(*selection)));
+  AssertColumnEq(*filtered, 0, expected_first);
+  AssertColumnEq(*filtered, kNumCols - 1, expected_last);
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -31,11 +31,13 @@
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/csv/chunker.h"
 #include "arrow/csv/column_builder.h"
 #include "arrow/csv/column_decoder.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
+#include "arrow/datum.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -152,6 +154,13 @@ struct CSVBlock {
   std::function<Status(int64_t)> consume_bytes;
 };
 
+// A buffer of CSV data, along with its speculatively computed line boundaries
+// if available
+struct SpeculatedBuffer {
+  std::shared_ptr<Buffer> buffer;
+  Future<SpeculativeBoundaries> boundaries;
+};
+
 }  // namespace
 }  // namespace csv
 
@@ -161,6 +170,12 @@ struct IterationTraits<csv::CSVBlock> {
   static bool IsEnd(const csv::CSVBlock& val) { return val.block_index < 0; }
 };
 
+template <>
+struct IterationTraits<csv::SpeculatedBuffer> {
+  static csv::SpeculatedBuffer End() { return csv::SpeculatedBuffer{}; }
+  static bool IsEnd(const csv::SpeculatedBuffer& val) { return val.buffer == nullptr; }
+};
+
 namespace csv {
 namespace {
 
@@ -277,32 +292,74 @@ class SerialBlockReader : public BlockReader {
 };
 
 // An object that reads delimited CSV blocks for threaded use.
+//
+// When values can contain newlines, finding the delimited blocks requires lexing
+// all the data.  To avoid doing so serially, upcoming buffers are lexed in parallel
+// under both possible assumptions about their start (see FindSpeculativeBoundaries),
+// and only the end of the previous buffer needs to be lexed here.
 class ThreadedBlockReader : public BlockReader {
  public:
-  using BlockReader::BlockReader;
+  ThreadedBlockReader(std::unique_ptr<Chunker> chunker,
+                      std::shared_ptr<Buffer> first_buffer, int64_t skip_rows,
+                      ParseOptions parse_options)
+      : BlockReader(std::move(chunker), std::move(first_buffer), skip_rows),
+        parse_options_(std::move(parse_options)) {}
 
   static AsyncGenerator<CSVBlock> MakeAsyncIterator(
       AsyncGenerator<std::shared_ptr<Buffer>> buffer_generator,
       std::unique_ptr<Chunker> chunker, std::shared_ptr<Buffer> first_buffer,
-      int64_t skip_rows) {
-    auto block_reader = std::make_shared<ThreadedBlockReader>(std::move(chunker),
-                                                              first_buffer, skip_rows);
+      int64_t skip_rows, const ParseOptions& parse_options, Executor* cpu_executor) {
+    auto block_reader = std::make_shared<ThreadedBlockReader>(
+        std::move(chunker), first_buffer, skip_rows, parse_options);
+
+    AsyncGenerator<SpeculatedBuffer> speculated_generator;
+    if (parse_options.newlines_in_values) {
+      auto speculate =
+          [parse_options, cpu_executor](
+              const std::shared_ptr<Buffer>& buffer) -> Result<SpeculatedBuffer> {
+        ARROW_ASSIGN_OR_RAISE(
+            auto boundaries, cpu_executor->Submit([parse_options, buffer] {
+              return FindSpeculativeBoundaries(parse_options, std::string_view(*buffer));
+            }));
+        return SpeculatedBuffer{buffer, std::move(boundaries)};
+      };
+      // Start lexing several buffers ahead, then wait for each in order
+      auto pending_generator = MakeSerialReadaheadGenerator(
+          MakeMappedGenerator(std::move(buffer_generator), std::move(speculate)),
+          cpu_executor->GetCapacity());
+      speculated_generator = MakeMappedGenerator(
+          std::move(pending_generator), [](const SpeculatedBuffer& pending) {
+            return pending.boundaries.Then(
+                [pending](const SpeculativeBoundaries&) { return pending; });
+          });
+    } else {
+      speculated_generator = MakeMappedGenerator(
+          std::move(buffer_generator), [](const std::shared_ptr<Buffer>& buffer) {
+            return SpeculatedBuffer{buffer, {}};
+          });
+    }
+
     // Wrap shared pointer in callable
-    Transformer<std::shared_ptr<Buffer>, CSVBlock> block_reader_fn =
-        [block_reader](std::shared_ptr<Buffer> next) { return (*block_reader)(next); };
-    return MakeTransformedGenerator(std::move(buffer_generator), block_reader_fn);
+    Transformer<SpeculatedBuffer, CSVBlock> block_reader_fn =
+        [block_reader](SpeculatedBuffer next) {
+          return (*block_reader)(std::move(next));
+        };
+    return MakeTransformedGenerator(std::move(speculated_generator), block_reader_fn);
   }
 
-  Result<TransformFlow<CSVBlock>> operator()(std::shared_ptr<Buffer> next_buffer) {
+  Result<TransformFlow<CSVBlock>> operator()(SpeculatedBuffer next) {
     if (buffer_ == nullptr) {
       // EOF
       return TransformFinish();
     }
 
+    auto next_buffer = std::move(next.buffer);
     bool is_final = (next_buffer == nullptr);
 
     auto current_partial = std::move(partial_);
     auto current_buffer = std::move(buffer_);
+    auto current_boundaries = std::move(boundaries_);
+    boundaries_ = std::move(next.boundaries);
     int64_t bytes_skipped = 0;
 
     if (skip_rows_) {
@@ -312,6 +369,8 @@ class ThreadedBlockReader : public BlockReader {
                                           &skip_rows_, &current_buffer));
       bytes_skipped += orig_size - current_buffer->size();
       current_partial = std::make_shared<Buffer>(nullptr, 0);
+      // The speculative boundaries don't apply to the remaining buffer
+      current_boundaries = {};
       if (skip_rows_) {
         partial_ = std::move(current_buffer);
         buffer_ = std::move(next_buffer);
@@ -332,15 +391,22 @@ class ThreadedBlockReader : public BlockReader {
       RETURN_NOT_OK(
           chunker_->ProcessFinal(current_partial, current_buffer, &completion, &whole));
     } else {
-      // Get completion of partial from previous block.
-      std::shared_ptr<Buffer> starts_with_whole;
-      // Get completion of partial from previous block.
-      RETURN_NOT_OK(chunker_->ProcessWithPartial(current_partial, current_buffer,
-                                                 &completion, &starts_with_whole));
-
-      // Get a complete CSV block inside `partial + block`, and keep
-      // the rest for the next iteration.
-      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &whole, &next_partial));
+      bool chunked = false;
+      if (current_boundaries.is_valid()) {
+        ARROW_ASSIGN_OR_RAISE(auto boundaries, current_boundaries.result());
+        chunked = ChunkSpeculative(parse_options_, boundaries, current_partial,
+                                   current_buffer, &completion, &whole, &next_partial);
+      }
+      if (!chunked) {
+        std::shared_ptr<Buffer> starts_with_whole;
+        // Get completion of partial from previous block.
+        RETURN_NOT_OK(chunker_->ProcessWithPartial(current_partial, current_buffer,
+                                                   &completion, &starts_with_whole));
+
+        // Get a complete CSV block inside `partial + block`, and keep
+        // the rest for the next iteration.
+        RETURN_NOT_OK(chunker_->Process(starts_with_whole, &whole, &next_partial));
+      }
     }
 
     partial_ = std::move(next_partial);
@@ -349,6 +415,11 @@ class ThreadedBlockReader : public BlockReader {
     return TransformYield<CSVBlock>(CSVBlock{
         current_partial, completion, whole, block_index_++, is_final, bytes_skipped, {}});
   }
+
+ protected:
+  ParseOptions parse_options_;
+  // The speculative boundaries of `buffer_`, if any
+  Future<SpeculativeBoundaries> boundaries_;
 };
 
 struct ParsedBlock {
@@ -468,6 +539,9 @@ class BlockDecodingOperator {
  public:
   Future<DecodedBlock> operator()(const ParsedBlock& block) {
     DCHECK(!state_->column_decoders.empty());
+    if (state_->convert_options.row_filter) {
+      return DecodeFiltered(block);
+    }
     std::vector<Future<std::shared_ptr<Array>>> decoded_array_futs;
     for (auto& decoder : state_->column_decoders) {
       decoded_array_futs.push_back(decoder->Decode(block.parser));
@@ -494,10 +568,63 @@ class BlockDecodingOperator {
     BlockDecodingOperator op(std::move(io_context), std::move(convert_options),
                              std::move(conversion_schema));
     RETURN_NOT_OK(op.state_->MakeColumnDecoders(io_context));
+    RETURN_NOT_OK(op.state_->FindRowFilterColumns());
     return op;
   }
 
  private:
+  // Decode the row filter columns, then the other columns for the selected rows only
+  Future<DecodedBlock> DecodeFiltered(const ParsedBlock& block) {
+    std::vector<Future<std::shared_ptr<Array>>> filter_array_futs;
+    for (int index : state_->filter_indices) {
+      filter_array_futs.push_back(state_->column_decoders[index]->Decode(block.parser));
+    }
+    auto state = state_;
+    auto parser = block.parser;
+    auto bytes_parsed_or_skipped = block.bytes_parsed_or_skipped;
+    return All(std::move(filter_array_futs))
+        .Then([state, parser, bytes_parsed_or_skipped](
+                  const std::vector<Result<std::shared_ptr<Array>>>& maybe_filter_arrays)
+                  -> Future<DecodedBlock> {
+          ARROW_ASSIGN_OR_RAISE(auto filter_arrays,
+                                arrow::internal::UnwrapOrRaise(maybe_filter_arrays));
+          ARROW_ASSIGN_OR_RAISE(auto selection, state->SelectRows(filter_arrays,
+                                                                  parser->num_rows()));
+          std::shared_ptr<BlockParser> filtered_parser = parser;
+          if (selection->true_count() < parser->num_rows()) {
+            ARROW_ASSIGN_OR_RAISE(filtered_parser, parser->Filter(*selection));
+            for (auto& array : filter_arrays) {
+              ARROW_ASSIGN_OR_RAISE(auto filtered, compute::Filter(array, selection));
+              array = filtered.make_array();
+            }
+          }
+
+          std::vector<Future<std::shared_ptr<Array>>> other_array_futs;
+          for (int index : state->other_indices) {
+            other_array_futs.push_back(
+                state->column_decoders[index]->Decode(filtered_parser));
+          }
+          return All(std::move(other_array_futs))
+              .Then([state, filter_arrays, bytes_parsed_or_skipped](
+                        const std::vector<Result<std::shared_ptr<Array>>>&
+                            maybe_other_arrays) -> Result<DecodedBlock> {
+                ARROW_ASSIGN_OR_RAISE(auto other_arrays,
+                                      arrow::internal::UnwrapOrRaise(maybe_other_arrays));
+                std::vector<std::shared_ptr<Array>> decoded_arrays(
+                    state->column_decoders.size());
+                for (size_t i = 0; i < filter_arrays.size(); ++i) {
+                  decoded_arrays[state->filter_indices[i]] = filter_arrays[i];
+                }
+                for (size_t i = 0; i < other_arrays.size(); ++i) {
+                  decoded_arrays[state->other_indices[i]] = std::move(other_arrays[i]);
+                }
+                ARROW_ASSIGN_OR_RAISE(
+                    auto batch, state->DecodedArraysToBatch(std::move(decoded_arrays)));
+                return DecodedBlock{std::move(batch), bytes_parsed_or_skipped};
+              });
+        });
+  }
+
   BlockDecodingOperator(io::IOContext io_context, ConvertOptions convert_options,
                         ConversionSchema conversion_schema)
       : state_(std::make_shared<State>(std::move(io_context), std::move(convert_options),
@@ -531,6 +658,53 @@ class BlockDecodingOperator {
       return RecordBatch::Make(schema, n_rows, std::move(arrays));
     }
 
+    // Split the columns between those given to the row filter and the others
+    Status FindRowFilterColumns() {
+      if (!convert_options.row_filter) {
+        return Status::OK();
+      }
+      std::unordered_map<std::string, int> indices;
+      for (int i = 0; i < static_cast<int>(conversion_schema.columns.size()); ++i) {
+        indices.emplace(conversion_schema.columns[i].name, i);
+      }
+      std::vector<bool> is_filter_column(conversion_schema.columns.size(), false);
+      for (const auto& name : convert_options.row_filter_columns) {
+        auto it = indices.find(name);
+        if (it == indices.end()) {
+          return Status::KeyError("Column '", name, "' in row_filter_columns ",
+                                  "is not read from the CSV file");
+        }
+        filter_indices.push_back(it->second);
+        is_filter_column[it->second] = true;
+      }
+      for (int i = 0; i < static_cast<int>(conversion_schema.columns.size()); ++i) {
+        if (!is_filter_column[i]) {
+          other_indices.push_back(i);
+        }
+      }
+      return Status::OK();
+    }
+
+    // Apply the row filter to the decoded filter columns
+    Result<std::shared_ptr<BooleanArray>> SelectRows(
+        const std::vector<std::shared_ptr<Array>>& filter_arrays, int64_t num_rows) {
+      FieldVector fields(filter_arrays.size());
+      for (size_t i = 0; i < filter_arrays.size(); ++i) {
+        fields[i] = field(conversion_schema.columns[filter_indices[i]].name,
+                          filter_arrays[i]->type());
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          auto selection,
+          convert_options.row_filter(RecordBatch::Make(arrow::schema(std::move(fields)),
+                                                       num_rows, filter_arrays)));
+      if (selection->type_id() != Type::BOOL || selection->length() != num_rows) {
+        return Status::Invalid(
+            "CSV row filter should return a boolean array of length ", num_rows,
+            ", got ", *selection->type(), " array of length ", selection->length());
+      }
+      return std::static_pointer_cast<BooleanArray>(std::move(selection));
+    }
+
     // Make column decoders from conversion schema
     Status MakeColumnDecoders(io::IOContext io_context) {
       for (const auto& column : conversion_schema.columns) {
@@ -556,6 +730,9 @@ class BlockDecodingOperator {
     ConversionSchema conversion_schema;
     std::vector<std::shared_ptr<ColumnDecoder>> column_decoders;
     std::shared_ptr<Schema> schema;
+    // Positions of the columns given to the row filter, and of the others
+    std::vector<int> filter_indices;
+    std::vector<int> other_indices;
   };
 
   std::shared_ptr<State> state_;
@@ -1054,7 +1231,8 @@ class AsyncThreadedTableReader
     return ProcessFirstBuffer().Then([self](const std::shared_ptr<Buffer>& first_buffer) {
       auto block_generator = ThreadedBlockReader::MakeAsyncIterator(
           self->buffer_generator_, MakeChunker(self->parse_options_),
-          std::move(first_buffer), self->read_options_.skip_rows_after_names);
+          std::move(first_buffer), self->read_options_.skip_rows_after_names,
+          self->parse_options_, self->cpu_executor_);
 
       std::function<Status(CSVBlock)> block_visitor =
           [self](CSVBlock maybe_block) -> Status {
@@ -1111,6 +1289,10 @@ Result<std::shared_ptr<TableReader>> MakeTableReader(
   RETURN_NOT_OK(parse_options.Validate());
   RETURN_NOT_OK(read_options.Validate());
   RETURN_NOT_OK(convert_options.Validate());
+  if (convert_options.row_filter) {
+    return Status::NotImplemented(
+        "CSV row filters are only supported by StreamingReader");
+  }
   std::shared_ptr<BaseTableReader> reader;
   if (read_options.use_threads) {
     auto cpu_executor = arrow::internal::GetCpuThreadPool();
@@ -17,6 +17,7 @@
 
 #include "arrow/csv/reader.h"
 
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <atomic>
@@ -26,6 +27,7 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array/builder_primitive.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/test_common.h"
 #include "arrow/io/interfaces.h"
@@ -35,10 +37,14 @@
 #include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/thread_pool.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace csv {
 
 // Allows the streaming reader to be used in tests that expect a table reader
@@ -206,6 +212,34 @@ void TestInvalidRowsSkipped(TableReaderFactory reader_factory, bool async) {
   ASSERT_EQ(NINVALID, num_invalid_rows);
 }
 
+void TestNewlinesInValues(TableReaderFactory reader_factory) {
+  const int NROWS = 1000;
+  std::string csv = "a,b,c\n";
+  for (int i = 0; i < NROWS; ++i) {
+    csv += std::to_string(i) + ",\"x\n" + std::string(i % 50, 'y') + "\"\"\",\"\n\"\n";
+  }
+  auto buffer = std::make_shared<Buffer>(csv);
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.newlines_in_values = true;
+
+  auto input = std::make_shared<io::BufferReader>(buffer);
+  ASSERT_OK_AND_ASSIGN(auto reader, reader_factory(input, parse_options));
+  ASSERT_OK_AND_ASSIGN(auto table, reader->Read());
+  ASSERT_OK(table->ValidateFull());
+  ASSERT_EQ(NROWS, table->num_rows());
+
+  // Compare with reading the whole data in a single block
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = false;
+  read_options.block_size = static_cast<int32_t>(csv.size()) + 1;
+  input = std::make_shared<io::BufferReader>(buffer);
+  ASSERT_OK_AND_ASSIGN(auto expected_reader,
+                       TableReader::Make(io::default_io_context(), input, read_options,
+                                         parse_options, ConvertOptions::Defaults()));
+  ASSERT_OK_AND_ASSIGN(auto expected, expected_reader->Read());
+  AssertTablesEqual(*expected, *table, /*same_chunk_layout=*/false);
+}
+
 TableReaderFactory MakeSerialFactory() {
   return [](std::shared_ptr<io::InputStream> input_stream, ParseOptions parse_options) {
     auto read_options = ReadOptions::Defaults();
@@ -227,6 +261,9 @@ TEST(SerialReaderTests, NestedParallelism) {
 TEST(SerialReaderTests, InvalidRowsSkipped) {
   TestInvalidRowsSkipped(MakeSerialFactory(), /*async=*/false);
 }
+TEST(SerialReaderTests, NewlinesInValues) {
+  TestNewlinesInValues(MakeSerialFactory());
+}
 
 Result<TableReaderFactory> MakeAsyncFactory(
     std::shared_ptr<internal::ThreadPool> thread_pool = nullptr) {
@@ -271,6 +308,11 @@ TEST(AsyncReaderTests, InvalidRowsSkipped) {
   ASSERT_OK_AND_ASSIGN(auto table_factory, MakeAsyncFactory());
   TestInvalidRowsSkipped(table_factory, /*async=*/true);
 }
+TEST(AsyncReaderTests, NewlinesInValues) {
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, internal::ThreadPool::Make(4));
+  ASSERT_OK_AND_ASSIGN(auto table_factory, MakeAsyncFactory(thread_pool));
+  TestNewlinesInValues(table_factory);
+}
 
 TableReaderFactory MakeStreamingFactory(bool use_threads = true) {
   return [use_threads](
@@ -436,6 +478,85 @@ TEST(StreamingReaderTests, SkipMultipleEmptyBlocksAtStart) {
   ASSERT_EQ(nullptr, batch.get());
 }
 
+TEST(StreamingReaderTests, RowFilter) {
+  auto table_buffer = std::make_shared<Buffer>(
+      "a,b,c\n1,x,10\n2,y,oops\n3,z,30\n4,,40\n5,w,50\n6,v,60\n");
+  auto read_table = [&](const ConvertOptions& convert_options,
+                        int32_t block_size) -> Result<std::shared_ptr<Table>> {
+    auto read_options = ReadOptions::Defaults();
+    read_options.block_size = block_size;
+    read_options.use_threads = false;
+    ARROW_ASSIGN_OR_RAISE(
+        auto reader,
+        StreamingReader::Make(io::default_io_context(),
+                              std::make_shared<io::BufferReader>(table_buffer),
+                              read_options, ParseOptions::Defaults(), convert_options));
+    return reader->ToTable();
+  };
+  // Select the rows where the first filter column satisfies `predicate`
+  auto make_row_filter = [](std::function<bool(int64_t)> predicate) -> RowFilter {
+    return [=](const std::shared_ptr<RecordBatch>& batch)
+               -> Result<std::shared_ptr<Array>> {
+      const auto& values = checked_cast<const Int64Array&>(*batch->column(0));
+      BooleanBuilder builder;
+      for (int64_t i = 0; i < values.length(); ++i) {
+        RETURN_NOT_OK(builder.Append(predicate(values.Value(i))));
+      }
+      return builder.Finish();
+    };
+  };
+
+  auto convert_options = ConvertOptions::Defaults();
+  convert_options.column_types["c"] = int64();
+  convert_options.row_filter = make_row_filter([](int64_t a) { return a % 2 == 1; });
+  convert_options.row_filter_columns = {"a"};
+  for (int32_t block_size : {1 << 10, 16}) {
+    ARROW_SCOPED_TRACE("block_size = ", block_size);
+    // The unconvertible value in column "c" is in a row filtered out
+    ASSERT_OK_AND_ASSIGN(auto table, read_table(convert_options, block_size));
+    ASSERT_OK_AND_ASSIGN(table, table->CombineChunks());
+    auto expected_schema =
+        schema({field("a", int64()), field("b", utf8()), field("c", int64())});
+    auto expected =
+        TableFromJSON(expected_schema, {R"([[1, "x", 10], [3, "z", 30], [5, "w", 50]])"});
+    AssertTablesEqual(*expected, *table);
+  }
+
+  // Columns are returned in the requested order
+  convert_options.include_columns = {"c", "b", "a"};
+  {
+    ASSERT_OK_AND_ASSIGN(auto table, read_table(convert_options, 1 << 10));
+    auto expected_schema =
+        schema({field("c", int64()), field("b", utf8()), field("a", int64())});
+    auto expected =
+        TableFromJSON(expected_schema, {R"([[10, "x", 1], [30, "z", 3], [50, "w", 5]])"});
+    AssertTablesEqual(*expected, *table);
+  }
+  convert_options.include_columns = {};
+
+  // Errors in the selected rows report their original row number
+  convert_options.row_filter = make_row_filter([](int64_t a) { return a != 1; });
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("Row #3"),
+                                  read_table(convert_options, 1 << 10));
+
+  // Invalid filters
+  convert_options.row_filter_columns = {"d"};
+  ASSERT_RAISES(KeyError, read_table(convert_options, 1 << 10));
+  convert_options.row_filter_columns = {};
+  ASSERT_RAISES(Invalid, read_table(convert_options, 1 << 10));
+  convert_options.row_filter_columns = {"a"};
+  convert_options.row_filter = [](const std::shared_ptr<RecordBatch>& batch)
+      -> Result<std::shared_ptr<Array>> { return batch->column(0); };
+  ASSERT_RAISES(Invalid, read_table(convert_options, 1 << 10));
+
+  // Only the streaming reader supports row filters
+  ASSERT_RAISES(NotImplemented,
+                TableReader::Make(io::default_io_context(),
+                                  std::make_shared<io::BufferReader>(table_buffer),
+                                  ReadOptions::Defaults(), ParseOptions::Defaults(),
+                                  convert_options));
+}
+
 TEST(CountRowsAsync, Basics) {
   constexpr int NROWS = 4096;
   ASSERT_OK_AND_ASSIGN(auto table_buffer, MakeSampleCsvBuffer(NROWS));
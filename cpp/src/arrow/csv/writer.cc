@@ -17,6 +17,7 @@
 
 #include "arrow/csv/writer.h"
 #include "arrow/array.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/cast.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/ipc/writer.h"
@@ -24,11 +25,16 @@
 #include "arrow/result.h"
 #include "arrow/result_internal.h"
 #include "arrow/stl_allocator.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/formatting.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visit_data_inline.h"
 #include "arrow/visit_type_inline.h"
 
+#include <cstring>
 #include <memory>
 
 #if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
@@ -37,6 +43,7 @@
 
 namespace arrow {
 
+using internal::checked_cast;
 using internal::checked_pointer_cast;
 
 namespace csv {
@@ -47,7 +54,9 @@ namespace csv {
 // The algorithm used here at a high level is to break RecordBatches/Tables into slices
 // and convert each slice independently.  A slice is then converted to CSV by first
 // scanning each column to determine the size of its contents when rendered as a string in
-// CSV. For non-string types this requires casting the value to string (which is cached).
+// CSV. For most non-string types this requires casting the value to string (which is
+// cached); integers are instead measured and later formatted straight into the output,
+// and floating point and boolean values are formatted once into a scratch buffer.
 // This data is used to understand the precise length of each row and a single allocation
 // for the final CSV data buffer. Once the final size is known each column is then
 // iterated over again to place its contents into the CSV data buffer. The rationale for
@@ -57,6 +66,10 @@ namespace csv {
 // still be competitive due to reduction in the number of per row branches necessary with
 // a single pass approach. Profiling would likely yield further opportunities for
 // optimization with this approach.
+//
+// Slices are independent, so when WriteOptions::use_threads is true several of them are
+// converted concurrently, each by its own set of column populators, and the resulting
+// buffers are written to the sink in order.
 
 namespace {
 
@@ -124,6 +137,22 @@ class ColumnPopulator {
   // Adds the number of characters each entry in data will add to to elements
   // in row_lengths.
   Status UpdateRowLengths(const Array& data, int64_t* row_lengths) {
+    RETURN_NOT_OK(SetData(data));
+    return UpdateRowLengths(row_lengths);
+  }
+
+  // Places string data onto each row in output and updates the corresponding row
+  // pointers in preparation for calls to other (next) ColumnPopulators.
+  // Implementations may apply certain checks e.g. for illegal values, which in case of
+  // failure causes this function to return an error Status.
+  // Args:
+  //   output: character buffer to write to.
+  //   offsets: an array of start of row column within the output buffer.
+  virtual Status PopulateRows(char* output, int64_t* offsets) const = 0;
+
+ protected:
+  // Stores the data to populate. By default, it is cast to string into array_.
+  virtual Status SetData(const Array& data) {
     compute::ExecContext ctx(pool_);
     // Populators are intented to be applied to reasonably small data.  In most cases
     // threading overhead would not be justified.
@@ -142,39 +171,62 @@ class ColumnPopulator {
         return casted.status();
       }
     }
-    return UpdateRowLengths(row_lengths);
+    return Status::OK();
   }
 
-  // Places string data onto each row in output and updates the corresponding row
-  // pointers in preparation for calls to other (next) ColumnPopulators.
-  // Implementations may apply certain checks e.g. for illegal values, which in case of
-  // failure causes this function to return an error Status.
-  // Args:
-  //   output: character buffer to write to.
-  //   offsets: an array of start of row column within the output buffer.
-  virtual Status PopulateRows(char* output, int64_t* offsets) const = 0;
-
- protected:
   virtual Status UpdateRowLengths(int64_t* row_lengths) = 0;
   // It must be a `StringArray` or `LargeStringArray`.
   std::shared_ptr<Array> array_;
   const std::string end_chars_;
   std::shared_ptr<Buffer> null_string_;
-
- private:
   MemoryPool* const pool_;
 };
 
 // Copies the contents of s to out properly escaping any necessary characters.
 // Returns the position next to last copied character.
 char* Escape(std::string_view s, char* out) {
-  for (const char c : s) {
-    *out++ = c;
-    if (c == '"') {
-      *out++ = '"';
-    }
+  const char* data = s.data();
+  const char* const end = data + s.size();
+  // Copy the runs between quotes in bulk
+  while (const char* quote =
+             static_cast<const char*>(std::memchr(data, '"', end - data))) {
+    const auto run_length = static_cast<size_t>(quote - data + 1);
+    memcpy(out, data, run_length);
+    out += run_length;
+    *out++ = '"';
+    data = quote + 1;
   }
-  return out;
+  memcpy(out, data, end - data);
+  return out + (end - data);
+}
+
+// Returns the number of decimal digits of value.
+int64_t CountDigits(uint64_t value) {
+  static constexpr uint64_t kPowersOf10[] = {1ULL,
+                                             10ULL,
+                                             100ULL,
+                                             1000ULL,
+                                             10000ULL,
+                                             100000ULL,
+                                             1000000ULL,
+                                             10000000ULL,
+                                             100000000ULL,
+                                             1000000000ULL,
+                                             10000000000ULL,
+                                             100000000000ULL,
+                                             1000000000000ULL,
+                                             10000000000000ULL,
+                                             100000000000000ULL,
+                                             1000000000000000ULL,
+                                             10000000000000000ULL,
+                                             100000000000000000ULL,
+                                             1000000000000000000ULL,
+                                             10000000000000000000ULL};
+  // Setting the lowest bit doesn't change the number of digits, but excludes zero
+  value |= 1;
+  // An approximation of log10(value) from log2(value), exact or one too large
+  const int64_t approx = (64 - bit_util::CountLeadingZeros(value)) * 1233 >> 12;
+  return approx + (value >= kPowersOf10[approx] ? 1 : 0);
 }
 
 // Populator used for non-string/binary types, or when unquoted strings/binary types are
@@ -332,37 +384,43 @@ class QuotedColumnPopulator : public ColumnPopulator {
     auto casted_array = checked_pointer_cast<StringArrayType>(array_);
     const StringArrayType& input = *casted_array;
 
-    row_needs_escaping_.resize(casted_array->length(), false);
-
-    if (NoQuoteInArray(input)) {
-      // fast path if no quote
-      int row_number = 0;
-      VisitArraySpanInline<typename StringArrayType::TypeClass>(
-          *input.data(),
-          [&](std::string_view s) {
-            row_lengths[row_number] += static_cast<int64_t>(s.length()) + kQuoteCount;
-            row_number++;
-          },
-          [&]() {
-            row_lengths[row_number] += static_cast<int64_t>(null_string_->size());
-            row_number++;
-          });
-    } else {
-      int row_number = 0;
-      VisitArraySpanInline<typename StringArrayType::TypeClass>(
-          *input.data(),
-          [&](std::string_view s) {
-            // Each quote in the value string needs to be escaped.
-            int64_t escaped_count = CountQuotes(s);
-            row_needs_escaping_[row_number] = escaped_count > 0;
-            row_lengths[row_number] +=
-                static_cast<int64_t>(s.length()) + escaped_count + kQuoteCount;
-            row_number++;
-          },
-          [&]() {
-            row_lengths[row_number] += static_cast<int64_t>(null_string_->size());
-            row_number++;
-          });
+    row_needs_escaping_.assign(casted_array->length(), false);
+
+    int row_number = 0;
+    VisitArraySpanInline<typename StringArrayType::TypeClass>(
+        *input.data(),
+        [&](std::string_view s) {
+          row_lengths[row_number] += static_cast<int64_t>(s.length()) + kQuoteCount;
+          row_number++;
+        },
+        [&]() {
+          row_lengths[row_number] += static_cast<int64_t>(null_string_->size());
+          row_number++;
+        });
+
+    // Each quote in a value needs to be escaped. Rather than counting them value by
+    // value, search the whole value buffer at once and attribute the quotes found to
+    // their rows, so that quote-free data costs a single vectorized scan.
+    const auto* value_offsets = input.raw_value_offsets();
+    const char* const data = reinterpret_cast<const char*>(input.raw_data());
+    const char* const end = data + value_offsets[input.length()];
+    const char* next = data + value_offsets[0];
+    int64_t row = 0;
+    while (next < end) {
+      const auto* quote = static_cast<const char*>(std::memchr(next, '"', end - next));
+      if (quote == nullptr) {
+        break;
+      }
+      const auto position = quote - data;
+      while (value_offsets[row + 1] <= position) {
+        ++row;
+      }
+      // Null slots may still have data, which is not written
+      if (input.IsValid(row)) {
+        row_needs_escaping_[row] = true;
+        ++row_lengths[row];
+      }
+      next = quote + 1;
     }
     return Status::OK();
   }
@@ -413,20 +471,123 @@ class QuotedColumnPopulator : public ColumnPopulator {
   }
 
  private:
-  // Returns true if there's no quote in the string array
-  template <typename StringArrayType>
-  static bool NoQuoteInArray(const StringArrayType& array) {
-    const uint8_t* data = array.raw_data() + array.value_offset(0);
-    const int64_t buffer_size = array.total_values_length();
-    return std::memchr(data, '"', buffer_size) == nullptr;
-  }
-
   // Older version of GCC don't support custom allocators
   // at some point we should change this to use memory_pool
   // backed allocator.
   std::vector<bool> row_needs_escaping_;
 };
 
+// Integer, floating point and boolean values are rendered without going through an
+// intermediate string array. Integers are measured and then formatted straight into the
+// output, other values are formatted once into a scratch buffer. The rendering is the
+// same as the cast to string. These values never contain quotes, so they are only quoted
+// when all valid values must be.
+template <typename ArrowType>
+class NumericColumnPopulator : public ColumnPopulator {
+ public:
+  using value_type = typename TypeTraits<ArrowType>::CType;
+
+  NumericColumnPopulator(MemoryPool* pool, std::string end_chars,
+                         std::shared_ptr<Buffer> null_string, bool quote_values)
+      : ColumnPopulator(pool, std::move(end_chars), std::move(null_string)),
+        quote_values_(quote_values) {}
+
+  Status PopulateRows(char* output, int64_t* offsets) const override {
+    const char* formatted = formatted_.data();
+    auto formatted_length = formatted_lengths_.begin();
+    VisitArraySpanInline<ArrowType>(
+        *values_,
+        [&](value_type value) {
+          char* row = output + *offsets;
+          if (quote_values_) {
+            *row++ = '"';
+          }
+          if constexpr (is_integer_type<ArrowType>::value) {
+            row += FormattedLength(value);
+            char* cursor = row;
+            ::arrow::internal::detail::FormatAllDigits(
+                ::arrow::internal::detail::Abs(value), &cursor);
+            if (value < 0) {
+              ::arrow::internal::detail::FormatOneChar('-', &cursor);
+            }
+            DCHECK_EQ(cursor, output + *offsets + (quote_values_ ? 1 : 0));
+          } else {
+            memcpy(row, formatted, *formatted_length);
+            row += *formatted_length;
+            formatted += *formatted_length;
+            ++formatted_length;
+          }
+          if (quote_values_) {
+            *row++ = '"';
+          }
+          CopyEndChars(row, end_chars_.data(), end_chars_.length());
+          row += end_chars_.length();
+          *offsets = static_cast<int64_t>(row - output);
+          offsets++;
+        },
+        [&]() {
+          // For nulls, the configured null value string is copied into the output.
+          memcpy(output + *offsets, null_string_->data(), null_string_->size());
+          CopyEndChars(output + *offsets + null_string_->size(), end_chars_.c_str(),
+                       end_chars_.size());
+          *offsets += static_cast<int64_t>(null_string_->size() + end_chars_.size());
+          offsets++;
+        });
+    return Status::OK();
+  }
+
+ protected:
+  Status SetData(const Array& data) override {
+    if (data.type_id() == Type::DICTIONARY) {
+      const auto& dict_array = checked_cast<const DictionaryArray&>(data);
+      compute::ExecContext ctx(pool_);
+      ctx.set_use_threads(false);
+      ASSIGN_OR_RAISE(auto decoded,
+                      compute::Take(*dict_array.dictionary(), *dict_array.indices(),
+                                    compute::TakeOptions::Defaults(), &ctx));
+      values_ = decoded->data();
+    } else {
+      values_ = data.data();
+    }
+    return Status::OK();
+  }
+
+  Status UpdateRowLengths(int64_t* row_lengths) override {
+    const auto quote_length = quote_values_ ? kQuoteCount : 0;
+    formatted_.clear();
+    formatted_lengths_.clear();
+    VisitArraySpanInline<ArrowType>(
+        *values_,
+        [&](value_type value) {
+          int64_t length;
+          if constexpr (is_integer_type<ArrowType>::value) {
+            length = FormattedLength(value);
+          } else {
+            formatter_(value, [&](std::string_view s) {
+              formatted_.append(s.data(), s.size());
+              formatted_lengths_.push_back(static_cast<int32_t>(s.size()));
+            });
+            length = formatted_lengths_.back();
+          }
+          *row_lengths++ += length + quote_length;
+        },
+        [&]() { *row_lengths++ += static_cast<int64_t>(null_string_->size()); });
+    return Status::OK();
+  }
+
+ private:
+  static int64_t FormattedLength(value_type value) {
+    return CountDigits(::arrow::internal::detail::Abs(value)) + (value < 0 ? 1 : 0);
+  }
+
+  const bool quote_values_;
+  std::shared_ptr<ArrayData> values_;
+  ::arrow::internal::StringFormatter<ArrowType> formatter_;
+  // Rendered values and their lengths, when not formatted straight into the output
+  std::string formatted_;
+  std::vector<int32_t> formatted_lengths_;
+};
+
 Result<std::unique_ptr<ColumnPopulator>> MakePopulator(
     const DataType& type, const std::string& end_chars, const char delimiter,
     const std::shared_ptr<Buffer>& null_string, QuotingStyle quoting_style,
@@ -435,6 +596,14 @@ Result<std::unique_ptr<ColumnPopulator>> MakePopulator(
       [&](const auto& type) -> Result<std::unique_ptr<ColumnPopulator>> {
     using Type = std::decay_t<decltype(type)>;
 
+    if constexpr (is_integer_type<Type>::value || is_boolean_type<Type>::value ||
+                  std::is_same<Type, FloatType>::value ||
+                  std::is_same<Type, DoubleType>::value) {
+      return std::make_unique<NumericColumnPopulator<Type>>(
+          pool, end_chars, null_string,
+          /*quote_values=*/quoting_style == QuotingStyle::AllValid);
+    }
+
     if constexpr (is_primitive_ctype<Type>::value || is_decimal_type<Type>::value ||
                   is_null_type<Type>::value || is_temporal_type<Type>::value) {
       switch (quoting_style) {
@@ -490,6 +659,90 @@ Result<std::unique_ptr<ColumnPopulator>> MakePopulator(
                        pool);
 }
 
+// Converts batches to CSV data, using its own column populators and buffers.
+class BatchTranslator {
+ public:
+  static Result<std::unique_ptr<BatchTranslator>> Make(
+      const Schema& schema, const std::shared_ptr<Buffer>& null_string,
+      const WriteOptions& options) {
+    std::vector<std::unique_ptr<ColumnPopulator>> populators(schema.num_fields());
+    std::string delimiter(1, options.delimiter);
+    for (int col = 0; col < schema.num_fields(); col++) {
+      const std::string& end_chars =
+          col < schema.num_fields() - 1 ? delimiter : options.eol;
+      ASSIGN_OR_RAISE(
+          populators[col],
+          MakePopulator(*schema.field(col), end_chars, options.delimiter, null_string,
+                        options.quoting_style, options.io_context.pool()));
+    }
+    ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> data_buffer,
+                    AllocateResizableBuffer(
+                        options.batch_size * schema.num_fields() * kColumnSizeGuess,
+                        options.io_context.pool()));
+    return std::make_unique<BatchTranslator>(std::move(populators),
+                                             std::move(data_buffer), options);
+  }
+
+  BatchTranslator(std::vector<std::unique_ptr<ColumnPopulator>> populators,
+                  std::shared_ptr<ResizableBuffer> data_buffer,
+                  const WriteOptions& options)
+      : column_populators_(std::move(populators)),
+        offsets_(0, 0, ::arrow::stl::allocator<char*>(options.io_context.pool())),
+        data_buffer_(std::move(data_buffer)),
+        eol_size_(static_cast<int32_t>(options.eol.size())) {}
+
+  // Converts batch to CSV into data_buffer().
+  Status Translate(const RecordBatch& batch) {
+    if (batch.num_rows() == 0) {
+      return data_buffer_->Resize(0, /*shrink_to_fit=*/false);
+    }
+    offsets_.resize(batch.num_rows());
+    std::fill(offsets_.begin(), offsets_.end(), 0);
+
+    // Calculate relative offsets for each row (excluding delimiters)
+    for (int32_t col = 0; col < static_cast<int32_t>(column_populators_.size()); col++) {
+      RETURN_NOT_OK(
+          column_populators_[col]->UpdateRowLengths(*batch.column(col), offsets_.data()));
+    }
+    // Calculate cumulative offsets for each row (including delimiters).
+    // - before conversion: offsets_[i] = length of i-th row
+    // - after conversion:  offsets_[i] = offset to the starting of i-th row buffer
+    //   - offsets_[0] = 0
+    //   - offsets_[i] = offsets_[i-1] + len(i-1-th row) + len(delimiters)
+    // Delimiters: ',' * (num_columns - 1) + eol
+    const int32_t delimiters_length =
+        static_cast<int32_t>(batch.num_columns() - 1 + eol_size_);
+    int64_t last_row_length = offsets_[0] + delimiters_length;
+    offsets_[0] = 0;
+    for (size_t row = 1; row < offsets_.size(); ++row) {
+      const int64_t this_row_length = offsets_[row] + delimiters_length;
+      offsets_[row] = offsets_[row - 1] + last_row_length;
+      last_row_length = this_row_length;
+    }
+    // Resize the target buffer to required size. We assume batch to batch sizes
+    // should be pretty close so don't shrink the buffer to avoid allocation churn.
+    RETURN_NOT_OK(
+        data_buffer_->Resize(offsets_.back() + last_row_length, /*shrink_to_fit=*/false));
+
+    // Use the offsets to populate contents.
+    for (auto& populator : column_populators_) {
+      RETURN_NOT_OK(populator->PopulateRows(
+          reinterpret_cast<char*>(data_buffer_->mutable_data()), offsets_.data()));
+    }
+    DCHECK_EQ(data_buffer_->size(), offsets_.back());
+    return Status::OK();
+  }
+
+  const std::shared_ptr<ResizableBuffer>& data_buffer() const { return data_buffer_; }
+
+ private:
+  static constexpr int64_t kColumnSizeGuess = 8;
+  std::vector<std::unique_ptr<ColumnPopulator>> column_populators_;
+  std::vector<int64_t, arrow::stl::allocator<int64_t>> offsets_;
+  std::shared_ptr<ResizableBuffer> data_buffer_;
+  const int32_t eol_size_;
+};
+
 class CSVWriterImpl : public ipc::RecordBatchWriter {
  public:
   static Result<std::shared_ptr<CSVWriterImpl>> Make(
@@ -506,19 +759,16 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     memcpy(null_string->mutable_data(), options.null_string.data(),
            options.null_string.length());
 
-    std::vector<std::unique_ptr<ColumnPopulator>> populators(schema->num_fields());
-    std::string delimiter(1, options.delimiter);
-    for (int col = 0; col < schema->num_fields(); col++) {
-      const std::string& end_chars =
-          col < schema->num_fields() - 1 ? delimiter : options.eol;
-      ASSIGN_OR_RAISE(
-          populators[col],
-          MakePopulator(*schema->field(col), end_chars, options.delimiter, null_string,
-                        options.quoting_style, options.io_context.pool()));
+    // Each translator converts one batch at a time, so as many are needed as batches
+    // are converted concurrently.
+    const int num_translators =
+        options.use_threads ? std::max(1, GetCpuThreadPoolCapacity()) : 1;
+    std::vector<std::unique_ptr<BatchTranslator>> translators(num_translators);
+    for (auto& translator : translators) {
+      ASSIGN_OR_RAISE(translator, BatchTranslator::Make(*schema, null_string, options));
     }
     auto writer = std::make_shared<CSVWriterImpl>(
-        sink, std::move(owned_sink), std::move(schema), std::move(populators), options);
-    RETURN_NOT_OK(writer->PrepareForContentsWrite());
+        sink, std::move(owned_sink), std::move(schema), std::move(translators), options);
     if (options.include_header) {
       RETURN_NOT_OK(writer->WriteHeader());
     }
@@ -529,11 +779,9 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     RecordBatchIterator iterator = RecordBatchSliceIterator(batch, options_.batch_size);
     for (auto maybe_slice : iterator) {
       ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> slice, maybe_slice);
-      RETURN_NOT_OK(TranslateMinimalBatch(*slice));
-      RETURN_NOT_OK(sink_->Write(data_buffer_));
-      stats_.num_record_batches++;
+      RETURN_NOT_OK(Enqueue(std::move(slice)));
     }
-    return Status::OK();
+    return Flush();
   }
 
   Status WriteTable(const Table& table, int64_t max_chunksize) override {
@@ -542,13 +790,10 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     std::shared_ptr<RecordBatch> batch;
     RETURN_NOT_OK(reader.ReadNext(&batch));
     while (batch != nullptr) {
-      RETURN_NOT_OK(TranslateMinimalBatch(*batch));
-      RETURN_NOT_OK(sink_->Write(data_buffer_));
+      RETURN_NOT_OK(Enqueue(std::move(batch)));
       RETURN_NOT_OK(reader.ReadNext(&batch));
-      stats_.num_record_batches++;
     }
-
-    return Status::OK();
+    return Flush();
   }
 
   Status Close() override { return Status::OK(); }
@@ -557,27 +802,15 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
 
   CSVWriterImpl(io::OutputStream* sink, std::shared_ptr<io::OutputStream> owned_sink,
                 std::shared_ptr<Schema> schema,
-                std::vector<std::unique_ptr<ColumnPopulator>> populators,
+                std::vector<std::unique_ptr<BatchTranslator>> translators,
                 const WriteOptions& options)
       : sink_(sink),
         owned_sink_(std::move(owned_sink)),
-        column_populators_(std::move(populators)),
-        offsets_(0, 0, ::arrow::stl::allocator<char*>(options.io_context.pool())),
+        translators_(std::move(translators)),
         schema_(std::move(schema)),
         options_(options) {}
 
  private:
-  Status PrepareForContentsWrite() {
-    // Only called once, as part of initialization
-    if (data_buffer_ == nullptr) {
-      ASSIGN_OR_RAISE(data_buffer_,
-                      AllocateResizableBuffer(
-                          options_.batch_size * schema_->num_fields() * kColumnSizeGuess,
-                          options_.io_context.pool()));
-    }
-    return Status::OK();
-  }
-
   int64_t CalculateHeaderSize() const {
     int64_t header_length = 0;
     for (int col = 0; col < schema_->num_fields(); col++) {
@@ -592,8 +825,9 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
 
   Status WriteHeader() {
     // Only called once, as part of initialization
-    RETURN_NOT_OK(data_buffer_->Resize(CalculateHeaderSize(), /*shrink_to_fit=*/false));
-    char* next = reinterpret_cast<char*>(data_buffer_->mutable_data());
+    ASSIGN_OR_RAISE(std::shared_ptr<Buffer> header_buffer,
+                    AllocateBuffer(CalculateHeaderSize(), options_.io_context.pool()));
+    char* next = reinterpret_cast<char*>(header_buffer->mutable_data());
     for (int col = 0; col < schema_->num_fields(); ++col) {
       *next++ = '"';
       next = Escape(schema_->field(col)->name(), next);
@@ -605,57 +839,40 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     memcpy(next, options_.eol.data(), options_.eol.size());
     next += options_.eol.size();
     DCHECK_EQ(reinterpret_cast<uint8_t*>(next),
-              data_buffer_->data() + data_buffer_->size());
-    return sink_->Write(data_buffer_);
+              header_buffer->data() + header_buffer->size());
+    return sink_->Write(header_buffer);
   }
 
-  Status TranslateMinimalBatch(const RecordBatch& batch) {
-    if (batch.num_rows() == 0) {
-      return Status::OK();
-    }
-    offsets_.resize(batch.num_rows());
-    std::fill(offsets_.begin(), offsets_.end(), 0);
-
-    // Calculate relative offsets for each row (excluding delimiters)
-    for (int32_t col = 0; col < static_cast<int32_t>(column_populators_.size()); col++) {
-      RETURN_NOT_OK(
-          column_populators_[col]->UpdateRowLengths(*batch.column(col), offsets_.data()));
-    }
-    // Calculate cumulative offsets for each row (including delimiters).
-    // - before conversion: offsets_[i] = length of i-th row
-    // - after conversion:  offsets_[i] = offset to the starting of i-th row buffer
-    //   - offsets_[0] = 0
-    //   - offsets_[i] = offsets_[i-1] + len(i-1-th row) + len(delimiters)
-    // Delimiters: ',' * (num_columns - 1) + eol
-    const int32_t delimiters_length =
-        static_cast<int32_t>(batch.num_columns() - 1 + options_.eol.size());
-    int64_t last_row_length = offsets_[0] + delimiters_length;
-    offsets_[0] = 0;
-    for (size_t row = 1; row < offsets_.size(); ++row) {
-      const int64_t this_row_length = offsets_[row] + delimiters_length;
-      offsets_[row] = offsets_[row - 1] + last_row_length;
-      last_row_length = this_row_length;
+  // Queues batch for conversion, converting the queue once there is a batch for
+  // every translator.
+  Status Enqueue(std::shared_ptr<RecordBatch> batch) {
+    pending_.push_back(std::move(batch));
+    if (pending_.size() == translators_.size()) {
+      return Flush();
     }
-    // Resize the target buffer to required size. We assume batch to batch sizes
-    // should be pretty close so don't shrink the buffer to avoid allocation churn.
-    RETURN_NOT_OK(
-        data_buffer_->Resize(offsets_.back() + last_row_length, /*shrink_to_fit=*/false));
+    return Status::OK();
+  }
 
-    // Use the offsets to populate contents.
-    for (auto& populator : column_populators_) {
-      RETURN_NOT_OK(populator->PopulateRows(
-          reinterpret_cast<char*>(data_buffer_->mutable_data()), offsets_.data()));
+  // Converts the queued batches, concurrently if there are several, and writes
+  // them out in order.
+  Status Flush() {
+    std::vector<std::shared_ptr<RecordBatch>> batches = std::move(pending_);
+    pending_.clear();
+    const auto num_batches = static_cast<int>(batches.size());
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        num_batches > 1, num_batches,
+        [&](int i) { return translators_[i]->Translate(*batches[i]); }));
+    for (int i = 0; i < num_batches; ++i) {
+      RETURN_NOT_OK(sink_->Write(translators_[i]->data_buffer()));
+      stats_.num_record_batches++;
     }
-    DCHECK_EQ(data_buffer_->size(), offsets_.back());
     return Status::OK();
   }
 
-  static constexpr int64_t kColumnSizeGuess = 8;
   io::OutputStream* sink_;
   std::shared_ptr<io::OutputStream> owned_sink_;
-  std::vector<std::unique_ptr<ColumnPopulator>> column_populators_;
-  std::vector<int64_t, arrow::stl::allocator<int64_t>> offsets_;
-  std::shared_ptr<ResizableBuffer> data_buffer_;
+  std::vector<std::unique_ptr<BatchTranslator>> translators_;
+  std::vector<std::shared_ptr<RecordBatch>> pending_;
   const std::shared_ptr<Schema> schema_;
   const WriteOptions options_;
   ipc::WriteStats stats_;
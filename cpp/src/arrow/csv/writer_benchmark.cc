@@ -110,7 +110,7 @@ void BenchmarkWriteCsv(benchmark::State& state, const WriteOptions& options,
   state.counters["null_percent"] = static_cast<double>(state.range(0));
 }
 
-// Exercises UnQuotedColumnPopulator with integer
+// Exercises NumericColumnPopulator with integer
 void WriteCsvNumeric(benchmark::State& state) {
   auto batch = MakeIntTestBatch(kCsvRows, kCsvCols, state.range(0));
   BenchmarkWriteCsv(state, WriteOptions::Defaults(), *batch);
@@ -137,7 +137,7 @@ void WriteCsvStringRejectQuote(benchmark::State& state) {
   BenchmarkWriteCsv(state, options, *batch);
 }
 
-// Exercise QuotedColumnPopulator with integer
+// Exercise NumericColumnPopulator with quoted integer
 // - check quote even for numeric type (is it useful?)
 void WriteCsvNumericCheckQuote(benchmark::State& state) {
   auto batch = MakeIntTestBatch(kCsvRows, kCsvCols, state.range(0));
@@ -146,6 +146,25 @@ void WriteCsvNumericCheckQuote(benchmark::State& state) {
   BenchmarkWriteCsv(state, options, *batch);
 }
 
+// Exercise converting several batches concurrently
+// - the input spans many batches of the default batch size
+void WriteCsvNumericThreads(benchmark::State& state) {
+  auto batch = MakeIntTestBatch(kCsvRows * 32, kCsvCols, /*null_percent=*/1);
+  auto options = WriteOptions::Defaults();
+  options.use_threads = state.range(0) != 0;
+  int64_t total_size = 0;
+
+  for (auto _ : state) {
+    auto out = io::BufferOutputStream::Create().ValueOrDie();
+    ABORT_NOT_OK(WriteCSV(*batch, options, out.get()));
+    auto buffer = out->Finish().ValueOrDie();
+    total_size += buffer->size();
+  }
+
+  state.SetBytesProcessed(total_size);
+  state.SetItemsProcessed(state.iterations() * batch->num_columns() * batch->num_rows());
+}
+
 void NullPercents(benchmark::internal::Benchmark* bench) {
   std::vector<int> null_percents = {0, 1, 10, 50};
   for (int null_percent : null_percents) {
@@ -160,6 +179,10 @@ BENCHMARK(WriteCsvStringNoQuote)->Apply(NullPercents);
 BENCHMARK(WriteCsvStringWithQuote)->Apply(NullPercents);
 BENCHMARK(WriteCsvStringRejectQuote)->Apply(NullPercents);
 BENCHMARK(WriteCsvNumericCheckQuote)->Apply(NullPercents);
+BENCHMARK(WriteCsvNumericThreads)
+    ->ArgName("use_threads")
+    ->DenseRange(0, 1)
+    ->UseRealTime();
 
 }  // namespace csv
 }  // namespace arrow
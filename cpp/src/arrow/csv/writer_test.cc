@@ -22,7 +22,9 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/compute/cast.h"
 #include "arrow/csv/writer.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/writer.h"
@@ -30,6 +32,7 @@
 #include "arrow/result_internal.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
+#include "arrow/testing/random.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 
@@ -351,7 +354,87 @@ TEST_P(TestWriteCSV, TestWrite) {
     // The writer should work identically.
     ASSERT_OK_AND_ASSIGN(csv, ToCsvStringUsingWriter(*table, options));
     EXPECT_EQ(csv, GetParam().expected_output);
+
+    // Converting several batches concurrently should work identically.
+    options.use_threads = true;
+    ASSERT_OK_AND_ASSIGN(csv, ToCsvString(*record_batch, options));
+    EXPECT_EQ(csv, GetParam().expected_output);
+    ASSERT_OK_AND_ASSIGN(csv, ToCsvString(*table, options));
+    EXPECT_EQ(csv, GetParam().expected_output);
+  }
+}
+
+// Numbers and booleans are formatted without casting, but must be rendered exactly
+// like their string cast.
+void AssertWrittenLikeCast(const RecordBatch& batch) {
+  FieldVector string_fields;
+  ArrayVector string_columns;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    string_fields.push_back(field(batch.schema()->field(i)->name(), utf8()));
+    ASSERT_OK_AND_ASSIGN(auto string_column, compute::Cast(*batch.column(i), utf8()));
+    string_columns.push_back(string_column);
+  }
+  auto string_batch =
+      RecordBatch::Make(schema(string_fields), batch.num_rows(), string_columns);
+
+  // Strings are only left unquoted by QuotingStyle::None
+  for (auto quoting_style : {QuotingStyle::None, QuotingStyle::AllValid}) {
+    for (bool use_threads : {false, true}) {
+      WriteOptions options =
+          DefaultTestOptions(/*include_header=*/true, /*null_string=*/"NA",
+                             quoting_style, /*eol=*/"\n", /*delimiter=*/',',
+                             /*batch_size=*/300);
+      options.use_threads = use_threads;
+      ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create());
+      ASSERT_OK(WriteCSV(batch, options, out.get()));
+      ASSERT_OK_AND_ASSIGN(auto actual, out->Finish());
+      ASSERT_OK_AND_ASSIGN(out, io::BufferOutputStream::Create());
+      ASSERT_OK(WriteCSV(*string_batch, options, out.get()));
+      ASSERT_OK_AND_ASSIGN(auto expected, out->Finish());
+      AssertBufferEqual(*actual, *expected);
+    }
+  }
+}
+
+TEST(TestWriteCSV, NumbersLikeCast) {
+  random::RandomArrayGenerator rng(42);
+  const int64_t length = 5000;
+  FieldVector fields;
+  ArrayVector columns;
+  for (const auto& type : {int8(), int16(), int32(), int64(), uint8(), uint16(),
+                           uint32(), uint64(), float32(), float64(), boolean()}) {
+    fields.push_back(field(type->ToString(), type));
+    columns.push_back(rng.ArrayOf(type, length, /*null_probability=*/0.1));
+  }
+  fields.push_back(field("dict", dictionary(int8(), int32())));
+  ASSERT_OK_AND_ASSIGN(auto dict_array,
+                       DictionaryArray::FromArrays(
+                           dictionary(int8(), int32()),
+                           rng.Int8(length, 0, 2, /*null_probability=*/0.1),
+                           ArrayFromJSON(int32(), "[-1, 100, 2147483647]")));
+  columns.push_back(dict_array);
+  AssertWrittenLikeCast(*RecordBatch::Make(schema(fields), length, columns));
+}
+
+TEST(TestWriteCSV, IntegerDigitsLikeCast) {
+  // Integers around each power of 10, where the number of digits changes
+  std::string values = "null";
+  for (int exponent = 0; exponent <= 18; ++exponent) {
+    int64_t power = 1;
+    for (int i = 0; i < exponent; ++i) {
+      power *= 10;
+    }
+    for (int64_t value : {power - 1, power, -power, 1 - power}) {
+      values += "," + std::to_string(value);
+    }
   }
+  values += ",-9223372036854775808,9223372036854775807";
+  auto array = ArrayFromJSON(int64(), "[" + values + "]");
+  AssertWrittenLikeCast(
+      *RecordBatch::Make(schema({field("int64", int64())}), array->length(), {array}));
+  AssertWrittenLikeCast(*RecordBatchFromJSON(
+      schema({field("uint64", uint64())}),
+      R"([{"uint64": 18446744073709551615}, {"uint64": 0}, {"uint64": 9}])"));
 }
 
 INSTANTIATE_TEST_SUITE_P(MultiColumnWriteCSVTest, TestWriteCSV,
@@ -106,7 +106,7 @@ int64_t FileSource::Size() const {
 }
 
 Result<std::shared_ptr<io::InputStream>> FileSource::OpenCompressed(
-    std::optional<Compression::type> compression) const {
+    std::optional<Compression::type> compression, bool use_threads) const {
   ARROW_ASSIGN_OR_RAISE(auto file, Open());
   auto actual_compression = Compression::type::UNCOMPRESSED;
   if (!compression.has_value()) {
@@ -126,6 +126,12 @@ Result<std::shared_ptr<io::InputStream>> FileSource::OpenCompressed(
   if (actual_compression == Compression::type::UNCOMPRESSED) {
     return file;
   }
+  if (use_threads && io::ParallelCompressedInputStream::IsSupported(actual_compression)) {
+    auto options = io::ParallelDecompressionOptions::Defaults();
+    options.io_context = file->io_context();
+    return io::ParallelCompressedInputStream::Make(actual_compression, std::move(file),
+                                                   options);
+  }
   ARROW_ASSIGN_OR_RAISE(auto codec, util::Codec::Create(actual_compression));
   return io::CompressedInputStream::Make(codec.get(), std::move(file));
 }
@@ -124,8 +124,13 @@ class ARROW_DS_EXPORT FileSource : public util::EqualityComparable<FileSource> {
   /// \brief Get an InputStream which views this file source (and decompresses if needed)
   /// \param[in] compression If nullopt, guess the compression scheme from the
   ///     filename, else decompress with the given codec
+  /// \param[in] use_threads If true, files made of several compressed members or
+  ///     frames (e.g. concatenated gzip or multi-frame zstd) are decompressed in
+  ///     parallel on the CPU thread pool, see io::ParallelCompressedInputStream.
+  ///     Pass false when only the beginning of the file is read.
   Result<std::shared_ptr<io::InputStream>> OpenCompressed(
-      std::optional<Compression::type> compression = std::nullopt) const;
+      std::optional<Compression::type> compression = std::nullopt,
+      bool use_threads = true) const;
 
   /// \brief equality comparison with another FileSource
   bool Equals(const FileSource& other) const;
@@ -24,6 +24,9 @@
 #include <unordered_set>
 #include <utility>
 
+#include "arrow/array/util.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/expression.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/csv/reader.h"
@@ -211,6 +214,69 @@ Result<std::unordered_set<std::string>> GetColumnNames(
   return unordered_names;
 }
 
+// Make the CSV reader evaluate the members of the scan filter's conjunction which only
+// reference columns being read, so that the other columns are only converted for the
+// rows they select. The scanner still applies the whole filter afterwards.
+static Status SetRowFilter(const ScanOptions& scan_options,
+                           csv::ConvertOptions* convert_options) {
+  compute::Expression filter = scan_options.filter;
+  if (!filter.IsBound()) {
+    ARROW_ASSIGN_OR_RAISE(filter, filter.Bind(*scan_options.dataset_schema));
+  }
+  const std::unordered_set<std::string> read_columns(
+      convert_options->include_columns.begin(), convert_options->include_columns.end());
+
+  std::vector<compute::Expression> members;
+  std::vector<std::string> filter_columns;
+  std::unordered_set<std::string> seen_filter_columns;
+  std::vector<compute::Expression> pending = {std::move(filter)};
+  while (!pending.empty()) {
+    compute::Expression expr = std::move(pending.back());
+    pending.pop_back();
+    const auto* call = expr.call();
+    if (call && call->function_name == "and_kleene") {
+      pending.insert(pending.end(), call->arguments.rbegin(), call->arguments.rend());
+      continue;
+    }
+    const auto refs = compute::FieldsInExpression(expr);
+    const bool only_read_columns =
+        !refs.empty() && std::all_of(refs.begin(), refs.end(), [&](const FieldRef& ref) {
+          return ref.name() != nullptr && read_columns.count(*ref.name()) != 0;
+        });
+    if (!only_read_columns) {
+      continue;
+    }
+    for (const auto& ref : refs) {
+      if (seen_filter_columns.insert(*ref.name()).second) {
+        filter_columns.push_back(*ref.name());
+      }
+    }
+    members.push_back(std::move(expr));
+  }
+  if (members.empty()) {
+    return Status::OK();
+  }
+
+  auto dataset_schema = scan_options.dataset_schema;
+  ARROW_ASSIGN_OR_RAISE(auto predicate,
+                        compute::and_(std::move(members)).Bind(*dataset_schema));
+  auto pool = scan_options.pool;
+  convert_options->row_filter_columns = std::move(filter_columns);
+  convert_options->row_filter = [predicate, dataset_schema, pool](
+                                    const std::shared_ptr<RecordBatch>& batch)
+      -> Result<std::shared_ptr<Array>> {
+    compute::ExecContext exec_context(pool);
+    ARROW_ASSIGN_OR_RAISE(Datum selection,
+                          compute::ExecuteScalarExpression(predicate, *dataset_schema,
+                                                           batch, &exec_context));
+    if (selection.is_scalar()) {
+      return MakeArrayFromScalar(*selection.scalar(), batch->num_rows(), pool);
+    }
+    return selection.make_array();
+  };
+  return Status::OK();
+}
+
 static inline Result<csv::ConvertOptions> GetConvertOptions(
     const CsvFileFormat& format, const ScanOptions* scan_options,
     const std::string_view first_block) {
@@ -258,6 +324,10 @@ static inline Result<csv::ConvertOptions> GetConvertOptions(
     // Properly set conversion types
     convert_options.column_types[field->name()] = field->type();
   }
+
+  if (csv_scan_options->filter_before_conversion) {
+    RETURN_NOT_OK(SetRowFilter(*scan_options, &convert_options));
+  }
   return convert_options;
 }
 
@@ -277,7 +347,8 @@ static inline Result<csv::ReadOptions> GetReadOptions(
 
 static inline Future<std::shared_ptr<csv::StreamingReader>> OpenReaderAsync(
     const FileSource& source, const CsvFileFormat& format,
-    const std::shared_ptr<ScanOptions>& scan_options, Executor* cpu_executor) {
+    const std::shared_ptr<ScanOptions>& scan_options, Executor* cpu_executor,
+    bool use_threads = true) {
 #ifdef ARROW_WITH_OPENTELEMETRY
   auto tracer = arrow::internal::tracing::GetTracer();
   auto span = tracer->StartSpan("arrow::dataset::CsvFileFormat::OpenReaderAsync");
@@ -287,7 +358,7 @@ static inline Future<std::shared_ptr<csv::StreamingReader>> OpenReaderAsync(
       GetFragmentScanOptions<CsvFragmentScanOptions>(
           kCsvTypeName, scan_options.get(), format.default_fragment_scan_options));
   ARROW_ASSIGN_OR_RAISE(auto reader_options, GetReadOptions(format, scan_options));
-  ARROW_ASSIGN_OR_RAISE(auto input, source.OpenCompressed());
+  ARROW_ASSIGN_OR_RAISE(auto input, source.OpenCompressed(std::nullopt, use_threads));
   if (fragment_scan_options->stream_transform_func) {
     ARROW_ASSIGN_OR_RAISE(input, fragment_scan_options->stream_transform_func(input));
   }
@@ -329,11 +400,13 @@ static inline Future<std::shared_ptr<csv::StreamingReader>> OpenReaderAsync(
       });
 }
 
+// Open a reader to inspect the beginning of the file, decompressing it serially
 static inline Result<std::shared_ptr<csv::StreamingReader>> OpenReader(
     const FileSource& source, const CsvFileFormat& format,
     const std::shared_ptr<ScanOptions>& scan_options = nullptr) {
-  auto open_reader_fut = OpenReaderAsync(source, format, scan_options,
-                                         ::arrow::internal::GetCpuThreadPool());
+  auto open_reader_fut =
+      OpenReaderAsync(source, format, scan_options, ::arrow::internal::GetCpuThreadPool(),
+                      /*use_threads=*/false);
   return open_reader_fut.result();
 }
 
@@ -423,7 +496,8 @@ Future<std::shared_ptr<FragmentScanner>> CsvFileFormat::BeginScan(
 Result<std::shared_ptr<InspectedFragment>> DoInspectFragment(
     const FileSource& source, const CsvFragmentScanOptions& csv_options,
     compute::ExecContext* exec_context) {
-  ARROW_ASSIGN_OR_RAISE(auto input, source.OpenCompressed());
+  ARROW_ASSIGN_OR_RAISE(auto input,
+                        source.OpenCompressed(std::nullopt, /*use_threads=*/false));
   if (csv_options.stream_transform_func) {
     ARROW_ASSIGN_OR_RAISE(input, csv_options.stream_transform_func(input));
   }
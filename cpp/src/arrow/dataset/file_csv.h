@@ -99,6 +99,15 @@ struct ARROW_DS_EXPORT CsvFragmentScanOptions : public FragmentScanOptions {
   /// CSV parse options
   csv::ParseOptions parse_options = csv::ParseOptions::Defaults();
 
+  /// Whether to evaluate the scan filter before converting most columns
+  ///
+  /// If true, the parts of the filter which only reference columns read from the
+  /// file (for example comparisons of a column with a literal) are evaluated as
+  /// soon as these columns are converted, and the other columns are only
+  /// converted for the rows that pass. This pays off for selective filters.
+  /// This overrides convert_options.row_filter.
+  bool filter_before_conversion = false;
+
   /// Optional stream wrapping function
   ///
   /// If defined, all open dataset file fragments will be passed
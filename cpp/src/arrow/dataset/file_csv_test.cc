@@ -432,6 +432,33 @@ N/A,bar
   ASSERT_OK(batch_it.Visit([](TaggedRecordBatch) { return Status::OK(); }));
 }
 
+TEST_P(TestCsvFileFormat, FilterBeforeConversion) {
+  auto source = GetFileSource(R"(i,n
+1,10
+2,oops
+3,30)");
+  auto fragment = MakeFragment(*source);
+  auto dataset_schema = schema({field("i", int64()), field("n", int64())});
+  auto fragment_scan_options =
+      static_cast<CsvFragmentScanOptions*>(opts_->fragment_scan_options.get());
+
+  auto scan = [&]() -> Result<std::shared_ptr<Table>> {
+    ScannerBuilder builder(dataset_schema, fragment, opts_);
+    RETURN_NOT_OK(builder.Filter(not_equal(field_ref("i"), literal(int64_t{2}))));
+    ARROW_ASSIGN_OR_RAISE(auto scanner, builder.Finish());
+    return scanner->ToTable();
+  };
+
+  // The unconvertible value is only seen when converting all rows
+  fragment_scan_options->filter_before_conversion = false;
+  ASSERT_RAISES(Invalid, scan());
+
+  fragment_scan_options->filter_before_conversion = true;
+  ASSERT_OK_AND_ASSIGN(auto table, scan());
+  AssertTablesEqual(*TableFromJSON(dataset_schema, {"[[1, 10], [3, 30]]"}), *table,
+                    /*same_chunk_layout=*/false);
+}
+
 TEST_P(TestCsvFileFormat, WriteRecordBatchReader) { TestWrite(); }
 
 TEST_P(TestCsvFileFormat, WriteRecordBatchReaderCustomOptions) {
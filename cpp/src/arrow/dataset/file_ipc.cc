@@ -19,9 +19,15 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/array_nested.h"
+#include "arrow/array/array_primitive.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/scanner.h"
@@ -34,6 +40,7 @@
 
 namespace arrow {
 
+using internal::checked_cast;
 using internal::checked_pointer_cast;
 
 namespace dataset {
@@ -124,6 +131,96 @@ static inline Result<ipc::IpcReadOptions> GetReadOptions(
   return options;
 }
 
+/// \brief Test each record batch of a file against a predicate
+///
+/// The statistics read from the file footer (see
+/// ipc::RecordBatchFileReader::ReadBatchStatistics) are converted to a guarantee for
+/// each record batch and the predicate is simplified against it.
+static inline Result<std::vector<compute::Expression>> TestRecordBatches(
+    const RecordBatch& statistics, const Schema& physical_schema,
+    const compute::Expression& predicate) {
+  const auto& num_rows = checked_cast<const Int64Array&>(*statistics.column(0));
+  const auto& columns = checked_cast<const StructArray&>(*statistics.column(1));
+  std::vector<std::vector<compute::Expression>> guarantees(num_rows.length());
+
+  std::unordered_set<std::string> seen;
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    const std::string* name = ref.name();
+    if (name == nullptr || !seen.insert(*name).second) continue;
+
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(physical_schema));
+    if (match.empty()) continue;
+    const auto& type = physical_schema.field(match[0])->type();
+
+    auto column = columns.GetFieldByName(*name);
+    if (column == nullptr || column->type_id() != Type::STRUCT ||
+        column->num_fields() != 3) {
+      continue;
+    }
+    const auto& column_statistics = checked_cast<const StructArray&>(*column);
+    auto min = column_statistics.field(0);
+    auto max = column_statistics.field(1);
+    if (!min->type()->Equals(type) || !max->type()->Equals(type) ||
+        column_statistics.field(2)->type_id() != Type::INT64) {
+      continue;
+    }
+    const auto& null_counts =
+        checked_cast<const Int64Array&>(*column_statistics.field(2));
+
+    for (int64_t i = 0; i < num_rows.length(); ++i) {
+      auto field_expr = compute::field_ref(ref);
+      compute::Expression guarantee;
+      if (null_counts.Value(i) == num_rows.Value(i)) {
+        // Optimize for corner case where all values are nulls
+        guarantee = compute::is_null(std::move(field_expr));
+      } else if (min->IsValid(i) && max->IsValid(i)) {
+        ARROW_ASSIGN_OR_RAISE(auto min_value, min->GetScalar(i));
+        ARROW_ASSIGN_OR_RAISE(auto max_value, max->GetScalar(i));
+        if (min_value->Equals(*max_value)) {
+          guarantee = compute::equal(field_expr, compute::literal(std::move(min_value)));
+        } else {
+          guarantee = compute::and_(
+              compute::greater_equal(field_expr, compute::literal(std::move(min_value))),
+              compute::less_equal(field_expr, compute::literal(std::move(max_value))));
+        }
+        if (null_counts.Value(i) > 0) {
+          guarantee = compute::or_(std::move(guarantee),
+                                   compute::is_null(std::move(field_expr)));
+        }
+      } else {
+        // No bounds were recorded, e.g. because of NaNs
+        continue;
+      }
+      guarantees[i].push_back(std::move(guarantee));
+    }
+  }
+
+  std::vector<compute::Expression> batches(guarantees.size());
+  for (size_t i = 0; i < guarantees.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto guarantee,
+                          compute::and_(std::move(guarantees[i])).Bind(physical_schema));
+    ARROW_ASSIGN_OR_RAISE(batches[i], SimplifyWithGuarantee(predicate, guarantee));
+  }
+  return batches;
+}
+
+/// \brief Whether a predicate references a column which may have statistics in the
+/// file footer
+static inline bool HasBatchStatistics(const compute::Expression& predicate) {
+  if (const auto* parameter = predicate.parameter()) {
+    // Statistics are only written for top-level columns of some types
+    if (parameter->ref.name() == nullptr) return false;
+    return predicate.type() == nullptr ||
+           ipc::internal::HasBatchStatistics(*predicate.type());
+  }
+  if (const auto* call = predicate.call()) {
+    for (const auto& argument : call->arguments) {
+      if (HasBatchStatistics(argument)) return true;
+    }
+  }
+  return false;
+}
+
 IpcFileFormat::IpcFileFormat() : FileFormat(std::make_shared<IpcFragmentScanOptions>()) {}
 
 Result<bool> IpcFileFormat::IsSupported(const FileSource& source) const {
@@ -151,6 +248,7 @@ Result<RecordBatchGenerator> IpcFileFormat::ScanBatchesAsync(
   };
   auto readahead_level = options->batch_readahead;
   auto default_fragment_scan_options = this->default_fragment_scan_options;
+  auto partition_expression = file->partition_expression();
   auto open_generator = [=](const std::shared_ptr<ipc::RecordBatchFileReader>& reader)
       -> Result<RecordBatchGenerator> {
     ARROW_ASSIGN_OR_RAISE(
@@ -158,15 +256,44 @@ Result<RecordBatchGenerator> IpcFileFormat::ScanBatchesAsync(
         GetFragmentScanOptions<IpcFragmentScanOptions>(kIpcTypeName, options.get(),
                                                        default_fragment_scan_options));
 
+    // Skip the record batches whose statistics cannot satisfy the filter
+    std::optional<std::vector<int>> batch_indices;
+    ARROW_ASSIGN_OR_RAISE(auto predicate, SimplifyWithGuarantee(
+                                              options->filter, partition_expression));
+    if (ExpressionHasFieldRefs(predicate)) {
+      ARROW_ASSIGN_OR_RAISE(auto statistics, reader->ReadBatchStatistics());
+      if (statistics != nullptr) {
+        ARROW_ASSIGN_OR_RAISE(
+            auto batch_predicates,
+            TestRecordBatches(*statistics, *reader->schema(), predicate));
+        std::vector<int> indices;
+        for (size_t i = 0; i < batch_predicates.size(); ++i) {
+          if (batch_predicates[i].IsSatisfiable()) {
+            indices.push_back(static_cast<int>(i));
+          }
+        }
+        if (indices.size() < batch_predicates.size()) {
+          batch_indices = std::move(indices);
+        }
+      }
+    }
+
+    if (!batch_indices.has_value()) {
+      batch_indices.emplace(reader->num_record_batches());
+      std::iota(batch_indices->begin(), batch_indices->end(), 0);
+    }
+
     RecordBatchGenerator generator;
     if (ipc_scan_options->cache_options) {
       // Transferring helps performance when coalescing
       ARROW_ASSIGN_OR_RAISE(generator, reader->GetRecordBatchGenerator(
+                                           std::move(*batch_indices),
                                            /*coalesce=*/true, options->io_context,
                                            *ipc_scan_options->cache_options,
                                            ::arrow::internal::GetCpuThreadPool()));
     } else {
       ARROW_ASSIGN_OR_RAISE(generator, reader->GetRecordBatchGenerator(
+                                           std::move(*batch_indices),
                                            /*coalesce=*/false, options->io_context));
     }
     WRAP_ASYNC_GENERATOR_WITH_CHILD_SPAN(
@@ -183,14 +310,33 @@ Result<RecordBatchGenerator> IpcFileFormat::ScanBatchesAsync(
 Future<std::optional<int64_t>> IpcFileFormat::CountRows(
     const std::shared_ptr<FileFragment>& file, compute::Expression predicate,
     const std::shared_ptr<ScanOptions>& options) {
-  if (ExpressionHasFieldRefs(predicate)) {
+  const bool has_field_refs = ExpressionHasFieldRefs(predicate);
+  if (has_field_refs && !HasBatchStatistics(predicate)) {
+    // The footer statistics can't help, don't bother reading them
     return Future<std::optional<int64_t>>::MakeFinished(std::nullopt);
   }
   auto self = checked_pointer_cast<IpcFileFormat>(shared_from_this());
   return DeferNotOk(options->io_context.executor()->Submit(
-      [self, file]() -> Result<std::optional<int64_t>> {
+      [self, file, predicate, has_field_refs]() -> Result<std::optional<int64_t>> {
         ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(file->source()));
-        return reader->CountRows();
+        if (!has_field_refs) {
+          return reader->CountRows();
+        }
+        ARROW_ASSIGN_OR_RAISE(auto statistics, reader->ReadBatchStatistics());
+        if (statistics == nullptr) return std::nullopt;
+        ARROW_ASSIGN_OR_RAISE(
+            auto batch_predicates,
+            TestRecordBatches(*statistics, *reader->schema(), predicate));
+        const auto& num_rows = checked_cast<const Int64Array&>(*statistics->column(0));
+        int64_t rows = 0;
+        for (size_t i = 0; i < batch_predicates.size(); ++i) {
+          // If the record batch is entirely excluded, exclude it from the row count
+          if (!batch_predicates[i].IsSatisfiable()) continue;
+          // Unless the record batch is entirely included, bail out of fast path
+          if (batch_predicates[i] != compute::literal(true)) return std::nullopt;
+          rows += num_rows.Value(i);
+        }
+        return rows;
       }));
 }
 
@@ -18,6 +18,7 @@
 #include "arrow/dataset/file_ipc.h"
 
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -44,9 +45,12 @@ namespace dataset {
 class IpcFormatHelper {
  public:
   using FormatType = IpcFileFormat;
-  static Result<std::shared_ptr<Buffer>> Write(RecordBatchReader* reader) {
+  static Result<std::shared_ptr<Buffer>> Write(
+      RecordBatchReader* reader,
+      const ipc::IpcWriteOptions& options = ipc::IpcWriteOptions::Defaults()) {
     ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create());
-    ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(sink, reader->schema()));
+    ARROW_ASSIGN_OR_RAISE(auto writer,
+                          ipc::MakeFileWriter(sink, reader->schema(), options));
     ARROW_ASSIGN_OR_RAISE(auto batches, reader->ToRecordBatches());
     for (auto batch : batches) {
       RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
@@ -91,6 +95,47 @@ TEST_F(TestIpcFileFormat, IsSupported) { TestIsSupported(); }
 TEST_F(TestIpcFileFormat, CountRows) { TestCountRows(); }
 TEST_F(TestIpcFileFormat, FragmentEquals) { TestFragmentEquals(); }
 
+TEST_F(TestIpcFileFormat, CountRowsBatchStatistics) {
+  constexpr int64_t kNumBatches = 8;
+  constexpr int64_t kTotalNumRows = kNumBatches * (kNumBatches + 1) / 2;
+
+  // See TestIpcFileFormatScan.PredicatePushdown for a description of the data
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumBatches);
+  auto options = std::make_shared<ScanOptions>();
+  auto predicate = less_equal(field_ref("i64"), literal(3));
+  ASSERT_OK_AND_ASSIGN(predicate, predicate.Bind(*reader->schema()));
+
+  // Without statistics, a predicate referencing fields can't be answered
+  auto fragment = MakeFragment(*GetFileSource(reader.get()));
+  ASSERT_FINISHES_OK_AND_EQ(std::nullopt, fragment->CountRows(predicate, options));
+
+  auto write_options = ipc::IpcWriteOptions::Defaults();
+  write_options.write_batch_statistics = true;
+  reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumBatches);
+  ASSERT_OK_AND_ASSIGN(auto buffer, IpcFormatHelper::Write(reader.get(), write_options));
+  fragment = MakeFragment(FileSource(buffer));
+
+  ASSERT_FINISHES_OK_AND_EQ(std::make_optional<int64_t>(kTotalNumRows),
+                            fragment->CountRows(literal(true), options));
+  for (int i = 1; i <= kNumBatches; i++) {
+    SCOPED_TRACE(i);
+    predicate = less_equal(field_ref("i64"), literal(i));
+    ASSERT_OK_AND_ASSIGN(predicate, predicate.Bind(*reader->schema()));
+    ASSERT_FINISHES_OK_AND_EQ(std::make_optional<int64_t>(i * (i + 1) / 2),
+                              fragment->CountRows(predicate, options));
+
+    predicate = equal(field_ref("u8"), literal<uint8_t>(i));
+    ASSERT_OK_AND_ASSIGN(predicate, predicate.Bind(*reader->schema()));
+    ASSERT_FINISHES_OK_AND_EQ(std::make_optional<int64_t>(i),
+                              fragment->CountRows(predicate, options));
+  }
+
+  // Predicates on columns without statistics can't be answered
+  predicate = equal(field_ref(FieldRef("struct", "i32")), literal(1));
+  ASSERT_OK_AND_ASSIGN(predicate, predicate.Bind(*reader->schema()));
+  ASSERT_FINISHES_OK_AND_EQ(std::nullopt, fragment->CountRows(predicate, options));
+}
+
 class TestIpcFileSystemDataset : public testing::Test,
                                  public WriteFileSystemDatasetMixin {
  public:
@@ -172,6 +217,65 @@ TEST_P(TestIpcFileFormatScan, FragmentScanOptions) {
   ASSERT_OK_AND_ASSIGN(auto batch_gen, fragment->ScanBatchesAsync(opts_));
   ASSERT_FINISHES_AND_RAISES(Invalid, CollectAsyncGenerator(batch_gen));
 }
+TEST_P(TestIpcFileFormatScan, PredicatePushdown) {
+  // Given a number `n`, the arithmetic dataset creates n RecordBatches where
+  // each RecordBatch is keyed by a unique integer in [1, n]. Let `rb_i` denote
+  // the record batch keyed by `i`. `rb_i` is composed of `i` rows where all
+  // values are a variant of `i`, e.g. {"i64": i, "u8": i, ... }.
+  //
+  // The fragment is scanned directly, so no post-filtering is applied and
+  // counting the returned rows and batches shows which batches were skipped.
+  constexpr int64_t kNumBatches = 16;
+  constexpr int64_t kTotalNumRows = kNumBatches * (kNumBatches + 1) / 2;
+
+  auto write_options = ipc::IpcWriteOptions::Defaults();
+  write_options.write_batch_statistics = true;
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumBatches);
+  ASSERT_OK_AND_ASSIGN(auto buffer, IpcFormatHelper::Write(reader.get(), write_options));
+
+  SetSchema(reader->schema()->fields());
+  auto fragment = MakeFragment(FileSource(buffer));
+
+  auto count_rows_and_batches = [&](int64_t expected_rows, int64_t expected_batches) {
+    int64_t actual_rows = 0;
+    int64_t actual_batches = 0;
+    for (auto maybe_batch : PhysicalBatches(fragment)) {
+      ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      actual_rows += batch->num_rows();
+      ++actual_batches;
+    }
+    EXPECT_EQ(actual_rows, expected_rows);
+    EXPECT_EQ(actual_batches, expected_batches);
+  };
+
+  SetFilter(literal(true));
+  count_rows_and_batches(kTotalNumRows, kNumBatches);
+
+  for (int64_t i = 1; i <= kNumBatches; i++) {
+    SCOPED_TRACE(i);
+    SetFilter(equal(field_ref("i64"), literal(i)));
+    count_rows_and_batches(i, 1);
+  }
+
+  // Out of bound filters should skip all batches
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(kNumBatches + 1)));
+  count_rows_and_batches(0, 0);
+  SetFilter(and_(equal(field_ref("i64"), literal<int64_t>(1)),
+                 equal(field_ref("u8"), literal<uint8_t>(2))));
+  count_rows_and_batches(0, 0);
+
+  SetFilter(or_(equal(field_ref("i64"), literal<int64_t>(2)),
+                equal(field_ref("i64"), literal<int64_t>(4))));
+  count_rows_and_batches(2 + 4, 2);
+
+  SetFilter(greater(field_ref("i64"), literal<int64_t>(kNumBatches - 2)));
+  count_rows_and_batches((kNumBatches - 1) + kNumBatches, 2);
+
+  // Nested columns have no statistics and don't allow skipping
+  SetFilter(equal(field_ref(FieldRef("struct", "i32")), literal(1)));
+  count_rows_and_batches(kTotalNumRows, kNumBatches);
+}
+
 INSTANTIATE_TEST_SUITE_P(TestScan, TestIpcFileFormatScan,
                          ::testing::ValuesIn(TestFormatParams::Values()),
                          TestFormatParams::ToTestNameString);
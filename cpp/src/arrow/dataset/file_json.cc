@@ -259,7 +259,7 @@ Result<std::shared_ptr<JsonFragmentScanOptions>> GetJsonFormatOptions(
 
 Result<Future<ReaderPtr>> DoOpenReader(
     const FileSource& source, const JsonFileFormat& format,
-    const std::shared_ptr<ScanOptions>& scan_options = nullptr) {
+    const std::shared_ptr<ScanOptions>& scan_options = nullptr, bool use_threads = true) {
   ARROW_ASSIGN_OR_RAISE(auto json_options,
                         GetJsonFormatOptions(format, scan_options.get()));
 
@@ -276,7 +276,7 @@ Result<Future<ReaderPtr>> DoOpenReader(
   };
 
   auto state = std::make_shared<State>(*json_options, scan_options);
-  ARROW_ASSIGN_OR_RAISE(state->stream, source.OpenCompressed());
+  ARROW_ASSIGN_OR_RAISE(state->stream, source.OpenCompressed(std::nullopt, use_threads));
   ARROW_ASSIGN_OR_RAISE(
       state->stream,
       io::BufferedInputStream::Create(state->read_options.block_size,
@@ -308,15 +308,11 @@ Result<Future<ReaderPtr>> DoOpenReader(
                      });
 }
 
-Future<ReaderPtr> OpenReaderAsync(
-    const FileSource& source, const JsonFileFormat& format,
-    const std::shared_ptr<ScanOptions>& scan_options = nullptr) {
-  return DeferNotOk(DoOpenReader(source, format, scan_options));
-}
-
+// Open a reader to inspect the beginning of the file, decompressing it serially
 Result<ReaderPtr> OpenReader(const FileSource& source, const JsonFileFormat& format,
                              const std::shared_ptr<ScanOptions>& scan_options = nullptr) {
-  return OpenReaderAsync(source, format, scan_options).result();
+  return DeferNotOk(DoOpenReader(source, format, scan_options, /*use_threads=*/false))
+      .result();
 }
 
 Result<RecordBatchGenerator> MakeBatchGenerator(
@@ -335,7 +331,8 @@ Result<RecordBatchGenerator> MakeBatchGenerator(
 Result<std::shared_ptr<InspectedFragment>> DoInspectFragment(
     const FileSource& source, const JsonFragmentScanOptions& format_options,
     MemoryPool* pool) {
-  ARROW_ASSIGN_OR_RAISE(auto stream, source.OpenCompressed());
+  ARROW_ASSIGN_OR_RAISE(auto stream,
+                        source.OpenCompressed(std::nullopt, /*use_threads=*/false));
   ARROW_ASSIGN_OR_RAISE(
       stream, io::BufferedInputStream::Create(format_options.read_options.block_size,
                                               default_memory_pool(), std::move(stream)));
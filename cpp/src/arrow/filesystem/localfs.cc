@@ -19,7 +19,9 @@
 #include <cstring>
 #include <memory>
 #include <sstream>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #ifdef _WIN32
 #include "arrow/util/windows_compatibility.h"
@@ -220,7 +222,10 @@ Status StatSelector(const PlatformFilename& dir_fn, const FileSelector& select,
 LocalFileSystemOptions LocalFileSystemOptions::Defaults() { return {}; }
 
 bool LocalFileSystemOptions::Equals(const LocalFileSystemOptions& other) const {
-  return use_mmap == other.use_mmap && directory_readahead == other.directory_readahead &&
+  return use_mmap == other.use_mmap && use_io_uring == other.use_io_uring &&
+         use_direct_io == other.use_direct_io &&
+         direct_io_pool == other.direct_io_pool &&
+         directory_readahead == other.directory_readahead &&
          file_info_batch_size == other.file_info_batch_size;
 }
 
@@ -253,11 +258,23 @@ Result<LocalFileSystemOptions> LocalFileSystemOptions::FromUri(
     if (key == "use_mmap") {
       if (value.empty()) {
         options.use_mmap = true;
-        continue;
       } else {
         ARROW_ASSIGN_OR_RAISE(options.use_mmap, ::arrow::internal::ParseBoolean(value));
       }
-      break;
+    } else if (key == "use_io_uring") {
+      if (value.empty()) {
+        options.use_io_uring = true;
+      } else {
+        ARROW_ASSIGN_OR_RAISE(options.use_io_uring,
+                              ::arrow::internal::ParseBoolean(value));
+      }
+    } else if (key == "use_direct_io") {
+      if (value.empty()) {
+        options.use_direct_io = true;
+      } else {
+        ARROW_ASSIGN_OR_RAISE(options.use_direct_io,
+                              ::arrow::internal::ParseBoolean(value));
+      }
     }
   }
   return options;
@@ -288,7 +305,21 @@ Result<std::string> LocalFileSystem::PathFromUri(const std::string& uri_string)
 
 Result<std::string> LocalFileSystem::MakeUri(std::string path) const {
   ARROW_ASSIGN_OR_RAISE(path, DoNormalizePath(std::move(path)));
-  return "file://" + path + (options_.use_mmap ? "?use_mmap" : "");
+  std::vector<std::string_view> flags;
+  if (options_.use_mmap) {
+    flags.push_back("use_mmap");
+  }
+  if (options_.use_io_uring) {
+    flags.push_back("use_io_uring");
+  }
+  if (options_.use_direct_io) {
+    flags.push_back("use_direct_io");
+  }
+  std::string uri = "file://" + path;
+  if (!flags.empty()) {
+    uri += "?" + ::arrow::internal::JoinStrings(flags, "&");
+  }
+  return uri;
 }
 
 bool LocalFileSystem::Equals(const FileSystem& other) const {
@@ -653,6 +684,16 @@ Result<std::shared_ptr<InputStreamType>> OpenInputStreamGeneric(
   RETURN_NOT_OK(ValidatePath(path));
   if (options.use_mmap) {
     return io::MemoryMappedFile::Open(path, io::FileMode::READ);
+  }
+  if (options.use_direct_io) {
+    auto maybe_file = io::DirectReadableFile::Open(
+        path, options.direct_io_pool ? options.direct_io_pool : io_context.pool());
+    if (!maybe_file.status().IsNotImplemented()) {
+      return maybe_file;
+    }
+  }
+  if (options.use_io_uring && io::UringReadableFile::IsAvailable()) {
+    return io::UringReadableFile::Open(path, io_context.pool());
   } else {
     return io::ReadableFile::Open(path, io_context.pool());
   }
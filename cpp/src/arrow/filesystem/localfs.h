@@ -41,6 +41,24 @@ struct ARROW_EXPORT LocalFileSystemOptions {
   /// or a regular one.
   bool use_mmap = false;
 
+  /// Whether OpenInputStream and OpenInputFile return a file issuing
+  /// asynchronous reads through io_uring (see io::UringReadableFile)
+  /// rather than through the IO thread pool.
+  /// This is ignored if `use_mmap` is true or io_uring isn't available.
+  bool use_io_uring = false;
+
+  /// Whether OpenInputStream and OpenInputFile return a file bypassing the
+  /// page cache (see io::DirectReadableFile), for large scans that shouldn't
+  /// evict other data from it.  Files on filesystems not supporting direct
+  /// I/O are opened normally.  This takes precedence over `use_io_uring`
+  /// and is ignored if `use_mmap` is true.
+  bool use_direct_io = false;
+
+  /// The pool allocating the aligned read buffers of direct I/O files, or
+  /// null to use the pool of the filesystem's IOContext.  A dedicated pool
+  /// keeps these large, short-lived buffers apart from other allocations.
+  MemoryPool* direct_io_pool = NULLPTR;
+
   /// Options related to `GetFileInfoGenerator` interface.
 
   /// EXPERIMENTAL: The maximum number of directories processed in parallel
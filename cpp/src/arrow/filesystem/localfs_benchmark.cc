@@ -15,8 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <memory>
+#include <random>
 #include <string_view>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 
@@ -27,6 +30,7 @@
 #include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
+#include "arrow/testing/util.h"
 #include "arrow/util/async_generator.h"
 #include "arrow/util/io_util.h"
 
@@ -131,6 +135,92 @@ BENCHMARK_REGISTER_F(LocalFSFixture, AsyncFileDiscovery)
     ->UseRealTime()
     ->Unit(benchmark::kMillisecond);
 
+/// Set up a file to compare asynchronous reads through the IO thread pool
+/// (the default) with reads through io_uring (`use_io_uring`).
+class LocalFSReadFixture : public benchmark::Fixture {
+ public:
+  void SetUp(const benchmark::State& state) override {
+    ASSERT_OK_AND_ASSIGN(tmp_dir_, TemporaryDir::Make("localfs-read-"));
+    ASSERT_OK_AND_ASSIGN(auto path, tmp_dir_->path().Join("data"));
+    path_ = path.ToString();
+
+    std::vector<uint8_t> data(kFileSize);
+    random_bytes(kFileSize, /*seed=*/42, data.data());
+    ASSERT_OK_AND_ASSIGN(auto stream, io::FileOutputStream::Open(path_));
+    ASSERT_OK(stream->Write(data.data(), kFileSize));
+    ASSERT_OK(stream->Close());
+
+    // The whole file in a random order
+    ranges_.clear();
+    for (int64_t offset = 0; offset < kFileSize; offset += kReadSize) {
+      ranges_.push_back({offset, kReadSize});
+    }
+    std::shuffle(ranges_.begin(), ranges_.end(), std::default_random_engine(42));
+  }
+
+  void TearDown(const benchmark::State& state) override { tmp_dir_.reset(); }
+
+ protected:
+  static constexpr int64_t kFileSize = 64 << 20;
+  static constexpr int64_t kReadSize = 64 << 10;
+
+  std::unique_ptr<TemporaryDir> tmp_dir_;
+  std::string path_;
+  std::vector<io::ReadRange> ranges_;
+};
+
+/// Read the file with ReadManyAsync() in batches of `queue_depth` ranges.
+///
+/// Through the IO thread pool, the number of reads actually in flight is
+/// also bounded by the pool's capacity.
+static void ReadManyAsyncBenchmark(benchmark::State& st, const std::string& path,
+                                   const std::vector<io::ReadRange>& ranges,
+                                   bool use_io_uring) {
+  if (use_io_uring && !io::UringReadableFile::IsAvailable()) {
+    st.SkipWithError("io_uring not available");
+    return;
+  }
+  const auto queue_depth = static_cast<size_t>(st.range(0));
+  auto options = LocalFileSystemOptions::Defaults();
+  options.use_io_uring = use_io_uring;
+  LocalFileSystem fs(options);
+  ASSERT_OK_AND_ASSIGN(auto file, fs.OpenInputFile(path));
+
+  int64_t total_bytes = 0;
+  for (auto _ : st) {
+    for (size_t i = 0; i < ranges.size(); i += queue_depth) {
+      std::vector<io::ReadRange> batch(
+          ranges.begin() + i, ranges.begin() + std::min(ranges.size(), i + queue_depth));
+      for (auto& fut : file->ReadManyAsync(batch)) {
+        ASSERT_FINISHES_OK_AND_ASSIGN(auto buffer, fut);
+        total_bytes += buffer->size();
+      }
+    }
+  }
+  st.SetBytesProcessed(total_bytes);
+}
+
+BENCHMARK_DEFINE_F(LocalFSReadFixture, ReadManyAsyncThreadPool)
+(benchmark::State& st) {
+  ReadManyAsyncBenchmark(st, path_, ranges_, /*use_io_uring=*/false);
+}
+
+BENCHMARK_DEFINE_F(LocalFSReadFixture, ReadManyAsyncIoUring)
+(benchmark::State& st) {
+  ReadManyAsyncBenchmark(st, path_, ranges_, /*use_io_uring=*/true);
+}
+
+BENCHMARK_REGISTER_F(LocalFSReadFixture, ReadManyAsyncThreadPool)
+    ->ArgName("queue_depth")
+    ->RangeMultiplier(4)
+    ->Range(1, 256)
+    ->UseRealTime();
+BENCHMARK_REGISTER_F(LocalFSReadFixture, ReadManyAsyncIoUring)
+    ->ArgName("queue_depth")
+    ->RangeMultiplier(4)
+    ->Range(1, 256)
+    ->UseRealTime();
+
 }  // namespace fs
 
 }  // namespace arrow
@@ -28,6 +28,8 @@
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/test_util.h"
 #include "arrow/filesystem/util_internal.h"
+#include "arrow/io/file.h"
+#include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
 #include "arrow/util/io_util.h"
@@ -259,6 +261,28 @@ class TestLocalFSGenericMMap : public TestLocalFSGeneric<CommonPathFormatter> {
 
 GENERIC_FS_TEST_FUNCTIONS(TestLocalFSGenericMMap);
 
+class TestLocalFSGenericIoUring : public TestLocalFSGeneric<CommonPathFormatter> {
+ protected:
+  LocalFileSystemOptions options() override {
+    auto options = LocalFileSystemOptions::Defaults();
+    options.use_io_uring = true;
+    return options;
+  }
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestLocalFSGenericIoUring);
+
+class TestLocalFSGenericDirectIO : public TestLocalFSGeneric<CommonPathFormatter> {
+ protected:
+  LocalFileSystemOptions options() override {
+    auto options = LocalFileSystemOptions::Defaults();
+    options.use_direct_io = true;
+    return options;
+  }
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestLocalFSGenericDirectIO);
+
 ////////////////////////////////////////////////////////////////////////////
 // Concrete LocalFileSystem tests
 
@@ -433,6 +457,22 @@ TYPED_TEST(TestLocalFS, FileSystemFromUriFile) {
     EXPECT_EQ(uri, "file:///_?use_mmap");
   }
 
+  this->TestLocalUri("file:///_?use_mmap&use_io_uring=true", "/_");
+  if (this->path_formatter_.supports_uri()) {
+    ASSERT_TRUE(this->local_fs_->options().use_mmap);
+    ASSERT_TRUE(this->local_fs_->options().use_io_uring);
+    ASSERT_OK_AND_ASSIGN(auto uri, this->fs_->MakeUri("/_"));
+    EXPECT_EQ(uri, "file:///_?use_mmap&use_io_uring");
+  }
+
+  this->TestLocalUri("file:///_?use_direct_io", "/_");
+  if (this->path_formatter_.supports_uri()) {
+    ASSERT_FALSE(this->local_fs_->options().use_mmap);
+    ASSERT_TRUE(this->local_fs_->options().use_direct_io);
+    ASSERT_OK_AND_ASSIGN(auto uri, this->fs_->MakeUri("/_"));
+    EXPECT_EQ(uri, "file:///_?use_direct_io");
+  }
+
 #ifdef _WIN32
   this->TestLocalUri("file:/C:/foo/bar", "C:/foo/bar");
   this->TestLocalUri("file:///C:/foo/bar", "C:/foo/bar");
@@ -533,6 +573,22 @@ TYPED_TEST(TestLocalFS, FileMTime) {
   AssertDurationBetween(t2 - infos[1].mtime(), -kTimeSlack, kTimeSlack);
 }
 
+TYPED_TEST(TestLocalFS, DirectIOPool) {
+  ProxyMemoryPool pool(default_memory_pool());
+  this->options_.use_direct_io = true;
+  this->options_.direct_io_pool = &pool;
+  this->MakeFileSystem();
+  CreateFile(this->fs_.get(), "ab", "some data");
+
+  ASSERT_OK_AND_ASSIGN(auto file, this->fs_->OpenInputFile("ab"));
+  if (dynamic_cast<io::DirectReadableFile*>(file.get()) == nullptr) {
+    GTEST_SKIP() << "Direct I/O is not supported for the temporary directory";
+  }
+  ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(5, 4));
+  AssertBufferEqual(*buffer, "data");
+  ASSERT_EQ(1, pool.num_allocations());
+}
+
 struct DirTreeCreator {
   static constexpr int kFilesPerDir = 50;
   static constexpr int kDirLevels = 2;
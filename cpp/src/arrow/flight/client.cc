@@ -20,10 +20,16 @@
 // Platform-specific defines
 #include "arrow/flight/platform.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/ipc/options.h"
@@ -32,8 +38,11 @@
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/flight/client_auth.h"
 #include "arrow/flight/serialization_internal.h"
@@ -110,6 +119,10 @@ std::shared_ptr<FlightWriteSizeStatusDetail> FlightWriteSizeStatusDetail::Unwrap
 
 FlightClientOptions FlightClientOptions::Defaults() { return FlightClientOptions(); }
 
+FlightEndpointsReaderOptions FlightEndpointsReaderOptions::Defaults() {
+  return FlightEndpointsReaderOptions();
+}
+
 arrow::Result<std::shared_ptr<Table>> FlightStreamReader::ToTable(
     const StopToken& stop_token) {
   ARROW_ASSIGN_OR_RAISE(auto batches, ToRecordBatches(stop_token));
@@ -319,19 +332,17 @@ class ServerErrorTagStatusDetail : public arrow::StatusDetail {
   }
 };
 
-/// \brief An IpcPayloadWriter for any ClientDataStream.
+/// \brief An IpcPayloadWriter producing Flight payloads.
 ///
 /// To support app_metadata and reuse the existing IPC infrastructure,
 /// this takes a pointer to a buffer to be combined with the IPC
 /// payload when writing a Flight payload.
-class ClientPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
+class PutPayloadWriterBase : public ipc::internal::IpcPayloadWriter {
  public:
-  ClientPutPayloadWriter(std::shared_ptr<internal::ClientDataStream> stream,
-                         FlightDescriptor descriptor, int64_t write_size_limit_bytes,
-                         std::shared_ptr<Buffer>* app_metadata)
+  PutPayloadWriterBase(FlightDescriptor descriptor, int64_t write_size_limit_bytes,
+                       std::shared_ptr<Buffer>* app_metadata)
       : descriptor_(std::move(descriptor)),
         write_size_limit_bytes_(write_size_limit_bytes),
-        stream_(std::move(stream)),
         app_metadata_(app_metadata),
         first_payload_(true) {}
 
@@ -368,27 +379,48 @@ class ClientPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
             std::make_shared<FlightWriteSizeStatusDetail>(write_size_limit_bytes_, size));
       }
     }
-    ARROW_ASSIGN_OR_RAISE(auto success, stream_->WriteData(payload));
-    if (!success) {
-      return Status::FromDetailAndArgs(
-          StatusCode::IOError, std::make_shared<ServerErrorTagStatusDetail>(),
-          "Could not write record batch to stream (server disconnect?)");
-    }
-    return Status::OK();
+    return WriteFlightPayload(payload);
   }
   Status Close() override {
     // Closing is handled one layer up in ClientStreamWriter::Close
     return Status::OK();
   }
 
+ protected:
+  virtual Status WriteFlightPayload(const FlightPayload& payload) = 0;
+
  private:
   const FlightDescriptor descriptor_;
   const int64_t write_size_limit_bytes_;
-  std::shared_ptr<internal::ClientDataStream> stream_;
   std::shared_ptr<Buffer>* app_metadata_;
   bool first_payload_;
 };
 
+/// \brief A PutPayloadWriterBase for any ClientDataStream.
+class ClientPutPayloadWriter : public PutPayloadWriterBase {
+ public:
+  ClientPutPayloadWriter(std::shared_ptr<internal::ClientDataStream> stream,
+                         FlightDescriptor descriptor, int64_t write_size_limit_bytes,
+                         std::shared_ptr<Buffer>* app_metadata)
+      : PutPayloadWriterBase(std::move(descriptor), write_size_limit_bytes,
+                             app_metadata),
+        stream_(std::move(stream)) {}
+
+ protected:
+  Status WriteFlightPayload(const FlightPayload& payload) override {
+    ARROW_ASSIGN_OR_RAISE(auto success, stream_->WriteData(payload));
+    if (!success) {
+      return Status::FromDetailAndArgs(
+          StatusCode::IOError, std::make_shared<ServerErrorTagStatusDetail>(),
+          "Could not write record batch to stream (server disconnect?)");
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<internal::ClientDataStream> stream_;
+};
+
 class ClientStreamWriter : public FlightStreamWriter {
  public:
   explicit ClientStreamWriter(std::shared_ptr<internal::ClientDataStream> stream,
@@ -537,6 +569,769 @@ class ClientStreamWriter : public FlightStreamWriter {
   FlightDescriptor descriptor_;
 };
 
+//------------------------------------------------------------
+// Async data streams
+
+/// \brief The state of an async DoGet/DoPut/DoExchange, shared by
+///   its reader and writer and notified by the transport.
+///
+/// Messages are opened as they arrive and queued. Reads are requested
+/// from the transport while fewer than kReadAheadMessages are queued,
+/// or while the consumer waits for a message that has not arrived,
+/// so that a slow consumer holds back the server. Futures are always
+/// completed without holding the lock, as their callbacks may call
+/// back into the stream.
+class AsyncClientStream : public AsyncListener<internal::FlightData>,
+                          public std::enable_shared_from_this<AsyncClientStream> {
+ public:
+  static constexpr size_t kReadAheadMessages = 4;
+
+  AsyncClientStream(const FlightCallOptions& options, bool has_writer)
+      : read_options_(options.read_options),
+        memory_manager_(options.memory_manager
+                            ? options.memory_manager
+                            : CPUDevice::Instance()->default_memory_manager()),
+        writer_alive_(has_writer) {}
+
+  /// Start reading ahead once the transport started the call.
+  void Start() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    MaybeReadLocked();
+  }
+
+  void OnNext(internal::FlightData data) override {
+    Entry entry;
+    entry.app_metadata = std::move(data.app_metadata);
+    Status status;
+    if (data.metadata) {
+      // Validate the IPC message
+      if (data.body) {
+        status = Buffer::ViewOrCopy(data.body, memory_manager_).Value(&data.body);
+      }
+      if (status.ok()) {
+        status = data.OpenMessage().Value(&entry.message);
+      }
+    }
+
+    Future<> waiter;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      read_outstanding_ = false;
+      if (!status.ok()) {
+        client_status_ = std::move(status);
+        internal::ClientTransport::GetAsyncRpc(this)->TryCancel();
+        return;
+      }
+      if (!draining_) {
+        queue_.push_back(std::move(entry));
+        if (waiter_.is_valid() && ReadyLocked(waiter_started_)) {
+          waiter = std::move(waiter_);
+          waiter_ = Future<>();
+        }
+      }
+      MaybeReadLocked();
+    }
+    if (waiter.is_valid()) waiter.MarkFinished();
+  }
+
+  void OnFinish(Status status) override {
+    Future<> waiter;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      finished_ = true;
+      // A client-side error caused the cancellation
+      final_status_ = client_status_.ok() ? std::move(status) : client_status_;
+      waiter = std::move(waiter_);
+      waiter_ = Future<>();
+    }
+    if (waiter.is_valid()) waiter.MarkFinished();
+    finished_future_.MarkFinished(final_status_);
+  }
+
+  Future<std::shared_ptr<Schema>> GetSchema() {
+    if (batch_reader_) {
+      return batch_reader_->schema();
+    }
+    auto self = shared_from_this();
+    return WaitReadable(/*started=*/false)
+        .Then([self]() -> arrow::Result<std::shared_ptr<Schema>> {
+          RETURN_NOT_OK(self->EnsureDataStarted());
+          return self->batch_reader_->schema();
+        });
+  }
+
+  Future<FlightStreamChunk> Next() {
+    auto self = shared_from_this();
+    return WaitReadable(/*started=*/batch_reader_ != nullptr).Then([self]() {
+      return self->NextReadable();
+    });
+  }
+
+  void Cancel() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (finished_) return;
+    internal::ClientTransport::GetAsyncRpc(this)->TryCancel();
+  }
+
+  Future<bool> Write(FlightPayload payload) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (finished_) return false;
+    return internal::ClientTransport::GetAsyncRpc(this)->Write(std::move(payload));
+  }
+
+  void DoneWriting() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (finished_) return;
+    internal::ClientTransport::GetAsyncRpc(this)->DoneWriting();
+  }
+
+  /// Discard any unread and future messages so the call can end.
+  void Drain() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    DrainLocked();
+  }
+
+  void ReleaseReader() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (writer_alive_) {
+      DrainLocked();
+    } else if (!finished_ && !draining_) {
+      internal::ClientTransport::GetAsyncRpc(this)->TryCancel();
+    }
+  }
+
+  void ReleaseWriter() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    writer_alive_ = false;
+  }
+
+  /// Completes with the final status of the call.
+  const Future<>& finished() const { return finished_future_; }
+
+ private:
+  struct Entry {
+    // Null for metadata-only messages
+    std::unique_ptr<ipc::Message> message;
+    std::shared_ptr<Buffer> app_metadata;
+  };
+
+  /// An ipc::MessageReader over the queued messages, only used once
+  /// the messages it needs have arrived.
+  class QueueMessageReader : public ipc::MessageReader {
+   public:
+    explicit QueueMessageReader(AsyncClientStream* stream) : stream_(stream) {}
+
+    arrow::Result<std::unique_ptr<ipc::Message>> ReadNextMessage() override {
+      std::lock_guard<std::mutex> guard(stream_->mutex_);
+      auto& queue = stream_->queue_;
+      // Metadata-only messages cannot be represented here; skip them
+      while (!queue.empty() && !queue.front().message) {
+        queue.pop_front();
+      }
+      if (queue.empty()) {
+        return nullptr;
+      }
+      Entry entry = std::move(queue.front());
+      queue.pop_front();
+      stream_->MaybeReadLocked();
+      stream_->app_metadata_ = std::move(entry.app_metadata);
+      return std::move(entry.message);
+    }
+
+   private:
+    AsyncClientStream* stream_;
+  };
+
+  // Whether Next() can make progress without waiting for the server.
+  // 'started' is whether the schema was already read.
+  bool ReadyLocked(bool started) const {
+    if (finished_) return true;
+    if (queue_.empty()) return false;
+    if (!queue_.front().message || !started) return true;
+    // Dictionary batches may precede the record batch
+    return std::any_of(queue_.begin(), queue_.end(), [](const Entry& entry) {
+      return entry.message && entry.message->type() == ipc::MessageType::RECORD_BATCH;
+    });
+  }
+
+  Future<> WaitReadable(bool started) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (ReadyLocked(started)) {
+      return Future<>::MakeFinished();
+    }
+    DCHECK(!waiter_.is_valid()) << "Concurrent reads on an async Flight stream";
+    waiter_ = Future<>::Make();
+    waiter_started_ = started;
+    MaybeReadLocked();
+    return waiter_;
+  }
+
+  void MaybeReadLocked() {
+    if (finished_ || read_outstanding_) return;
+    if (draining_ || waiter_.is_valid() || queue_.size() < kReadAheadMessages) {
+      read_outstanding_ = true;
+      internal::ClientTransport::GetAsyncRpc(this)->StartRead();
+    }
+  }
+
+  void DrainLocked() {
+    draining_ = true;
+    queue_.clear();
+    MaybeReadLocked();
+  }
+
+  Status FinalStatusLocked() const {
+    if (final_status_.ok() && draining_) {
+      return Status::Invalid("The async Flight stream was closed");
+    }
+    return final_status_;
+  }
+
+  Status EnsureDataStarted() {
+    if (batch_reader_) return Status::OK();
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      // Discard metadata preceding the first data message
+      while (!queue_.empty() && !queue_.front().message) {
+        queue_.pop_front();
+      }
+      if (queue_.empty()) {
+        DCHECK(finished_);
+        RETURN_NOT_OK(FinalStatusLocked());
+        return MakeFlightError(FlightStatusCode::Internal,
+                               "Server never sent a data message");
+      }
+    }
+    auto status = ipc::RecordBatchStreamReader::Open(
+                      std::make_unique<QueueMessageReader>(this), read_options_)
+                      .Value(&batch_reader_);
+    if (!status.ok()) {
+      Cancel();
+    }
+    return status;
+  }
+
+  // Called once ReadyLocked() returned true
+  Future<FlightStreamChunk> NextReadable() {
+    FlightStreamChunk out;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      if (queue_.empty()) {
+        DCHECK(finished_);
+        RETURN_NOT_OK(FinalStatusLocked());
+        return out;
+      }
+      if (!queue_.front().message) {
+        out.app_metadata = std::move(queue_.front().app_metadata);
+        queue_.pop_front();
+        MaybeReadLocked();
+        return out;
+      }
+    }
+    if (!batch_reader_) {
+      RETURN_NOT_OK(EnsureDataStarted());
+      return Next();
+    }
+    auto status = batch_reader_->ReadNext(&out.data);
+    if (!status.ok()) {
+      Cancel();
+      return status;
+    }
+    if (!out.data) {
+      // The stream ended
+      std::lock_guard<std::mutex> guard(mutex_);
+      RETURN_NOT_OK(FinalStatusLocked());
+      return out;
+    }
+    out.app_metadata = std::move(app_metadata_);
+    return out;
+  }
+
+  const ipc::IpcReadOptions read_options_;
+  const std::shared_ptr<MemoryManager> memory_manager_;
+
+  std::mutex mutex_;
+  std::deque<Entry> queue_;
+  bool read_outstanding_ = false;
+  bool draining_ = false;
+  bool writer_alive_;
+  // A consumer waiting for the stream to become ready
+  Future<> waiter_;
+  bool waiter_started_ = false;
+  bool finished_ = false;
+  Status client_status_;
+  Status final_status_;
+  Future<> finished_future_ = Future<>::Make();
+
+  // Only used by the consumer, which does not read concurrently
+  std::shared_ptr<ipc::RecordBatchReader> batch_reader_;
+  std::shared_ptr<Buffer> app_metadata_;
+};
+
+class AsyncClientStreamReader : public AsyncFlightStreamReader {
+ public:
+  explicit AsyncClientStreamReader(std::shared_ptr<AsyncClientStream> stream)
+      : stream_(std::move(stream)) {}
+  ~AsyncClientStreamReader() override { stream_->ReleaseReader(); }
+
+  Future<std::shared_ptr<Schema>> GetSchema() override { return stream_->GetSchema(); }
+  Future<FlightStreamChunk> Next() override { return stream_->Next(); }
+  void Cancel() override { stream_->Cancel(); }
+
+  AsyncGenerator<std::shared_ptr<RecordBatch>> ToRecordBatchGenerator() override {
+    // Hold on to the stream, as the generator may outlive the reader
+    auto stream = stream_;
+    return [stream]() {
+      return Loop([stream]() {
+        return stream->Next().Then([](const FlightStreamChunk& chunk)
+                                       -> ControlFlow<std::shared_ptr<RecordBatch>> {
+          // Skip metadata-only chunks; end of stream yields null
+          if (chunk.data || !chunk.app_metadata) {
+            return Break(chunk.data);
+          }
+          return Continue();
+        });
+      });
+    };
+  }
+
+  Future<std::vector<std::shared_ptr<RecordBatch>>> ToRecordBatches() override {
+    return CollectAsyncGenerator(ToRecordBatchGenerator());
+  }
+
+  Future<std::shared_ptr<Table>> ToTable() override {
+    auto batches = ToRecordBatchGenerator();
+    return stream_->GetSchema().Then(
+        [batches](const std::shared_ptr<Schema>& schema) {
+          return CollectAsyncGenerator(batches).Then(
+              [schema](const std::vector<std::shared_ptr<RecordBatch>>& batches) {
+                return Table::FromRecordBatches(schema, batches);
+              });
+        });
+  }
+
+ private:
+  std::shared_ptr<AsyncClientStream> stream_;
+};
+
+class AsyncClientMetadataReader : public AsyncFlightMetadataReader {
+ public:
+  explicit AsyncClientMetadataReader(std::shared_ptr<AsyncClientStream> stream)
+      : stream_(std::move(stream)) {}
+  ~AsyncClientMetadataReader() override { stream_->ReleaseReader(); }
+
+  Future<std::shared_ptr<Buffer>> ReadMetadata() override {
+    return stream_->Next().Then(
+        [](const FlightStreamChunk& chunk) { return chunk.app_metadata; });
+  }
+
+ private:
+  std::shared_ptr<AsyncClientStream> stream_;
+};
+
+/// \brief A PutPayloadWriterBase queueing payloads on an AsyncClientStream.
+class AsyncPutPayloadWriter : public PutPayloadWriterBase {
+ public:
+  AsyncPutPayloadWriter(std::shared_ptr<AsyncClientStream> stream,
+                        FlightDescriptor descriptor, int64_t write_size_limit_bytes,
+                        std::shared_ptr<Buffer>* app_metadata,
+                        Future<bool>* last_write)
+      : PutPayloadWriterBase(std::move(descriptor), write_size_limit_bytes,
+                             app_metadata),
+        stream_(std::move(stream)),
+        last_write_(last_write) {}
+
+ protected:
+  Status WriteFlightPayload(const FlightPayload& payload) override {
+    // Writes complete in order, so only the last one needs tracking
+    *last_write_ = stream_->Write(payload);
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<AsyncClientStream> stream_;
+  Future<bool>* last_write_;
+};
+
+class AsyncClientStreamWriter : public AsyncFlightStreamWriter {
+ public:
+  AsyncClientStreamWriter(std::shared_ptr<AsyncClientStream> stream,
+                          const ipc::IpcWriteOptions& options,
+                          int64_t write_size_limit_bytes, FlightDescriptor descriptor)
+      : stream_(std::move(stream)),
+        write_options_(options),
+        write_size_limit_bytes_(write_size_limit_bytes),
+        descriptor_(std::move(descriptor)),
+        last_write_(Future<bool>::MakeFinished(true)) {}
+
+  ~AsyncClientStreamWriter() override {
+    // Unlike Close(), let the application keep reading from the stream
+    if (!done_writing_) {
+      ARROW_WARN_NOT_OK(FinishWriting(), "DoneWriting() failed");
+    }
+    stream_->ReleaseWriter();
+  }
+
+  Future<> Begin(const std::shared_ptr<Schema>& schema) override {
+    return Begin(schema, write_options_);
+  }
+
+  Future<> Begin(const std::shared_ptr<Schema>& schema,
+                 const ipc::IpcWriteOptions& options) override {
+    if (batch_writer_) {
+      return Status::Invalid("This writer has already been started.");
+    }
+    auto payload_writer = std::make_unique<AsyncPutPayloadWriter>(
+        stream_, std::move(descriptor_), write_size_limit_bytes_, &app_metadata_,
+        &last_write_);
+    // XXX: like ClientStreamWriter, this does not actually write the
+    // schema until the first batch or Close().
+    auto status =
+        ipc::internal::OpenRecordBatchWriter(std::move(payload_writer), schema, options)
+            .Value(&batch_writer_);
+    if (!status.ok()) {
+      stream_->Cancel();
+    }
+    return status;
+  }
+
+  // Used by FlightClient::DoExchangeAsync
+  Status WriteDescriptor() {
+    FlightPayload payload;
+    RETURN_NOT_OK(internal::ToPayload(descriptor_, &payload.descriptor));
+    last_write_ = stream_->Write(std::move(payload));
+    return Status::OK();
+  }
+
+  Future<> WriteRecordBatch(const RecordBatch& batch) override {
+    return WriteWithMetadata(batch, nullptr);
+  }
+
+  Future<> WriteWithMetadata(const RecordBatch& batch,
+                             std::shared_ptr<Buffer> app_metadata) override {
+    if (!batch_writer_) {
+      return Status::Invalid("Writer not initialized. Call Begin() with a schema.");
+    }
+    app_metadata_ = std::move(app_metadata);
+    RETURN_NOT_OK(batch_writer_->WriteRecordBatch(batch));
+    return LastWriteResult();
+  }
+
+  Future<> WriteMetadata(std::shared_ptr<Buffer> app_metadata) override {
+    FlightPayload payload;
+    payload.app_metadata = std::move(app_metadata);
+    last_write_ = stream_->Write(std::move(payload));
+    return LastWriteResult();
+  }
+
+  Future<> DoneWriting() override {
+    if (!done_writing_) {
+      RETURN_NOT_OK(FinishWriting());
+    }
+    return LastWriteResult();
+  }
+
+  Future<> Close() override {
+    if (!close_future_.is_valid()) {
+      Status status = done_writing_ ? Status::OK() : FinishWriting();
+      stream_->Drain();
+      close_future_ = stream_->finished().Then(
+          [status]() { return status; },
+          [status](const Status& server_status) {
+            return status.ok() ? server_status : status;
+          });
+    }
+    return close_future_;
+  }
+
+ private:
+  Status FinishWriting() {
+    done_writing_ = true;
+    if (batch_writer_) {
+      // This writes the schema if no batch was written yet
+      auto status = batch_writer_->Close();
+      if (!status.ok()) {
+        stream_->Cancel();
+        return status;
+      }
+    }
+    stream_->DoneWriting();
+    return Status::OK();
+  }
+
+  Future<> LastWriteResult() const {
+    return last_write_.Then([](bool success) -> Status {
+      if (!success) {
+        return Status::IOError(
+            "Could not write to stream (server disconnect?); Close() the writer "
+            "to get the server error");
+      }
+      return Status::OK();
+    });
+  }
+
+  std::shared_ptr<AsyncClientStream> stream_;
+  std::unique_ptr<ipc::RecordBatchWriter> batch_writer_;
+  std::shared_ptr<Buffer> app_metadata_;
+  bool done_writing_ = false;
+  Future<> close_future_;
+
+  // Temporary state to construct the IPC payload writer
+  ipc::IpcWriteOptions write_options_;
+  int64_t write_size_limit_bytes_;
+  FlightDescriptor descriptor_;
+  Future<bool> last_write_;
+};
+
+AsyncFlightStreamReader::~AsyncFlightStreamReader() = default;
+
+AsyncFlightStreamWriter::~AsyncFlightStreamWriter() = default;
+
+AsyncFlightMetadataReader::~AsyncFlightMetadataReader() = default;
+
+/// Reads the endpoints of a FlightInfo concurrently on a dedicated
+/// thread pool, buffering a bounded amount of data for the consumer.
+class FlightEndpointsReader : public RecordBatchReader {
+ public:
+  FlightEndpointsReader(FlightClient* client, const FlightCallOptions& call_options,
+                        std::vector<FlightEndpoint> endpoints,
+                        const FlightEndpointsReaderOptions& options)
+      : client_(client),
+        call_options_(call_options),
+        endpoints_(std::move(endpoints)),
+        options_(options),
+        queues_(options.preserve_order ? endpoints_.size() : 1),
+        done_(endpoints_.size(), false),
+        streams_(endpoints_.size(), nullptr) {}
+
+  ~FlightEndpointsReader() override {
+    ARROW_WARN_NOT_OK(Close(), "Failed to close FlightEndpointsReader");
+  }
+
+  /// Start reading. If the schema isn't known, wait for the first
+  /// endpoint to provide it.
+  Status Start(std::shared_ptr<Schema> schema) {
+    schema_ = std::move(schema);
+    if (endpoints_.empty()) {
+      if (!schema_) return Status::Invalid("Flight has neither a schema nor endpoints");
+      return Status::OK();
+    }
+    const int num_threads = static_cast<int>(std::min<size_t>(
+        static_cast<size_t>(options_.max_concurrent_streams), endpoints_.size()));
+    ARROW_ASSIGN_OR_RAISE(pool_, ::arrow::internal::ThreadPool::Make(num_threads));
+    // The pool starts tasks in order, so that in ordered mode the
+    // endpoint being consumed is always being read
+    for (size_t i = 0; i < endpoints_.size(); i++) {
+      RETURN_NOT_OK(pool_->Spawn([this, i]() { ReadEndpoint(i); }));
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    consumer_cv_.wait(lock, [&]() {
+      return schema_ || !status_.ok() || num_done_ == endpoints_.size();
+    });
+    RETURN_NOT_OK(status_);
+    if (!schema_) return Status::Invalid("Flight has no schema and no data");
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    *out = nullptr;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      RETURN_NOT_OK(status_);
+      if (closed_) return Status::OK();
+      const size_t index = options_.preserve_order ? current_ : 0;
+      if (index < queues_.size() && !queues_[index].empty()) {
+        *out = std::move(queues_[index].front().batch);
+        buffered_bytes_ -= queues_[index].front().size;
+        queues_[index].pop_front();
+        producer_cv_.notify_all();
+        return Status::OK();
+      }
+      if (options_.preserve_order) {
+        if (current_ == endpoints_.size()) return Status::OK();
+        if (done_[current_]) {
+          // Move on to the next endpoint, which may now buffer freely
+          ++current_;
+          producer_cv_.notify_all();
+          continue;
+        }
+      } else if (num_done_ == endpoints_.size()) {
+        return Status::OK();
+      }
+      consumer_cv_.wait(lock);
+    }
+  }
+
+  Status Close() override {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      if (closed_) return Status::OK();
+      closed_ = stopped_ = true;
+      for (auto* stream : streams_) {
+        if (stream) stream->Cancel();
+      }
+      consumer_cv_.notify_all();
+      producer_cv_.notify_all();
+    }
+    Status st;
+    if (pool_) st &= pool_->Shutdown();
+    for (auto& [uri, client] : clients_) {
+      st &= client->Close();
+    }
+    return st;
+  }
+
+ private:
+  struct BufferedBatch {
+    std::shared_ptr<RecordBatch> batch;
+    int64_t size;
+  };
+
+  void ReadEndpoint(size_t i) {
+    Status st = ReadEndpointLocations(i);
+    std::lock_guard<std::mutex> guard(mutex_);
+    // Errors caused by stopping the other streams are not interesting
+    if (!st.ok() && !stopped_) {
+      status_ = std::move(st);
+      stopped_ = true;
+      for (auto* stream : streams_) {
+        if (stream) stream->Cancel();
+      }
+    }
+    done_[i] = true;
+    ++num_done_;
+    consumer_cv_.notify_all();
+    producer_cv_.notify_all();
+  }
+
+  Status ReadEndpointLocations(size_t i) {
+    std::vector<Location> locations = endpoints_[i].locations;
+    if (locations.empty()) {
+      locations.push_back(Location::ReuseConnection());
+    }
+    Status st;
+    for (const auto& location : locations) {
+      bool got_data = false;
+      st = ReadEndpointFrom(i, location, &got_data);
+      // Fail over to the next location, unless data would be duplicated
+      if (st.ok() || got_data || IsStopped()) break;
+    }
+    return st;
+  }
+
+  Status ReadEndpointFrom(size_t i, const Location& location, bool* got_data) {
+    if (IsStopped()) return Status::OK();
+    ARROW_ASSIGN_OR_RAISE(auto client, GetClient(location));
+    ARROW_ASSIGN_OR_RAISE(auto stream,
+                          client->DoGet(call_options_, endpoints_[i].ticket));
+    ARROW_ASSIGN_OR_RAISE(auto schema, stream->GetSchema());
+    RETURN_NOT_OK(CheckSchema(*schema, schema));
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      if (stopped_) return Status::OK();
+      streams_[i] = stream.get();
+    }
+    Status st = ReadStream(i, stream.get(), got_data);
+    std::lock_guard<std::mutex> guard(mutex_);
+    streams_[i] = nullptr;
+    return st;
+  }
+
+  Status ReadStream(size_t i, FlightStreamReader* stream, bool* got_data) {
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(FlightStreamChunk chunk, stream->Next());
+      if (!chunk.data) {
+        if (chunk.app_metadata) continue;
+        return Status::OK();
+      }
+      if (!Push(i, std::move(chunk.data))) return Status::OK();
+      *got_data = true;
+    }
+  }
+
+  /// Queue a batch, waiting for buffer space. Returns false if stopped.
+  bool Push(size_t i, std::shared_ptr<RecordBatch> batch) {
+    const int64_t size = util::TotalBufferSize(*batch);
+    const size_t index = options_.preserve_order ? i : 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    producer_cv_.wait(lock, [&]() {
+      // The endpoint being consumed must make progress no matter what, but
+      // only needs one batch queued at a time to do so
+      return stopped_ || buffered_bytes_ == 0 ||
+             buffered_bytes_ + size <= options_.max_buffered_bytes ||
+             (options_.preserve_order && i == current_ && queues_[i].empty());
+    });
+    if (stopped_) return false;
+    queues_[index].push_back({std::move(batch), size});
+    buffered_bytes_ += size;
+    consumer_cv_.notify_all();
+    return true;
+  }
+
+  Status CheckSchema(const Schema& schema, const std::shared_ptr<Schema>& owned) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!schema_) {
+      schema_ = owned;
+      consumer_cv_.notify_all();
+      return Status::OK();
+    }
+    if (!schema_->Equals(schema, /*check_metadata=*/false)) {
+      return Status::Invalid("Flight endpoint has schema ", schema.ToString(),
+                             ", expected ", schema_->ToString());
+    }
+    return Status::OK();
+  }
+
+  arrow::Result<FlightClient*> GetClient(const Location& location) {
+    if (location == Location::ReuseConnection()) return client_;
+    std::lock_guard<std::mutex> guard(clients_mutex_);
+    auto& client = clients_[location.ToString()];
+    if (!client) {
+      auto maybe_client = FlightClient::Connect(location, options_.client_options);
+      if (!maybe_client.ok()) {
+        clients_.erase(location.ToString());
+        return maybe_client.status();
+      }
+      client = std::move(maybe_client).MoveValueUnsafe();
+    }
+    return client.get();
+  }
+
+  bool IsStopped() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return stopped_;
+  }
+
+  FlightClient* client_;
+  const FlightCallOptions call_options_;
+  const std::vector<FlightEndpoint> endpoints_;
+  const FlightEndpointsReaderOptions options_;
+  std::shared_ptr<Schema> schema_;
+
+  std::mutex clients_mutex_;
+  std::unordered_map<std::string, std::unique_ptr<FlightClient>> clients_;
+
+  std::mutex mutex_;
+  std::condition_variable consumer_cv_;
+  std::condition_variable producer_cv_;
+  // One queue per endpoint if preserving order, else a single one
+  std::vector<std::deque<BufferedBatch>> queues_;
+  std::vector<bool> done_;
+  std::vector<FlightStreamReader*> streams_;
+  int64_t buffered_bytes_ = 0;
+  size_t current_ = 0;
+  size_t num_done_ = 0;
+  Status status_;
+  bool stopped_ = false;
+  bool closed_ = false;
+
+  // Destroy first, since its tasks refer to the above
+  std::shared_ptr<::arrow::internal::ThreadPool> pool_;
+};
+
 FlightClient::FlightClient() : closed_(false), write_size_limit_bytes_(0) {}
 
 FlightClient::~FlightClient() {
@@ -680,6 +1475,25 @@ arrow::Result<std::unique_ptr<FlightStreamReader>> FlightClient::DoGet(
   return stream_reader;
 }
 
+arrow::Result<std::shared_ptr<RecordBatchReader>> FlightClient::DoGetEndpoints(
+    const FlightCallOptions& options, const FlightInfo& info,
+    const FlightEndpointsReaderOptions& reader_options) {
+  RETURN_NOT_OK(CheckOpen());
+  if (reader_options.max_concurrent_streams <= 0) {
+    return Status::Invalid("max_concurrent_streams must be positive");
+  }
+  // Prefer the advertised schema; otherwise use the first endpoint's
+  ipc::DictionaryMemo memo;
+  std::shared_ptr<Schema> schema;
+  auto maybe_schema = info.GetSchema(&memo);
+  if (maybe_schema.ok()) schema = maybe_schema.MoveValueUnsafe();
+
+  auto reader = std::make_shared<FlightEndpointsReader>(this, options, info.endpoints(),
+                                                        reader_options);
+  RETURN_NOT_OK(reader->Start(std::move(schema)));
+  return reader;
+}
+
 arrow::Result<FlightClient::DoPutResult> FlightClient::DoPut(
     const FlightCallOptions& options, const FlightDescriptor& descriptor,
     const std::shared_ptr<Schema>& schema) {
@@ -713,6 +1527,46 @@ arrow::Result<FlightClient::DoExchangeResult> FlightClient::DoExchange(
   return result;
 }
 
+arrow::Result<std::unique_ptr<AsyncFlightStreamReader>> FlightClient::DoGetAsync(
+    const FlightCallOptions& options, const Ticket& ticket) {
+  RETURN_NOT_OK(CheckOpen());
+  RETURN_NOT_OK(CheckAsyncSupport());
+  auto stream = std::make_shared<AsyncClientStream>(options, /*has_writer=*/false);
+  transport_->DoGetAsync(options, ticket, stream);
+  stream->Start();
+  return std::make_unique<AsyncClientStreamReader>(std::move(stream));
+}
+
+arrow::Result<FlightClient::AsyncDoPutResult> FlightClient::DoPutAsync(
+    const FlightCallOptions& options, const FlightDescriptor& descriptor) {
+  RETURN_NOT_OK(CheckOpen());
+  RETURN_NOT_OK(CheckAsyncSupport());
+  auto stream = std::make_shared<AsyncClientStream>(options, /*has_writer=*/true);
+  transport_->DoPutAsync(options, stream);
+  stream->Start();
+  AsyncDoPutResult result;
+  result.reader = std::make_unique<AsyncClientMetadataReader>(stream);
+  result.writer = std::make_unique<AsyncClientStreamWriter>(
+      std::move(stream), options.write_options, write_size_limit_bytes_, descriptor);
+  return result;
+}
+
+arrow::Result<FlightClient::AsyncDoExchangeResult> FlightClient::DoExchangeAsync(
+    const FlightCallOptions& options, const FlightDescriptor& descriptor) {
+  RETURN_NOT_OK(CheckOpen());
+  RETURN_NOT_OK(CheckAsyncSupport());
+  auto stream = std::make_shared<AsyncClientStream>(options, /*has_writer=*/true);
+  transport_->DoExchangeAsync(options, stream);
+  stream->Start();
+  AsyncDoExchangeResult result;
+  result.reader = std::make_unique<AsyncClientStreamReader>(stream);
+  auto stream_writer = std::make_unique<AsyncClientStreamWriter>(
+      std::move(stream), options.write_options, write_size_limit_bytes_, descriptor);
+  RETURN_NOT_OK(stream_writer->WriteDescriptor());
+  result.writer = std::move(stream_writer);
+  return result;
+}
+
 ::arrow::Result<SetSessionOptionsResult> FlightClient::SetSessionOptions(
     const FlightCallOptions& options, const SetSessionOptionsRequest& request) {
   RETURN_NOT_OK(CheckOpen());
@@ -32,6 +32,7 @@
 #include "arrow/ipc/writer.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/async_generator_fwd.h"
 #include "arrow/util/cancel.h"
 
 #include "arrow/flight/type_fwd.h"
@@ -127,6 +128,33 @@ struct ARROW_FLIGHT_EXPORT FlightClientOptions {
   static FlightClientOptions Defaults();
 };
 
+/// \brief Options for reading all the endpoints of a FlightInfo.
+///
+/// \see FlightClient::DoGetEndpoints
+struct ARROW_FLIGHT_EXPORT FlightEndpointsReaderOptions {
+  /// \brief The maximum number of endpoints to read from concurrently.
+  int max_concurrent_streams = 4;
+  /// \brief A soft limit on the size of the record batches fetched
+  ///     ahead of the consumer.
+  ///
+  /// Streams stop reading from the network once the limit is
+  /// reached. At least one batch is always buffered, so a single
+  /// batch larger than the limit does not stall the reader.
+  int64_t max_buffered_bytes = 64 * 1024 * 1024;
+  /// \brief Whether to return record batches in endpoint order.
+  ///
+  /// If true, all the batches of an endpoint are returned before any
+  /// batch of the next endpoint (endpoints are still fetched
+  /// concurrently). If false, batches are returned as they arrive.
+  bool preserve_order = true;
+  /// \brief Options for connecting to endpoint locations other than
+  ///     the client's own.
+  FlightClientOptions client_options = FlightClientOptions::Defaults();
+
+  /// \brief Get default options.
+  static FlightEndpointsReaderOptions Defaults();
+};
+
 /// \brief A RecordBatchReader exposing Flight metadata and cancel
 /// operations.
 class ARROW_FLIGHT_EXPORT FlightStreamReader : public MetadataRecordBatchReader {
@@ -176,6 +204,106 @@ class ARROW_FLIGHT_EXPORT FlightMetadataReader {
   virtual Status ReadMetadata(std::shared_ptr<Buffer>* out) = 0;
 };
 
+/// \brief An asynchronous reader for a Flight data stream.
+///
+/// Messages are read from the server on demand, with at most a few
+/// messages buffered ahead of the consumer, so that a slow consumer
+/// applies backpressure to the server. A single thread can thus
+/// drive many concurrent streams.
+///
+/// The methods may be called from any thread, but a new GetSchema()
+/// or Next() must not be called before the previous future has
+/// completed.  Destroying the reader before the end of the stream
+/// cancels the call, unless a writer for the same call is still
+/// alive.
+///
+/// This API is EXPERIMENTAL.
+class ARROW_FLIGHT_EXPORT AsyncFlightStreamReader {
+ public:
+  virtual ~AsyncFlightStreamReader();
+
+  /// \brief Get the schema of the stream.
+  ///
+  /// Application metadata sent before the schema is discarded.
+  virtual Future<std::shared_ptr<Schema>> GetSchema() = 0;
+
+  /// \brief Read the next chunk of the stream.
+  ///
+  /// The end of the stream is signaled by a chunk with neither data
+  /// nor app_metadata. If the call failed, the future carries the
+  /// server error once all data received before it was consumed.
+  virtual Future<FlightStreamChunk> Next() = 0;
+
+  /// \brief Try to cancel the call.
+  virtual void Cancel() = 0;
+
+  /// \brief Iterate over the record batches of the stream.
+  ///
+  /// Chunks carrying only application metadata are skipped.
+  /// The generator may outlive the reader, though destroying the
+  /// reader still cancels the call as usual.
+  virtual AsyncGenerator<std::shared_ptr<RecordBatch>> ToRecordBatchGenerator() = 0;
+
+  /// \brief Consume the entire stream as a vector of record batches
+  virtual Future<std::vector<std::shared_ptr<RecordBatch>>> ToRecordBatches() = 0;
+
+  /// \brief Consume the entire stream as a Table
+  virtual Future<std::shared_ptr<Table>> ToTable() = 0;
+};
+
+/// \brief An asynchronous writer for a Flight data stream.
+///
+/// Writes are queued and sent in order. The future returned by a
+/// write completes once it was handed to the transport, so an
+/// application can bound its memory use by waiting for it before
+/// writing more.
+///
+/// This API is EXPERIMENTAL.
+class ARROW_FLIGHT_EXPORT AsyncFlightStreamWriter {
+ public:
+  virtual ~AsyncFlightStreamWriter();
+
+  /// \brief Start writing data with the given schema.
+  virtual Future<> Begin(const std::shared_ptr<Schema>& schema,
+                         const ipc::IpcWriteOptions& options) = 0;
+  /// \brief Start writing data with the given schema and the write
+  /// options of the call.
+  virtual Future<> Begin(const std::shared_ptr<Schema>& schema) = 0;
+
+  /// \brief Write a record batch.
+  virtual Future<> WriteRecordBatch(const RecordBatch& batch) = 0;
+
+  /// \brief Write a record batch along with application metadata.
+  virtual Future<> WriteWithMetadata(const RecordBatch& batch,
+                                     std::shared_ptr<Buffer> app_metadata) = 0;
+
+  /// \brief Write a message containing only application metadata.
+  virtual Future<> WriteMetadata(std::shared_ptr<Buffer> app_metadata) = 0;
+
+  /// \brief Indicate that the application is done writing to this stream.
+  ///
+  /// The server may still send data to the client afterwards.
+  virtual Future<> DoneWriting() = 0;
+
+  /// \brief Finish writing and wait for the end of the call.
+  ///
+  /// Data that the server sends and the application does not read
+  /// is discarded. The future carries the final status of the call.
+  virtual Future<> Close() = 0;
+};
+
+/// \brief An asynchronous reader for the application metadata that
+/// the server sends back during an upload.
+///
+/// This API is EXPERIMENTAL.
+class ARROW_FLIGHT_EXPORT AsyncFlightMetadataReader {
+ public:
+  virtual ~AsyncFlightMetadataReader();
+
+  /// \brief Read a message from the server; null at the end of the stream.
+  virtual Future<std::shared_ptr<Buffer>> ReadMetadata() = 0;
+};
+
 /// \brief Client class for Arrow Flight RPC services.
 /// API experimental for now
 class ARROW_FLIGHT_EXPORT FlightClient {
@@ -345,6 +473,33 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoGet({}, ticket);
   }
 
+  /// \brief Read the data of all the endpoints of a flight as a single
+  /// stream of record batches.
+  ///
+  /// Endpoints are fetched concurrently on background threads. Each
+  /// endpoint is fetched from the first of its locations that works;
+  /// a location is only abandoned for the next one if it fails
+  /// before yielding any data. An endpoint without locations (or with
+  /// Location::ReuseConnection()) is fetched through this client,
+  /// which must outlive the returned reader. Application metadata
+  /// sent alongside the data is discarded.
+  ///
+  /// The returned reader can also be used as an Acero source through
+  /// RecordBatchReaderSourceNodeOptions.
+  ///
+  /// \param[in] options Per-RPC options, used for every DoGet
+  /// \param[in] info The flight to read
+  /// \param[in] reader_options Concurrency and buffering options
+  /// \return Arrow result with a RecordBatchReader over all the endpoints
+  arrow::Result<std::shared_ptr<RecordBatchReader>> DoGetEndpoints(
+      const FlightCallOptions& options, const FlightInfo& info,
+      const FlightEndpointsReaderOptions& reader_options =
+          FlightEndpointsReaderOptions::Defaults());
+  arrow::Result<std::shared_ptr<RecordBatchReader>> DoGetEndpoints(
+      const FlightInfo& info) {
+    return DoGetEndpoints({}, info);
+  }
+
   /// \brief DoPut return value
   struct DoPutResult {
     /// \brief a writer to write record batches to
@@ -383,6 +538,58 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoExchange({}, descriptor);
   }
 
+  /// \brief Asynchronous DoGet.
+  /// \param[in] options Per-RPC options
+  /// \param[in] ticket The flight ticket to use
+  /// \return Arrow result with a reader for the stream
+  ///
+  /// Unlike DoGet, this does not wait for the schema. Errors are
+  /// reported through the reader.
+  ///
+  /// This API is EXPERIMENTAL.
+  arrow::Result<std::unique_ptr<AsyncFlightStreamReader>> DoGetAsync(
+      const FlightCallOptions& options, const Ticket& ticket);
+  arrow::Result<std::unique_ptr<AsyncFlightStreamReader>> DoGetAsync(
+      const Ticket& ticket) {
+    return DoGetAsync({}, ticket);
+  }
+
+  /// \brief Asynchronous DoPut return value
+  struct AsyncDoPutResult {
+    /// \brief a writer to write record batches to
+    std::unique_ptr<AsyncFlightStreamWriter> writer;
+    /// \brief a reader for application metadata from the server
+    std::unique_ptr<AsyncFlightMetadataReader> reader;
+  };
+  /// \brief Asynchronous DoPut.
+  /// \param[in] options Per-RPC options
+  /// \param[in] descriptor the descriptor of the stream
+  ///
+  /// The caller must call Begin() with the schema, then Close() once
+  /// done writing.
+  ///
+  /// This API is EXPERIMENTAL.
+  arrow::Result<AsyncDoPutResult> DoPutAsync(const FlightCallOptions& options,
+                                             const FlightDescriptor& descriptor);
+  arrow::Result<AsyncDoPutResult> DoPutAsync(const FlightDescriptor& descriptor) {
+    return DoPutAsync({}, descriptor);
+  }
+
+  /// \brief Asynchronous DoExchange return value
+  struct AsyncDoExchangeResult {
+    std::unique_ptr<AsyncFlightStreamWriter> writer;
+    std::unique_ptr<AsyncFlightStreamReader> reader;
+  };
+  /// \brief Asynchronous DoExchange.
+  ///
+  /// This API is EXPERIMENTAL.
+  arrow::Result<AsyncDoExchangeResult> DoExchangeAsync(
+      const FlightCallOptions& options, const FlightDescriptor& descriptor);
+  arrow::Result<AsyncDoExchangeResult> DoExchangeAsync(
+      const FlightDescriptor& descriptor) {
+    return DoExchangeAsync({}, descriptor);
+  }
+
   /// \brief Set server session option(s) by name/value. Sessions are generally
   /// persisted via HTTP cookies.
   /// \param[in] options Per-RPC options
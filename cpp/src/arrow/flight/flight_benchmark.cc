@@ -43,6 +43,9 @@
 #include <cuda.h>
 #include "arrow/gpu/cuda_api.h"
 #endif
+#ifdef ARROW_FLIGHT_SHM
+#include "arrow/flight/transport/shm/shm.h"
+#endif
 #ifdef ARROW_WITH_UCX
 #include "arrow/flight/transport/ucx/ucx.h"
 #endif
@@ -50,6 +53,9 @@
 DEFINE_bool(cuda, false, "Allocate results in CUDA memory");
 DEFINE_string(transport, "grpc",
               "The network transport to use. Supported: \"grpc\" (default)"
+#ifdef ARROW_FLIGHT_SHM
+              ", \"shm\""
+#endif  // ARROW_FLIGHT_SHM
 #ifdef ARROW_WITH_UCX
               ", \"ucx\""
 #endif  // ARROW_WITH_UCX
@@ -505,6 +511,25 @@ int main(int argc, char** argv) {
         options.disable_server_verification = true;
       }
     }
+  } else if (FLAGS_transport == "shm") {
+#ifdef ARROW_FLIGHT_SHM
+    arrow::flight::transport::shm::InitializeFlightShm();
+    if (FLAGS_server_unix == "") {
+      FLAGS_server_unix = "/tmp/flight-bench-shm.sock";
+      std::cout << "Using spawned shared memory server" << std::endl;
+      server.reset(
+          new arrow::flight::TestServer("arrow-flight-perf-server", FLAGS_server_unix));
+      server->Start(server_args);
+    } else {
+      std::cout << "Using standalone shared memory server" << std::endl;
+    }
+    std::cout << "Server unix socket: " << FLAGS_server_unix << std::endl;
+    ARROW_CHECK_OK(
+        arrow::flight::Location::Parse("shm://" + FLAGS_server_unix).Value(&location));
+#else
+    std::cerr << "Not built with transport: " << FLAGS_transport << std::endl;
+    return EXIT_FAILURE;
+#endif
   } else if (FLAGS_transport == "ucx") {
 #ifdef ARROW_WITH_UCX
     arrow::flight::transport::ucx::InitializeFlightUcx();
@@ -44,6 +44,9 @@
 #ifdef ARROW_CUDA
 #include "arrow/gpu/cuda_api.h"
 #endif
+#ifdef ARROW_FLIGHT_SHM
+#include "arrow/flight/transport/shm/shm.h"
+#endif
 #ifdef ARROW_WITH_UCX
 #include "arrow/flight/transport/ucx/ucx.h"
 #endif
@@ -51,6 +54,9 @@
 DEFINE_bool(cuda, false, "Allocate results in CUDA memory");
 DEFINE_string(transport, "grpc",
               "The network transport to use. Supported: \"grpc\" (default)"
+#ifdef ARROW_FLIGHT_SHM
+              ", \"shm\""
+#endif  // ARROW_FLIGHT_SHM
 #ifdef ARROW_WITH_UCX
               ", \"ucx\""
 #endif  // ARROW_WITH_UCX
@@ -280,6 +286,21 @@ int main(int argc, char** argv) {
       ARROW_CHECK_OK(arrow::flight::Location::ForGrpcUnix(FLAGS_server_unix)
                          .Value(&connect_location));
     }
+  } else if (FLAGS_transport == "shm") {
+#ifdef ARROW_FLIGHT_SHM
+    arrow::flight::transport::shm::InitializeFlightShm();
+    if (FLAGS_server_unix.empty()) {
+      std::cerr << "Transport requires a socket path (-server_unix): " << FLAGS_transport
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+    ARROW_CHECK_OK(arrow::flight::Location::Parse("shm://" + FLAGS_server_unix)
+                       .Value(&bind_location));
+    connect_location = bind_location;
+#else
+    std::cerr << "Not built with transport: " << FLAGS_transport << std::endl;
+    return EXIT_FAILURE;
+#endif
   } else if (FLAGS_transport == "ucx") {
 #ifdef ARROW_WITH_UCX
     arrow::flight::transport::ucx::InitializeFlightUcx();
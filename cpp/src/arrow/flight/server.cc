@@ -28,15 +28,20 @@
 #include <chrono>
 #include <cstdint>
 #include <memory>
+#include <numeric>
 #include <string_view>
 #include <thread>
 #include <utility>
 
+#include "arrow/buffer.h"
 #include "arrow/device.h"
 #include "arrow/flight/transport.h"
 #include "arrow/flight/transport/grpc/grpc_server.h"
 #include "arrow/flight/transport_server.h"
 #include "arrow/flight/types.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/message.h"
+#include "arrow/ipc/reader.h"
 #include "arrow/status.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
@@ -379,5 +384,122 @@ arrow::Result<FlightPayload> RecordBatchStream::Next() {
   return payload;
 }
 
+// Implement RecordBatchFileStream
+
+class RecordBatchFileStream::RecordBatchFileStreamImpl {
+ public:
+  RecordBatchFileStreamImpl(std::shared_ptr<ipc::RecordBatchFileReader> reader,
+                            std::unique_ptr<ipc::Message> schema_message,
+                            std::shared_ptr<Schema> schema, std::vector<int> indices)
+      : reader_(std::move(reader)),
+        schema_message_(std::move(schema_message)),
+        schema_(std::move(schema)),
+        indices_(std::move(indices)) {}
+
+  static arrow::Result<std::unique_ptr<RecordBatchFileStreamImpl>> Make(
+      std::shared_ptr<io::RandomAccessFile> file, std::vector<int> indices) {
+    // Validates the file magic and reads the footer
+    ARROW_ASSIGN_OR_RAISE(auto reader, ipc::RecordBatchFileReader::Open(file));
+
+    // The file schema is stored as a regular schema message at the start of
+    // the file, after the 8-byte magic and padding. It carries the same
+    // dictionary ids as the dictionary batches of the file, so it can be
+    // sent as is.
+    constexpr int64_t kMessagesOffset = 8;
+    ARROW_ASSIGN_OR_RAISE(auto file_size, file->GetSize());
+    ARROW_ASSIGN_OR_RAISE(auto input,
+                          io::RandomAccessFile::GetStream(file, kMessagesOffset,
+                                                          file_size - kMessagesOffset));
+    ARROW_ASSIGN_OR_RAISE(auto schema_message, ipc::ReadMessage(input.get()));
+    if (!schema_message || schema_message->type() != ipc::MessageType::SCHEMA) {
+      return Status::Invalid("IPC file does not start with a schema message");
+    }
+    ipc::DictionaryMemo dictionary_memo;
+    ARROW_ASSIGN_OR_RAISE(auto schema,
+                          ipc::ReadSchema(*schema_message, &dictionary_memo));
+
+    if (indices.empty()) {
+      indices.resize(reader->num_record_batches());
+      std::iota(indices.begin(), indices.end(), 0);
+    }
+    for (int index : indices) {
+      if (index < 0 || index >= reader->num_record_batches()) {
+        return Status::IndexError("Record batch index ", index,
+                                  " out of bounds for IPC file with ",
+                                  reader->num_record_batches(), " record batches");
+      }
+    }
+    return std::make_unique<RecordBatchFileStreamImpl>(
+        std::move(reader), std::move(schema_message), std::move(schema),
+        std::move(indices));
+  }
+
+  std::shared_ptr<Schema> schema() { return schema_; }
+
+  FlightPayload GetSchemaPayload() { return MessageToPayload(*schema_message_); }
+
+  arrow::Result<FlightPayload> Next() {
+    // All dictionaries, including deltas, precede the first record batch
+    if (dictionary_index_ < reader_->num_dictionaries()) {
+      ARROW_ASSIGN_OR_RAISE(auto message,
+                            reader_->ReadDictionaryMessage(dictionary_index_++));
+      return MessageToPayload(*message);
+    }
+    if (batch_index_ < indices_.size()) {
+      ARROW_ASSIGN_OR_RAISE(auto message,
+                            reader_->ReadRecordBatchMessage(indices_[batch_index_++]));
+      return MessageToPayload(*message);
+    }
+    // Signal that iteration is over
+    FlightPayload payload;
+    payload.ipc_message.metadata = nullptr;
+    return payload;
+  }
+
+ private:
+  static FlightPayload MessageToPayload(const ipc::Message& message) {
+    // The body already has the buffers laid out and padded as the IPC
+    // format requires, so it is sent as a single buffer
+    FlightPayload payload;
+    payload.ipc_message.type = message.type();
+    payload.ipc_message.metadata = message.metadata();
+    if (message.body()) {
+      payload.ipc_message.body_buffers.push_back(message.body());
+      payload.ipc_message.body_length = message.body()->size();
+      payload.ipc_message.raw_body_length = message.body()->size();
+    }
+    return payload;
+  }
+
+  std::shared_ptr<ipc::RecordBatchFileReader> reader_;
+  std::unique_ptr<ipc::Message> schema_message_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<int> indices_;
+  int dictionary_index_ = 0;
+  size_t batch_index_ = 0;
+};
+
+RecordBatchFileStream::RecordBatchFileStream(
+    std::unique_ptr<RecordBatchFileStreamImpl> impl)
+    : impl_(std::move(impl)) {}
+
+RecordBatchFileStream::~RecordBatchFileStream() = default;
+
+arrow::Result<std::unique_ptr<RecordBatchFileStream>> RecordBatchFileStream::Make(
+    std::shared_ptr<io::RandomAccessFile> file, std::vector<int> indices) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto impl, RecordBatchFileStreamImpl::Make(std::move(file), std::move(indices)));
+  return std::unique_ptr<RecordBatchFileStream>(
+      new RecordBatchFileStream(std::move(impl)));
+}
+
+std::shared_ptr<Schema> RecordBatchFileStream::schema() { return impl_->schema(); }
+
+arrow::Result<FlightPayload> RecordBatchFileStream::GetSchemaPayload() {
+  return impl_->GetSchemaPayload();
+}
+
+arrow::Result<FlightPayload> RecordBatchFileStream::Next() { return impl_->Next(); }
+
 }  // namespace flight
 }  // namespace arrow
@@ -31,6 +31,7 @@
 #include "arrow/flight/type_fwd.h"
 #include "arrow/flight/types.h"       // IWYU pragma: keep
 #include "arrow/flight/visibility.h"  // IWYU pragma: keep
+#include "arrow/io/type_fwd.h"
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/options.h"
 #include "arrow/record_batch.h"
@@ -86,6 +87,38 @@ class ARROW_FLIGHT_EXPORT RecordBatchStream : public FlightDataStream {
   std::unique_ptr<RecordBatchStreamImpl> impl_;
 };
 
+/// \brief A FlightDataStream that sends the record batches of an Arrow IPC
+/// file without decoding them
+///
+/// The encapsulated messages stored in the file (the schema, all dictionary
+/// batches, then the selected record batches) are handed to the transport
+/// as they are laid out in the file, including any buffer compression,
+/// instead of being read into arrays and serialized again. If the file
+/// supports zero-copy reads, as io::MemoryMappedFile does, the payloads are
+/// slices of the mapping and no data is copied before the transport writes
+/// it out.
+class ARROW_FLIGHT_EXPORT RecordBatchFileStream : public FlightDataStream {
+ public:
+  ~RecordBatchFileStream() override;
+
+  /// \brief Create a stream over an Arrow IPC file
+  ///
+  /// \param[in] file the IPC file; it must start with the Arrow file magic
+  /// \param[in] indices the record batches to send, in order. If empty,
+  ///     all record batches of the file are sent.
+  static arrow::Result<std::unique_ptr<RecordBatchFileStream>> Make(
+      std::shared_ptr<io::RandomAccessFile> file, std::vector<int> indices = {});
+
+  std::shared_ptr<Schema> schema() override;
+  arrow::Result<FlightPayload> GetSchemaPayload() override;
+  arrow::Result<FlightPayload> Next() override;
+
+ private:
+  class RecordBatchFileStreamImpl;
+  explicit RecordBatchFileStream(std::unique_ptr<RecordBatchFileStreamImpl> impl);
+  std::unique_ptr<RecordBatchFileStreamImpl> impl_;
+};
+
 /// \brief A reader for IPC payloads uploaded by a client. Also allows
 /// reading application-defined metadata via the Flight protocol.
 class ARROW_FLIGHT_EXPORT FlightMessageReader : public MetadataRecordBatchReader {
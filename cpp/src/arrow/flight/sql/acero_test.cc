@@ -17,13 +17,17 @@
 
 /// Integration test using the Acero backend
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 #include <sstream>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/dataset/dataset.h"
 #include "arrow/engine/substrait/util.h"
 #include "arrow/flight/server.h"
 #include "arrow/flight/sql/client.h"
@@ -219,6 +223,123 @@ TEST_F(TestAcero, Transactions) {
                                   client_->PrepareSubstrait(call_options, plan, handle));
 }
 
+class TestAceroPartitioned : public ::testing::Test {
+ public:
+  void SetUp() override {
+    schema_ = arrow::schema({field("x", int64())});
+    // Each row is distinct, so that partitions can be told apart
+    RecordBatchVector batches;
+    for (int i = 0; i < 6; i++) {
+      std::stringstream json;
+      json << "[[" << 3 * i << "], [" << 3 * i + 1 << "], [" << 3 * i + 2 << "]]";
+      batches.push_back(RecordBatchFromJSON(schema_, json.str()));
+    }
+
+    acero_example::AceroServerOptions server_options;
+    server_options.datasets["numbers"] =
+        std::make_shared<dataset::InMemoryDataset>(schema_, std::move(batches));
+    server_options.num_partitions = 4;
+
+    ASSERT_OK_AND_ASSIGN(auto location, Location::ForGrpcTcp("localhost", 0));
+    flight::FlightServerOptions options(location);
+    ASSERT_OK_AND_ASSIGN(server_, acero_example::MakeAceroServer(server_options));
+    ASSERT_OK(server_->Init(options));
+
+    ASSERT_OK_AND_ASSIGN(auto client, FlightClient::Connect(server_->location()));
+    client_.reset(new FlightSqlClient(std::move(client)));
+  }
+
+  void TearDown() override {
+    ASSERT_OK(client_->Close());
+    ASSERT_OK(server_->Shutdown());
+  }
+
+  void CheckPartitionedResult(const FlightInfo& info) {
+    // Every fragment of the dataset is read by exactly one endpoint:
+    // the partitions are disjoint and together cover all the rows
+    ASSERT_EQ(4, info.endpoints().size());
+    std::vector<int64_t> values;
+    for (const auto& endpoint : info.endpoints()) {
+      ASSERT_OK_AND_ASSIGN(auto reader, client_->DoGet({}, endpoint.ticket));
+      ASSERT_OK_AND_ASSIGN(auto table, reader->ToTable());
+      ASSERT_NO_FATAL_FAILURE(AssertSchemaEqual(schema_, table->schema()));
+      ASSERT_GT(table->num_rows(), 0);
+      for (const auto& chunk : table->column(0)->chunks()) {
+        for (const auto value : checked_cast<const Int64Array&>(*chunk)) {
+          ASSERT_TRUE(value.has_value());
+          values.push_back(*value);
+        }
+      }
+    }
+    std::sort(values.begin(), values.end());
+    std::vector<int64_t> expected(18);
+    std::iota(expected.begin(), expected.end(), 0);
+    ASSERT_EQ(expected, values);
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_;
+  std::unique_ptr<FlightSqlClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+};
+
+TEST_F(TestAceroPartitioned, NamedTable) {
+  ASSERT_OK_AND_ASSIGN(auto serialized_plan, engine::SerializeJsonPlan(R"({
+    "relations": [
+      {
+        "rel": {
+          "read": {
+            "base_schema": {
+              "struct": {"types": [{"i64": {}}]},
+              "names": ["x"]
+            },
+            "named_table": {"names": ["numbers"]}
+          }
+        }
+      }
+    ]
+  })"));
+  SubstraitPlan plan{serialized_plan->ToString(), /*version=*/"0.6.0"};
+
+  // Twice, to also use the cached plan
+  for (int i = 0; i < 2; i++) {
+    ASSERT_OK_AND_ASSIGN(std::unique_ptr<FlightInfo> info,
+                         client_->ExecuteSubstrait({}, plan));
+    ASSERT_NO_FATAL_FAILURE(CheckPartitionedResult(*info));
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto prepared_statement, client_->PrepareSubstrait({}, plan));
+  ASSERT_NO_FATAL_FAILURE(
+      AssertSchemaEqual(schema_, prepared_statement->dataset_schema()));
+  ASSERT_OK_AND_ASSIGN(std::unique_ptr<FlightInfo> info, prepared_statement->Execute());
+  ASSERT_NO_FATAL_FAILURE(CheckPartitionedResult(*info));
+  ASSERT_OK(prepared_statement->Close());
+
+  // The tickets of a closed statement are no longer valid
+  ASSERT_RAISES(KeyError, client_->DoGet({}, info->endpoints()[0].ticket));
+}
+
+TEST_F(TestAceroPartitioned, UnknownTable) {
+  ASSERT_OK_AND_ASSIGN(auto serialized_plan, engine::SerializeJsonPlan(R"({
+    "relations": [
+      {
+        "rel": {
+          "read": {
+            "base_schema": {
+              "struct": {"types": [{"i64": {}}]},
+              "names": ["x"]
+            },
+            "named_table": {"names": ["letters"]}
+          }
+        }
+      }
+    ]
+  })"));
+  SubstraitPlan plan{serialized_plan->ToString(), /*version=*/"0.6.0"};
+  EXPECT_RAISES_WITH_MESSAGE_THAT(KeyError, ::testing::HasSubstr("Unknown table"),
+                                  client_->ExecuteSubstrait({}, plan));
+}
+
 }  // namespace sql
 }  // namespace flight
 }  // namespace arrow
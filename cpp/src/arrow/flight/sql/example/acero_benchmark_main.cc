@@ -0,0 +1,170 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Benchmark client for the example Flight SQL server backed by Acero.
+//
+// Executes a Substrait plan, then reads the partitioned endpoints of the
+// result concurrently with FlightClient::DoGetEndpoints and reports the
+// throughput.
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <gflags/gflags.h>
+
+#include "arrow/buffer.h"
+#include "arrow/engine/substrait/util.h"
+#include "arrow/flight/client.h"
+#include "arrow/flight/sql/client.h"
+#include "arrow/flight/types.h"
+#include "arrow/io/file.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/util/byte_size.h"
+#include "arrow/util/stopwatch.h"
+#include "arrow/util/string.h"
+
+namespace flight = arrow::flight;
+namespace sql = arrow::flight::sql;
+
+DEFINE_string(location, "grpc://localhost:12345", "Location of the server");
+DEFINE_string(plan, "",
+              "Path to the Substrait plan to execute, serialized as protobuf, or "
+              "as JSON if the file name ends with .json");
+DEFINE_string(substrait_version, "0.6.0", "Substrait version of the plan");
+DEFINE_int32(num_runs, 5, "Number of times to execute the plan");
+DEFINE_int32(num_streams, 4, "Number of endpoints to read from concurrently");
+DEFINE_int64(max_buffered_bytes, 64 << 20,
+             "Maximum size of the batches buffered ahead of the consumer");
+DEFINE_bool(preserve_order, false, "Return batches in endpoint order");
+
+namespace {
+
+constexpr double kMegabyte = 1 << 20;
+
+struct RunStats {
+  int64_t num_endpoints = 0;
+  int64_t num_batches = 0;
+  int64_t num_rows = 0;
+  int64_t num_bytes = 0;
+  // Time to get the FlightInfo, then to read all its endpoints
+  uint64_t info_nanos = 0;
+  uint64_t read_nanos = 0;
+};
+
+arrow::Result<sql::SubstraitPlan> ReadPlan(const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto file, arrow::io::ReadableFile::Open(path));
+  ARROW_ASSIGN_OR_RAISE(auto size, file->GetSize());
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Buffer> plan, file->Read(size));
+  if (arrow::internal::EndsWith(path, ".json")) {
+    ARROW_ASSIGN_OR_RAISE(plan, arrow::engine::SerializeJsonPlan(plan->ToString()));
+  }
+  return sql::SubstraitPlan{plan->ToString(), FLAGS_substrait_version};
+}
+
+arrow::Result<RunStats> RunOnce(flight::FlightClient* client,
+                                sql::FlightSqlClient* sql_client,
+                                const sql::SubstraitPlan& plan) {
+  RunStats stats;
+  arrow::internal::StopWatch timer;
+
+  timer.Start();
+  ARROW_ASSIGN_OR_RAISE(auto info, sql_client->ExecuteSubstrait({}, plan));
+  stats.info_nanos = timer.Stop();
+  stats.num_endpoints = static_cast<int64_t>(info->endpoints().size());
+
+  auto options = flight::FlightEndpointsReaderOptions::Defaults();
+  options.max_concurrent_streams = FLAGS_num_streams;
+  options.max_buffered_bytes = FLAGS_max_buffered_bytes;
+  options.preserve_order = FLAGS_preserve_order;
+
+  timer.Start();
+  ARROW_ASSIGN_OR_RAISE(auto reader, client->DoGetEndpoints({}, *info, options));
+  while (true) {
+    std::shared_ptr<arrow::RecordBatch> batch;
+    ARROW_RETURN_NOT_OK(reader->ReadNext(&batch));
+    if (!batch) break;
+    ++stats.num_batches;
+    stats.num_rows += batch->num_rows();
+    stats.num_bytes += arrow::util::TotalBufferSize(*batch);
+  }
+  ARROW_RETURN_NOT_OK(reader->Close());
+  stats.read_nanos = timer.Stop();
+  return stats;
+}
+
+arrow::Status RunMain() {
+  if (FLAGS_plan.empty()) {
+    return arrow::Status::Invalid("Must provide --plan");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto plan, ReadPlan(FLAGS_plan));
+  ARROW_ASSIGN_OR_RAISE(auto location, flight::Location::Parse(FLAGS_location));
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<flight::FlightClient> client,
+                        flight::FlightClient::Connect(location));
+  sql::FlightSqlClient sql_client(client);
+
+  RunStats total;
+  for (int i = 0; i < FLAGS_num_runs; i++) {
+    ARROW_ASSIGN_OR_RAISE(auto stats, RunOnce(client.get(), &sql_client, plan));
+    std::cout << "Run " << i << ": " << stats.num_endpoints << " endpoints, "
+              << stats.num_rows << " rows, " << stats.num_bytes << " bytes, "
+              << stats.info_nanos / 1000 << " us to plan, " << stats.read_nanos / 1000
+              << " us to read" << std::endl;
+    total.num_endpoints += stats.num_endpoints;
+    total.num_batches += stats.num_batches;
+    total.num_rows += stats.num_rows;
+    total.num_bytes += stats.num_bytes;
+    total.info_nanos += stats.info_nanos;
+    total.read_nanos += stats.read_nanos;
+  }
+
+  if (FLAGS_num_runs > 0) {
+    const double runs = FLAGS_num_runs;
+    const double read_seconds = static_cast<double>(total.read_nanos) / 1e9;
+    std::cout << "Number of runs: " << FLAGS_num_runs << std::endl;
+    std::cout << "Concurrent streams: " << FLAGS_num_streams << std::endl;
+    std::cout << "Endpoints per run: " << total.num_endpoints / runs << std::endl;
+    std::cout << "Batches read: " << total.num_batches << std::endl;
+    std::cout << "Rows read: " << total.num_rows << std::endl;
+    std::cout << "Bytes read: " << total.num_bytes << std::endl;
+    std::cout << "Planning latency mean: " << total.info_nanos / runs / 1000 << " us"
+              << std::endl;
+    std::cout << "Read latency mean: " << total.read_nanos / runs / 1000 << " us"
+              << std::endl;
+    std::cout << "Speed: " << total.num_bytes / kMegabyte / read_seconds << " MB/s"
+              << std::endl;
+    std::cout << "Rows/s: " << total.num_rows / read_seconds << std::endl;
+  }
+  ARROW_RETURN_NOT_OK(sql_client.Close());
+  return arrow::Status::OK();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+  arrow::Status st = RunMain();
+  if (!st.ok()) {
+    std::cerr << st << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
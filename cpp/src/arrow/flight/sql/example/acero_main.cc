@@ -26,21 +26,60 @@
 
 #include <gflags/gflags.h>
 
+#include "arrow/dataset/discovery.h"
+#include "arrow/dataset/file_parquet.h"
+#include "arrow/filesystem/filesystem.h"
 #include "arrow/flight/sql/example/acero_server.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/string.h"
 
 namespace flight = arrow::flight;
 namespace sql = arrow::flight::sql;
 
 DEFINE_string(location, "grpc://localhost:12345", "Location to listen on");
+DEFINE_string(tables, "",
+              "Comma-separated list of NAME=URI of directories of Parquet files to "
+              "serve as named tables");
+DEFINE_int32(num_partitions, 1, "Number of endpoints to split table scans into");
+
+arrow::Result<std::shared_ptr<arrow::dataset::Dataset>> OpenParquetDataset(
+    const std::string& uri) {
+  std::string path;
+  ARROW_ASSIGN_OR_RAISE(auto filesystem, arrow::fs::FileSystemFromUriOrPath(uri, &path));
+  arrow::fs::FileSelector selector;
+  selector.base_dir = path;
+  selector.recursive = true;
+  ARROW_ASSIGN_OR_RAISE(auto factory,
+                        arrow::dataset::FileSystemDatasetFactory::Make(
+                            std::move(filesystem), std::move(selector),
+                            std::make_shared<arrow::dataset::ParquetFileFormat>(),
+                            arrow::dataset::FileSystemFactoryOptions{}));
+  return factory->Finish();
+}
 
 arrow::Status RunMain(const std::string& location_str) {
   ARROW_ASSIGN_OR_RAISE(flight::Location location, flight::Location::Parse(location_str));
   flight::FlightServerOptions options(location);
 
+  sql::acero_example::AceroServerOptions server_options;
+  server_options.num_partitions = FLAGS_num_partitions;
+  if (!FLAGS_tables.empty()) {
+    for (const auto& table : arrow::internal::SplitString(FLAGS_tables, ',')) {
+      const auto equals = table.find('=');
+      if (equals == std::string_view::npos) {
+        return arrow::Status::Invalid("Expected NAME=URI, got ", table);
+      }
+      std::string name(table.substr(0, equals));
+      ARROW_ASSIGN_OR_RAISE(server_options.datasets[name],
+                            OpenParquetDataset(std::string(table.substr(equals + 1))));
+      ARROW_LOG(INFO) << "Serving table " << name;
+    }
+  }
+
   std::unique_ptr<flight::FlightServerBase> server;
-  ARROW_ASSIGN_OR_RAISE(server, sql::acero_example::MakeAceroServer());
+  ARROW_ASSIGN_OR_RAISE(server,
+                        sql::acero_example::MakeAceroServer(std::move(server_options)));
   ARROW_RETURN_NOT_OK(server->Init(options));
 
   ARROW_RETURN_NOT_OK(server->SetShutdownOnSignals({SIGTERM}));
@@ -17,17 +17,29 @@
 
 #include "arrow/flight/sql/example/acero_server.h"
 
-#include <condition_variable>
-#include <deque>
+#include <algorithm>
+#include <list>
 #include <mutex>
+#include <string_view>
 #include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
 
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/plan.h"
+#include "arrow/dataset/projector.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/engine/substrait/options.h"
 #include "arrow/engine/substrait/serde.h"
 #include "arrow/flight/sql/types.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/value_parsing.h"
 
 namespace arrow {
 namespace flight {
@@ -36,10 +48,175 @@ namespace acero_example {
 
 namespace {
 
+using arrow::internal::checked_cast;
+
+/// \brief A dataset made of a subset of the fragments of another dataset.
+class FragmentSubsetDataset : public dataset::Dataset {
+ public:
+  FragmentSubsetDataset(std::shared_ptr<Schema> schema, dataset::FragmentVector fragments)
+      : Dataset(std::move(schema)), fragments_(std::move(fragments)) {}
+
+  std::string type_name() const override { return "fragment-subset"; }
+
+  arrow::Result<std::shared_ptr<dataset::Dataset>> ReplaceSchema(
+      std::shared_ptr<Schema> schema) const override {
+    RETURN_NOT_OK(dataset::CheckProjectable(*schema_, *schema));
+    return std::make_shared<FragmentSubsetDataset>(std::move(schema), fragments_);
+  }
+
+ protected:
+  arrow::Result<dataset::FragmentIterator> GetFragmentsImpl(
+      compute::Expression) override {
+    return MakeVectorIterator(fragments_);
+  }
+
+  dataset::FragmentVector fragments_;
+};
+
+arrow::Result<dataset::FragmentVector> ListFragments(dataset::Dataset* dataset) {
+  ARROW_ASSIGN_OR_RAISE(auto fragments, dataset->GetFragments());
+  return fragments.ToVector();
+}
+
+/// \brief If the plan only filters and projects a single scan, return
+/// the scan: scanning a subset of its fragments then yields a subset
+/// of the results.
+const dataset::ScanNodeOptions* GetPartitionableScan(
+    const acero::Declaration& declaration) {
+  if (declaration.factory_name == "scan") {
+    return &checked_cast<const dataset::ScanNodeOptions&>(*declaration.options);
+  }
+  if ((declaration.factory_name != "filter" && declaration.factory_name != "project") ||
+      declaration.inputs.size() != 1) {
+    return nullptr;
+  }
+  const auto* input = std::get_if<acero::Declaration>(&declaration.inputs[0]);
+  return input ? GetPartitionableScan(*input) : nullptr;
+}
+
+/// \brief Copy a plan for execution, restricting its scan to one
+/// partition of the fragments if there are several partitions.
+arrow::Result<acero::Declaration> InstantiatePlan(const acero::Declaration& declaration,
+                                                  int partition, int num_partitions) {
+  acero::Declaration copy = declaration;
+  if (copy.factory_name == "scan") {
+    const auto& options = checked_cast<const dataset::ScanNodeOptions&>(*copy.options);
+    std::shared_ptr<dataset::Dataset> scanned = options.dataset;
+    if (num_partitions > 1) {
+      ARROW_ASSIGN_OR_RAISE(auto fragments, ListFragments(scanned.get()));
+      dataset::FragmentVector subset;
+      for (size_t i = partition; i < fragments.size(); i += num_partitions) {
+        subset.push_back(std::move(fragments[i]));
+      }
+      scanned = std::make_shared<FragmentSubsetDataset>(scanned->schema(),
+                                                        std::move(subset));
+    }
+    // The scan node fills in its scan options, so plans can't share them
+    copy.options = std::make_shared<dataset::ScanNodeOptions>(
+        std::move(scanned), std::make_shared<dataset::ScanOptions>(*options.scan_options),
+        options.require_sequenced_output);
+    return copy;
+  }
+  for (auto& input : copy.inputs) {
+    if (auto* child = std::get_if<acero::Declaration>(&input)) {
+      ARROW_ASSIGN_OR_RAISE(*child, InstantiatePlan(*child, partition, num_partitions));
+    }
+  }
+  return copy;
+}
+
+/// \brief A deserialized Substrait plan, which can be executed any
+/// number of times.
+struct CachedPlan {
+  acero::Declaration declaration;
+  std::shared_ptr<Schema> schema;
+  /// \brief The dataset scanned by the plan, if the plan can be split
+  /// by fragments.
+  std::shared_ptr<dataset::Dataset> partitionable_dataset;
+};
+
+/// \brief A least-recently-used cache of plans, keyed by serialized plan.
+class PlanCache {
+ public:
+  explicit PlanCache(int64_t capacity) : capacity_(capacity) {}
+
+  std::shared_ptr<CachedPlan> Get(const std::string& key) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) return nullptr;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->second;
+  }
+
+  void Put(const std::string& key, std::shared_ptr<CachedPlan> plan) {
+    if (capacity_ <= 0) return;
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (index_.find(key) != index_.end()) return;
+    entries_.emplace_front(key, std::move(plan));
+    index_[key] = entries_.begin();
+    if (static_cast<int64_t>(entries_.size()) > capacity_) {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+  }
+
+ private:
+  using Entry = std::pair<std::string, std::shared_ptr<CachedPlan>>;
+
+  const int64_t capacity_;
+  std::mutex mutex_;
+  std::list<Entry> entries_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+};
+
+/// \brief The contents of the tickets of this server: the plan to
+/// execute, and which partition of it.
+///
+/// Serialized as "<kind><partition>/<num_partitions>/<payload>", where
+/// the kind is 'p' if the payload is a prepared statement handle, or
+/// 's' if it is a serialized plan.
+struct PlanTicket {
+  bool prepared;
+  int partition;
+  int num_partitions;
+  std::string payload;
+
+  std::string Serialize() const {
+    return (prepared ? "p" : "s") + std::to_string(partition) + "/" +
+           std::to_string(num_partitions) + "/" + payload;
+  }
+
+  static arrow::Result<PlanTicket> Deserialize(std::string_view ticket) {
+    PlanTicket out;
+    if (ticket.empty() || (ticket[0] != 'p' && ticket[0] != 's')) {
+      return Status::Invalid("Malformed ticket");
+    }
+    out.prepared = ticket[0] == 'p';
+    ticket.remove_prefix(1);
+    for (int* value : {&out.partition, &out.num_partitions}) {
+      const auto end = ticket.find('/');
+      if (end == std::string_view::npos ||
+          !::arrow::internal::ParseValue<Int32Type>(ticket.data(), end, value)) {
+        return Status::Invalid("Malformed ticket");
+      }
+      ticket.remove_prefix(end + 1);
+    }
+    if (out.num_partitions <= 0 || out.partition < 0 ||
+        out.partition >= out.num_partitions) {
+      return Status::Invalid("Malformed ticket");
+    }
+    out.payload = std::string(ticket);
+    return out;
+  }
+};
+
 /// \brief An implementation of a Flight SQL service backed by Acero.
 class AceroFlightSqlServer : public FlightSqlServerBase {
  public:
-  AceroFlightSqlServer() {
+  explicit AceroFlightSqlServer(AceroServerOptions options)
+      : options_(std::move(options)), plan_cache_(options_.plan_cache_size) {
+    dataset::internal::Initialize();
+
     RegisterSqlInfo(SqlInfoOptions::SqlInfo::FLIGHT_SQL_SERVER_SUBSTRAIT,
                     SqlInfoResult(true));
     RegisterSqlInfo(SqlInfoOptions::SqlInfo::FLIGHT_SQL_SERVER_SUBSTRAIT_MIN_VERSION,
@@ -61,44 +238,42 @@ class AceroFlightSqlServer : public FlightSqlServerBase {
       return Status::NotImplemented("Transactions are unsupported");
     }
 
-    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Schema> output_schema,
-                          GetPlanSchema(command.plan.plan));
+    ARROW_ASSIGN_OR_RAISE(auto plan, GetPlan(command.plan.plan));
 
     ARROW_LOG(INFO) << "GetFlightInfoSubstraitPlan: preparing plan with output schema "
-                    << *output_schema;
+                    << *plan->schema;
 
-    return MakeFlightInfo(command.plan.plan, descriptor, *output_schema);
+    return MakeFlightInfo(/*prepared=*/false, command.plan.plan, *plan, descriptor);
   }
 
   arrow::Result<std::unique_ptr<FlightInfo>> GetFlightInfoPreparedStatement(
       const ServerCallContext& context, const PreparedStatementQuery& command,
       const FlightDescriptor& descriptor) override {
-    std::shared_ptr<arrow::Buffer> plan;
-    {
-      std::lock_guard<std::mutex> guard(mutex_);
-      auto it = prepared_.find(command.prepared_statement_handle);
-      if (it == prepared_.end()) {
-        return Status::KeyError("Prepared statement not found");
-      }
-      plan = it->second;
-    }
-
-    return MakeFlightInfo(plan->ToString(), descriptor, Schema({}));
+    ARROW_ASSIGN_OR_RAISE(auto plan, GetPreparedPlan(command.prepared_statement_handle));
+    return MakeFlightInfo(/*prepared=*/true, command.prepared_statement_handle, *plan,
+                          descriptor);
   }
 
   arrow::Result<std::unique_ptr<FlightDataStream>> DoGetStatement(
       const ServerCallContext& context, const StatementQueryTicket& command) override {
-    // GetFlightInfoSubstraitPlan encodes the plan into the ticket
-    std::shared_ptr<Buffer> serialized_plan =
-        Buffer::FromString(command.statement_handle);
-    ARROW_ASSIGN_OR_RAISE(engine::PlanInfo plan,
-                          engine::DeserializePlan(*serialized_plan));
+    // MakeFlightInfo encodes the plan (or prepared statement) into the ticket
+    ARROW_ASSIGN_OR_RAISE(auto ticket, PlanTicket::Deserialize(command.statement_handle));
+    std::shared_ptr<CachedPlan> plan;
+    if (ticket.prepared) {
+      ARROW_ASSIGN_OR_RAISE(plan, GetPreparedPlan(ticket.payload));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(plan, GetPlan(ticket.payload));
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto declaration,
+        InstantiatePlan(plan->declaration, ticket.partition, ticket.num_partitions));
 
-    ARROW_LOG(INFO)
-        << "DoGetStatement: executing plan "
-        << acero::DeclarationToString(plan.root.declaration).ValueOr("Invalid plan");
+    ARROW_LOG(INFO) << "DoGetStatement: executing partition " << ticket.partition
+                    << " of " << ticket.num_partitions << " of plan "
+                    << acero::DeclarationToString(declaration).ValueOr("Invalid plan");
 
-    ARROW_ASSIGN_OR_RAISE(auto reader, acero::DeclarationToReader(plan.root.declaration));
+    ARROW_ASSIGN_OR_RAISE(auto reader,
+                          acero::DeclarationToReader(std::move(declaration)));
     return std::make_unique<RecordBatchStream>(std::move(reader));
   }
 
@@ -126,21 +301,19 @@ class AceroFlightSqlServer : public FlightSqlServerBase {
     if (!request.transaction_id.empty()) {
       return Status::NotImplemented("Transactions are unsupported");
     }
-    // There's not any real point to precompiling the plan, since the
-    // consumer has to be provided here. So this is effectively the
-    // same as a non-prepared plan.
-    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Schema> schema,
-                          GetPlanSchema(request.plan.plan));
+    // The plan is deserialized once here and reused by every
+    // execution of the statement
+    ARROW_ASSIGN_OR_RAISE(auto plan, GetPlan(request.plan.plan));
 
     std::string handle;
     {
       std::lock_guard<std::mutex> guard(mutex_);
       handle = std::to_string(counter_++);
-      prepared_[handle] = Buffer::FromString(request.plan.plan);
+      prepared_[handle] = plan;
     }
 
     return ActionCreatePreparedStatementResult{
-        /*dataset_schema=*/std::move(schema),
+        /*dataset_schema=*/plan->schema,
         /*parameter_schema=*/nullptr,
         handle,
     };
@@ -155,35 +328,122 @@ class AceroFlightSqlServer : public FlightSqlServerBase {
   }
 
  private:
-  arrow::Result<std::shared_ptr<arrow::Schema>> GetPlanSchema(
+  arrow::Result<std::shared_ptr<CachedPlan>> GetPlan(const std::string& serialized_plan) {
+    if (auto plan = plan_cache_.Get(serialized_plan)) {
+      return plan;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto plan, DeserializePlan(serialized_plan));
+    plan_cache_.Put(serialized_plan, plan);
+    return plan;
+  }
+
+  arrow::Result<std::shared_ptr<CachedPlan>> GetPreparedPlan(const std::string& handle) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = prepared_.find(handle);
+    if (it == prepared_.end()) {
+      return Status::KeyError("Prepared statement not found");
+    }
+    return it->second;
+  }
+
+  arrow::Result<std::shared_ptr<CachedPlan>> DeserializePlan(
       const std::string& serialized_plan) {
+    engine::ConversionOptions conversion_options;
+    conversion_options.named_table_provider =
+        [this](const std::vector<std::string>& names,
+               const Schema& schema) -> arrow::Result<acero::Declaration> {
+      return ScanNamedTable(names, schema);
+    };
     std::shared_ptr<Buffer> plan_buf = Buffer::FromString(serialized_plan);
-    ARROW_ASSIGN_OR_RAISE(engine::PlanInfo plan, engine::DeserializePlan(*plan_buf));
-    return acero::DeclarationToSchema(plan.root.declaration);
+    ARROW_ASSIGN_OR_RAISE(engine::PlanInfo plan_info,
+                          engine::DeserializePlan(*plan_buf, /*registry=*/nullptr,
+                                                  /*ext_set_out=*/nullptr,
+                                                  conversion_options));
+
+    auto plan = std::make_shared<CachedPlan>();
+    plan->declaration = std::move(plan_info.root.declaration);
+    ARROW_ASSIGN_OR_RAISE(auto declaration,
+                          InstantiatePlan(plan->declaration, /*partition=*/0,
+                                          /*num_partitions=*/1));
+    ARROW_ASSIGN_OR_RAISE(plan->schema, acero::DeclarationToSchema(declaration));
+    if (const auto* scan = GetPartitionableScan(plan->declaration)) {
+      plan->partitionable_dataset = scan->dataset;
+    }
+    return plan;
+  }
+
+  arrow::Result<acero::Declaration> ScanNamedTable(const std::vector<std::string>& names,
+                                                   const Schema& schema) {
+    std::string name;
+    for (const auto& part : names) {
+      if (!name.empty()) name += ".";
+      name += part;
+    }
+    auto it = options_.datasets.find(name);
+    if (it == options_.datasets.end()) {
+      return Status::KeyError("Unknown table: ", name);
+    }
+    const std::shared_ptr<dataset::Dataset>& scanned = it->second;
+
+    // Only read the columns of the declared schema, in its order
+    auto scan_options = std::make_shared<dataset::ScanOptions>();
+    ARROW_ASSIGN_OR_RAISE(
+        auto projection,
+        dataset::ProjectionDescr::FromNames(schema.field_names(), *scanned->schema()));
+    dataset::SetProjection(scan_options.get(), std::move(projection));
+    // ...and drop the fields the scan node adds
+    std::vector<compute::Expression> fields;
+    for (const auto& field_name : schema.field_names()) {
+      fields.push_back(compute::field_ref(field_name));
+    }
+    return acero::Declaration::Sequence({
+        {"scan", dataset::ScanNodeOptions{scanned, std::move(scan_options)}},
+        {"project", acero::ProjectNodeOptions{std::move(fields), schema.field_names()}},
+    });
   }
 
   arrow::Result<std::unique_ptr<FlightInfo>> MakeFlightInfo(
-      const std::string& plan, const FlightDescriptor& descriptor, const Schema& schema) {
-    ARROW_ASSIGN_OR_RAISE(auto ticket, CreateStatementQueryTicket(plan));
-    std::vector<FlightEndpoint> endpoints{
-        FlightEndpoint{Ticket{std::move(ticket)}, /*locations=*/{},
-                       /*expiration_time=*/std::nullopt, ""}};
+      bool prepared, const std::string& payload, const CachedPlan& plan,
+      const FlightDescriptor& descriptor) {
+    int num_partitions = 1;
+    if (plan.partitionable_dataset && options_.num_partitions > 1) {
+      ARROW_ASSIGN_OR_RAISE(auto fragments,
+                            ListFragments(plan.partitionable_dataset.get()));
+      num_partitions = static_cast<int>(std::max<size_t>(
+          1, std::min<size_t>(options_.num_partitions, fragments.size())));
+    }
+
+    std::vector<FlightEndpoint> endpoints;
+    for (int partition = 0; partition < num_partitions; partition++) {
+      PlanTicket plan_ticket{prepared, partition, num_partitions, payload};
+      ARROW_ASSIGN_OR_RAISE(auto ticket,
+                            CreateStatementQueryTicket(plan_ticket.Serialize()));
+      endpoints.push_back(FlightEndpoint{Ticket{std::move(ticket)}, /*locations=*/{},
+                                         /*expiration_time=*/std::nullopt, ""});
+    }
     ARROW_ASSIGN_OR_RAISE(
         auto info,
-        FlightInfo::Make(schema, descriptor, std::move(endpoints),
+        FlightInfo::Make(*plan.schema, descriptor, std::move(endpoints),
                          /*total_records=*/-1, /*total_bytes=*/-1, /*ordered=*/false));
     return std::make_unique<FlightInfo>(std::move(info));
   }
 
+  const AceroServerOptions options_;
+  PlanCache plan_cache_;
+
   std::mutex mutex_;
-  std::unordered_map<std::string, std::shared_ptr<arrow::Buffer>> prepared_;
-  int64_t counter_;
+  std::unordered_map<std::string, std::shared_ptr<CachedPlan>> prepared_;
+  int64_t counter_ = 0;
 };
 
 }  // namespace
 
-arrow::Result<std::unique_ptr<FlightSqlServerBase>> MakeAceroServer() {
-  return std::make_unique<AceroFlightSqlServer>();
+arrow::Result<std::unique_ptr<FlightSqlServerBase>> MakeAceroServer(
+    AceroServerOptions options) {
+  if (options.num_partitions <= 0) {
+    return Status::Invalid("num_partitions must be positive");
+  }
+  return std::make_unique<AceroFlightSqlServer>(std::move(options));
 }
 
 }  // namespace acero_example
@@ -17,8 +17,12 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <unordered_map>
 
+#include "arrow/dataset/type_fwd.h"
 #include "arrow/flight/sql/server.h"
 #include "arrow/flight/sql/visibility.h"
 #include "arrow/result.h"
@@ -28,8 +32,29 @@ namespace flight {
 namespace sql {
 namespace acero_example {
 
+/// \brief Options for the Acero-backed Flight SQL server.
+struct AceroServerOptions {
+  /// \brief Datasets that Substrait plans can read as named tables.
+  ///
+  /// A named table with several names is looked up by the names
+  /// joined with ".".
+  std::unordered_map<std::string, std::shared_ptr<dataset::Dataset>> datasets;
+  /// \brief The number of endpoints to split a query into.
+  ///
+  /// Only queries that filter and project a single named table are
+  /// split: each endpoint then scans a subset of the dataset's
+  /// fragments, so that clients can fetch them in parallel. Other
+  /// queries always have a single endpoint.
+  int num_partitions = 1;
+  /// \brief The number of deserialized plans of non-prepared
+  /// statements to keep for reuse. Prepared statements always keep
+  /// their plan until closed.
+  int64_t plan_cache_size = 64;
+};
+
 /// \brief Make a Flight SQL server backed by the Acero query engine.
-arrow::Result<std::unique_ptr<FlightSqlServerBase>> MakeAceroServer();
+arrow::Result<std::unique_ptr<FlightSqlServerBase>> MakeAceroServer(
+    AceroServerOptions options = {});
 
 }  // namespace acero_example
 }  // namespace sql
@@ -36,6 +36,7 @@
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/config.h"
 #include "arrow/util/logging.h"
 #include "gmock/gmock.h"
@@ -49,13 +50,24 @@ namespace flight {
 
 using arrow::internal::checked_cast;
 
+arrow::Result<Location> FlightTest::MakeServerLocation() {
+  return Location::ForScheme(transport(), "127.0.0.1", 0);
+}
+
+arrow::Result<Location> FlightTest::MakeClientLocation(const FlightServerBase& server) {
+  return Location::ForScheme(transport(), "127.0.0.1", server.port());
+}
+
 //------------------------------------------------------------
 // Tests of initialization/shutdown
 
 void ConnectivityTest::TestGetPort() {
+  if (!supports_port()) {
+    GTEST_SKIP() << "Servers don't listen on a port";
+  }
   std::unique_ptr<FlightServerBase> server = ExampleTestServer();
 
-  ASSERT_OK_AND_ASSIGN(auto location, Location::ForScheme(transport(), "127.0.0.1", 0));
+  ASSERT_OK_AND_ASSIGN(auto location, MakeServerLocation());
   FlightServerOptions options(location);
   ASSERT_OK(server->Init(options));
   ASSERT_GT(server->port(), 0);
@@ -63,7 +75,7 @@ void ConnectivityTest::TestGetPort() {
 void ConnectivityTest::TestBuilderHook() {
   std::unique_ptr<FlightServerBase> server = ExampleTestServer();
 
-  ASSERT_OK_AND_ASSIGN(auto location, Location::ForScheme(transport(), "127.0.0.1", 0));
+  ASSERT_OK_AND_ASSIGN(auto location, MakeServerLocation());
   FlightServerOptions options(location);
   bool builder_hook_run = false;
   options.builder_hook = [&builder_hook_run](void* builder) {
@@ -72,19 +84,19 @@ void ConnectivityTest::TestBuilderHook() {
   };
   ASSERT_OK(server->Init(options));
   ASSERT_TRUE(builder_hook_run);
-  ASSERT_GT(server->port(), 0);
+  if (supports_port()) ASSERT_GT(server->port(), 0);
   ASSERT_OK(server->Shutdown());
 }
 void ConnectivityTest::TestShutdown() {
   // Regression test for ARROW-15181
   constexpr int kIterations = 10;
-  ASSERT_OK_AND_ASSIGN(auto location, Location::ForScheme(transport(), "127.0.0.1", 0));
+  ASSERT_OK_AND_ASSIGN(auto location, MakeServerLocation());
   for (int i = 0; i < kIterations; i++) {
     std::unique_ptr<FlightServerBase> server = ExampleTestServer();
 
     FlightServerOptions options(location);
     ASSERT_OK(server->Init(options));
-    ASSERT_GT(server->port(), 0);
+    if (supports_port()) ASSERT_GT(server->port(), 0);
     std::thread t([&]() { ASSERT_OK(server->Serve()); });
     ASSERT_OK(server->Shutdown());
     ASSERT_OK(server->Wait());
@@ -94,10 +106,10 @@ void ConnectivityTest::TestShutdown() {
 void ConnectivityTest::TestShutdownWithDeadline() {
   std::unique_ptr<FlightServerBase> server = ExampleTestServer();
 
-  ASSERT_OK_AND_ASSIGN(auto location, Location::ForScheme(transport(), "127.0.0.1", 0));
+  ASSERT_OK_AND_ASSIGN(auto location, MakeServerLocation());
   FlightServerOptions options(location);
   ASSERT_OK(server->Init(options));
-  ASSERT_GT(server->port(), 0);
+  if (supports_port()) ASSERT_GT(server->port(), 0);
 
   auto deadline = std::chrono::system_clock::now() + std::chrono::microseconds(10);
 
@@ -106,13 +118,13 @@ void ConnectivityTest::TestShutdownWithDeadline() {
 }
 void ConnectivityTest::TestBrokenConnection() {
   std::unique_ptr<FlightServerBase> server = ExampleTestServer();
-  ASSERT_OK_AND_ASSIGN(auto location, Location::ForScheme(transport(), "127.0.0.1", 0));
+  ASSERT_OK_AND_ASSIGN(auto location, MakeServerLocation());
   FlightServerOptions options(location);
   ASSERT_OK(server->Init(options));
 
   std::unique_ptr<FlightClient> client;
   ASSERT_OK_AND_ASSIGN(location,
-                       Location::ForScheme(transport(), "127.0.0.1", server->port()));
+                       MakeClientLocation(*server));
   ASSERT_OK_AND_ASSIGN(client, FlightClient::Connect(location));
 
   ASSERT_OK(server->Shutdown());
@@ -153,7 +165,7 @@ class GetFlightInfoListener : public AsyncListener<FlightInfo> {
 void DataTest::SetUpTest() {
   server_ = ExampleTestServer();
 
-  ASSERT_OK_AND_ASSIGN(auto location, Location::ForScheme(transport(), "127.0.0.1", 0));
+  ASSERT_OK_AND_ASSIGN(auto location, MakeServerLocation());
   FlightServerOptions options(location);
   ASSERT_OK(server_->Init(options));
 
@@ -165,7 +177,7 @@ void DataTest::TearDownTest() {
 }
 Status DataTest::ConnectClient() {
   ARROW_ASSIGN_OR_RAISE(auto location,
-                        Location::ForScheme(transport(), "127.0.0.1", server_->port()));
+                        MakeClientLocation(*server_));
   ARROW_ASSIGN_OR_RAISE(client_, FlightClient::Connect(location));
   return Status::OK();
 }
@@ -281,6 +293,20 @@ void DataTest::TestDoGetLargeBatch() {
   Ticket ticket{"ticket-large-batch-1"};
   CheckDoGet(ticket, expected_batches);
 }
+// Serve an IPC file without decoding it (RecordBatchFileStream)
+void DataTest::TestDoGetIpcFile() {
+  RecordBatchVector expected_batches;
+  ASSERT_OK(ExampleDictBatches(&expected_batches));
+  CheckDoGet(Ticket{"ticket-ipc-file-dicts"}, expected_batches);
+
+  RecordBatchVector int_batches;
+  ASSERT_OK(ExampleIntBatches(&int_batches));
+  CheckDoGet(Ticket{"ticket-ipc-file-ints-subset"}, {int_batches[3], int_batches[1]});
+
+  if (util::Codec::IsAvailable(Compression::ZSTD)) {
+    CheckDoGet(Ticket{"ticket-ipc-file-ints-compressed"}, int_batches);
+  }
+}
 // Ensure FlightDataStream/RecordBatchStream::Close errors are propagated
 void DataTest::TestFlightDataStreamError() {
   Ticket ticket{"ticket-stream-error"};
@@ -637,6 +663,114 @@ void DataTest::TestIssue5095() {
   ASSERT_RAISES(KeyError, status);
   ASSERT_THAT(status.message(), ::testing::HasSubstr("No data"));
 }
+void DataTest::TestDoGetEndpoints() {
+  RecordBatchVector int_batches, float_batches;
+  ASSERT_OK(ExampleIntBatches(&int_batches));
+  ASSERT_OK(ExampleFloatBatches(&float_batches));
+  auto schema = int_batches[0]->schema();
+
+  std::vector<FlightEndpoint> endpoints;
+  RecordBatchVector expected;
+  for (int i = 0; i < 4; i++) {
+    endpoints.push_back({Ticket{"ticket-ints-1"}, {}, std::nullopt, ""});
+    expected.insert(expected.end(), int_batches.begin(), int_batches.end());
+  }
+  ASSERT_OK_AND_ASSIGN(auto info,
+                       FlightInfo::Make(*schema, FlightDescriptor::Path({"ints"}),
+                                        endpoints, -1, -1, /*ordered=*/true));
+
+  // Tiny buffers force the streams to wait for the consumer
+  for (const int64_t max_buffered_bytes : {int64_t(1), int64_t(64) << 20}) {
+    ARROW_SCOPED_TRACE("max_buffered_bytes = ", max_buffered_bytes);
+    auto options = FlightEndpointsReaderOptions::Defaults();
+    options.max_concurrent_streams = 2;
+    options.max_buffered_bytes = max_buffered_bytes;
+    ASSERT_OK_AND_ASSIGN(auto reader, client_->DoGetEndpoints({}, info, options));
+    AssertSchemaEqual(*schema, *reader->schema());
+    ASSERT_OK_AND_ASSIGN(auto batches, reader->ToRecordBatches());
+    ASSERT_EQ(expected.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); i++) {
+      ASSERT_BATCHES_EQUAL(*expected[i], *batches[i]);
+    }
+
+    // Unordered: same data, any order
+    options.preserve_order = false;
+    ASSERT_OK_AND_ASSIGN(reader, client_->DoGetEndpoints({}, info, options));
+    ASSERT_OK_AND_ASSIGN(auto table, reader->ToTable());
+    ASSERT_OK_AND_ASSIGN(auto expected_table, Table::FromRecordBatches(expected));
+    ASSERT_EQ(expected_table->num_rows(), table->num_rows());
+  }
+
+  // Closing early cancels the remaining streams
+  auto options = FlightEndpointsReaderOptions::Defaults();
+  options.max_buffered_bytes = 1;
+  ASSERT_OK_AND_ASSIGN(auto reader, client_->DoGetEndpoints({}, info, options));
+  ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+  ASSERT_NE(nullptr, batch);
+  ASSERT_OK(reader->Close());
+
+  // Without an advertised schema, the first stream's is used
+  FlightInfo::Data data;
+  data.descriptor = FlightDescriptor::Path({"floats"});
+  data.endpoints = {{Ticket{"ticket-floats-1"}, {}, std::nullopt, ""}};
+  ASSERT_OK_AND_ASSIGN(reader, client_->DoGetEndpoints(FlightInfo(std::move(data))));
+  AssertSchemaEqual(*float_batches[0]->schema(), *reader->schema());
+  ASSERT_OK_AND_ASSIGN(auto batches, reader->ToRecordBatches());
+  ASSERT_EQ(float_batches.size(), batches.size());
+}
+
+void DataTest::TestDoGetEndpointsFailover() {
+  RecordBatchVector expected;
+  ASSERT_OK(ExampleIntBatches(&expected));
+  auto schema = expected[0]->schema();
+
+  // Nothing listens on the first location
+  ASSERT_OK_AND_ASSIGN(auto unreachable, Location::ForGrpcTcp("127.0.0.1", 1));
+  ASSERT_OK_AND_ASSIGN(auto location,
+                       MakeClientLocation(*server_));
+  FlightEndpoint endpoint{Ticket{"ticket-ints-1"}, {unreachable, location}, std::nullopt,
+                          ""};
+  ASSERT_OK_AND_ASSIGN(auto info, FlightInfo::Make(*schema, FlightDescriptor::Path({}),
+                                                   {endpoint}, -1, -1));
+  ASSERT_OK_AND_ASSIGN(auto reader, client_->DoGetEndpoints(info));
+  ASSERT_OK_AND_ASSIGN(auto batches, reader->ToRecordBatches());
+  ASSERT_EQ(expected.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); i++) {
+    ASSERT_BATCHES_EQUAL(*expected[i], *batches[i]);
+  }
+
+  // All locations failing fails the read
+  endpoint.locations = {unreachable};
+  ASSERT_OK_AND_ASSIGN(info, FlightInfo::Make(*schema, FlightDescriptor::Path({}),
+                                              {endpoint}, -1, -1));
+  ASSERT_OK_AND_ASSIGN(reader, client_->DoGetEndpoints(info));
+  ASSERT_NOT_OK(reader->ToRecordBatches());
+}
+
+void DataTest::TestDoGetEndpointsError() {
+  RecordBatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  auto schema = batches[0]->schema();
+
+  std::vector<FlightEndpoint> endpoints = {
+      {Ticket{"ticket-ints-1"}, {}, std::nullopt, ""},
+      {Ticket{"ARROW-5095-fail"}, {}, std::nullopt, ""},
+      {Ticket{"ticket-ints-1"}, {}, std::nullopt, ""},
+  };
+  ASSERT_OK_AND_ASSIGN(auto info, FlightInfo::Make(*schema, FlightDescriptor::Path({}),
+                                                   endpoints, -1, -1));
+  ASSERT_OK_AND_ASSIGN(auto reader, client_->DoGetEndpoints(info));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(UnknownError, ::testing::HasSubstr("Server-side error"),
+                                  reader->ToRecordBatches());
+
+  // Endpoints must agree on the schema
+  endpoints[1].ticket = Ticket{"ticket-floats-1"};
+  ASSERT_OK_AND_ASSIGN(info, FlightInfo::Make(*schema, FlightDescriptor::Path({}),
+                                              endpoints, -1, -1));
+  ASSERT_OK_AND_ASSIGN(reader, client_->DoGetEndpoints(info));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("schema"),
+                                  reader->ToRecordBatches());
+}
 
 //------------------------------------------------------------
 // Specific tests for DoPut
@@ -697,9 +831,8 @@ class DoPutTestServer : public FlightServerBase {
 };
 
 void DoPutTest::SetUpTest() {
-  ASSERT_OK_AND_ASSIGN(auto location, Location::ForScheme(transport(), "127.0.0.1", 0));
-  ASSERT_OK(MakeServer<DoPutTestServer>(
-      location, &server_, &client_,
+  ASSERT_OK(MakeTestServer<DoPutTestServer>(
+      &server_, &client_,
       [](FlightServerOptions* options) { return Status::OK(); },
       [](FlightClientOptions* options) { return Status::OK(); }));
 }
@@ -825,7 +958,7 @@ void DoPutTest::TestLargeBatch() {
 void DoPutTest::TestSizeLimit() {
   const int64_t size_limit = 4096;
   ASSERT_OK_AND_ASSIGN(auto location,
-                       Location::ForScheme(transport(), "127.0.0.1", server_->port()));
+                       MakeClientLocation(*server_));
   auto client_options = FlightClientOptions::Defaults();
   client_options.write_size_limit_bytes = size_limit;
   ASSERT_OK_AND_ASSIGN(auto client, FlightClient::Connect(location, client_options));
@@ -925,9 +1058,8 @@ Status AppMetadataTestServer::DoPut(const ServerCallContext& context,
 }
 
 void AppMetadataTest::SetUpTest() {
-  ASSERT_OK_AND_ASSIGN(auto location, Location::ForScheme(transport(), "127.0.0.1", 0));
-  ASSERT_OK(MakeServer<AppMetadataTestServer>(
-      location, &server_, &client_,
+  ASSERT_OK(MakeTestServer<AppMetadataTestServer>(
+      &server_, &client_,
       [](FlightServerOptions* options) { return Status::OK(); },
       [](FlightClientOptions* options) { return Status::OK(); }));
 }
@@ -1104,9 +1236,8 @@ class IpcOptionsTestServer : public FlightServerBase {
 };
 
 void IpcOptionsTest::SetUpTest() {
-  ASSERT_OK_AND_ASSIGN(auto location, Location::ForScheme(transport(), "127.0.0.1", 0));
-  ASSERT_OK(MakeServer<IpcOptionsTestServer>(
-      location, &server_, &client_,
+  ASSERT_OK(MakeTestServer<IpcOptionsTestServer>(
+      &server_, &client_,
       [](FlightServerOptions* options) { return Status::OK(); },
       [](FlightClientOptions* options) { return Status::OK(); }));
 }
@@ -1300,9 +1431,8 @@ void CudaDataTest::SetUpTest() {
   impl_->device = std::move(device);
   impl_->context = std::move(context);
 
-  ASSERT_OK_AND_ASSIGN(auto location, Location::ForScheme(transport(), "127.0.0.1", 0));
-  ASSERT_OK(MakeServer<CudaTestServer>(
-      location, &server_, &client_,
+  ASSERT_OK(MakeTestServer<CudaTestServer>(
+      &server_, &client_,
       [this](FlightServerOptions* options) {
         options->memory_manager = impl_->device->default_memory_manager();
         return Status::OK();
@@ -1590,9 +1720,8 @@ struct ErrorHandlingTest::Impl {
 
 void ErrorHandlingTest::SetUpTest() {
   impl_ = std::make_shared<Impl>();
-  ASSERT_OK_AND_ASSIGN(auto location, Location::ForScheme(transport(), "127.0.0.1", 0));
-  ASSERT_OK(MakeServer<ErrorHandlingTestServer>(
-      location, &server_, &client_,
+  ASSERT_OK(MakeTestServer<ErrorHandlingTestServer>(
+      &server_, &client_,
       [](FlightServerOptions* options) { return Status::OK(); },
       [&](FlightClientOptions* options) {
         options->middleware.emplace_back(impl_->metadata);
@@ -1820,14 +1949,13 @@ void AsyncClientTest::SetUpTest() {
     GTEST_SKIP() << "async is not supported";
   }
 
-  ASSERT_OK_AND_ASSIGN(auto location, Location::ForScheme(transport(), "127.0.0.1", 0));
+  ASSERT_OK_AND_ASSIGN(auto location, MakeServerLocation());
 
   server_ = ExampleTestServer();
   FlightServerOptions server_options(location);
   ASSERT_OK(server_->Init(server_options));
 
-  std::string uri = location.scheme() + "://127.0.0.1:" + std::to_string(server_->port());
-  ASSERT_OK_AND_ASSIGN(auto real_location, Location::Parse(uri));
+  ASSERT_OK_AND_ASSIGN(auto real_location, MakeClientLocation(*server_));
   FlightClientOptions client_options = FlightClientOptions::Defaults();
   ASSERT_OK_AND_ASSIGN(client_, FlightClient::Connect(real_location, client_options));
 
@@ -1921,5 +2049,152 @@ void AsyncClientTest::TestListenerLifetime() {
   ASSERT_FINISHES_OK(future);
 }
 
+void AsyncClientTest::TestDoGet() {
+  RecordBatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+
+  ASSERT_OK_AND_ASSIGN(auto reader, client_->DoGetAsync(Ticket{"ticket-ints-1"}));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto schema, reader->GetSchema());
+  AssertSchemaEqual(*expected_batches[0]->schema(), *schema);
+  for (const auto& expected : expected_batches) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto chunk, reader->Next());
+    ASSERT_NE(nullptr, chunk.data);
+    ASSERT_BATCHES_EQUAL(*expected, *chunk.data);
+  }
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto chunk, reader->Next());
+  ASSERT_EQ(nullptr, chunk.data);
+  ASSERT_EQ(nullptr, chunk.app_metadata);
+
+  ASSERT_OK_AND_ASSIGN(reader, client_->DoGetAsync(Ticket{"ticket-ints-1"}));
+  ASSERT_OK_AND_ASSIGN(auto expected_table, Table::FromRecordBatches(expected_batches));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto table, reader->ToTable());
+  AssertTablesEqual(*expected_table, *table);
+
+  // The future may outlive the reader, whose destruction cancels the call
+  ASSERT_OK_AND_ASSIGN(reader, client_->DoGetAsync(Ticket{"ticket-ints-1"}));
+  auto table_future = reader->ToTable();
+  reader.reset();
+  table_future.Wait();
+  if (!table_future.status().ok()) {
+    ASSERT_RAISES(Cancelled, table_future.status());
+  }
+}
+
+void AsyncClientTest::TestDoGetDicts() {
+  RecordBatchVector expected_batches;
+  ASSERT_OK(ExampleDictBatches(&expected_batches));
+
+  // Dictionary batches must be received along with the record batch
+  ASSERT_OK_AND_ASSIGN(auto reader, client_->DoGetAsync(Ticket{"ticket-dicts-1"}));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, reader->ToRecordBatches());
+  ASSERT_EQ(expected_batches.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); i++) {
+    ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+  }
+}
+
+void AsyncClientTest::TestDoGetError() {
+  // As with the other async calls, server errors arrive as transport errors
+  ASSERT_OK_AND_ASSIGN(auto reader, client_->DoGetAsync(Ticket{"ARROW-5095-fail"}));
+  EXPECT_FINISHES_AND_RAISES_WITH_MESSAGE_THAT(
+      UnknownError, ::testing::HasSubstr("Server-side error"), reader->GetSchema());
+
+  // The error comes after the data sent before it
+  ASSERT_OK_AND_ASSIGN(reader, client_->DoGetAsync(Ticket{"ticket-stream-error"}));
+  EXPECT_FINISHES_AND_RAISES_WITH_MESSAGE_THAT(
+      UnknownError, ::testing::HasSubstr("Expected error"), reader->ToRecordBatches());
+}
+
+void AsyncClientTest::TestDoGetConcurrent() {
+  RecordBatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+
+  // Consume many streams at once without a thread per stream
+  constexpr int kNumStreams = 32;
+  std::vector<std::unique_ptr<AsyncFlightStreamReader>> readers;
+  std::vector<Future<std::vector<std::shared_ptr<RecordBatch>>>> futures;
+  for (int i = 0; i < kNumStreams; i++) {
+    ASSERT_OK_AND_ASSIGN(auto reader, client_->DoGetAsync(Ticket{"ticket-ints-1"}));
+    futures.push_back(reader->ToRecordBatches());
+    readers.push_back(std::move(reader));
+  }
+  for (auto& future : futures) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, future);
+    ASSERT_EQ(expected_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); i++) {
+      ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+    }
+  }
+}
+
+void AsyncClientTest::TestDoGetCancel() {
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       client_->DoGetAsync(Ticket{"ticket-large-batch-1"}));
+  ASSERT_FINISHES_OK(reader->GetSchema());
+  reader->Cancel();
+  Status status;
+  while (status.ok()) {
+    auto chunk = reader->Next().result();
+    status = chunk.status();
+    if (status.ok() && !chunk->data) break;
+  }
+  if (!status.ok()) {
+    ASSERT_RAISES(Cancelled, status);
+  }
+}
+
+void AsyncClientTest::TestDoPut() {
+  RecordBatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+
+  auto descr = FlightDescriptor::Path({"ints"});
+  ASSERT_OK_AND_ASSIGN(auto stream, client_->DoPutAsync(descr));
+  ASSERT_FINISHES_OK(stream.writer->Begin(batches[0]->schema()));
+  std::vector<Future<>> writes;
+  for (const auto& batch : batches) {
+    writes.push_back(stream.writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_FINISHES_OK(AllComplete(writes));
+  ASSERT_FINISHES_OK(stream.writer->DoneWriting());
+  // The test server does not send metadata back
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto metadata, stream.reader->ReadMetadata());
+  ASSERT_EQ(nullptr, metadata);
+  ASSERT_FINISHES_OK(stream.writer->Close());
+}
+
+void AsyncClientTest::TestDoExchange() {
+  RecordBatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+
+  auto descr = FlightDescriptor::Command("counter");
+  ASSERT_OK_AND_ASSIGN(auto stream, client_->DoExchangeAsync(descr));
+  ASSERT_FINISHES_OK(stream.writer->Begin(batches[0]->schema()));
+  for (const auto& batch : batches) {
+    ASSERT_FINISHES_OK(stream.writer->WriteWithMetadata(*batch, Buffer::FromString("x")));
+  }
+  ASSERT_FINISHES_OK(stream.writer->DoneWriting());
+  // The writer may go away before the reader
+  stream.writer.reset();
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto chunk, stream.reader->Next());
+  ASSERT_EQ(nullptr, chunk.data);
+  ASSERT_NE(nullptr, chunk.app_metadata);
+  ASSERT_EQ(std::to_string(batches.size()), chunk.app_metadata->ToString());
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto echoed, stream.reader->ToRecordBatches());
+  ASSERT_EQ(batches.size(), echoed.size());
+  for (size_t i = 0; i < batches.size(); i++) {
+    ASSERT_BATCHES_EQUAL(*batches[i], *echoed[i]);
+  }
+}
+
+void AsyncClientTest::TestDoExchangeError() {
+  auto descr = FlightDescriptor::Command("error");
+  ASSERT_OK_AND_ASSIGN(auto stream, client_->DoExchangeAsync(descr));
+  EXPECT_FINISHES_AND_RAISES_WITH_MESSAGE_THAT(
+      NotImplemented, ::testing::HasSubstr("Expected error"), stream.reader->Next());
+  EXPECT_FINISHES_AND_RAISES_WITH_MESSAGE_THAT(
+      NotImplemented, ::testing::HasSubstr("Expected error"), stream.writer->Close());
+}
+
 }  // namespace flight
 }  // namespace arrow
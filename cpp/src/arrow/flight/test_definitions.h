@@ -30,6 +30,7 @@
 #include <type_traits>
 #include <vector>
 
+#include "arrow/flight/client.h"
 #include "arrow/flight/server.h"
 #include "arrow/flight/types.h"
 #include "arrow/util/macros.h"
@@ -41,8 +42,33 @@ class ARROW_FLIGHT_EXPORT FlightTest {
  protected:
   virtual std::string transport() const = 0;
   virtual bool supports_async() const { return false; }
+  /// Whether servers listen on a TCP port
+  virtual bool supports_port() const { return true; }
   virtual void SetUpTest() {}
   virtual void TearDownTest() {}
+
+  /// \brief The location for a new test server to listen on
+  virtual arrow::Result<Location> MakeServerLocation();
+  /// \brief The location for clients to connect to a test server
+  virtual arrow::Result<Location> MakeClientLocation(const FlightServerBase& server);
+
+  /// \brief Initialize a test server and a client connected to it
+  template <typename T, typename... Args>
+  Status MakeTestServer(std::unique_ptr<FlightServerBase>* server,
+                        std::unique_ptr<FlightClient>* client,
+                        std::function<Status(FlightServerOptions*)> make_server_options,
+                        std::function<Status(FlightClientOptions*)> make_client_options,
+                        Args&&... server_args) {
+    ARROW_ASSIGN_OR_RAISE(auto location, MakeServerLocation());
+    *server = std::make_unique<T>(std::forward<Args>(server_args)...);
+    FlightServerOptions server_options(location);
+    RETURN_NOT_OK(make_server_options(&server_options));
+    RETURN_NOT_OK((*server)->Init(server_options));
+    ARROW_ASSIGN_OR_RAISE(auto client_location, MakeClientLocation(**server));
+    FlightClientOptions client_options = FlightClientOptions::Defaults();
+    RETURN_NOT_OK(make_client_options(&client_options));
+    return FlightClient::Connect(client_location, client_options).Value(client);
+  }
 };
 
 /// Common tests of startup/shutdown
@@ -77,6 +103,7 @@ class ARROW_FLIGHT_EXPORT DataTest : public FlightTest {
   void TestDoGetFloats();
   void TestDoGetDicts();
   void TestDoGetLargeBatch();
+  void TestDoGetIpcFile();
   void TestFlightDataStreamError();
   void TestOverflowServerBatch();
   void TestOverflowClientBatch();
@@ -91,6 +118,9 @@ class ARROW_FLIGHT_EXPORT DataTest : public FlightTest {
   void TestDoExchangeConcurrency();
   void TestDoExchangeUndrained();
   void TestIssue5095();
+  void TestDoGetEndpoints();
+  void TestDoGetEndpointsFailover();
+  void TestDoGetEndpointsError();
 
  private:
   void CheckDoGet(
@@ -109,6 +139,7 @@ class ARROW_FLIGHT_EXPORT DataTest : public FlightTest {
   TEST_F(FIXTURE, TestDoGetFloats) { TestDoGetFloats(); }                             \
   TEST_F(FIXTURE, TestDoGetDicts) { TestDoGetDicts(); }                               \
   TEST_F(FIXTURE, TestDoGetLargeBatch) { TestDoGetLargeBatch(); }                     \
+  TEST_F(FIXTURE, TestDoGetIpcFile) { TestDoGetIpcFile(); }                           \
   TEST_F(FIXTURE, TestFlightDataStreamError) { TestFlightDataStreamError(); }         \
   TEST_F(FIXTURE, TestOverflowServerBatch) { TestOverflowServerBatch(); }             \
   TEST_F(FIXTURE, TestOverflowClientBatch) { TestOverflowClientBatch(); }             \
@@ -122,7 +153,10 @@ class ARROW_FLIGHT_EXPORT DataTest : public FlightTest {
   TEST_F(FIXTURE, TestDoExchangeError) { TestDoExchangeError(); }                     \
   TEST_F(FIXTURE, TestDoExchangeConcurrency) { TestDoExchangeConcurrency(); }         \
   TEST_F(FIXTURE, TestDoExchangeUndrained) { TestDoExchangeUndrained(); }             \
-  TEST_F(FIXTURE, TestIssue5095) { TestIssue5095(); }
+  TEST_F(FIXTURE, TestIssue5095) { TestIssue5095(); }                                 \
+  TEST_F(FIXTURE, TestDoGetEndpoints) { TestDoGetEndpoints(); }                       \
+  TEST_F(FIXTURE, TestDoGetEndpointsFailover) { TestDoGetEndpointsFailover(); }       \
+  TEST_F(FIXTURE, TestDoGetEndpointsError) { TestDoGetEndpointsError(); }
 
 /// \brief Specific tests of DoPut.
 class ARROW_FLIGHT_EXPORT DoPutTest : public FlightTest {
@@ -300,6 +334,14 @@ class ARROW_FLIGHT_EXPORT AsyncClientTest : public FlightTest {
   void TestGetFlightInfo();
   void TestGetFlightInfoFuture();
   void TestListenerLifetime();
+  void TestDoGet();
+  void TestDoGetDicts();
+  void TestDoGetError();
+  void TestDoGetConcurrent();
+  void TestDoGetCancel();
+  void TestDoPut();
+  void TestDoExchange();
+  void TestDoExchangeError();
 
  private:
   std::unique_ptr<FlightClient> client_;
@@ -311,7 +353,15 @@ class ARROW_FLIGHT_EXPORT AsyncClientTest : public FlightTest {
                 ARROW_STRINGIFY(FIXTURE) " must inherit from AsyncClientTest"); \
   TEST_F(FIXTURE, TestGetFlightInfo) { TestGetFlightInfo(); }                   \
   TEST_F(FIXTURE, TestGetFlightInfoFuture) { TestGetFlightInfoFuture(); }       \
-  TEST_F(FIXTURE, TestListenerLifetime) { TestListenerLifetime(); }
+  TEST_F(FIXTURE, TestListenerLifetime) { TestListenerLifetime(); }             \
+  TEST_F(FIXTURE, TestDoGet) { TestDoGet(); }                                   \
+  TEST_F(FIXTURE, TestDoGetDicts) { TestDoGetDicts(); }                         \
+  TEST_F(FIXTURE, TestDoGetError) { TestDoGetError(); }                         \
+  TEST_F(FIXTURE, TestDoGetConcurrent) { TestDoGetConcurrent(); }               \
+  TEST_F(FIXTURE, TestDoGetCancel) { TestDoGetCancel(); }                       \
+  TEST_F(FIXTURE, TestDoPut) { TestDoPut(); }                                   \
+  TEST_F(FIXTURE, TestDoExchange) { TestDoExchange(); }                         \
+  TEST_F(FIXTURE, TestDoExchangeError) { TestDoExchangeError(); }
 
 }  // namespace flight
 }  // namespace arrow
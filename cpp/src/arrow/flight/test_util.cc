@@ -40,10 +40,13 @@
 
 #include "arrow/array.h"
 #include "arrow/array/builder_primitive.h"
+#include "arrow/io/memory.h"
 #include "arrow/ipc/test_common.h"
+#include "arrow/ipc/writer.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 
 #include "arrow/flight/api.h"
@@ -197,6 +200,39 @@ Status GetBatchForFlight(const Ticket& ticket, std::shared_ptr<RecordBatchReader
   }
 }
 
+// Serve batches from an IPC file held in memory, which supports zero-copy
+// reads as a memory-mapped file does
+Status GetIpcFileStreamForFlight(const Ticket& ticket,
+                                 std::unique_ptr<FlightDataStream>* out) {
+  RecordBatchVector batches;
+  auto write_options = ipc::IpcWriteOptions::Defaults();
+  std::vector<int> indices;
+  if (ticket.ticket == "ticket-ipc-file-dicts") {
+    RETURN_NOT_OK(ExampleDictBatches(&batches));
+  } else if (ticket.ticket == "ticket-ipc-file-ints-subset") {
+    RETURN_NOT_OK(ExampleIntBatches(&batches));
+    indices = {3, 1};
+  } else if (ticket.ticket == "ticket-ipc-file-ints-compressed") {
+    RETURN_NOT_OK(ExampleIntBatches(&batches));
+    ARROW_ASSIGN_OR_RAISE(write_options.codec, util::Codec::Create(Compression::ZSTD));
+  } else {
+    return Status::NotImplemented("no stream implemented for ticket: " + ticket.ticket);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create());
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        ipc::MakeFileWriter(sink, batches[0]->schema(), write_options));
+  for (const auto& batch : batches) {
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  }
+  RETURN_NOT_OK(writer->Close());
+  ARROW_ASSIGN_OR_RAISE(auto contents, sink->Finish());
+  ARROW_ASSIGN_OR_RAISE(*out,
+                        RecordBatchFileStream::Make(
+                            std::make_shared<io::BufferReader>(std::move(contents)),
+                            std::move(indices)));
+  return Status::OK();
+}
+
 class FlightTestServer : public FlightServerBase {
   Status ListFlights(const ServerCallContext& context, const Criteria* criteria,
                      std::unique_ptr<FlightListing>* listings) override {
@@ -250,6 +286,10 @@ class FlightTestServer : public FlightServerBase {
       return Status::OK();
     }
 
+    if (request.ticket.rfind("ticket-ipc-file-", 0) == 0) {
+      return GetIpcFileStreamForFlight(request, data_stream);
+    }
+
     std::shared_ptr<RecordBatchReader> batch_reader;
     RETURN_NOT_OK(GetBatchForFlight(request, &batch_reader));
 
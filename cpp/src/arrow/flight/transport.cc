@@ -28,6 +28,7 @@
 #include "arrow/ipc/message.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 
 namespace arrow {
 namespace flight {
@@ -106,6 +107,19 @@ Status ClientTransport::DoExchange(const FlightCallOptions& options,
                                    std::unique_ptr<ClientDataStream>* stream) {
   return Status::NotImplemented("DoExchange for this transport");
 }
+void ClientTransport::DoGetAsync(const FlightCallOptions& options, const Ticket& ticket,
+                                 std::shared_ptr<AsyncListener<FlightData>> listener) {
+  listener->OnFinish(Status::NotImplemented("Async DoGet for this transport"));
+}
+void ClientTransport::DoPutAsync(const FlightCallOptions& options,
+                                 std::shared_ptr<AsyncListener<FlightData>> listener) {
+  listener->OnFinish(Status::NotImplemented("Async DoPut for this transport"));
+}
+void ClientTransport::DoExchangeAsync(
+    const FlightCallOptions& options,
+    std::shared_ptr<AsyncListener<FlightData>> listener) {
+  listener->OnFinish(Status::NotImplemented("Async DoExchange for this transport"));
+}
 void ClientTransport::SetAsyncRpc(AsyncListenerBase* listener,
                                   std::unique_ptr<AsyncRpc>&& rpc) {
   listener->rpc_state_ = std::move(rpc);
@@ -117,6 +131,10 @@ std::unique_ptr<AsyncRpc> ClientTransport::ReleaseAsyncRpc(AsyncListenerBase* li
   return std::move(listener->rpc_state_);
 }
 
+Future<bool> AsyncRpc::Write(FlightPayload) {
+  return Status::NotImplemented("Writing data for this RPC");
+}
+
 class TransportRegistry::Impl final {
  public:
   arrow::Result<std::unique_ptr<ClientTransport>> MakeClient(
@@ -200,6 +200,22 @@ class ARROW_FLIGHT_EXPORT ClientTransport {
                        std::unique_ptr<ClientDataStream>* stream);
   virtual Status DoExchange(const FlightCallOptions& options,
                             std::unique_ptr<ClientDataStream>* stream);
+  /// \brief Start an asynchronous DoGet.
+  ///
+  /// The transport must store its AsyncRpc in the listener (see
+  /// SetAsyncRpc). Messages are only read from the server when
+  /// requested with AsyncRpc::StartRead.
+  virtual void DoGetAsync(const FlightCallOptions& options, const Ticket& ticket,
+                          std::shared_ptr<AsyncListener<FlightData>> listener);
+  /// \brief Start an asynchronous DoPut.
+  ///
+  /// Application metadata sent by the server is delivered to the
+  /// listener as FlightData with only app_metadata set.
+  virtual void DoPutAsync(const FlightCallOptions& options,
+                          std::shared_ptr<AsyncListener<FlightData>> listener);
+  /// \brief Start an asynchronous DoExchange.
+  virtual void DoExchangeAsync(const FlightCallOptions& options,
+                               std::shared_ptr<AsyncListener<FlightData>> listener);
 
   bool supports_async() const { return CheckAsyncSupport().ok(); }
   virtual Status CheckAsyncSupport() const {
@@ -256,11 +272,28 @@ class ARROW_FLIGHT_EXPORT AsyncRpc {
   /// \brief Request cancellation of the RPC.
   virtual void TryCancel() {}
 
+  /// \brief Request the next message of a streaming RPC.
+  ///
+  /// At most one read is outstanding at a time, and the listener's
+  /// OnNext is called once the message arrives; a call made while a
+  /// read is outstanding starts another read after that OnNext
+  /// returns. Reading on demand like this lets a slow consumer apply
+  /// backpressure to the server.
+  virtual void StartRead() {}
+
   /// Only needed for DoPut/DoExchange
   virtual void Begin(const FlightDescriptor& descriptor, std::shared_ptr<Schema> schema) {
   }
+  /// \brief Write a payload to a DoPut/DoExchange stream.
+  ///
+  /// Payloads are queued and written in order. The returned future
+  /// completes once the payload has been written, with false if the
+  /// stream was closed first (e.g. the server finished the call).
+  ///
   /// Only needed for DoPut/DoExchange
-  virtual void Write(arrow::flight::FlightStreamChunk chunk) {}
+  virtual Future<bool> Write(FlightPayload payload);
+  /// \brief Indicate that no further payloads will be written.
+  ///
   /// Only needed for DoPut/DoExchange
   virtual void DoneWriting() {}
 };
@@ -17,6 +17,7 @@
 
 #include "arrow/flight/transport/grpc/grpc_client.h"
 
+#include <algorithm>
 #include <condition_variable>
 #include <deque>
 #include <map>
@@ -25,8 +26,10 @@
 #include <sstream>
 #include <string>
 #include <thread>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <grpcpp/grpcpp.h>
 #include <grpcpp/support/client_callback.h>
@@ -41,6 +44,7 @@
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/base64.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string.h"
 #include "arrow/util/uri.h"
@@ -599,16 +603,34 @@ class GrpcGarbageBin {
     });
   }
 
+  /// Announce that an RPC is about to notify its listener and then be
+  /// disposed of. The listener may well close the client as soon as it
+  /// is notified, so Stop() waits for the RPC to arrive here (unless
+  /// called from that very callback).
+  void Expect() {
+    std::unique_lock<std::mutex> guard(grpc_destructor_mutex_);
+    ++expected_;
+    finishing_threads_.push_back(std::this_thread::get_id());
+  }
+
   void Dispose(std::unique_ptr<internal::AsyncRpc> trash) {
     std::unique_lock<std::mutex> guard(grpc_destructor_mutex_);
+    auto it = FindFinishingThread();
+    if (it != finishing_threads_.end()) {
+      finishing_threads_.erase(it);
+      --expected_;
+    }
+    grpc_destructor_cv_.notify_all();
     if (!running_) return;
     garbage_bin_.push_back(std::move(trash));
-    grpc_destructor_cv_.notify_all();
   }
 
   void Stop() {
     {
       std::unique_lock<std::mutex> guard(grpc_destructor_mutex_);
+      if (FindFinishingThread() == finishing_threads_.end()) {
+        grpc_destructor_cv_.wait(guard, [&]() { return expected_ == 0; });
+      }
       running_ = false;
       grpc_destructor_cv_.notify_all();
     }
@@ -616,7 +638,16 @@ class GrpcGarbageBin {
   }
 
  private:
+  // Must be called with the lock held
+  std::vector<std::thread::id>::iterator FindFinishingThread() {
+    return std::find(finishing_threads_.begin(), finishing_threads_.end(),
+                     std::this_thread::get_id());
+  }
+
   bool running_ = true;
+  int64_t expected_ = 0;
+  // The threads currently notifying a listener between Expect() and Dispose()
+  std::vector<std::thread::id> finishing_threads_;
   std::thread grpc_destructor_thread_;
   std::mutex grpc_destructor_mutex_;
   std::condition_variable grpc_destructor_cv_;
@@ -659,6 +690,7 @@ class UnaryUnaryAsyncCall : public ::grpc::ClientUnaryReactor, public internal::
 
   void Finish(const ::grpc::Status& status) {
     auto listener = std::move(this->listener);
+    garbage_bin_->Expect();
     listener->OnFinish(
         CombinedTransportStatus(status, std::move(client_status), &rpc.context));
     // SetAsyncRpc may trigger destruction, so Finish() first
@@ -670,6 +702,242 @@ class UnaryUnaryAsyncCall : public ::grpc::ClientUnaryReactor, public internal::
   }
 };
 
+/// Convert a message read by a streaming async call for the listener.
+internal::FlightData FromReadMessage(internal::FlightData* message) {
+  return std::move(*message);
+}
+internal::FlightData FromReadMessage(pb::PutResult* message) {
+  internal::FlightData data;
+  data.app_metadata = Buffer::FromString(std::move(*message->mutable_app_metadata()));
+  return data;
+}
+pb::FlightData* ReadTarget(internal::FlightData* message) {
+  return AsGrpcMessage(message);
+}
+pb::PutResult* ReadTarget(pb::PutResult* message) { return message; }
+/// The protobuf type that gRPC reads into the given message type.
+template <typename ReadMessage>
+using GrpcReadType =
+    std::remove_pointer_t<decltype(ReadTarget(std::declval<ReadMessage*>()))>;
+
+/// The read side of an async DoGet/DoPut/DoExchange.
+///
+/// Reads are only started on request (AsyncRpc::StartRead). A hold
+/// keeps the call open between reads; it is released once the server
+/// ends the stream, or on cancellation. gRPC never runs reactions
+/// inline, so it is safe to call into gRPC while holding the mutex,
+/// which in turn guarantees the call is alive while a hold is held.
+template <typename Reactor, typename ReadMessage>
+class StreamingAsyncCall : public Reactor, public internal::AsyncRpc {
+ public:
+  ClientRpc rpc;
+  std::shared_ptr<AsyncListener<internal::FlightData>> listener;
+  std::shared_ptr<GrpcGarbageBin> garbage_bin_;
+
+  // Destruct last
+  FinishedFlag finished;
+
+  StreamingAsyncCall(const FlightCallOptions& options,
+                     std::shared_ptr<AsyncListener<internal::FlightData>> listener,
+                     std::shared_ptr<GrpcGarbageBin> garbage_bin)
+      : rpc(options),
+        listener(std::move(listener)),
+        garbage_bin_(std::move(garbage_bin)) {}
+
+  /// Take the holds and start the call.
+  virtual void Start() {
+    read_hold_ = true;
+    this->AddHold();
+    this->StartCall();
+  }
+
+  void TryCancel() override {
+    std::lock_guard<std::mutex> guard(mutex_);
+    cancelled_ = true;
+    rpc.context.TryCancel();
+    // A pending read will release the hold when it fails
+    if (!read_pending_) ReleaseReadHold();
+    StopWriting();
+  }
+
+  void StartRead() override {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!read_hold_) return;
+    if (read_pending_) {
+      // Start it once the pending read has been delivered
+      read_wanted_ = true;
+      return;
+    }
+    read_pending_ = true;
+    Reactor::StartRead(ReadTarget(&read_message_));
+  }
+
+  void OnReadDone(bool ok) override {
+    if (ok) {
+      // Don't start the next read before this returns, so that OnNext
+      // is never called concurrently
+      listener->OnNext(FromReadMessage(&read_message_));
+    }
+    std::lock_guard<std::mutex> guard(mutex_);
+    read_pending_ = false;
+    if (!ok) {
+      // The server ended the call (gRPC servers can't half-close), so
+      // the call can't finish until we stop writing too
+      ReleaseReadHold();
+      StopWriting();
+    } else if (cancelled_) {
+      ReleaseReadHold();
+    } else if (read_wanted_) {
+      read_wanted_ = false;
+      read_pending_ = true;
+      Reactor::StartRead(ReadTarget(&read_message_));
+    }
+  }
+
+  void OnDone(const ::grpc::Status& status) override {
+    auto listener = std::move(this->listener);
+    garbage_bin_->Expect();
+    listener->OnFinish(CombinedTransportStatus(status, Status::OK(), &rpc.context));
+    // SetAsyncRpc may trigger destruction, so Finish() first
+    finished.Finish();
+    // Instead of potentially destructing gRPC resources here,
+    // transfer it to a dedicated background thread
+    garbage_bin_->Dispose(
+        flight::internal::ClientTransport::ReleaseAsyncRpc(listener.get()));
+  }
+
+ protected:
+  // Must be called with the lock held
+  virtual void StopWriting() {}
+
+  std::mutex mutex_;
+  bool cancelled_ = false;
+
+ private:
+  // Must be called with the lock held and no read pending
+  void ReleaseReadHold() {
+    if (!read_hold_) return;
+    read_hold_ = false;
+    this->RemoveHold();
+  }
+
+  ReadMessage read_message_;
+  bool read_hold_ = false;
+  bool read_pending_ = false;
+  bool read_wanted_ = false;
+};
+
+/// An async DoGet.
+class DoGetAsyncCall
+    : public StreamingAsyncCall<::grpc::ClientReadReactor<pb::FlightData>,
+                                internal::FlightData> {
+ public:
+  using StreamingAsyncCall::StreamingAsyncCall;
+
+  pb::Ticket pb_ticket;
+};
+
+/// An async DoPut/DoExchange: adds a queue of payloads to write.
+///
+/// gRPC allows a single outstanding write, so payloads are queued
+/// and written one after the other. A second hold keeps the call
+/// open for writing until DoneWriting(), a failed write, the server
+/// ending the call, or cancellation.
+template <typename ReadMessage>
+class BidiStreamingAsyncCall
+    : public StreamingAsyncCall<
+          ::grpc::ClientBidiReactor<pb::FlightData, GrpcReadType<ReadMessage>>,
+          ReadMessage> {
+ public:
+  using Base = StreamingAsyncCall<
+      ::grpc::ClientBidiReactor<pb::FlightData, GrpcReadType<ReadMessage>>,
+      ReadMessage>;
+  using Base::Base;
+
+  void Start() override {
+    write_hold_ = true;
+    this->AddHold();
+    Base::Start();
+  }
+
+  Future<bool> Write(FlightPayload payload) override {
+    RETURN_NOT_OK(payload.Validate());
+    std::lock_guard<std::mutex> guard(this->mutex_);
+    if (!write_hold_ || writes_done_ || writes_stopped_) {
+      return false;
+    }
+    auto future = Future<bool>::Make();
+    writes_.push_back({std::move(payload), future});
+    if (writes_.size() == 1) {
+      this->StartWrite(AsGrpcMessage(&writes_.front().payload));
+    }
+    return future;
+  }
+
+  void DoneWriting() override {
+    std::lock_guard<std::mutex> guard(this->mutex_);
+    if (writes_done_) return;
+    writes_done_ = true;
+    if (writes_.empty()) FinishWrites();
+  }
+
+  void OnWriteDone(bool ok) override {
+    std::vector<Future<bool>> completed;
+    {
+      std::lock_guard<std::mutex> guard(this->mutex_);
+      completed.push_back(std::move(writes_.front().future));
+      writes_.pop_front();
+      write_failed_ = write_failed_ || !ok;
+      if (write_failed_ || writes_stopped_) {
+        // The stream is broken or ended; fail the queued writes
+        for (auto& write : writes_) {
+          completed.push_back(std::move(write.future));
+        }
+        writes_.clear();
+      }
+      if (!writes_.empty()) {
+        this->StartWrite(AsGrpcMessage(&writes_.front().payload));
+      } else if (writes_done_ || write_failed_ || writes_stopped_) {
+        FinishWrites();
+      }
+    }
+    // Complete futures without holding the lock, as callbacks may write again
+    for (auto& future : completed) {
+      future.MarkFinished(ok);
+      ok = false;
+    }
+  }
+
+ protected:
+  void StopWriting() override {
+    writes_stopped_ = true;
+    // A pending write will release the hold when it completes
+    if (writes_.empty()) FinishWrites();
+  }
+
+ private:
+  struct PendingWrite {
+    FlightPayload payload;
+    Future<bool> future;
+  };
+
+  // Must be called with the lock held and no write pending
+  void FinishWrites() {
+    if (!write_hold_) return;
+    write_hold_ = false;
+    if (writes_done_ && !write_failed_ && !writes_stopped_) {
+      this->StartWritesDone();
+    }
+    this->RemoveHold();
+  }
+
+  std::deque<PendingWrite> writes_;
+  bool write_hold_ = false;
+  bool writes_done_ = false;
+  bool write_failed_ = false;
+  bool writes_stopped_ = false;
+};
+
 #define LISTENER_NOT_OK(LISTENER, EXPR)                 \
   if (auto arrow_status = (EXPR); !arrow_status.ok()) { \
     (LISTENER)->OnFinish(std::move(arrow_status));      \
@@ -1034,6 +1302,39 @@ class GrpcClientImpl : public internal::ClientTransport {
         ->StartCall();
   }
 
+  void DoGetAsync(
+      const FlightCallOptions& options, const Ticket& ticket,
+      std::shared_ptr<AsyncListener<internal::FlightData>> listener) override {
+    auto call = std::make_unique<DoGetAsyncCall>(options, listener, garbage_bin_);
+    LISTENER_NOT_OK(listener, internal::ToProto(ticket, &call->pb_ticket));
+    LISTENER_NOT_OK(listener, call->rpc.SetToken(auth_handler_.get()));
+
+    stub_->experimental_async()->DoGet(&call->rpc.context, &call->pb_ticket, call.get());
+    StartStreamingCall<DoGetAsyncCall>(std::move(call), listener.get());
+  }
+
+  void DoPutAsync(
+      const FlightCallOptions& options,
+      std::shared_ptr<AsyncListener<internal::FlightData>> listener) override {
+    using AsyncCall = BidiStreamingAsyncCall<pb::PutResult>;
+    auto call = std::make_unique<AsyncCall>(options, listener, garbage_bin_);
+    LISTENER_NOT_OK(listener, call->rpc.SetToken(auth_handler_.get()));
+
+    stub_->experimental_async()->DoPut(&call->rpc.context, call.get());
+    StartStreamingCall<AsyncCall>(std::move(call), listener.get());
+  }
+
+  void DoExchangeAsync(
+      const FlightCallOptions& options,
+      std::shared_ptr<AsyncListener<internal::FlightData>> listener) override {
+    using AsyncCall = BidiStreamingAsyncCall<internal::FlightData>;
+    auto call = std::make_unique<AsyncCall>(options, listener, garbage_bin_);
+    LISTENER_NOT_OK(listener, call->rpc.SetToken(auth_handler_.get()));
+
+    stub_->experimental_async()->DoExchange(&call->rpc.context, call.get());
+    StartStreamingCall<AsyncCall>(std::move(call), listener.get());
+  }
+
   Status CheckAsyncSupport() const override { return Status::OK(); }
 #else
   void GetFlightInfoAsync(const FlightCallOptions& options,
@@ -1074,6 +1375,16 @@ class GrpcClientImpl : public internal::ClientTransport {
     return Status::OK();
   }
 
+#ifdef GRPC_ENABLE_ASYNC
+  template <typename AsyncCall>
+  static void StartStreamingCall(std::unique_ptr<AsyncCall> call,
+                                 AsyncListenerBase* listener) {
+    ClientTransport::SetAsyncRpc(listener, std::move(call));
+    arrow::internal::checked_cast<AsyncCall*>(ClientTransport::GetAsyncRpc(listener))
+        ->Start();
+  }
+#endif
+
   std::unique_ptr<pb::FlightService::Stub> stub_;
   std::shared_ptr<ClientAuthHandler> auth_handler_;
 #if defined(GRPC_NAMESPACE_FOR_TLS_CREDENTIALS_OPTIONS) && \
@@ -477,6 +477,16 @@ bool ReadPayload(::grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* read
   return reader->Read(data);
 }
 
+const pb::FlightData* AsGrpcMessage(const FlightPayload* payload) {
+  // Pretend to be pb::FlightData and intercept in SerializationTraits
+  return reinterpret_cast<const pb::FlightData*>(payload);
+}
+
+pb::FlightData* AsGrpcMessage(flight::internal::FlightData* data) {
+  // Pretend to be pb::FlightData and intercept in SerializationTraits
+  return reinterpret_cast<pb::FlightData*>(data);
+}
+
 #ifndef _WIN32
 #pragma GCC diagnostic pop
 #endif
@@ -65,6 +65,11 @@ bool ReadPayload(::grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* rea
 bool ReadPayload(::grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* reader,
                  pb::PutResult* data);
 
+/// Pass Flight messages to the gRPC callback API with the same
+/// zero-copy optimizations (the result must only be handed to gRPC).
+const pb::FlightData* AsGrpcMessage(const FlightPayload* payload);
+pb::FlightData* AsGrpcMessage(flight::internal::FlightData* data);
+
 }  // namespace grpc
 }  // namespace transport
 }  // namespace flight
@@ -0,0 +1,357 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <sys/socket.h>
+
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "arrow/array/array_base.h"
+#include "arrow/flight/test_definitions.h"
+#include "arrow/flight/test_util.h"
+#include "arrow/flight/transport/shm/shm.h"
+#include "arrow/flight/transport/shm/shm_internal.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/table.h"
+#include "arrow/testing/generator.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/uri.h"
+
+namespace arrow {
+namespace flight {
+
+using arrow::internal::FileDescriptor;
+using arrow::internal::TemporaryDir;
+
+class ShmEnvironment : public ::testing::Environment {
+ public:
+  void SetUp() override { transport::shm::InitializeFlightShm(); }
+};
+
+testing::Environment* const kShmEnvironment =
+    testing::AddGlobalTestEnvironment(new ShmEnvironment());
+
+//------------------------------------------------------------
+// Common transport tests
+
+// Servers listen on Unix domain sockets in a temporary directory
+template <typename Base>
+class ShmTest : public Base, public ::testing::Test {
+ protected:
+  std::string transport() const override { return "shm"; }
+  bool supports_port() const override { return false; }
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_, TemporaryDir::Make("flight-shm-test-"));
+    this->SetUpTest();
+  }
+  void TearDown() override { this->TearDownTest(); }
+
+  arrow::Result<Location> MakeServerLocation() override {
+    return Location::Parse("shm://" + temp_dir_->path().ToString() + "flight-" +
+                           std::to_string(num_servers_++) + ".sock");
+  }
+  arrow::Result<Location> MakeClientLocation(const FlightServerBase& server) override {
+    return server.location();
+  }
+
+ private:
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  int num_servers_ = 0;
+};
+
+class ShmConnectivityTest : public ShmTest<ConnectivityTest> {
+ protected:
+  void TestBuilderHook() { GTEST_SKIP() << "No transport builder to hook"; }
+};
+ARROW_FLIGHT_TEST_CONNECTIVITY(ShmConnectivityTest);
+
+class ShmDataTest : public ShmTest<DataTest> {};
+ARROW_FLIGHT_TEST_DATA(ShmDataTest);
+
+class ShmDoPutTest : public ShmTest<DoPutTest> {};
+ARROW_FLIGHT_TEST_DO_PUT(ShmDoPutTest);
+
+class ShmAppMetadataTest : public ShmTest<AppMetadataTest> {};
+ARROW_FLIGHT_TEST_APP_METADATA(ShmAppMetadataTest);
+
+class ShmIpcOptionsTest : public ShmTest<IpcOptionsTest> {};
+ARROW_FLIGHT_TEST_IPC_OPTIONS(ShmIpcOptionsTest);
+
+class ShmErrorHandlingTest : public ShmTest<ErrorHandlingTest> {
+ protected:
+  void TestGetFlightInfoMetadata() { GTEST_SKIP() << "Middleware not implemented"; }
+};
+ARROW_FLIGHT_TEST_ERROR_HANDLING(ShmErrorHandlingTest);
+
+//------------------------------------------------------------
+// Shared memory transport internals tests
+
+namespace transport {
+namespace shm {
+
+static constexpr std::initializer_list<FrameType> kFrameTypes = {
+    FrameType::kHeaders,         FrameType::kBuffer,     FrameType::kPayloadHeader,
+    FrameType::kPayloadBody,     FrameType::kPayloadBodyRef,
+    FrameType::kDisconnect,
+};
+
+TEST(FrameHeader, Basics) {
+  for (const auto frame_type : kFrameTypes) {
+    FrameHeader header;
+    ASSERT_OK(header.Set(frame_type, /*counter=*/42, /*body_size=*/65535));
+    if (frame_type == FrameType::kDisconnect) {
+      ASSERT_RAISES(Cancelled, Frame::ParseHeader(header.data(), header.size()));
+    } else {
+      ASSERT_OK_AND_ASSIGN(auto frame, Frame::ParseHeader(header.data(), header.size()));
+      ASSERT_EQ(frame->type, frame_type);
+      ASSERT_EQ(frame->counter, 42);
+      ASSERT_EQ(frame->size, 65535);
+    }
+  }
+}
+
+TEST(FrameHeader, FrameType) {
+  for (const auto frame_type : kFrameTypes) {
+    ASSERT_LE(static_cast<int>(frame_type), static_cast<int>(FrameType::kMaxFrameType));
+  }
+}
+
+TEST(ShmUri, Parse) {
+  arrow::util::Uri uri;
+  ASSERT_OK(uri.Parse("shm:///tmp/flight.sock"));
+  ASSERT_OK_AND_ASSIGN(auto path, SocketPathFromUri(uri));
+  ASSERT_EQ(path, "/tmp/flight.sock");
+  ASSERT_OK_AND_ASSIGN(auto ring_size, RingSizeFromUri(uri));
+  ASSERT_EQ(ring_size, kDefaultRingSize);
+
+  ASSERT_OK(uri.Parse("shm:///tmp/flight.sock?ring_size=0"));
+  ASSERT_OK_AND_ASSIGN(ring_size, RingSizeFromUri(uri));
+  ASSERT_EQ(ring_size, 0);
+
+  ASSERT_OK(uri.Parse("shm:///tmp/flight.sock?ring_size=1024"));
+  ASSERT_RAISES(Invalid, RingSizeFromUri(uri));
+  ASSERT_OK(uri.Parse("shm:///tmp/flight.sock?ring_size=foo"));
+  ASSERT_RAISES(Invalid, RingSizeFromUri(uri));
+}
+
+TEST(SharedMemoryRing, ReserveAndReclaim) {
+  constexpr int64_t kRingSize = 64 * 1024;
+  FileDescriptor fd;
+  ASSERT_OK_AND_ASSIGN(auto segment, SharedMemorySegment::Create(kRingSize, &fd));
+  SharedMemoryRing ring(segment);
+  ASSERT_EQ(ring.capacity(), kRingSize);
+
+  auto free_chunk = [&](int64_t offset) {
+    reinterpret_cast<ChunkHeader*>(segment->data() + offset)
+        ->state.store(ChunkHeader::kFree);
+  };
+
+  // Fill the ring with four chunks of a quarter of its size each
+  constexpr int64_t kChunkSize = kRingSize / 4 - SharedMemoryRing::kChunkHeaderBytes;
+  constexpr int64_t kLargeChunkSize =
+      kRingSize / 2 - SharedMemoryRing::kChunkHeaderBytes;
+  std::vector<int64_t> offsets;
+  while (true) {
+    auto offset = ring.Reserve(kChunkSize);
+    if (!offset.has_value()) break;
+    offsets.push_back(*offset);
+  }
+  ASSERT_EQ(offsets, std::vector<int64_t>({0, 16384, 32768, 49152}));
+  ASSERT_EQ(ring.bytes_reserved(), kRingSize);
+  ASSERT_FALSE(ring.Reserve(1).has_value());
+
+  // Freeing a chunk other than the oldest does not make room
+  free_chunk(offsets[1]);
+  ASSERT_FALSE(ring.Reserve(1).has_value());
+  // Freeing the oldest reclaims it and the chunk after it
+  free_chunk(offsets[0]);
+  auto offset = ring.Reserve(kLargeChunkSize);
+  ASSERT_TRUE(offset.has_value());
+  ASSERT_EQ(*offset, 0);
+  ASSERT_FALSE(ring.Reserve(1).has_value());
+
+  // A chunk which does not fit before the end of the ring wraps around
+  free_chunk(offsets[2]);
+  free_chunk(offsets[3]);
+  free_chunk(0);
+  ASSERT_EQ(ring.Reserve(kLargeChunkSize), 0);
+  ASSERT_EQ(ring.Reserve(kChunkSize), 32768);
+  free_chunk(0);
+  ASSERT_EQ(ring.Reserve(kLargeChunkSize), 0);
+  // The skipped end of the ring is reclaimed along with the chunk before it
+  free_chunk(32768);
+  ASSERT_EQ(ring.Reserve(kLargeChunkSize), 32768);
+
+  // Chunks larger than the ring never fit
+  ASSERT_FALSE(ring.Reserve(kRingSize).has_value());
+}
+
+class TestShmCallDriver : public ::testing::Test {
+ public:
+  void Connect(int64_t ring_size) {
+    int fds[2];
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+    FileDescriptor sender_fd(fds[0]), receiver_fd(fds[1]);
+    arrow::Result<std::unique_ptr<ShmCallDriver>> receiver;
+    std::thread thread([&] {
+      receiver = ShmCallDriver::Connect(std::move(receiver_fd), ring_size, "sender");
+    });
+    auto sender = ShmCallDriver::Connect(std::move(sender_fd), ring_size, "receiver");
+    thread.join();
+    ASSERT_OK_AND_ASSIGN(sender_, sender);
+    ASSERT_OK_AND_ASSIGN(receiver_, receiver);
+  }
+
+  void TearDown() override {
+    if (sender_) ASSERT_OK(sender_->Close());
+    if (receiver_) ASSERT_OK(receiver_->Close());
+  }
+
+  // Send a batch and read it back, returning the body frame
+  void RoundTrip(const RecordBatch& batch, std::shared_ptr<Frame>* body) {
+    FlightPayload payload;
+    ASSERT_OK(ipc::GetRecordBatchPayload(batch, ipc::IpcWriteOptions::Defaults(),
+                                         &payload.ipc_message));
+    ASSERT_OK(sender_->SendFlightPayload(payload));
+    ASSERT_OK_AND_ASSIGN(auto header, receiver_->ReadNextFrame());
+    ASSERT_OK(receiver_->ExpectFrameType(*header, FrameType::kPayloadHeader));
+    ASSERT_OK_AND_ASSIGN(*body, receiver_->ReadNextFrame());
+    ASSERT_OK(receiver_->ExpectFrameType(**body, FrameType::kPayloadBody));
+    ASSERT_EQ((*body)->size, payload.ipc_message.body_length);
+  }
+
+ protected:
+  std::unique_ptr<ShmCallDriver> sender_;
+  std::unique_ptr<ShmCallDriver> receiver_;
+};
+
+TEST_F(TestShmCallDriver, BodiesByReference) {
+  ASSERT_NO_FATAL_FAILURE(Connect(/*ring_size=*/64 * 1024));
+  auto batch = RecordBatchFromJSON(schema({field("a", int64())}), "[[1], [2], [3]]");
+  for (int i = 0; i < 16; ++i) {
+    std::shared_ptr<Frame> body;
+    ASSERT_NO_FATAL_FAILURE(RoundTrip(*batch, &body));
+  }
+  // Released bodies are recycled, so the ring never fills up
+  ASSERT_EQ(sender_->bodies_sent_by_reference(), 16);
+  ASSERT_EQ(sender_->bodies_sent_inline(), 0);
+}
+
+TEST_F(TestShmCallDriver, FallbackWhenRingFull) {
+  ASSERT_NO_FATAL_FAILURE(Connect(/*ring_size=*/64 * 1024));
+  auto batch = ConstantArrayGenerator::Zeroes(2000, int64());
+  auto record_batch = RecordBatch::Make(schema({field("a", int64())}), 2000, {batch});
+
+  // Hold on to the received bodies so the ring fills up
+  std::vector<std::shared_ptr<Frame>> bodies(8);
+  for (auto& body : bodies) {
+    ASSERT_NO_FATAL_FAILURE(RoundTrip(*record_batch, &body));
+  }
+  // Each body takes up 16000 bytes, so four fit in the ring
+  ASSERT_EQ(sender_->bodies_sent_by_reference(), 4);
+  ASSERT_EQ(sender_->bodies_sent_inline(), 4);
+  for (const auto& body : bodies) {
+    ASSERT_EQ(body->buffer->size(), bodies[0]->buffer->size());
+  }
+
+  bodies.clear();
+  std::shared_ptr<Frame> body;
+  ASSERT_NO_FATAL_FAILURE(RoundTrip(*record_batch, &body));
+  ASSERT_EQ(sender_->bodies_sent_by_reference(), 5);
+}
+
+TEST_F(TestShmCallDriver, RingDisabled) {
+  ASSERT_NO_FATAL_FAILURE(Connect(/*ring_size=*/0));
+  auto batch = RecordBatchFromJSON(schema({field("a", int64())}), "[[1], [2], [3]]");
+  std::shared_ptr<Frame> body;
+  ASSERT_NO_FATAL_FAILURE(RoundTrip(*batch, &body));
+  ASSERT_EQ(sender_->bodies_sent_by_reference(), 0);
+  ASSERT_EQ(sender_->bodies_sent_inline(), 1);
+}
+
+}  // namespace shm
+}  // namespace transport
+
+//------------------------------------------------------------
+// Ad-hoc shared memory transport tests
+
+class TestShm : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK_AND_ASSIGN(temp_dir_, TemporaryDir::Make("flight-shm-test-"));
+    ASSERT_OK_AND_ASSIGN(
+        auto location,
+        Location::Parse("shm://" + temp_dir_->path().ToString() + "flight.sock"));
+    server_ = ExampleTestServer();
+    ASSERT_OK(server_->Init(FlightServerOptions(location)));
+    ASSERT_OK_AND_ASSIGN(client_, FlightClient::Connect(server_->location()));
+  }
+
+  void TearDown() {
+    ASSERT_OK(client_->Close());
+    ASSERT_OK(server_->Shutdown());
+  }
+
+ protected:
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+};
+
+TEST_F(TestShm, DoGetRingDisabled) {
+  ASSERT_OK_AND_ASSIGN(
+      auto location,
+      Location::Parse("shm://" + temp_dir_->path().ToString() + "flight.sock" +
+                      "?ring_size=0"));
+  ASSERT_OK_AND_ASSIGN(auto client, FlightClient::Connect(location));
+
+  Ticket ticket{"ticket-ints-1"};
+  ASSERT_OK_AND_ASSIGN(auto stream1, client_->DoGet(ticket));
+  ASSERT_OK_AND_ASSIGN(auto table1, stream1->ToTable());
+  ASSERT_OK_AND_ASSIGN(auto stream2, client->DoGet(ticket));
+  ASSERT_OK_AND_ASSIGN(auto table2, stream2->ToTable());
+  AssertTablesEqual(*table1, *table2);
+  ASSERT_OK(client->Close());
+}
+
+TEST_F(TestShm, ConcurrentClients) {
+  ASSERT_OK_AND_ASSIGN(
+      auto client2,
+      FlightClient::Connect(server_->location(), FlightClientOptions::Defaults()));
+
+  Ticket ticket{"ticket-ints-1"};
+
+  ASSERT_OK_AND_ASSIGN(auto stream1, client_->DoGet(ticket));
+  ASSERT_OK_AND_ASSIGN(auto stream2, client2->DoGet(ticket));
+
+  ASSERT_OK_AND_ASSIGN(auto table1, stream1->ToTable());
+  ASSERT_OK_AND_ASSIGN(auto table2, stream2->ToTable());
+
+  AssertTablesEqual(*table1, *table2);
+  ASSERT_OK(client2->Close());
+}
+
+TEST_F(TestShm, SocketInUse) {
+  auto server = ExampleTestServer();
+  ASSERT_RAISES(AlreadyExists, server->Init(FlightServerOptions(server_->location())));
+}
+
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,42 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/flight/visibility.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace shm {
+
+/// \brief Register the shared memory transport under the "shm" scheme.
+///
+/// The transport is meant for clients and servers on the same host.
+/// Locations take the form shm:///path/to/socket: connections are
+/// established over a Unix domain socket at that path, after which
+/// record batch bodies are passed through shared memory instead of
+/// being copied through the socket. The size of the shared memory
+/// ring of each connection can be set with the ring_size query
+/// parameter (in bytes, 0 to disable).
+ARROW_FLIGHT_EXPORT
+void InitializeFlightShm();
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,524 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+/// The client-side implementation of a shared memory transport for
+/// Flight.
+///
+/// As with the UCX transport, each connection carries one call at a
+/// time, and a client keeps a small pool of connections to support
+/// concurrent calls. Connections use blocking I/O: reading and
+/// writing are independent, so unlike UCX, streams don't need a
+/// worker thread to drive progress.
+
+#include "arrow/flight/transport/shm/shm_internal.h"
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/client.h"
+#include "arrow/flight/transport.h"
+#include "arrow/flight/types.h"
+#include "arrow/ipc/message.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/uri.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace shm {
+
+namespace {
+class ShmClientImpl;
+
+Status MergeStatuses(Status server_status, Status transport_status) {
+  if (server_status.ok()) {
+    if (transport_status.ok()) return server_status;
+    return transport_status;
+  } else if (transport_status.ok()) {
+    return server_status;
+  }
+  return Status::FromDetailAndArgs(server_status.code(), server_status.detail(),
+                                   server_status.message(),
+                                   ". Transport context: ", transport_status.ToString());
+}
+
+/// \brief An individual connection to the server.
+class ClientConnection {
+ public:
+  ClientConnection() = default;
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ClientConnection);
+  ARROW_DEFAULT_MOVE_AND_ASSIGN(ClientConnection);
+  ~ClientConnection() { DCHECK(!driver_) << "Connection was not closed!"; }
+
+  Status Init(const std::string& socket_path, int64_t ring_size) {
+    struct sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(addr.sun_path)) {
+      return Status::Invalid("Socket path is too long: ", socket_path);
+    }
+    std::memcpy(addr.sun_path, socket_path.data(), socket_path.size());
+
+    arrow::internal::FileDescriptor fd(::socket(AF_UNIX, SOCK_STREAM, 0));
+    if (fd.closed()) {
+      return arrow::internal::IOErrorFromErrno(errno, "Failed to create socket");
+    }
+    int ret;
+    do {
+      ret = ::connect(fd.fd(), reinterpret_cast<const struct sockaddr*>(&addr),
+                      sizeof(addr));
+    } while (ret == -1 && errno == EINTR);
+    if (ret == -1) {
+      return arrow::internal::IOErrorFromErrno(errno, "Failed to connect to ",
+                                               socket_path);
+    }
+    ARROW_ASSIGN_OR_RAISE(driver_, ShmCallDriver::Connect(std::move(fd), ring_size,
+                                                          "unix:" + socket_path));
+    ARROW_LOG(DEBUG) << "Connected to " << driver_->peer();
+    return Status::OK();
+  }
+
+  Status Close() {
+    if (!driver_) return Status::OK();
+    // The server may already be gone, in which case there is nobody
+    // to notify
+    ARROW_UNUSED(driver_->SendFrame(FrameType::kDisconnect, nullptr, 0));
+    auto status = driver_->Close();
+    driver_.reset();
+    return status;
+  }
+
+  ShmCallDriver* driver() {
+    DCHECK(driver_);
+    return driver_.get();
+  }
+  bool has_driver() const { return driver_ != nullptr; }
+
+ private:
+  std::unique_ptr<ShmCallDriver> driver_;
+};
+
+class ShmClientStream : public internal::ClientDataStream {
+ public:
+  ShmClientStream(ShmClientImpl* impl, ClientConnection conn)
+      : impl_(impl),
+        conn_(std::move(conn)),
+        driver_(conn_.driver()),
+        writes_done_(false),
+        finished_(false) {
+    DCHECK_NE(impl, nullptr);
+    DCHECK_NE(conn_.driver(), nullptr);
+  }
+
+  ~ShmClientStream() override {
+    // The stream was dropped before the call finished (e.g. the reader
+    // was abandoned mid-stream): the connection is out of sync with the
+    // server and can't be reused
+    if (impl_) ARROW_UNUSED(conn_.Close());
+  }
+
+  arrow::Result<bool> WriteData(const FlightPayload& payload) override {
+    if (finished_ || writes_done_) return false;
+    RETURN_NOT_OK(driver_->SendFlightPayload(payload));
+    return true;
+  }
+
+  Status WritesDone() override {
+    if (!writes_done_) {
+      writes_done_ = true;
+      ARROW_ASSIGN_OR_RAISE(auto headers, HeadersFrame::Make({}));
+      auto buffer = std::move(headers).GetBuffer();
+      RETURN_NOT_OK(
+          driver_->SendFrame(FrameType::kHeaders, buffer->data(), buffer->size()));
+    }
+    return Status::OK();
+  }
+
+ protected:
+  Status DoFinish() override;
+
+  /// \brief Read a payload (header and body frames), or the trailers.
+  ///
+  /// \return false if the server sent its trailers.
+  arrow::Result<bool> ReadPayload(internal::FlightData* data) {
+    ARROW_ASSIGN_OR_RAISE(auto frame, driver_->ReadNextFrame());
+    if (frame->type == FrameType::kHeaders) {
+      RETURN_NOT_OK(ReadTrailers(frame.get()));
+      return false;
+    }
+
+    RETURN_NOT_OK(driver_->ExpectFrameType(*frame, FrameType::kPayloadHeader));
+    PayloadHeaderFrame payload_header(std::move(frame->buffer));
+    RETURN_NOT_OK(payload_header.ToFlightData(data));
+
+    if (data->metadata) {
+      ARROW_ASSIGN_OR_RAISE(auto message, ipc::Message::Open(data->metadata, nullptr));
+      if (ipc::Message::HasBody(message->type())) {
+        ARROW_ASSIGN_OR_RAISE(frame, driver_->ReadNextFrame());
+        RETURN_NOT_OK(driver_->ExpectFrameType(*frame, FrameType::kPayloadBody));
+        data->body = std::move(frame->buffer);
+      }
+    }
+    return true;
+  }
+
+  Status ReadTrailers(Frame* frame) {
+    // Trailers, stream is over
+    ARROW_ASSIGN_OR_RAISE(auto headers, HeadersFrame::Parse(std::move(frame->buffer)));
+    return headers.GetStatus(&server_status_);
+  }
+
+  std::mutex finish_mutex_;
+  ShmClientImpl* impl_;
+  ClientConnection conn_;
+  ShmCallDriver* driver_;
+  std::atomic<bool> writes_done_;
+  std::atomic<bool> finished_;
+  Status io_status_;
+  Status server_status_;
+};
+
+class GetClientStream : public ShmClientStream {
+ public:
+  GetClientStream(ShmClientImpl* impl, ClientConnection conn)
+      : ShmClientStream(impl, std::move(conn)) {
+    writes_done_ = true;
+  }
+
+  bool ReadData(internal::FlightData* data) override {
+    if (finished_) return false;
+
+    bool success = true;
+    io_status_ = ReadPayload(data).Value(&success);
+
+    if (!io_status_.ok() || !success) {
+      finished_ = true;
+    }
+    return success;
+  }
+};
+
+class PutClientStream : public ShmClientStream {
+ public:
+  using ShmClientStream::ShmClientStream;
+
+  bool ReadPutMetadata(std::shared_ptr<Buffer>* out) override {
+    *out = nullptr;
+    if (finished_) return false;
+
+    bool success = true;
+    io_status_ = ReadImpl(out).Value(&success);
+
+    if (!io_status_.ok() || !success) {
+      finished_ = true;
+    }
+    return success;
+  }
+
+ private:
+  arrow::Result<bool> ReadImpl(std::shared_ptr<Buffer>* out) {
+    ARROW_ASSIGN_OR_RAISE(auto frame, driver_->ReadNextFrame());
+    if (frame->type == FrameType::kHeaders) {
+      RETURN_NOT_OK(ReadTrailers(frame.get()));
+      return false;
+    }
+    RETURN_NOT_OK(driver_->ExpectFrameType(*frame, FrameType::kBuffer));
+    *out = std::move(frame->buffer);
+    return true;
+  }
+};
+
+class ExchangeClientStream : public ShmClientStream {
+ public:
+  using ShmClientStream::ShmClientStream;
+
+  bool ReadData(internal::FlightData* data) override {
+    if (finished_) return false;
+
+    bool success = true;
+    io_status_ = ReadPayload(data).Value(&success);
+
+    if (!io_status_.ok() || !success) {
+      finished_ = true;
+    }
+    return success;
+  }
+};
+
+class ShmClientImpl : public arrow::flight::internal::ClientTransport {
+ public:
+  ShmClientImpl() = default;
+
+  ~ShmClientImpl() override {
+    ARROW_WARN_NOT_OK(Close(), "ShmClientImpl errored in Close() in destructor");
+  }
+
+  Status Init(const FlightClientOptions& options, const Location& location,
+              const arrow::util::Uri& uri) override {
+    ARROW_ASSIGN_OR_RAISE(socket_path_, SocketPathFromUri(uri));
+    ARROW_ASSIGN_OR_RAISE(ring_size_, RingSizeFromUri(uri));
+    RETURN_NOT_OK(MakeConnection());
+    return Status::OK();
+  }
+
+  Status Close() override {
+    std::unique_lock<std::mutex> guard(connections_mutex_);
+    Status status;
+    while (!connections_.empty()) {
+      ClientConnection conn = std::move(connections_.front());
+      connections_.pop_front();
+      status &= conn.Close();
+    }
+    return status;
+  }
+
+  Status GetFlightInfo(const FlightCallOptions& options,
+                       const FlightDescriptor& descriptor,
+                       std::unique_ptr<FlightInfo>* info) override {
+    ARROW_ASSIGN_OR_RAISE(std::string payload, descriptor.SerializeToString());
+    std::string response;
+    RETURN_NOT_OK(UnaryCall(options, kMethodGetFlightInfo, payload, &response));
+    ARROW_ASSIGN_OR_RAISE(*info, FlightInfo::Deserialize(response));
+    return Status::OK();
+  }
+
+  Status PollFlightInfo(const FlightCallOptions& options,
+                        const FlightDescriptor& descriptor,
+                        std::unique_ptr<PollInfo>* info) override {
+    ARROW_ASSIGN_OR_RAISE(std::string payload, descriptor.SerializeToString());
+    std::string response;
+    RETURN_NOT_OK(UnaryCall(options, kMethodPollFlightInfo, payload, &response));
+    ARROW_ASSIGN_OR_RAISE(*info, PollInfo::Deserialize(response));
+    return Status::OK();
+  }
+
+  Status DoAction(const FlightCallOptions& options, const Action& action,
+                  std::unique_ptr<ResultStream>* results) override {
+    ARROW_ASSIGN_OR_RAISE(auto connection, CheckoutConnection(options));
+    ShmCallDriver* driver = connection.driver();
+
+    std::vector<Result> collected;
+    Status server_status;
+    auto impl = [&]() -> Status {
+      RETURN_NOT_OK(driver->StartCall(kMethodDoAction));
+      ARROW_ASSIGN_OR_RAISE(std::string payload, action.SerializeToString());
+      RETURN_NOT_OK(driver->SendFrame(FrameType::kBuffer,
+                                      reinterpret_cast<const uint8_t*>(payload.data()),
+                                      static_cast<int64_t>(payload.size())));
+      while (true) {
+        ARROW_ASSIGN_OR_RAISE(auto frame, driver->ReadNextFrame());
+        if (frame->type != FrameType::kBuffer) {
+          RETURN_NOT_OK(driver->ExpectFrameType(*frame, FrameType::kHeaders));
+          ARROW_ASSIGN_OR_RAISE(auto headers,
+                                HeadersFrame::Parse(std::move(frame->buffer)));
+          return headers.GetStatus(&server_status);
+        }
+        ARROW_ASSIGN_OR_RAISE(auto result, Result::Deserialize(frame->view()));
+        collected.push_back(std::move(result));
+      }
+    };
+    auto status = impl();
+    status = FinishCall(std::move(connection), std::move(status));
+    RETURN_NOT_OK(MergeStatuses(std::move(server_status), std::move(status)));
+    *results = std::make_unique<SimpleResultStream>(std::move(collected));
+    return Status::OK();
+  }
+
+  Status DoExchange(const FlightCallOptions& options,
+                    std::unique_ptr<internal::ClientDataStream>* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto connection, CheckoutConnection(options));
+    ShmCallDriver* driver = connection.driver();
+
+    auto status = driver->StartCall(kMethodDoExchange);
+    if (ARROW_PREDICT_TRUE(status.ok())) {
+      *out = std::make_unique<ExchangeClientStream>(this, std::move(connection));
+      return Status::OK();
+    }
+    return FinishCall(std::move(connection), std::move(status));
+  }
+
+  Status DoGet(const FlightCallOptions& options, const Ticket& ticket,
+               std::unique_ptr<internal::ClientDataStream>* stream) override {
+    ARROW_ASSIGN_OR_RAISE(auto connection, CheckoutConnection(options));
+    ShmCallDriver* driver = connection.driver();
+
+    auto impl = [&]() {
+      RETURN_NOT_OK(driver->StartCall(kMethodDoGet));
+      ARROW_ASSIGN_OR_RAISE(std::string payload, ticket.SerializeToString());
+      RETURN_NOT_OK(driver->SendFrame(FrameType::kBuffer,
+                                      reinterpret_cast<const uint8_t*>(payload.data()),
+                                      static_cast<int64_t>(payload.size())));
+      *stream = std::make_unique<GetClientStream>(this, std::move(connection));
+      return Status::OK();
+    };
+
+    auto status = impl();
+    if (ARROW_PREDICT_TRUE(status.ok())) return status;
+    return FinishCall(std::move(connection), std::move(status));
+  }
+
+  Status DoPut(const FlightCallOptions& options,
+               std::unique_ptr<internal::ClientDataStream>* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto connection, CheckoutConnection(options));
+    ShmCallDriver* driver = connection.driver();
+
+    auto status = driver->StartCall(kMethodDoPut);
+    if (ARROW_PREDICT_TRUE(status.ok())) {
+      *out = std::make_unique<PutClientStream>(this, std::move(connection));
+      return Status::OK();
+    }
+    return FinishCall(std::move(connection), std::move(status));
+  }
+
+  Status ReturnConnection(ClientConnection conn) {
+    std::unique_lock<std::mutex> guard(connections_mutex_);
+    if (connections_.size() >= kMaxOpenConnections) {
+      guard.unlock();
+      return conn.Close();
+    }
+    DCHECK_NE(conn.driver(), nullptr);
+    connections_.push_back(std::move(conn));
+    return Status::OK();
+  }
+
+  /// \brief Release a connection after a call, given the transport
+  ///   status of the call.
+  ///
+  /// After a transport error, the connection may be out of sync with
+  /// the server, so it is closed rather than reused.
+  Status FinishCall(ClientConnection conn, Status io_status) {
+    if (io_status.ok()) return ReturnConnection(std::move(conn));
+    return MergeStatuses(std::move(io_status), conn.Close());
+  }
+
+ private:
+  /// \brief Send one request message, then receive at most one
+  ///   response message and the status.
+  Status UnaryCall(const FlightCallOptions& options, const char* method,
+                   const std::string& request, std::string* response) {
+    ARROW_ASSIGN_OR_RAISE(auto connection, CheckoutConnection(options));
+    ShmCallDriver* driver = connection.driver();
+
+    Status server_status;
+    auto impl = [&]() -> Status {
+      RETURN_NOT_OK(driver->StartCall(method));
+      RETURN_NOT_OK(driver->SendFrame(FrameType::kBuffer,
+                                      reinterpret_cast<const uint8_t*>(request.data()),
+                                      static_cast<int64_t>(request.size())));
+
+      ARROW_ASSIGN_OR_RAISE(auto incoming_message, driver->ReadNextFrame());
+      if (incoming_message->type == FrameType::kBuffer) {
+        *response = std::string(incoming_message->view());
+        ARROW_ASSIGN_OR_RAISE(incoming_message, driver->ReadNextFrame());
+      }
+      RETURN_NOT_OK(driver->ExpectFrameType(*incoming_message, FrameType::kHeaders));
+      ARROW_ASSIGN_OR_RAISE(auto headers,
+                            HeadersFrame::Parse(std::move(incoming_message->buffer)));
+      return headers.GetStatus(&server_status);
+    };
+    auto status = impl();
+    status = FinishCall(std::move(connection), std::move(status));
+    return MergeStatuses(std::move(server_status), std::move(status));
+  }
+
+  Status MakeConnection() {
+    ClientConnection conn;
+    RETURN_NOT_OK(conn.Init(socket_path_, ring_size_));
+    std::unique_lock<std::mutex> guard(connections_mutex_);
+    connections_.push_back(std::move(conn));
+    return Status::OK();
+  }
+
+  arrow::Result<ClientConnection> CheckoutConnection(const FlightCallOptions& options) {
+    ClientConnection conn;
+    {
+      std::unique_lock<std::mutex> guard(connections_mutex_);
+      if (!connections_.empty()) {
+        conn = std::move(connections_.front());
+        connections_.pop_front();
+      }
+    }
+    if (!conn.has_driver()) {
+      RETURN_NOT_OK(conn.Init(socket_path_, ring_size_));
+    }
+    conn.driver()->set_memory_manager(options.memory_manager);
+    conn.driver()->set_read_memory_pool(options.read_options.memory_pool);
+    conn.driver()->set_write_memory_pool(options.write_options.memory_pool);
+    return conn;
+  }
+
+  static constexpr size_t kMaxOpenConnections = 3;
+
+  std::string socket_path_;
+  int64_t ring_size_ = kDefaultRingSize;
+  std::mutex connections_mutex_;
+  std::deque<ClientConnection> connections_;
+};
+
+Status ShmClientStream::DoFinish() {
+  RETURN_NOT_OK(WritesDone());
+  // Both reader and writer may be used concurrently, and both may
+  // call Finish() - prevent concurrent state mutation
+  std::lock_guard<std::mutex> guard(finish_mutex_);
+  if (!finished_) {
+    internal::FlightData message;
+    std::shared_ptr<Buffer> metadata;
+    while (ReadData(&message)) {
+    }
+    while (ReadPutMetadata(&metadata)) {
+    }
+    finished_ = true;
+  }
+  if (impl_) {
+    DCHECK_NE(conn_.driver(), nullptr);
+    // If the call did not complete cleanly, the connection may be
+    // out of sync with the server, so don't reuse it
+    auto status = io_status_.ok() ? impl_->ReturnConnection(std::move(conn_))
+                                  : conn_.Close();
+    impl_ = nullptr;
+    driver_ = nullptr;
+    if (!status.ok()) {
+      if (io_status_.ok()) {
+        io_status_ = std::move(status);
+      } else {
+        io_status_ = Status::FromDetailAndArgs(
+            io_status_.code(), io_status_.detail(), io_status_.message(),
+            ". Transport context: ", status.ToString());
+      }
+    }
+  }
+  return MergeStatuses(server_status_, io_status_);
+}
+}  // namespace
+
+std::unique_ptr<arrow::flight::internal::ClientTransport> MakeShmClientImpl() {
+  return std::make_unique<ShmClientImpl>();
+}
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
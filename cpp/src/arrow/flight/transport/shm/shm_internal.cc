@@ -0,0 +1,919 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/transport/shm/shm_internal.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "arrow/buffer.h"
+#include "arrow/device.h"
+#include "arrow/flight/types.h"
+#include "arrow/ipc/message.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string.h"
+#include "arrow/util/value_parsing.h"
+
+namespace arrow {
+
+using internal::ToChars;
+
+namespace flight {
+namespace transport {
+namespace shm {
+
+using internal::TransportStatus;
+
+constexpr char kHeaderMethod[] = ":method:";
+
+namespace {
+
+// Sent by both sides when a connection is established, along with
+// the file descriptor of the sender's ring (if any)
+constexpr char kHandshakeMagic[] = "ARROWSHM";
+constexpr int64_t kHandshakeMagicBytes = 8;
+constexpr int64_t kHandshakeBytes = kHandshakeMagicBytes + 8;
+constexpr uint32_t kHandshakeVersion = 1;
+
+// Ring offsets and lengths are sent as 32-bit integers
+constexpr int64_t kMinRingSize = 64 * 1024;
+constexpr int64_t kMaxRingSize = int64_t{1} << 31;
+constexpr int64_t kBodyRefBytes = 8;
+
+// Upper bound on the number of iovecs passed to a single sendmsg()
+constexpr size_t kMaxIovecs = 64;
+
+#ifdef MSG_NOSIGNAL
+constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+constexpr int kSendFlags = 0;
+#endif
+
+Status SizeToUInt32BytesBe(const int64_t in, uint8_t* out) {
+  if (ARROW_PREDICT_FALSE(in < 0)) {
+    return Status::Invalid("Length cannot be negative");
+  } else if (ARROW_PREDICT_FALSE(
+                 in > static_cast<int64_t>(std::numeric_limits<uint32_t>::max()))) {
+    return Status::Invalid("Length cannot exceed uint32_t");
+  }
+  UInt32ToBytesBe(static_cast<uint32_t>(in), out);
+  return Status::OK();
+}
+
+/// \brief An IPC body living in the peer's shared memory ring.
+///
+/// Frees the chunk for reuse by the peer once destroyed.
+class ShmBodyBuffer : public Buffer {
+ public:
+  ShmBodyBuffer(std::shared_ptr<SharedMemorySegment> segment, int64_t chunk_offset,
+                int64_t size)
+      : Buffer(segment->data() + chunk_offset + SharedMemoryRing::kChunkHeaderBytes,
+               size),
+        segment_(std::move(segment)),
+        header_(reinterpret_cast<ChunkHeader*>(segment_->data() + chunk_offset)) {}
+
+  ~ShmBodyBuffer() override {
+    header_->state.store(ChunkHeader::kFree, std::memory_order_release);
+  }
+
+ private:
+  std::shared_ptr<SharedMemorySegment> segment_;
+  ChunkHeader* header_;
+};
+
+Status SendHandshake(int fd, int64_t ring_size, int ring_fd) {
+  std::array<uint8_t, kHandshakeBytes> message;
+  std::memcpy(message.data(), kHandshakeMagic, kHandshakeMagicBytes);
+  UInt32ToBytesBe(kHandshakeVersion, message.data() + kHandshakeMagicBytes);
+  RETURN_NOT_OK(
+      SizeToUInt32BytesBe(ring_size, message.data() + kHandshakeMagicBytes + 4));
+
+  struct iovec iov;
+  iov.iov_base = message.data();
+  iov.iov_len = message.size();
+  struct msghdr msg;
+  std::memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+
+  alignas(struct cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+  if (ring_fd >= 0) {
+    std::memset(control, 0, sizeof(control));
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(cmsg), &ring_fd, sizeof(int));
+  }
+
+  ssize_t ret;
+  do {
+    ret = ::sendmsg(fd, &msg, kSendFlags);
+  } while (ret == -1 && errno == EINTR);
+  if (ret == -1) {
+    return arrow::internal::IOErrorFromErrno(errno, "Failed to send handshake");
+  } else if (ret != static_cast<ssize_t>(message.size())) {
+    return Status::IOError("Short write while sending handshake");
+  }
+  return Status::OK();
+}
+
+Status RecvHandshake(int fd, int64_t* ring_size,
+                     arrow::internal::FileDescriptor* ring_fd) {
+  std::array<uint8_t, kHandshakeBytes> message;
+  struct iovec iov;
+  iov.iov_base = message.data();
+  iov.iov_len = message.size();
+  struct msghdr msg;
+  std::memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  alignas(struct cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+  std::memset(control, 0, sizeof(control));
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+
+  int flags = MSG_WAITALL;
+#ifdef MSG_CMSG_CLOEXEC
+  flags |= MSG_CMSG_CLOEXEC;
+#endif
+  ssize_t ret;
+  do {
+    ret = ::recvmsg(fd, &msg, flags);
+  } while (ret == -1 && errno == EINTR);
+  if (ret == -1) {
+    return arrow::internal::IOErrorFromErrno(errno, "Failed to receive handshake");
+  }
+
+  // Take ownership of any passed descriptor first so it can't leak
+  for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+       cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+    if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS &&
+        cmsg->cmsg_len == CMSG_LEN(sizeof(int))) {
+      int received_fd;
+      std::memcpy(&received_fd, CMSG_DATA(cmsg), sizeof(int));
+      *ring_fd = arrow::internal::FileDescriptor(received_fd);
+    }
+  }
+  if (ret != static_cast<ssize_t>(message.size())) {
+    return Status::IOError("Connection closed during handshake");
+  }
+  if (msg.msg_flags & MSG_CTRUNC) {
+    return Status::IOError("Handshake control message was truncated");
+  }
+  if (std::memcmp(message.data(), kHandshakeMagic, kHandshakeMagicBytes) != 0) {
+    return Status::IOError("Peer is not speaking the shared memory Flight protocol");
+  }
+  const uint32_t version = BytesToUInt32Be(message.data() + kHandshakeMagicBytes);
+  if (version != kHandshakeVersion) {
+    return Status::IOError("Expected protocol version ", kHandshakeVersion, " but got ",
+                           version);
+  }
+  *ring_size = BytesToUInt32Be(message.data() + kHandshakeMagicBytes + 4);
+  if (*ring_size > 0 && ring_fd->closed()) {
+    return Status::IOError("Peer did not send its shared memory ring");
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+arrow::Result<std::string> SocketPathFromUri(const arrow::util::Uri& uri) {
+  std::string path = uri.path();
+  if (path.empty()) {
+    return Status::Invalid("Shared memory Flight locations need a socket path, e.g. ",
+                           "shm:///tmp/flight.sock; got: ", uri.ToString());
+  }
+  return path;
+}
+
+arrow::Result<int64_t> RingSizeFromUri(const arrow::util::Uri& uri) {
+  ARROW_ASSIGN_OR_RAISE(auto items, uri.query_items());
+  int64_t ring_size = kDefaultRingSize;
+  for (const auto& item : items) {
+    if (item.first != kRingSizeParameter) continue;
+    if (!::arrow::internal::ParseValue<Int64Type>(item.second.data(), item.second.size(),
+                                                  &ring_size)) {
+      return Status::Invalid("Invalid ", kRingSizeParameter, ": '", item.second, "'");
+    }
+  }
+  if (ring_size != 0 && (ring_size < kMinRingSize || ring_size > kMaxRingSize)) {
+    return Status::Invalid(kRingSizeParameter, " must be 0 or between ", kMinRingSize,
+                           " and ", kMaxRingSize, ", got ", ring_size);
+  }
+  return bit_util::RoundUpToMultipleOf64(ring_size);
+}
+
+//------------------------------------------------------------
+// Shared Memory Helpers
+
+SharedMemorySegment::~SharedMemorySegment() {
+  if (::munmap(data_, static_cast<size_t>(size_)) != 0) {
+    ARROW_LOG(WARNING) << "Failed to unmap shared memory: " << std::strerror(errno);
+  }
+}
+
+arrow::Result<std::shared_ptr<SharedMemorySegment>> SharedMemorySegment::Create(
+    int64_t size, arrow::internal::FileDescriptor* fd) {
+#ifdef __linux__
+  int raw_fd = ::memfd_create("arrow-flight-shm", MFD_CLOEXEC);
+  if (raw_fd == -1) {
+    return arrow::internal::IOErrorFromErrno(errno, "Failed to create shared memory");
+  }
+#else
+  static std::atomic<int64_t> counter{0};
+  const std::string name = "/arrow-flight-shm-" + ToChars(::getpid()) + "-" +
+                           ToChars(counter.fetch_add(1));
+  int raw_fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (raw_fd == -1) {
+    return arrow::internal::IOErrorFromErrno(errno, "Failed to create shared memory");
+  }
+  // The object only needs to be reachable through the descriptor
+  ::shm_unlink(name.c_str());
+#endif
+  arrow::internal::FileDescriptor owned_fd(raw_fd);
+  if (::ftruncate(raw_fd, static_cast<off_t>(size)) != 0) {
+    return arrow::internal::IOErrorFromErrno(errno, "Failed to size shared memory");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto segment, Map(raw_fd, size));
+  *fd = std::move(owned_fd);
+  return segment;
+}
+
+arrow::Result<std::shared_ptr<SharedMemorySegment>> SharedMemorySegment::Map(
+    int fd, int64_t size) {
+  struct stat st;
+  if (::fstat(fd, &st) != 0) {
+    return arrow::internal::IOErrorFromErrno(errno, "Failed to stat shared memory");
+  }
+  if (static_cast<int64_t>(st.st_size) < size) {
+    return Status::IOError("Shared memory object has ", st.st_size,
+                           " bytes, expected at least ", size);
+  }
+  void* data = ::mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd, 0);
+  if (data == MAP_FAILED) {
+    return arrow::internal::IOErrorFromErrno(errno, "Failed to map shared memory");
+  }
+  return std::shared_ptr<SharedMemorySegment>(
+      new SharedMemorySegment(reinterpret_cast<uint8_t*>(data), size));
+}
+
+constexpr int64_t SharedMemoryRing::kChunkHeaderBytes;
+
+SharedMemoryRing::SharedMemoryRing(std::shared_ptr<SharedMemorySegment> segment)
+    : segment_(std::move(segment)),
+      capacity_(segment_->size() / kChunkHeaderBytes * kChunkHeaderBytes) {}
+
+void SharedMemoryRing::Reclaim() {
+  while (!chunks_.empty()) {
+    const Chunk& chunk = chunks_.front();
+    if (!chunk.padding &&
+        header_at(chunk.offset)->state.load(std::memory_order_acquire) !=
+            ChunkHeader::kFree) {
+      break;
+    }
+    tail_ = chunk.offset + chunk.size;
+    if (tail_ == capacity_) tail_ = 0;
+    used_ -= chunk.size;
+    chunks_.pop_front();
+  }
+  if (chunks_.empty()) {
+    head_ = tail_ = 0;
+  }
+}
+
+int64_t SharedMemoryRing::Commit(int64_t offset, int64_t size) {
+  header_at(offset)->state.store(ChunkHeader::kInUse, std::memory_order_relaxed);
+  chunks_.push_back({offset, size, /*padding=*/false});
+  used_ += size;
+  head_ = offset + size;
+  if (head_ == capacity_) head_ = 0;
+  return offset;
+}
+
+std::optional<int64_t> SharedMemoryRing::Reserve(int64_t size) {
+  const int64_t needed = kChunkHeaderBytes + bit_util::RoundUpToMultipleOf64(size);
+  if (needed > capacity_) return std::nullopt;
+  Reclaim();
+  if (used_ == capacity_) return std::nullopt;
+
+  if (head_ >= tail_) {
+    // Free space is [head_, capacity_) followed by [0, tail_)
+    if (capacity_ - head_ >= needed) return Commit(head_, needed);
+    if (tail_ < needed) return std::nullopt;
+    // Skip the end of the ring
+    const int64_t padding = capacity_ - head_;
+    chunks_.push_back({head_, padding, /*padding=*/true});
+    used_ += padding;
+    return Commit(0, needed);
+  }
+  // Free space is [head_, tail_)
+  if (tail_ - head_ >= needed) return Commit(head_, needed);
+  return std::nullopt;
+}
+
+//------------------------------------------------------------
+// Message Framing
+
+constexpr size_t FrameHeader::kFrameHeaderBytes;
+constexpr uint8_t FrameHeader::kFrameVersion;
+
+Status FrameHeader::Set(FrameType frame_type, uint32_t counter, int64_t body_size) {
+  header[0] = kFrameVersion;
+  header[1] = static_cast<uint8_t>(frame_type);
+  UInt32ToBytesBe(counter, header.data() + 4);
+  RETURN_NOT_OK(SizeToUInt32BytesBe(body_size, header.data() + 8));
+  return Status::OK();
+}
+
+arrow::Result<std::shared_ptr<Frame>> Frame::ParseHeader(const void* header,
+                                                         size_t header_length) {
+  if (header_length < FrameHeader::kFrameHeaderBytes) {
+    return Status::IOError("Header is too short, must be at least ",
+                           FrameHeader::kFrameHeaderBytes, " bytes, got ", header_length);
+  }
+
+  const uint8_t* frame_header = reinterpret_cast<const uint8_t*>(header);
+  if (frame_header[0] != FrameHeader::kFrameVersion) {
+    return Status::IOError("Expected frame version ",
+                           static_cast<int>(FrameHeader::kFrameVersion), " but got ",
+                           static_cast<int>(frame_header[0]));
+  } else if (frame_header[1] > static_cast<uint8_t>(FrameType::kMaxFrameType)) {
+    return Status::IOError("Unknown frame type ", static_cast<int>(frame_header[1]));
+  }
+
+  const FrameType frame_type = static_cast<FrameType>(frame_header[1]);
+  const uint32_t frame_counter = BytesToUInt32Be(frame_header + 4);
+  const uint32_t frame_size = BytesToUInt32Be(frame_header + 8);
+
+  if (frame_type == FrameType::kDisconnect) {
+    return Status::Cancelled("Client initiated disconnect");
+  }
+
+  return std::make_shared<Frame>(frame_type, frame_size, frame_counter, nullptr);
+}
+
+arrow::Result<HeadersFrame> HeadersFrame::Parse(std::unique_ptr<Buffer> buffer) {
+  HeadersFrame result;
+  const uint8_t* payload = buffer->data();
+  const uint8_t* end = payload + buffer->size();
+  if (ARROW_PREDICT_FALSE((end - payload) < 4)) {
+    return Status::Invalid("Buffer underflow, expected number of headers");
+  }
+  const uint32_t num_headers = BytesToUInt32Be(payload);
+  payload += 4;
+  for (uint32_t i = 0; i < num_headers; i++) {
+    if (ARROW_PREDICT_FALSE((end - payload) < 4)) {
+      return Status::Invalid("Buffer underflow, expected length of key ", i + 1);
+    }
+    const uint32_t key_length = BytesToUInt32Be(payload);
+    payload += 4;
+
+    if (ARROW_PREDICT_FALSE((end - payload) < 4)) {
+      return Status::Invalid("Buffer underflow, expected length of value ", i + 1);
+    }
+    const uint32_t value_length = BytesToUInt32Be(payload);
+    payload += 4;
+
+    if (ARROW_PREDICT_FALSE((end - payload) < key_length)) {
+      return Status::Invalid("Buffer underflow, expected key ", i + 1, " to have length ",
+                             key_length, ", but only ", (end - payload), " bytes remain");
+    }
+    const std::string_view key(reinterpret_cast<const char*>(payload), key_length);
+    payload += key_length;
+
+    if (ARROW_PREDICT_FALSE((end - payload) < value_length)) {
+      return Status::Invalid("Buffer underflow, expected value ", i + 1,
+                             " to have length ", value_length, ", but only ",
+                             (end - payload), " bytes remain");
+    }
+    const std::string_view value(reinterpret_cast<const char*>(payload), value_length);
+    payload += value_length;
+    result.headers_.emplace_back(key, value);
+  }
+
+  result.buffer_ = std::move(buffer);
+  return result;
+}
+
+arrow::Result<HeadersFrame> HeadersFrame::Make(
+    const std::vector<std::pair<std::string, std::string>>& headers) {
+  int64_t total_length = 4 /* # of headers */;
+  for (const auto& header : headers) {
+    total_length += 4 /* key length */ + 4 /* value length */ +
+                    header.first.size() /* key */ + header.second.size();
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(total_length));
+  uint8_t* payload = buffer->mutable_data();
+
+  RETURN_NOT_OK(SizeToUInt32BytesBe(headers.size(), payload));
+  payload += 4;
+  for (const auto& header : headers) {
+    RETURN_NOT_OK(SizeToUInt32BytesBe(header.first.size(), payload));
+    payload += 4;
+    RETURN_NOT_OK(SizeToUInt32BytesBe(header.second.size(), payload));
+    payload += 4;
+    std::memcpy(payload, header.first.data(), header.first.size());
+    payload += header.first.size();
+    std::memcpy(payload, header.second.data(), header.second.size());
+    payload += header.second.size();
+  }
+  return Parse(std::move(buffer));
+}
+
+arrow::Result<HeadersFrame> HeadersFrame::Make(
+    const Status& status,
+    const std::vector<std::pair<std::string, std::string>>& headers) {
+  auto all_headers = headers;
+
+  TransportStatus transport_status = TransportStatus::FromStatus(status);
+  all_headers.emplace_back(kHeaderStatus,
+                           ToChars(static_cast<int32_t>(transport_status.code)));
+  all_headers.emplace_back(kHeaderMessage, std::move(transport_status.message));
+  all_headers.emplace_back(kHeaderStatusCode,
+                           ToChars(static_cast<int32_t>(status.code())));
+  all_headers.emplace_back(kHeaderStatusMessage, status.message());
+  if (status.detail()) {
+    all_headers.emplace_back(kHeaderStatusDetail, status.detail()->ToString());
+    auto fsd = FlightStatusDetail::UnwrapStatus(status);
+    if (fsd && !fsd->extra_info().empty()) {
+      all_headers.emplace_back(kHeaderStatusDetailBin, fsd->extra_info());
+    }
+  }
+  return Make(all_headers);
+}
+
+arrow::Result<std::string_view> HeadersFrame::Get(const std::string& key) {
+  for (const auto& pair : headers_) {
+    if (pair.first == key) return pair.second;
+  }
+  return Status::KeyError(key);
+}
+
+Status HeadersFrame::GetStatus(Status* out) {
+  static const std::string kUnknownMessage = "Server did not send status message header";
+  std::string_view code_str, message_str;
+  auto status = Get(kHeaderStatus).Value(&code_str);
+  if (!status.ok()) {
+    return Status::KeyError("Server did not send status code header ", kHeaderStatusCode);
+  }
+  if (code_str == "0") {  // == ToChars(TransportStatusCode::kOk)
+    *out = Status::OK();
+    return Status::OK();
+  }
+
+  status = Get(kHeaderMessage).Value(&message_str);
+  if (!status.ok()) message_str = kUnknownMessage;
+
+  TransportStatus transport_status = TransportStatus::FromCodeStringAndMessage(
+      std::string(code_str), std::string(message_str));
+  if (transport_status.code == TransportStatusCode::kOk) {
+    *out = Status::OK();
+    return Status::OK();
+  }
+  *out = transport_status.ToStatus();
+
+  std::string_view detail_str, bin_str;
+  std::optional<std::string> message, detail_message, detail_bin;
+  if (!Get(kHeaderStatusCode).Value(&code_str).ok()) {
+    // No Arrow status sent, go with the transport status
+    return Status::OK();
+  }
+  if (Get(kHeaderStatusMessage).Value(&message_str).ok()) {
+    message = std::string(message_str);
+  }
+  if (Get(kHeaderStatusDetail).Value(&detail_str).ok()) {
+    detail_message = std::string(detail_str);
+  }
+  if (Get(kHeaderStatusDetailBin).Value(&bin_str).ok()) {
+    detail_bin = std::string(bin_str);
+  }
+  *out = internal::ReconstructStatus(std::string(code_str), *out, std::move(message),
+                                     std::move(detail_message), std::move(detail_bin),
+                                     FlightStatusDetail::UnwrapStatus(*out));
+  return Status::OK();
+}
+
+namespace {
+static constexpr uint32_t kMissingFieldSentinel = std::numeric_limits<uint32_t>::max();
+static constexpr uint32_t kInt32Max =
+    static_cast<uint32_t>(std::numeric_limits<int32_t>::max());
+arrow::Result<uint32_t> PayloadHeaderFieldSize(const std::string& field,
+                                               const std::shared_ptr<Buffer>& data,
+                                               uint32_t* total_size) {
+  if (!data) return kMissingFieldSentinel;
+  if (data->size() > kInt32Max) {
+    return Status::Invalid(field, " must be less than 2 GiB, was: ", data->size());
+  }
+  const uint32_t new_size = *total_size + static_cast<uint32_t>(data->size());
+  if (new_size < *total_size) {
+    return Status::Invalid("Payload header must fit in a uint32_t");
+  }
+  *total_size = new_size;
+  return static_cast<uint32_t>(data->size());
+}
+uint8_t* PackField(uint32_t size, const std::shared_ptr<Buffer>& data, uint8_t* out) {
+  UInt32ToBytesBe(size, out);
+  if (size != kMissingFieldSentinel) {
+    std::memcpy(out + 4, data->data(), size);
+    return out + 4 + size;
+  } else {
+    return out + 4;
+  }
+}
+Status UnpackField(const std::shared_ptr<Buffer>& buffer, uint32_t* offset,
+                   std::shared_ptr<Buffer>* out) {
+  if (static_cast<int64_t>(*offset) + 4 > buffer->size()) {
+    return Status::Invalid("Buffer is too small: expected a field length at offset ",
+                           *offset, " but have ", buffer->size(), " bytes");
+  }
+  const uint32_t size = BytesToUInt32Be(buffer->data() + *offset);
+  *offset += 4;
+  if (size == kMissingFieldSentinel) {
+    *out = nullptr;
+    return Status::OK();
+  }
+  if (static_cast<int64_t>(*offset) + size > buffer->size()) {
+    return Status::Invalid("Buffer is too small: expected ",
+                           static_cast<int64_t>(*offset) + size, " bytes but have ",
+                           buffer->size());
+  }
+  *out = SliceBuffer(buffer, *offset, size);
+  *offset += size;
+  return Status::OK();
+}
+}  // namespace
+
+arrow::Result<PayloadHeaderFrame> PayloadHeaderFrame::Make(const FlightPayload& payload,
+                                                           MemoryPool* memory_pool) {
+  // Structure per field: [4 byte length][data]. If a field is not
+  // present, UINT32_MAX is used as the sentinel (since 0-sized fields
+  // are acceptable)
+  uint32_t header_size = 12;
+  ARROW_ASSIGN_OR_RAISE(
+      const uint32_t descriptor_size,
+      PayloadHeaderFieldSize("descriptor", payload.descriptor, &header_size));
+  ARROW_ASSIGN_OR_RAISE(
+      const uint32_t app_metadata_size,
+      PayloadHeaderFieldSize("app_metadata", payload.app_metadata, &header_size));
+  ARROW_ASSIGN_OR_RAISE(
+      const uint32_t ipc_metadata_size,
+      PayloadHeaderFieldSize("ipc_message.metadata", payload.ipc_message.metadata,
+                             &header_size));
+
+  ARROW_ASSIGN_OR_RAISE(auto header_buffer, AllocateBuffer(header_size, memory_pool));
+  uint8_t* payload_header = header_buffer->mutable_data();
+
+  payload_header = PackField(descriptor_size, payload.descriptor, payload_header);
+  payload_header = PackField(app_metadata_size, payload.app_metadata, payload_header);
+  payload_header =
+      PackField(ipc_metadata_size, payload.ipc_message.metadata, payload_header);
+
+  return PayloadHeaderFrame(std::move(header_buffer));
+}
+
+Status PayloadHeaderFrame::ToFlightData(internal::FlightData* data) {
+  std::shared_ptr<Buffer> buffer = std::move(buffer_);
+  uint32_t offset = 0;
+
+  std::shared_ptr<Buffer> descriptor;
+  RETURN_NOT_OK(UnpackField(buffer, &offset, &descriptor));
+  if (descriptor) {
+    data->descriptor.reset(new FlightDescriptor());
+    ARROW_ASSIGN_OR_RAISE(*data->descriptor,
+                          FlightDescriptor::Deserialize(std::string_view(*descriptor)));
+  } else {
+    data->descriptor = nullptr;
+  }
+  RETURN_NOT_OK(UnpackField(buffer, &offset, &data->app_metadata));
+  RETURN_NOT_OK(UnpackField(buffer, &offset, &data->metadata));
+  data->body = nullptr;
+  return Status::OK();
+}
+
+//------------------------------------------------------------
+// Call Driver
+
+ShmCallDriver::ShmCallDriver(arrow::internal::FileDescriptor fd,
+                             std::unique_ptr<SharedMemoryRing> send_ring,
+                             std::shared_ptr<SharedMemorySegment> recv_segment,
+                             std::string peer)
+    : fd_(std::move(fd)),
+      send_ring_(std::move(send_ring)),
+      recv_segment_(std::move(recv_segment)),
+      peer_(std::move(peer)),
+      read_memory_pool_(default_memory_pool()),
+      write_memory_pool_(default_memory_pool()),
+      memory_manager_(CPUDevice::Instance()->default_memory_manager()) {}
+
+ShmCallDriver::~ShmCallDriver() {
+  ARROW_WARN_NOT_OK(Close(), "Failed to close shared memory Flight connection");
+}
+
+arrow::Result<std::unique_ptr<ShmCallDriver>> ShmCallDriver::Connect(
+    arrow::internal::FileDescriptor fd, int64_t ring_size, std::string peer) {
+  std::shared_ptr<SharedMemorySegment> send_segment;
+  arrow::internal::FileDescriptor send_fd;
+  if (ring_size > 0) {
+    ARROW_ASSIGN_OR_RAISE(send_segment, SharedMemorySegment::Create(ring_size, &send_fd));
+  }
+  // Both sides send first: the handshake is small enough to never block
+  RETURN_NOT_OK(SendHandshake(fd.fd(), ring_size, send_fd.fd()));
+  RETURN_NOT_OK(send_fd.Close());
+
+  int64_t recv_ring_size = 0;
+  arrow::internal::FileDescriptor recv_fd;
+  RETURN_NOT_OK(RecvHandshake(fd.fd(), &recv_ring_size, &recv_fd));
+  std::shared_ptr<SharedMemorySegment> recv_segment;
+  if (recv_ring_size > 0) {
+    ARROW_ASSIGN_OR_RAISE(recv_segment,
+                          SharedMemorySegment::Map(recv_fd.fd(), recv_ring_size));
+  }
+  RETURN_NOT_OK(recv_fd.Close());
+
+  std::unique_ptr<SharedMemoryRing> send_ring;
+  if (send_segment) {
+    send_ring = std::make_unique<SharedMemoryRing>(std::move(send_segment));
+  }
+  return std::unique_ptr<ShmCallDriver>(new ShmCallDriver(
+      std::move(fd), std::move(send_ring), std::move(recv_segment), std::move(peer)));
+}
+
+Status ShmCallDriver::CheckClosed() const {
+  if (fd_.closed()) {
+    return Status::Invalid("ShmCallDriver is closed");
+  }
+  return Status::OK();
+}
+
+Status ShmCallDriver::WriteAll(std::vector<Slice> slices) {
+  std::vector<struct iovec> iovs;
+  iovs.reserve(slices.size());
+  for (const auto& slice : slices) {
+    if (slice.second == 0) continue;
+    struct iovec iov;
+    iov.iov_base = const_cast<uint8_t*>(slice.first);
+    iov.iov_len = static_cast<size_t>(slice.second);
+    iovs.push_back(iov);
+  }
+
+  size_t next = 0;
+  while (next < iovs.size()) {
+    struct msghdr msg;
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iovs.data() + next;
+    msg.msg_iovlen = std::min(kMaxIovecs, iovs.size() - next);
+    const ssize_t ret = ::sendmsg(fd_.fd(), &msg, kSendFlags);
+    if (ret == -1) {
+      if (errno == EINTR) continue;
+      return arrow::internal::IOErrorFromErrno(errno, "Failed to send to ", peer_);
+    }
+    // Skip over what was written, which may end in the middle of an iovec
+    auto written = static_cast<size_t>(ret);
+    while (next < iovs.size() && written >= iovs[next].iov_len) {
+      written -= iovs[next].iov_len;
+      ++next;
+    }
+    if (written > 0) {
+      iovs[next].iov_base = reinterpret_cast<uint8_t*>(iovs[next].iov_base) + written;
+      iovs[next].iov_len -= written;
+    }
+  }
+  return Status::OK();
+}
+
+Status ShmCallDriver::WriteFrameLocked(FrameType frame_type,
+                                       const std::vector<Slice>& body) {
+  int64_t size = 0;
+  for (const auto& slice : body) size += slice.second;
+
+  FrameHeader header;
+  RETURN_NOT_OK(header.Set(frame_type, send_counter_++, size));
+  std::vector<Slice> slices;
+  slices.reserve(body.size() + 1);
+  slices.emplace_back(header.data(), static_cast<int64_t>(header.size()));
+  slices.insert(slices.end(), body.begin(), body.end());
+  return WriteAll(std::move(slices));
+}
+
+Status ShmCallDriver::ReadExact(uint8_t* out, int64_t size, bool* eof) {
+  int64_t bytes_read = 0;
+  *eof = false;
+  while (bytes_read < size) {
+    const ssize_t ret =
+        ::recv(fd_.fd(), out + bytes_read, static_cast<size_t>(size - bytes_read), 0);
+    if (ret == -1) {
+      if (errno == EINTR) continue;
+      return arrow::internal::IOErrorFromErrno(errno, "Failed to receive from ", peer_);
+    } else if (ret == 0) {
+      if (bytes_read == 0) {
+        *eof = true;
+        return Status::OK();
+      }
+      return Status::IOError("Connection closed in the middle of a frame by ", peer_);
+    }
+    bytes_read += ret;
+  }
+  return Status::OK();
+}
+
+Status ShmCallDriver::StartCall(const std::string& method) {
+  std::vector<std::pair<std::string, std::string>> headers;
+  headers.emplace_back(kHeaderMethod, method);
+  ARROW_ASSIGN_OR_RAISE(auto frame, HeadersFrame::Make(headers));
+  auto buffer = std::move(frame).GetBuffer();
+  return SendFrame(FrameType::kHeaders, buffer->data(), buffer->size());
+}
+
+Status ShmCallDriver::SendFrame(FrameType frame_type, const uint8_t* data,
+                                const int64_t size) {
+  RETURN_NOT_OK(CheckClosed());
+  std::lock_guard<std::mutex> guard(send_mutex_);
+  return WriteFrameLocked(frame_type, {{data, size}});
+}
+
+Status ShmCallDriver::SendFlightPayload(const FlightPayload& payload) {
+  static const int64_t kMaxBatchSize = std::numeric_limits<int32_t>::max();
+  static const std::array<uint8_t, 8> kPaddingBytes = {0, 0, 0, 0, 0, 0, 0, 0};
+  RETURN_NOT_OK(CheckClosed());
+
+  if (payload.ipc_message.body_length > kMaxBatchSize) {
+    return Status::Invalid("Cannot send record batches exceeding 2GiB yet");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto header_frame,
+                        PayloadHeaderFrame::Make(payload, write_memory_pool_));
+
+  // Device buffers are brought to the CPU before sending
+  std::vector<std::shared_ptr<Buffer>> body_buffers;
+  std::vector<Slice> body;
+  if (ipc::Message::HasBody(payload.ipc_message.type)) {
+    const auto cpu_mm = CPUDevice::Instance()->default_memory_manager();
+    for (const auto& buffer : payload.ipc_message.body_buffers) {
+      if (!buffer || buffer->size() == 0) continue;
+      std::shared_ptr<Buffer> cpu_buffer = buffer;
+      if (!buffer->is_cpu()) {
+        ARROW_ASSIGN_OR_RAISE(cpu_buffer, Buffer::ViewOrCopy(buffer, cpu_mm));
+      }
+      body.emplace_back(cpu_buffer->data(), cpu_buffer->size());
+      // Arrow IPC requires that we align buffers to 8 byte boundary
+      const auto remainder =
+          bit_util::RoundUpToMultipleOf8(cpu_buffer->size()) - cpu_buffer->size();
+      if (remainder) body.emplace_back(kPaddingBytes.data(), remainder);
+      body_buffers.push_back(std::move(cpu_buffer));
+    }
+  }
+
+  std::lock_guard<std::mutex> guard(send_mutex_);
+  RETURN_NOT_OK(WriteFrameLocked(FrameType::kPayloadHeader,
+                                 {{header_frame.data(), header_frame.size()}}));
+  if (!ipc::Message::HasBody(payload.ipc_message.type)) {
+    return Status::OK();
+  }
+
+  int64_t body_length = 0;
+  for (const auto& slice : body) body_length += slice.second;
+  std::optional<int64_t> chunk_offset;
+  if (send_ring_) chunk_offset = send_ring_->Reserve(body_length);
+  if (!chunk_offset.has_value()) {
+    // No room in the ring (e.g. the receiver is holding on to earlier
+    // batches): send the body over the socket instead
+    bodies_sent_inline_.fetch_add(1);
+    return WriteFrameLocked(FrameType::kPayloadBody, body);
+  }
+
+  uint8_t* out = send_ring_->chunk_data(*chunk_offset);
+  for (const auto& slice : body) {
+    std::memcpy(out, slice.first, static_cast<size_t>(slice.second));
+    out += slice.second;
+  }
+  std::array<uint8_t, kBodyRefBytes> body_ref;
+  UInt32ToBytesBe(static_cast<uint32_t>(*chunk_offset), body_ref.data());
+  UInt32ToBytesBe(static_cast<uint32_t>(body_length), body_ref.data() + 4);
+  bodies_sent_by_reference_.fetch_add(1);
+  return WriteFrameLocked(FrameType::kPayloadBodyRef,
+                          {{body_ref.data(), static_cast<int64_t>(body_ref.size())}});
+}
+
+arrow::Result<std::shared_ptr<Frame>> ShmCallDriver::ReadNextFrame() {
+  RETURN_NOT_OK(CheckClosed());
+  std::lock_guard<std::mutex> guard(recv_mutex_);
+
+  std::array<uint8_t, FrameHeader::kFrameHeaderBytes> header;
+  bool eof = false;
+  RETURN_NOT_OK(ReadExact(header.data(), static_cast<int64_t>(header.size()), &eof));
+  if (eof) {
+    return Status::Cancelled("Connection closed by ", peer_);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto frame, Frame::ParseHeader(header.data(), header.size()));
+  if (frame->counter != recv_counter_++) {
+    return Status::IOError("Expected frame ", recv_counter_ - 1, " but got frame ",
+                           frame->counter);
+  }
+  if (frame->size > static_cast<uint32_t>(std::numeric_limits<int32_t>::max())) {
+    return Status::Invalid("Cannot allocate buffer greater than 2 GiB, requested: ",
+                           frame->size);
+  }
+
+  if (frame->type == FrameType::kPayloadBodyRef) {
+    std::array<uint8_t, kBodyRefBytes> body_ref;
+    if (frame->size != body_ref.size()) {
+      return Status::IOError("Expected body reference of ", body_ref.size(),
+                             " bytes, got ", frame->size);
+    }
+    RETURN_NOT_OK(ReadExact(body_ref.data(), kBodyRefBytes, &eof));
+    if (eof) return Status::IOError("Connection closed in the middle of a frame");
+    const int64_t chunk_offset = BytesToUInt32Be(body_ref.data());
+    const int64_t length = BytesToUInt32Be(body_ref.data() + 4);
+    if (!recv_segment_ || chunk_offset % SharedMemoryRing::kChunkHeaderBytes != 0 ||
+        chunk_offset + SharedMemoryRing::kChunkHeaderBytes + length >
+            recv_segment_->size()) {
+      return Status::IOError("Invalid body reference: offset ", chunk_offset,
+                             ", length ", length);
+    }
+    auto body = std::make_unique<ShmBodyBuffer>(recv_segment_, chunk_offset, length);
+    frame->type = FrameType::kPayloadBody;
+    frame->size = static_cast<uint32_t>(length);
+    if (memory_manager_->is_cpu()) {
+      frame->buffer = std::move(body);
+    } else {
+      // Releases the chunk once copied
+      ARROW_ASSIGN_OR_RAISE(frame->buffer,
+                            MemoryManager::CopyNonOwned(*body, memory_manager_));
+    }
+    return frame;
+  }
+
+  std::unique_ptr<Buffer> buffer;
+  ARROW_ASSIGN_OR_RAISE(buffer, AllocateBuffer(frame->size, read_memory_pool_));
+  RETURN_NOT_OK(ReadExact(buffer->mutable_data(), frame->size, &eof));
+  if (eof && frame->size > 0) {
+    return Status::IOError("Connection closed in the middle of a frame");
+  }
+  if (frame->type == FrameType::kPayloadBody && !memory_manager_->is_cpu()) {
+    ARROW_ASSIGN_OR_RAISE(buffer, MemoryManager::CopyNonOwned(*buffer, memory_manager_));
+  }
+  frame->buffer = std::move(buffer);
+  return frame;
+}
+
+Status ShmCallDriver::ExpectFrameType(const Frame& frame, FrameType type) {
+  if (frame.type != type) {
+    return Status::IOError("Expected frame type ", static_cast<int32_t>(type),
+                           ", but got frame type ", static_cast<int32_t>(frame.type));
+  }
+  return Status::OK();
+}
+
+Status ShmCallDriver::Close() { return fd_.Close(); }
+
+void ShmCallDriver::set_memory_manager(std::shared_ptr<MemoryManager> memory_manager) {
+  if (memory_manager) {
+    memory_manager_ = std::move(memory_manager);
+  } else {
+    memory_manager_ = CPUDevice::Instance()->default_memory_manager();
+  }
+}
+
+void ShmCallDriver::set_read_memory_pool(MemoryPool* pool) {
+  read_memory_pool_ = pool ? pool : default_memory_pool();
+}
+
+void ShmCallDriver::set_write_memory_pool(MemoryPool* pool) {
+  write_memory_pool_ = pool ? pool : default_memory_pool();
+}
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,433 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Common implementation of the shared memory transport primitives.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/server.h"
+#include "arrow/flight/transport.h"
+#include "arrow/flight/visibility.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/ubsan.h"
+#include "arrow/util/uri.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace shm {
+
+//------------------------------------------------------------
+// Protocol Constants
+
+static constexpr char kMethodDoAction[] = "DoAction";
+static constexpr char kMethodDoExchange[] = "DoExchange";
+static constexpr char kMethodDoGet[] = "DoGet";
+static constexpr char kMethodDoPut[] = "DoPut";
+static constexpr char kMethodGetFlightInfo[] = "GetFlightInfo";
+static constexpr char kMethodPollFlightInfo[] = "PollFlightInfo";
+
+/// The header encoding the transport status.
+static constexpr char kHeaderStatus[] = "flight-status";
+/// The header encoding the transport status.
+static constexpr char kHeaderMessage[] = "flight-message";
+/// The header encoding the C++ status.
+static constexpr char kHeaderStatusCode[] = "flight-status-code";
+/// The header encoding the C++ status message.
+static constexpr char kHeaderStatusMessage[] = "flight-status-message";
+/// The header encoding the C++ status detail message.
+static constexpr char kHeaderStatusDetail[] = "flight-status-detail";
+/// The header encoding the C++ status detail binary data.
+static constexpr char kHeaderStatusDetailBin[] = "flight-status-detail-bin";
+
+/// The URI query parameter setting the size of the shared memory ring.
+static constexpr char kRingSizeParameter[] = "ring_size";
+/// The default size of the shared memory ring of each connection.
+static constexpr int64_t kDefaultRingSize = 64 * 1024 * 1024;
+
+static inline void UInt32ToBytesBe(const uint32_t in, uint8_t* out) {
+  util::SafeStore(out, bit_util::ToBigEndian(in));
+}
+
+static inline uint32_t BytesToUInt32Be(const uint8_t* in) {
+  return bit_util::FromBigEndian(util::SafeLoadAs<uint32_t>(in));
+}
+
+/// \brief Get the path of the Unix domain socket named by a shm:// URI.
+ARROW_FLIGHT_EXPORT
+arrow::Result<std::string> SocketPathFromUri(const arrow::util::Uri& uri);
+
+/// \brief Get the ring size requested by a shm:// URI (0 disables the ring).
+ARROW_FLIGHT_EXPORT
+arrow::Result<int64_t> RingSizeFromUri(const arrow::util::Uri& uri);
+
+//------------------------------------------------------------
+// Shared Memory Helpers
+
+/// \brief A shared memory mapping.
+///
+/// Buffers received by reference point into the sender's segment, so
+/// they hold a reference to the segment to keep it mapped even after
+/// the connection is closed.
+class ARROW_FLIGHT_EXPORT SharedMemorySegment final {
+ public:
+  ~SharedMemorySegment();
+  ARROW_DISALLOW_COPY_AND_ASSIGN(SharedMemorySegment);
+
+  /// \brief Create and map a new anonymous shared memory object.
+  ///
+  /// \param[in] size The size of the segment.
+  /// \param[out] fd A file descriptor for the object, to be passed
+  ///   to the peer.
+  static arrow::Result<std::shared_ptr<SharedMemorySegment>> Create(
+      int64_t size, arrow::internal::FileDescriptor* fd);
+  /// \brief Map a shared memory object received from the peer.
+  static arrow::Result<std::shared_ptr<SharedMemorySegment>> Map(int fd, int64_t size);
+
+  uint8_t* data() const { return data_; }
+  int64_t size() const { return size_; }
+
+ private:
+  SharedMemorySegment(uint8_t* data, int64_t size) : data_(data), size_(size) {}
+
+  uint8_t* data_;
+  int64_t size_;
+};
+
+/// \brief The header of a chunk in a shared memory ring.
+///
+/// The sender marks a chunk in use when it writes a message body to
+/// it, and the receiver marks it free once the last reference to the
+/// body is gone.
+struct ChunkHeader {
+  static constexpr uint32_t kFree = 0;
+  static constexpr uint32_t kInUse = 1;
+
+  std::atomic<uint32_t> state;
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free,
+              "Chunk state must be lock-free to be shared between processes");
+
+/// \brief A ring allocator over a shared memory segment. Used when
+///   sending only.
+///
+/// Chunks are reserved at the head and reclaimed in order from the
+/// tail once the receiver has freed them. A chunk which is still
+/// referenced by the receiver holds back reclamation of all chunks
+/// after it; when the ring is full, the caller should fall back to
+/// sending data inline.
+class ARROW_FLIGHT_EXPORT SharedMemoryRing final {
+ public:
+  /// \brief Bytes reserved at the start of each chunk (also the chunk
+  ///   alignment).
+  static constexpr int64_t kChunkHeaderBytes = 64;
+
+  explicit SharedMemoryRing(std::shared_ptr<SharedMemorySegment> segment);
+
+  /// \brief Reserve a chunk able to hold `size` bytes.
+  ///
+  /// \return The offset of the chunk in the segment, or nullopt if the
+  ///   ring does not currently have enough space.
+  std::optional<int64_t> Reserve(int64_t size);
+
+  /// \brief The data area of the chunk at the given offset.
+  uint8_t* chunk_data(int64_t offset) const {
+    return segment_->data() + offset + kChunkHeaderBytes;
+  }
+
+  int64_t capacity() const { return capacity_; }
+  int64_t bytes_reserved() const { return used_; }
+
+ private:
+  struct Chunk {
+    int64_t offset;
+    int64_t size;
+    // Padding at the end of the ring is never handed out
+    bool padding;
+  };
+
+  ChunkHeader* header_at(int64_t offset) const {
+    return reinterpret_cast<ChunkHeader*>(segment_->data() + offset);
+  }
+  void Reclaim();
+  int64_t Commit(int64_t offset, int64_t size);
+
+  std::shared_ptr<SharedMemorySegment> segment_;
+  int64_t capacity_;
+  int64_t head_ = 0;
+  int64_t tail_ = 0;
+  int64_t used_ = 0;
+  // Chunk sizes are tracked locally rather than trusted from shared memory
+  std::deque<Chunk> chunks_;
+};
+
+//------------------------------------------------------------
+// Message Framing
+
+/// \brief The message type.
+enum class FrameType : uint8_t {
+  /// Key-value headers. Sent at the beginning (client->server) and
+  /// end (server->client) of a call. Also, for client-streaming calls
+  /// (e.g. DoPut), the client should send a headers frame to signal
+  /// end-of-stream.
+  kHeaders = 0,
+  /// Binary blob, does not contain Arrow data.
+  kBuffer,
+  /// Binary blob. Contains IPC metadata, app metadata.
+  kPayloadHeader,
+  /// Binary blob. Contains IPC body, sent inline over the socket.
+  kPayloadBody,
+  /// Reference to an IPC body in the sender's shared memory ring: the
+  /// chunk offset and the body length, both 4 bytes big-endian.
+  kPayloadBodyRef,
+  /// Ask server to disconnect (to avoid client/server waiting on each
+  /// other and getting stuck).
+  kDisconnect,
+  /// Keep at end.
+  kMaxFrameType = kDisconnect,
+};
+
+/// \brief The header of a message frame. Used when sending only.
+///
+/// The header is as follows:
+/// +-------+---------------------------------+
+/// | Bytes | Function                        |
+/// +=======+=================================+
+/// | 0     | Version tag (see kFrameVersion) |
+/// | 1     | Frame type (see FrameType)      |
+/// | 2-3   | Unused, reserved                |
+/// | 4-7   | Frame counter (big-endian)      |
+/// | 8-11  | Body size (big-endian)          |
+/// +-------+---------------------------------+
+///
+/// The body (of the given size) immediately follows the header on
+/// the socket.
+struct FrameHeader {
+  /// \brief The size of a frame header.
+  static constexpr size_t kFrameHeaderBytes = 12;
+  /// \brief The expected version tag in the header.
+  static constexpr uint8_t kFrameVersion = 0x01;
+
+  FrameHeader() = default;
+  /// \brief Initialize the frame header.
+  Status Set(FrameType frame_type, uint32_t counter, int64_t body_size);
+  const uint8_t* data() const { return header.data(); }
+  size_t size() const { return kFrameHeaderBytes; }
+
+  std::array<uint8_t, kFrameHeaderBytes> header = {0};
+};
+
+/// \brief A single message received over the socket. Used when
+///   receiving only.
+struct Frame {
+  /// \brief The message type.
+  FrameType type;
+  /// \brief The message length.
+  uint32_t size;
+  /// \brief An incrementing message counter (may wrap over).
+  uint32_t counter;
+  /// \brief The message contents.
+  std::unique_ptr<Buffer> buffer;
+
+  Frame() = default;
+  Frame(FrameType type_, uint32_t size_, uint32_t counter_,
+        std::unique_ptr<Buffer> buffer_)
+      : type(type_), size(size_), counter(counter_), buffer(std::move(buffer_)) {}
+
+  std::string_view view() const {
+    return std::string_view(reinterpret_cast<const char*>(buffer->data()), size);
+  }
+
+  /// \brief Parse a frame header. This will not initialize the
+  ///   buffer field.
+  static arrow::Result<std::shared_ptr<Frame>> ParseHeader(const void* header,
+                                                           size_t header_length);
+};
+
+/// \brief A collection of key-value headers.
+///
+/// This should be stored in a frame of type kHeaders. The format is
+/// the same as the UCX transport's.
+class ARROW_FLIGHT_EXPORT HeadersFrame {
+ public:
+  /// \brief Get a header value (or an error if it was not found)
+  arrow::Result<std::string_view> Get(const std::string& key);
+  /// \brief Extract the server-sent status.
+  Status GetStatus(Status* out);
+  /// \brief Parse the headers from the buffer.
+  static arrow::Result<HeadersFrame> Parse(std::unique_ptr<Buffer> buffer);
+  /// \brief Create a new frame with the given headers.
+  static arrow::Result<HeadersFrame> Make(
+      const std::vector<std::pair<std::string, std::string>>& headers);
+  /// \brief Create a new frame with the given headers and the given status.
+  static arrow::Result<HeadersFrame> Make(
+      const Status& status,
+      const std::vector<std::pair<std::string, std::string>>& headers);
+
+  /// \brief Take ownership of the underlying buffer.
+  std::unique_ptr<Buffer> GetBuffer() && { return std::move(buffer_); }
+
+ private:
+  std::unique_ptr<Buffer> buffer_;
+  std::vector<std::pair<std::string_view, std::string_view>> headers_;
+};
+
+/// \brief A representation of a kPayloadHeader frame (i.e. all of the
+///   metadata in a FlightPayload/FlightData).
+///
+/// The format is the same as the UCX transport's: the descriptor,
+/// app_metadata and IPC metadata, each prefixed with its length
+/// (big-endian, UINT32_MAX if the field is not present).
+class ARROW_FLIGHT_EXPORT PayloadHeaderFrame {
+ public:
+  explicit PayloadHeaderFrame(std::unique_ptr<Buffer> buffer)
+      : buffer_(std::move(buffer)) {}
+  /// \brief Unpack the internal buffer into a FlightData.
+  Status ToFlightData(internal::FlightData* data);
+  /// \brief Pack a payload into the internal buffer.
+  static arrow::Result<PayloadHeaderFrame> Make(const FlightPayload& payload,
+                                                MemoryPool* memory_pool);
+  const uint8_t* data() const { return buffer_->data(); }
+  int64_t size() const { return buffer_->size(); }
+
+ private:
+  std::unique_ptr<Buffer> buffer_;
+};
+
+/// \brief Manage the state of a connection.
+///
+/// Frames are exchanged over a connected Unix domain socket. IPC
+/// bodies are written once into the sender's shared memory ring and
+/// only a reference is sent over the socket; the receiver wraps the
+/// ring memory in a Buffer without copying.
+///
+/// Sending and receiving may happen concurrently from two threads,
+/// but each direction must only be used by one thread at a time.
+class ARROW_FLIGHT_EXPORT ShmCallDriver {
+ public:
+  ~ShmCallDriver();
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ShmCallDriver);
+
+  /// \brief Exchange shared memory rings with the peer over a
+  ///   connected socket. Takes ownership of the socket.
+  ///
+  /// \param[in] fd The connected socket.
+  /// \param[in] ring_size The size of the ring to create for sending
+  ///   (0 to always send data inline).
+  /// \param[in] peer A debug string naming the peer.
+  static arrow::Result<std::unique_ptr<ShmCallDriver>> Connect(
+      arrow::internal::FileDescriptor fd, int64_t ring_size, std::string peer);
+
+  /// \brief Start a call by sending a headers frame. Client side only.
+  ///
+  /// \param[in] method The RPC method.
+  Status StartCall(const std::string& method);
+
+  /// \brief Synchronously send a generic message with binary payload.
+  Status SendFrame(FrameType frame_type, const uint8_t* data, const int64_t size);
+  /// \brief Synchronously send a data message.
+  Status SendFlightPayload(const FlightPayload& payload);
+
+  /// \brief Synchronously read the next frame.
+  ///
+  /// Bodies sent by reference are returned as kPayloadBody frames.
+  arrow::Result<std::shared_ptr<Frame>> ReadNextFrame();
+
+  /// \brief Validate that the frame is of the given type.
+  Status ExpectFrameType(const Frame& frame, FrameType type);
+
+  /// \brief Close the socket.
+  Status Close();
+
+  /// \brief Get the associated memory manager.
+  const std::shared_ptr<MemoryManager>& memory_manager() const {
+    return memory_manager_;
+  }
+  /// \brief Set the associated memory manager.
+  void set_memory_manager(std::shared_ptr<MemoryManager> memory_manager);
+  /// \brief Set memory pool for scratch space used during reading.
+  void set_read_memory_pool(MemoryPool* memory_pool);
+  /// \brief Set memory pool for scratch space used during writing.
+  void set_write_memory_pool(MemoryPool* memory_pool);
+  /// \brief Get a debug string naming the peer.
+  const std::string& peer() const { return peer_; }
+
+  /// \brief The number of bodies sent by reference so far.
+  int64_t bodies_sent_by_reference() const { return bodies_sent_by_reference_.load(); }
+  /// \brief The number of bodies sent inline so far.
+  int64_t bodies_sent_inline() const { return bodies_sent_inline_.load(); }
+
+ private:
+  ShmCallDriver(arrow::internal::FileDescriptor fd,
+                std::unique_ptr<SharedMemoryRing> send_ring,
+                std::shared_ptr<SharedMemorySegment> recv_segment, std::string peer);
+
+  // A contiguous piece of a frame body
+  using Slice = std::pair<const uint8_t*, int64_t>;
+
+  Status WriteFrameLocked(FrameType frame_type, const std::vector<Slice>& body);
+  Status WriteAll(std::vector<Slice> slices);
+  Status ReadExact(uint8_t* out, int64_t size, bool* eof);
+  Status CheckClosed() const;
+
+  arrow::internal::FileDescriptor fd_;
+  std::unique_ptr<SharedMemoryRing> send_ring_;
+  std::shared_ptr<SharedMemorySegment> recv_segment_;
+  std::string peer_;
+
+  MemoryPool* read_memory_pool_;
+  MemoryPool* write_memory_pool_;
+  std::shared_ptr<MemoryManager> memory_manager_;
+
+  std::mutex send_mutex_;
+  uint32_t send_counter_ = 0;
+  std::mutex recv_mutex_;
+  uint32_t recv_counter_ = 0;
+
+  std::atomic<int64_t> bodies_sent_by_reference_{0};
+  std::atomic<int64_t> bodies_sent_inline_{0};
+};
+
+ARROW_FLIGHT_EXPORT
+std::unique_ptr<arrow::flight::internal::ClientTransport> MakeShmClientImpl();
+
+ARROW_FLIGHT_EXPORT
+std::unique_ptr<arrow::flight::internal::ServerTransport> MakeShmServerImpl(
+    FlightServerBase* base, std::shared_ptr<MemoryManager> memory_manager);
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,556 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/transport/shm/shm_internal.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/server.h"
+#include "arrow/flight/transport.h"
+#include "arrow/flight/transport_server.h"
+#include "arrow/flight/types.h"
+#include "arrow/ipc/message.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/uri.h"
+
+namespace arrow {
+
+using internal::ToChars;
+
+namespace flight {
+namespace transport {
+namespace shm {
+
+// Send an error to the client and return OK.
+// Statuses returned up to the main server loop close the connection instead.
+#define SERVER_RETURN_NOT_OK(driver, status)                                         \
+  do {                                                                               \
+    ::arrow::Status s = (status);                                                    \
+    if (!s.ok()) {                                                                   \
+      ARROW_ASSIGN_OR_RAISE(auto headers, HeadersFrame::Make(s, {}));                \
+      auto payload = std::move(headers).GetBuffer();                                 \
+      RETURN_NOT_OK(                                                                 \
+          driver->SendFrame(FrameType::kHeaders, payload->data(), payload->size())); \
+      return ::arrow::Status::OK();                                                  \
+    }                                                                                \
+  } while (false)
+
+#define FLIGHT_LOG(LEVEL) (ARROW_LOG(LEVEL) << "[server] ")
+#define FLIGHT_LOG_PEER(LEVEL, PEER) \
+  (ARROW_LOG(LEVEL) << "[server]"    \
+                    << "[peer=" << (PEER) << "] ")
+
+namespace {
+class ShmServerCallContext : public flight::ServerCallContext {
+ public:
+  explicit ShmServerCallContext(const ShmCallDriver* driver) : peer_(driver->peer()) {}
+
+  const std::string& peer_identity() const override { return peer_; }
+  const std::string& peer() const override { return peer_; }
+  // Not supported
+  void AddHeader(const std::string& key, const std::string& value) const override {}
+  void AddTrailer(const std::string& key, const std::string& value) const override {}
+  ServerMiddleware* GetMiddleware(const std::string& key) const override {
+    return nullptr;
+  }
+  bool is_cancelled() const override { return false; }
+  const CallHeaders& incoming_headers() const override { return incoming_headers_; }
+
+ private:
+  std::string peer_;
+  CallHeaders incoming_headers_;
+};
+
+class ShmServerStream : public internal::ServerDataStream {
+ public:
+  explicit ShmServerStream(ShmCallDriver* driver)
+      : peer_(driver->peer()), driver_(driver), writes_done_(false) {}
+
+  Status WritesDone() override {
+    writes_done_ = true;
+    return Status::OK();
+  }
+
+ protected:
+  std::string peer_;
+  ShmCallDriver* driver_;
+  bool writes_done_;
+};
+
+class GetServerStream : public ShmServerStream {
+ public:
+  using ShmServerStream::ShmServerStream;
+
+  arrow::Result<bool> WriteData(const FlightPayload& payload) override {
+    if (writes_done_) return false;
+    RETURN_NOT_OK(driver_->SendFlightPayload(payload));
+    return true;
+  }
+};
+
+class PutServerStream : public ShmServerStream {
+ public:
+  explicit PutServerStream(ShmCallDriver* driver)
+      : ShmServerStream(driver), finished_(false) {}
+
+  bool ReadData(internal::FlightData* data) override {
+    if (finished_) return false;
+
+    bool success = true;
+    auto status = ReadImpl(data).Value(&success);
+
+    if (!status.ok() || !success) {
+      finished_ = true;
+      if (!status.ok()) {
+        FLIGHT_LOG_PEER(WARNING, peer_) << "I/O error in DoPut: " << status.ToString();
+        return false;
+      }
+    }
+    return success;
+  }
+
+  Status WritePutMetadata(const Buffer& payload) override {
+    if (finished_) return Status::OK();
+    return driver_->SendFrame(FrameType::kBuffer, payload.data(), payload.size());
+  }
+
+ private:
+  ::arrow::Result<bool> ReadImpl(internal::FlightData* data) {
+    ARROW_ASSIGN_OR_RAISE(auto frame, driver_->ReadNextFrame());
+    if (frame->type == FrameType::kHeaders) {
+      // Trailers, client is done writing
+      return false;
+    }
+    RETURN_NOT_OK(driver_->ExpectFrameType(*frame, FrameType::kPayloadHeader));
+    PayloadHeaderFrame payload_header(std::move(frame->buffer));
+    RETURN_NOT_OK(payload_header.ToFlightData(data));
+
+    if (data->metadata) {
+      ARROW_ASSIGN_OR_RAISE(auto message, ipc::Message::Open(data->metadata, nullptr));
+
+      if (ipc::Message::HasBody(message->type())) {
+        ARROW_ASSIGN_OR_RAISE(frame, driver_->ReadNextFrame());
+        RETURN_NOT_OK(driver_->ExpectFrameType(*frame, FrameType::kPayloadBody));
+        data->body = std::move(frame->buffer);
+      }
+    }
+    return true;
+  }
+
+  bool finished_;
+};
+
+class ExchangeServerStream : public PutServerStream {
+ public:
+  using PutServerStream::PutServerStream;
+
+  arrow::Result<bool> WriteData(const FlightPayload& payload) override {
+    if (writes_done_) return false;
+    RETURN_NOT_OK(driver_->SendFlightPayload(payload));
+    return true;
+  }
+  Status WritePutMetadata(const Buffer& payload) override {
+    return Status::NotImplemented("Not supported on this stream");
+  }
+};
+
+class ShmServerImpl : public arrow::flight::internal::ServerTransport {
+ public:
+  using arrow::flight::internal::ServerTransport::ServerTransport;
+
+  virtual ~ShmServerImpl() {
+    if (listening_.load()) {
+      ARROW_WARN_NOT_OK(Shutdown(), "Server did not shut down properly");
+    }
+  }
+
+  Status Init(const FlightServerOptions& options, const arrow::util::Uri& uri) override {
+    ARROW_ASSIGN_OR_RAISE(socket_path_, SocketPathFromUri(uri));
+    ARROW_ASSIGN_OR_RAISE(ring_size_, RingSizeFromUri(uri));
+
+    struct sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (socket_path_.size() >= sizeof(addr.sun_path)) {
+      return Status::Invalid("Socket path is too long: ", socket_path_);
+    }
+    std::memcpy(addr.sun_path, socket_path_.data(), socket_path_.size());
+
+    // Remove a socket left behind by a server that did not shut down
+    // cleanly, but never anything else
+    struct stat st;
+    if (::lstat(socket_path_.c_str(), &st) == 0) {
+      if (!S_ISSOCK(st.st_mode)) {
+        return Status::AlreadyExists("Cannot listen on ", socket_path_,
+                                     ": file exists and is not a socket");
+      }
+      arrow::internal::FileDescriptor probe(::socket(AF_UNIX, SOCK_STREAM, 0));
+      if (!probe.closed() &&
+          ::connect(probe.fd(), reinterpret_cast<const struct sockaddr*>(&addr),
+                    sizeof(addr)) == 0) {
+        return Status::AlreadyExists("Cannot listen on ", socket_path_,
+                                     ": another server is listening");
+      }
+      ::unlink(socket_path_.c_str());
+    }
+
+    listen_fd_ = arrow::internal::FileDescriptor(::socket(AF_UNIX, SOCK_STREAM, 0));
+    if (listen_fd_.closed()) {
+      return arrow::internal::IOErrorFromErrno(errno, "Failed to create socket");
+    }
+    if (::bind(listen_fd_.fd(), reinterpret_cast<const struct sockaddr*>(&addr),
+               sizeof(addr)) != 0) {
+      return arrow::internal::IOErrorFromErrno(errno, "Failed to bind to ",
+                                               socket_path_);
+    }
+    if (::listen(listen_fd_.fd(), SOMAXCONN) != 0) {
+      return arrow::internal::IOErrorFromErrno(errno, "Failed to listen on ",
+                                               socket_path_);
+    }
+    FLIGHT_LOG(DEBUG) << "Listening on " << socket_path_;
+    ARROW_ASSIGN_OR_RAISE(location_, Location::Parse(uri.ToString()));
+
+    // Each connection occupies a thread for its whole lifetime
+    const auto max_threads = std::max<uint32_t>(8, std::thread::hardware_concurrency());
+    ARROW_ASSIGN_OR_RAISE(rpc_pool_, arrow::internal::ThreadPool::Make(max_threads));
+
+    {
+      listening_.store(true);
+      std::thread listener_thread(&ShmServerImpl::AcceptConnections, this);
+      listener_thread_.swap(listener_thread);
+    }
+
+    return Status::OK();
+  }
+
+  Status Shutdown() override {
+    if (!listening_.load()) return Status::OK();
+    Status status;
+
+    listening_.store(false);
+    // Unstick the listener thread from accept()
+    ::shutdown(listen_fd_.fd(), SHUT_RDWR);
+    status &= Wait();
+    status &= listen_fd_.Close();
+    ::unlink(socket_path_.c_str());
+
+    {
+      // Let current calls finish sending, but stop reading new calls
+      std::unique_lock<std::mutex> guard(connections_mutex_);
+      for (int fd : connections_) {
+        ::shutdown(fd, SHUT_RD);
+      }
+    }
+
+    status &= rpc_pool_->Shutdown();
+    rpc_pool_.reset();
+    return status;
+  }
+
+  Status Shutdown(const std::chrono::system_clock::time_point& deadline) override {
+    // Shutdown with a deadline is not implemented
+    return Shutdown();
+  }
+
+  Status Wait() override {
+    std::lock_guard<std::mutex> guard(join_mutex_);
+    try {
+      listener_thread_.join();
+    } catch (const std::system_error& e) {
+      if (e.code() != std::errc::invalid_argument) {
+        return Status::UnknownError("Could not Wait(): ", e.what());
+      }
+      // Else, server wasn't running anyways
+    }
+    return Status::OK();
+  }
+
+  Location location() const override { return location_; }
+
+ private:
+  Status SendStatus(ShmCallDriver* driver, const Status& status) {
+    ARROW_ASSIGN_OR_RAISE(auto headers, HeadersFrame::Make(status, {}));
+    auto payload = std::move(headers).GetBuffer();
+    RETURN_NOT_OK(
+        driver->SendFrame(FrameType::kHeaders, payload->data(), payload->size()));
+    return Status::OK();
+  }
+
+  Status SendString(ShmCallDriver* driver, const std::string& response) {
+    return driver->SendFrame(FrameType::kBuffer,
+                             reinterpret_cast<const uint8_t*>(response.data()),
+                             static_cast<int64_t>(response.size()));
+  }
+
+  Status HandleGetFlightInfo(ShmCallDriver* driver) {
+    ShmServerCallContext context(driver);
+
+    ARROW_ASSIGN_OR_RAISE(auto frame, driver->ReadNextFrame());
+    SERVER_RETURN_NOT_OK(driver, driver->ExpectFrameType(*frame, FrameType::kBuffer));
+    FlightDescriptor descriptor;
+    SERVER_RETURN_NOT_OK(driver,
+                         FlightDescriptor::Deserialize(frame->view()).Value(&descriptor));
+
+    std::unique_ptr<FlightInfo> info;
+    std::string response;
+    SERVER_RETURN_NOT_OK(driver, base_->GetFlightInfo(context, descriptor, &info));
+    SERVER_RETURN_NOT_OK(driver, info->SerializeToString().Value(&response));
+    RETURN_NOT_OK(SendString(driver, response));
+    RETURN_NOT_OK(SendStatus(driver, Status::OK()));
+    return Status::OK();
+  }
+
+  Status HandlePollFlightInfo(ShmCallDriver* driver) {
+    ShmServerCallContext context(driver);
+
+    ARROW_ASSIGN_OR_RAISE(auto frame, driver->ReadNextFrame());
+    SERVER_RETURN_NOT_OK(driver, driver->ExpectFrameType(*frame, FrameType::kBuffer));
+    FlightDescriptor descriptor;
+    SERVER_RETURN_NOT_OK(driver,
+                         FlightDescriptor::Deserialize(frame->view()).Value(&descriptor));
+
+    std::unique_ptr<PollInfo> info;
+    std::string response;
+    SERVER_RETURN_NOT_OK(driver, base_->PollFlightInfo(context, descriptor, &info));
+    SERVER_RETURN_NOT_OK(driver, info->SerializeToString().Value(&response));
+    RETURN_NOT_OK(SendString(driver, response));
+    RETURN_NOT_OK(SendStatus(driver, Status::OK()));
+    return Status::OK();
+  }
+
+  Status HandleDoAction(ShmCallDriver* driver) {
+    ShmServerCallContext context(driver);
+
+    ARROW_ASSIGN_OR_RAISE(auto frame, driver->ReadNextFrame());
+    SERVER_RETURN_NOT_OK(driver, driver->ExpectFrameType(*frame, FrameType::kBuffer));
+    Action action;
+    SERVER_RETURN_NOT_OK(driver, Action::Deserialize(frame->view()).Value(&action));
+
+    std::unique_ptr<ResultStream> results;
+    SERVER_RETURN_NOT_OK(driver, base_->DoAction(context, action, &results));
+    while (true) {
+      std::unique_ptr<Result> result;
+      SERVER_RETURN_NOT_OK(driver, results->Next().Value(&result));
+      if (!result) break;
+      std::string response;
+      SERVER_RETURN_NOT_OK(driver, result->SerializeToString().Value(&response));
+      RETURN_NOT_OK(SendString(driver, response));
+    }
+    RETURN_NOT_OK(SendStatus(driver, Status::OK()));
+    return Status::OK();
+  }
+
+  Status HandleDoGet(ShmCallDriver* driver) {
+    ShmServerCallContext context(driver);
+
+    ARROW_ASSIGN_OR_RAISE(auto frame, driver->ReadNextFrame());
+    SERVER_RETURN_NOT_OK(driver, driver->ExpectFrameType(*frame, FrameType::kBuffer));
+    Ticket ticket;
+    SERVER_RETURN_NOT_OK(driver, Ticket::Deserialize(frame->view()).Value(&ticket));
+
+    GetServerStream stream(driver);
+    auto status = DoGet(context, std::move(ticket), &stream);
+    RETURN_NOT_OK(SendStatus(driver, status));
+    return Status::OK();
+  }
+
+  Status HandleDoPut(ShmCallDriver* driver) {
+    ShmServerCallContext context(driver);
+
+    PutServerStream stream(driver);
+    auto status = DoPut(context, &stream);
+    RETURN_NOT_OK(SendStatus(driver, status));
+    // Must drain any unread messages, or the next call will get confused
+    internal::FlightData ignored;
+    while (stream.ReadData(&ignored)) {
+    }
+    return Status::OK();
+  }
+
+  Status HandleDoExchange(ShmCallDriver* driver) {
+    ShmServerCallContext context(driver);
+
+    ExchangeServerStream stream(driver);
+    auto status = DoExchange(context, &stream);
+    RETURN_NOT_OK(SendStatus(driver, status));
+    // Must drain any unread messages, or the next call will get confused
+    internal::FlightData ignored;
+    while (stream.ReadData(&ignored)) {
+    }
+    return Status::OK();
+  }
+
+  Status HandleOneCall(ShmCallDriver* driver, Frame* frame) {
+    SERVER_RETURN_NOT_OK(driver, driver->ExpectFrameType(*frame, FrameType::kHeaders));
+    ARROW_ASSIGN_OR_RAISE(auto headers, HeadersFrame::Parse(std::move(frame->buffer)));
+    ARROW_ASSIGN_OR_RAISE(auto method, headers.Get(":method:"));
+    if (method == kMethodGetFlightInfo) {
+      return HandleGetFlightInfo(driver);
+    } else if (method == kMethodPollFlightInfo) {
+      return HandlePollFlightInfo(driver);
+    } else if (method == kMethodDoAction) {
+      return HandleDoAction(driver);
+    } else if (method == kMethodDoExchange) {
+      return HandleDoExchange(driver);
+    } else if (method == kMethodDoGet) {
+      return HandleDoGet(driver);
+    } else if (method == kMethodDoPut) {
+      return HandleDoPut(driver);
+    }
+    RETURN_NOT_OK(SendStatus(driver, Status::NotImplemented(method)));
+    return Status::OK();
+  }
+
+  std::string PeerName(int fd) {
+    std::string peer = "unix:" + socket_path_ + ";conn=" + ToChars(counter_++);
+#ifdef SO_PEERCRED
+    struct ucred credentials;
+    socklen_t length = sizeof(credentials);
+    if (::getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &length) == 0) {
+      peer += ";pid=" + ToChars(credentials.pid);
+    }
+#endif
+    return peer;
+  }
+
+  void WorkerLoop(arrow::internal::FileDescriptor fd) {
+    const int raw_fd = fd.fd();
+    std::string peer = PeerName(raw_fd);
+    FLIGHT_LOG_PEER(DEBUG, peer) << "Received connection request";
+    {
+      // Registered before the handshake, so that Shutdown() can
+      // unblock it too
+      std::unique_lock<std::mutex> guard(connections_mutex_);
+      connections_.insert(raw_fd);
+    }
+    auto unregister = [&]() {
+      std::unique_lock<std::mutex> guard(connections_mutex_);
+      connections_.erase(raw_fd);
+    };
+    if (!listening_.load()) {
+      unregister();
+      return;
+    }
+
+    auto maybe_driver = ShmCallDriver::Connect(std::move(fd), ring_size_, peer);
+    if (!maybe_driver.ok()) {
+      FLIGHT_LOG_PEER(WARNING, peer)
+          << "Failed to set up connection: " << maybe_driver.status().ToString();
+      unregister();
+      return;
+    }
+    std::unique_ptr<ShmCallDriver> driver = maybe_driver.MoveValueUnsafe();
+    driver->set_memory_manager(memory_manager_);
+
+    while (listening_.load()) {
+      auto maybe_frame = driver->ReadNextFrame();
+      if (!maybe_frame.ok()) {
+        if (!maybe_frame.status().IsCancelled()) {
+          FLIGHT_LOG_PEER(WARNING, peer)
+              << "Failed to read next message: " << maybe_frame.status().ToString();
+        }
+        break;
+      }
+
+      auto status = HandleOneCall(driver.get(), maybe_frame->get());
+      if (!status.ok()) {
+        FLIGHT_LOG_PEER(WARNING, peer) << "Call failed: " << status.ToString();
+        break;
+      }
+    }
+
+    // Clean up
+    unregister();
+    auto status = driver->Close();
+    if (!status.ok()) {
+      FLIGHT_LOG_PEER(WARNING, peer) << "Failed to close connection: "
+                                     << status.ToString();
+    }
+    FLIGHT_LOG_PEER(DEBUG, peer) << "Disconnected";
+  }
+
+  void AcceptConnections() {
+    while (listening_.load()) {
+      const int fd = ::accept(listen_fd_.fd(), nullptr, nullptr);
+      if (fd == -1) {
+        if (!listening_.load()) break;
+        if (errno == EINTR || errno == ECONNABORTED) continue;
+        FLIGHT_LOG(WARNING) << arrow::internal::IOErrorFromErrno(errno, "accept() failed")
+                                   .ToString();
+        if (errno == EBADF || errno == EINVAL) break;
+        continue;
+      }
+      // std::function must be copyable, so pass the raw descriptor
+      auto submitted = rpc_pool_->Submit([this, fd]() {
+        WorkerLoop(arrow::internal::FileDescriptor(fd));
+      });
+      if (!submitted.ok()) {
+        ARROW_WARN_NOT_OK(submitted.status(), "Failed to submit task to handle client");
+        ARROW_WARN_NOT_OK(arrow::internal::FileClose(fd), "Failed to close socket");
+      }
+    }
+  }
+
+  std::string socket_path_;
+  int64_t ring_size_ = kDefaultRingSize;
+  arrow::internal::FileDescriptor listen_fd_;
+  Location location_;
+
+  // Counter for identifying peers
+  std::atomic<size_t> counter_{0};
+
+  std::shared_ptr<arrow::internal::ThreadPool> rpc_pool_;
+  std::atomic<bool> listening_{false};
+  std::thread listener_thread_;
+  // std::thread::join cannot be called concurrently
+  std::mutex join_mutex_;
+
+  std::mutex connections_mutex_;
+  // Sockets of the connections being served
+  std::unordered_set<int> connections_;
+};
+}  // namespace
+
+std::unique_ptr<arrow::flight::internal::ServerTransport> MakeShmServerImpl(
+    FlightServerBase* base, std::shared_ptr<MemoryManager> memory_manager) {
+  return std::make_unique<ShmServerImpl>(base, memory_manager);
+}
+
+#undef SERVER_RETURN_NOT_OK
+#undef FLIGHT_LOG
+#undef FLIGHT_LOG_PEER
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
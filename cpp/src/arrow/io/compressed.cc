@@ -18,18 +18,25 @@
 #include "arrow/io/compressed.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <deque>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -492,5 +499,620 @@ Future<std::shared_ptr<const KeyValueMetadata>> CompressedInputStream::ReadMetad
   return impl_->raw()->ReadMetadataAsync(io_context);
 }
 
+// ----------------------------------------------------------------------
+// ParallelCompressedInputStream implementation
+
+namespace {
+
+// Read 1 MB compressed data at a time
+constexpr int64_t kParallelReadSize = 1024 * 1024;
+// Decompress 1 MB at a time
+constexpr int64_t kParallelDecompressSize = 1024 * 1024;
+// Number of bytes looked at by IsMemberStart()
+constexpr int64_t kMemberHeaderSize = 5;
+
+// Return whether a member (gzip member, zstd or LZ4 frame) may start at `data`
+bool IsMemberStart(Compression::type compression, const uint8_t* data) {
+  // zstd and LZ4 skippable frames (e.g. the seek table of seekable zstd files)
+  const bool is_skippable_frame =
+      (data[0] & 0xf0) == 0x50 && data[1] == 0x2a && data[2] == 0x4d && data[3] == 0x18;
+  switch (compression) {
+    case Compression::GZIP:
+      // Magic number and deflate method, then flags without the reserved bits
+      return data[0] == 0x1f && data[1] == 0x8b && data[2] == 0x08 &&
+             (data[3] & 0xe0) == 0;
+    case Compression::ZSTD:
+      // Magic number, then frame header descriptor without the reserved bit
+      return (data[0] == 0x28 && data[1] == 0xb5 && data[2] == 0x2f &&
+              data[3] == 0xfd && (data[4] & 0x08) == 0) ||
+             is_skippable_frame;
+    case Compression::LZ4_FRAME:
+      // Magic number, then FLG byte with version 01 and no reserved bit
+      return (data[0] == 0x04 && data[1] == 0x22 && data[2] == 0x4d &&
+              data[3] == 0x18 && (data[4] & 0xc2) == 0x40) ||
+             is_skippable_frame;
+    default:
+      return false;
+  }
+}
+
+// Return the position of the first possible member start in [start, end),
+// or `end` if there is none
+int64_t FindMemberStart(Compression::type compression, const uint8_t* data,
+                        int64_t size, int64_t start, int64_t end) {
+  for (int64_t pos = start; pos < end && pos <= size - kMemberHeaderSize; ++pos) {
+    if (IsMemberStart(compression, data + pos)) {
+      return pos;
+    }
+  }
+  return end;
+}
+
+struct ParallelDecompressionState {
+  Compression::type compression;
+  std::unique_ptr<Codec> codec;
+  std::shared_ptr<RandomAccessFile> file;
+  int64_t file_size;
+  int64_t block_size;
+  int64_t max_buffered_bytes;
+  IOContext io_context;
+  MemoryPool* pool;
+  std::atomic<bool> closed{false};
+  // Bytes held by the range decompression tasks, see RangeDecompressionTask::Reserve
+  std::atomic<int64_t> buffered_bytes{0};
+};
+
+// Decompresses whole members of a file, one at a time
+class MemberDecoder {
+ public:
+  explicit MemberDecoder(const ParallelDecompressionState* state) : state_(state) {}
+
+  Status Init() {
+    ARROW_ASSIGN_OR_RAISE(decompressor_, state_->codec->MakeDecompressor());
+    return Status::OK();
+  }
+
+  // Make already read data at the given file offset available to the decompressor
+  void SetInput(std::shared_ptr<Buffer> input, int64_t input_offset) {
+    input_ = std::move(input);
+    input_offset_ = input_offset;
+  }
+
+  // Start decompressing the member at the given file offset
+  Status Start(int64_t offset) {
+    RETURN_NOT_OK(decompressor_->Reset());
+    offset_ = offset;
+    finished_ = false;
+    return Status::OK();
+  }
+
+  // Whether the end of the current member was reached
+  bool finished() const { return finished_; }
+
+  // The file offset of the first compressed byte not consumed yet
+  int64_t offset() const { return offset_; }
+
+  // Decompress the next bytes of the current member into `out`, returning the
+  // number of bytes written
+  Result<int64_t> Decompress(int64_t out_len, uint8_t* out) {
+    int64_t bytes_written = 0;
+    while (!finished_ && bytes_written < out_len) {
+      if (input_ == nullptr || offset_ < input_offset_ ||
+          offset_ >= input_offset_ + input_->size()) {
+        RETURN_NOT_OK(ReadInput());
+      }
+      const int64_t input_pos = offset_ - input_offset_;
+      const int64_t input_len = input_->size() - input_pos;
+      ARROW_ASSIGN_OR_RAISE(
+          auto result,
+          decompressor_->Decompress(input_len, input_->data() + input_pos,
+                                    out_len - bytes_written, out + bytes_written));
+      offset_ += result.bytes_read;
+      bytes_written += result.bytes_written;
+      finished_ = decompressor_->IsFinished();
+      if (result.bytes_read == 0 && result.bytes_written == 0 && !finished_) {
+        if (bytes_written > 0) {
+          break;
+        }
+        return Status::IOError("Compressed stream made no progress");
+      }
+    }
+    return bytes_written;
+  }
+
+ private:
+  Status ReadInput() {
+    if (offset_ < state_->file_size) {
+      ARROW_ASSIGN_OR_RAISE(input_, state_->file->ReadAt(offset_, kParallelReadSize));
+      input_offset_ = offset_;
+    }
+    if (offset_ >= state_->file_size || input_->size() == 0) {
+      return Status::IOError("Truncated compressed stream");
+    }
+    return Status::OK();
+  }
+
+  const ParallelDecompressionState* state_;
+  std::shared_ptr<Decompressor> decompressor_;
+  std::shared_ptr<Buffer> input_;
+  int64_t input_offset_ = 0;
+  int64_t offset_ = 0;
+  bool finished_ = false;
+};
+
+// The members starting in a range of the file, decompressed
+struct DecompressedRange {
+  // File offset of the first member
+  int64_t start;
+  // File offset of the end of the last member
+  int64_t end;
+  std::shared_ptr<Buffer> data;
+};
+
+// Decompresses the members starting in a range of the file.  The range is read
+// asynchronously, then decompressed either on the CPU thread pool or on demand in
+// the reader thread, whichever comes first.
+class RangeDecompressionTask {
+ public:
+  RangeDecompressionTask(std::shared_ptr<ParallelDecompressionState> state,
+                         int64_t range_index)
+      : state_(std::move(state)),
+        range_start_(range_index * state_->block_size),
+        range_end_(std::min(range_start_ + state_->block_size, state_->file_size)),
+        future_(Future<DecompressedRange>::Make()) {}
+
+  ~RangeDecompressionTask() { Release(reserved_); }
+
+  // The number of bytes read by the task, which are accounted for from its launch
+  int64_t input_size() const { return range_end_ - range_start_ + kMemberHeaderSize - 1; }
+
+  // Start reading the range, then decompress it on the CPU thread pool.  The
+  // caller is responsible for checking the memory limit beforehand.
+  static void Launch(std::shared_ptr<RangeDecompressionTask> task) {
+    const auto& state = *task->state_;
+    task->Account(task->input_size());
+    // Read a few more bytes to check the headers of members starting at the end
+    task->read_ = state.file->ReadAsync(state.io_context, task->range_start_,
+                                        task->input_size());
+    ::arrow::internal::GetCpuThreadPool()
+        ->TransferAlways(task->read_)
+        .AddCallback([task](const Result<std::shared_ptr<Buffer>>& data) {
+          task->Run(data);
+        });
+  }
+
+  // Cancel the decompression if it didn't start yet.  Use finished() to wait for
+  // the task to stop accessing the file.
+  void Cancel() {
+    if (!started_.exchange(true)) {
+      future_.MarkFinished(Status::Cancelled("Range decompression cancelled"));
+      // Only the read may still access the file
+      read_.AddCallback([finished = finished_](const Result<std::shared_ptr<Buffer>>&)
+                            mutable { finished.MarkFinished(); });
+    }
+  }
+
+  // Completes once the task doesn't access the file anymore
+  const Future<>& finished() const { return finished_; }
+
+  // Whether the task found that no member starts in the range
+  bool no_member_start() const { return no_member_start_.load(); }
+
+  // Return the decompressed range, decompressing it now if it wasn't started yet.
+  // A failure means the range must be decompressed serially instead.
+  const Result<DecompressedRange>& Wait() {
+    Run(read_.result());
+    return future_.result();
+  }
+
+ private:
+  void Run(const Result<std::shared_ptr<Buffer>>& data) {
+    if (!started_.exchange(true)) {
+      Result<DecompressedRange> result =
+          data.ok() ? Decompress(*data) : Result<DecompressedRange>(data.status());
+      finished_.MarkFinished();
+      // The input is held by read_ until the task is destroyed, but the
+      // decompressed data of a failed range isn't
+      if (!result.ok()) {
+        Release(reserved_ - input_size());
+      }
+      future_.MarkFinished(std::move(result));
+    }
+  }
+
+  // Account for `nbytes` more bytes held by this task, failing if that makes the
+  // tasks exceed their memory limit.  The bytes are accounted for until released
+  // or until the task is destroyed, i.e. until the reader takes over the range.
+  Status Reserve(int64_t nbytes) {
+    Account(nbytes);
+    if (state_->buffered_bytes.load() > state_->max_buffered_bytes) {
+      return Status::Cancelled("Range decompression exceeds the memory limit");
+    }
+    return Status::OK();
+  }
+
+  void Release(int64_t nbytes) { Account(-nbytes); }
+
+  void Account(int64_t nbytes) {
+    reserved_ += nbytes;
+    state_->buffered_bytes += nbytes;
+  }
+
+  Result<DecompressedRange> Decompress(const std::shared_ptr<Buffer>& data) {
+    const auto& state = *state_;
+    const int64_t range_start = range_start_;
+    const int64_t range_end = range_end_;
+    // Members extending far beyond the range are better decompressed serially
+    const int64_t decompress_limit = range_end + state.block_size;
+
+    MemberDecoder decoder(&state);
+    RETURN_NOT_OK(decoder.Init());
+
+    int64_t candidate = FindMemberStart(state.compression, data->data(), data->size(),
+                                        0, range_end - range_start);
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> decompressed,
+                          AllocateResizableBuffer(0, state.pool));
+    while (candidate < range_end - range_start) {
+      const int64_t start = range_start + candidate;
+      int64_t offset = start;
+      int64_t decompressed_size = 0;
+      decoder.SetInput(data, range_start);
+      auto status = [&]() -> Status {
+        while (offset < range_end) {
+          RETURN_NOT_OK(decoder.Start(offset));
+          while (!decoder.finished()) {
+            if (decoder.offset() > decompress_limit || state.closed.load()) {
+              return Status::Cancelled("Range decompression cancelled");
+            }
+            if (decompressed->size() - decompressed_size < kParallelDecompressSize) {
+              const int64_t new_size =
+                  std::max(decompressed->size() * 2, kParallelDecompressSize);
+              RETURN_NOT_OK(Reserve(new_size - decompressed->size()));
+              RETURN_NOT_OK(decompressed->Resize(new_size, /*shrink_to_fit=*/false));
+            }
+            ARROW_ASSIGN_OR_RAISE(
+                int64_t bytes_written,
+                decoder.Decompress(decompressed->size() - decompressed_size,
+                                   decompressed->mutable_data() + decompressed_size));
+            decompressed_size += bytes_written;
+          }
+          offset = decoder.offset();
+        }
+        return Status::OK();
+      }();
+      if (status.ok()) {
+        Release(decompressed->size() - decompressed_size);
+        RETURN_NOT_OK(decompressed->Resize(decompressed_size));
+        return DecompressedRange{start, offset, std::move(decompressed)};
+      }
+      if (offset != start || status.IsCancelled()) {
+        // The first member was valid, so this isn't a false positive
+        return status;
+      }
+      candidate = FindMemberStart(state.compression, data->data(), data->size(),
+                                  candidate + 1, range_end - range_start);
+    }
+    no_member_start_.store(true);
+    return Status::Invalid("No compressed member starts in range");
+  }
+
+  std::shared_ptr<ParallelDecompressionState> state_;
+  const int64_t range_start_;
+  const int64_t range_end_;
+  // Only modified at launch and by the decompression, which don't run concurrently
+  int64_t reserved_ = 0;
+  std::atomic<bool> started_{false};
+  std::atomic<bool> no_member_start_{false};
+  Future<std::shared_ptr<Buffer>> read_;
+  Future<DecompressedRange> future_;
+  Future<> finished_ = Future<>::Make();
+};
+
+}  // namespace
+
+class ParallelCompressedInputStream::Impl {
+ public:
+  explicit Impl(std::shared_ptr<ParallelDecompressionState> state)
+      : state_(std::move(state)), serial_decoder_(state_.get()) {}
+
+  Status Init() {
+    RETURN_NOT_OK(serial_decoder_.Init());
+    readahead_ = ::arrow::internal::GetCpuThreadPool()->GetCapacity();
+    return Status::OK();
+  }
+
+  Status Close() {
+    if (is_open_) {
+      Stop();
+      return state_->file->Close();
+    } else {
+      return Status::OK();
+    }
+  }
+
+  Status Abort() {
+    if (is_open_) {
+      Stop();
+      return state_->file->Abort();
+    } else {
+      return Status::OK();
+    }
+  }
+
+  bool closed() const { return !is_open_; }
+
+  Result<int64_t> Tell() const { return total_pos_; }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) {
+    auto* out_data = reinterpret_cast<uint8_t*>(out);
+
+    int64_t total_read = 0;
+    while (total_read < nbytes) {
+      if (decompressed_.empty()) {
+        ARROW_ASSIGN_OR_RAISE(bool has_data, Refill());
+        if (!has_data) {
+          break;
+        }
+      }
+      const auto& buffer = decompressed_.front();
+      const int64_t read_bytes =
+          std::min(buffer->size() - decompressed_pos_, nbytes - total_read);
+      memcpy(out_data + total_read, buffer->data() + decompressed_pos_, read_bytes);
+      total_read += read_bytes;
+      Consume(read_bytes);
+    }
+
+    total_pos_ += total_read;
+    return total_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) {
+    if (decompressed_.empty()) {
+      ARROW_ASSIGN_OR_RAISE(bool has_data, Refill());
+      if (!has_data) {
+        return std::make_shared<Buffer>(nullptr, 0);
+      }
+    }
+    if (decompressed_.front()->size() - decompressed_pos_ >= nbytes) {
+      // Avoid a copy if the data is contiguous
+      auto buf = SliceBuffer(decompressed_.front(), decompressed_pos_, nbytes);
+      Consume(nbytes);
+      total_pos_ += nbytes;
+      return buf;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buf, AllocateResizableBuffer(nbytes, state_->pool));
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, buf->mutable_data()));
+    RETURN_NOT_OK(buf->Resize(bytes_read));
+    return std::move(buf);
+  }
+
+  const std::shared_ptr<RandomAccessFile>& raw() const { return state_->file; }
+
+ private:
+  void Consume(int64_t nbytes) {
+    decompressed_pos_ += nbytes;
+    if (decompressed_pos_ == decompressed_.front()->size()) {
+      decompressed_.pop_front();
+      decompressed_pos_ = 0;
+    }
+  }
+
+  // Stop the tasks and wait for them to stop accessing the file, so that it can
+  // be closed
+  void Stop() {
+    is_open_ = false;
+    state_->closed.store(true);
+    StopSpeculating();
+    AllComplete(launched_).Wait();
+    launched_.clear();
+  }
+
+  void StopSpeculating() {
+    speculating_ = false;
+    for (const auto& task : tasks_) {
+      task.second->Cancel();
+    }
+    tasks_.clear();
+  }
+
+  // Start decompressing the ranges after the given one, within the memory limit,
+  // and forget about the ranges before it
+  void LaunchTasks(int64_t range_index) {
+    for (const auto& task : tasks_) {
+      if (task.second->no_member_start()) {
+        StopSpeculating();
+        return;
+      }
+    }
+    while (!tasks_.empty() && tasks_.begin()->first < range_index) {
+      tasks_.begin()->second->Cancel();
+      tasks_.erase(tasks_.begin());
+    }
+    launched_.erase(std::remove_if(launched_.begin(), launched_.end(),
+                                   [](const Future<>& f) { return f.is_finished(); }),
+                    launched_.end());
+    const int64_t num_ranges = bit_util::CeilDiv(state_->file_size, state_->block_size);
+    const int64_t launch_end = std::min(range_index + 1 + readahead_, num_ranges);
+    for (int64_t i = std::max(next_range_index_, range_index + 1); i < launch_end; ++i) {
+      auto task = std::make_shared<RangeDecompressionTask>(state_, i);
+      if (state_->buffered_bytes.load() + task->input_size() >
+          state_->max_buffered_bytes) {
+        break;
+      }
+      tasks_.emplace(i, task);
+      launched_.push_back(task->finished());
+      RangeDecompressionTask::Launch(std::move(task));
+      next_range_index_ = i + 1;
+    }
+  }
+
+  // Make more decompressed data available.  Returns whether there is more data.
+  Result<bool> Refill() {
+    while (decompressed_.empty()) {
+      if (in_member_) {
+        if (!serial_decoder_.finished()) {
+          // Reuse the previous buffer if it isn't referenced anymore
+          if (serial_buffer_ == nullptr || serial_buffer_.use_count() > 1) {
+            ARROW_ASSIGN_OR_RAISE(
+                serial_buffer_,
+                AllocateResizableBuffer(kParallelDecompressSize, state_->pool));
+          } else {
+            RETURN_NOT_OK(serial_buffer_->Resize(kParallelDecompressSize,
+                                                 /*shrink_to_fit=*/false));
+          }
+          ARROW_ASSIGN_OR_RAISE(
+              int64_t bytes_written,
+              serial_decoder_.Decompress(serial_buffer_->size(),
+                                         serial_buffer_->mutable_data()));
+          if (bytes_written > 0) {
+            RETURN_NOT_OK(serial_buffer_->Resize(bytes_written, /*shrink_to_fit=*/false));
+            decompressed_.push_back(serial_buffer_);
+          }
+          continue;
+        }
+        in_member_ = false;
+        // The ranges entirely within a member have no member start: members are
+        // too large to be worth decompressing in parallel
+        if (member_offset_ > 0 && serial_decoder_.offset() / state_->block_size >
+                                      member_offset_ / state_->block_size + 1) {
+          StopSpeculating();
+        }
+        member_offset_ = serial_decoder_.offset();
+      }
+      if (member_offset_ >= state_->file_size) {
+        return false;
+      }
+      // At a member boundary: use the range decompressed in parallel if it starts
+      // here, otherwise decompress the next member serially.  Speculation only
+      // starts after the first member, so as to not waste work on single-member
+      // files.
+      const int64_t range_index = member_offset_ / state_->block_size;
+      if (member_offset_ > 0 && speculating_) {
+        LaunchTasks(range_index);
+      }
+      auto it = tasks_.find(range_index);
+      if (it != tasks_.end()) {
+        auto task = std::move(it->second);
+        tasks_.erase(it);
+        const auto& maybe_range = task->Wait();
+        if (maybe_range.ok() && maybe_range->start == member_offset_) {
+          if (maybe_range->data->size() > 0) {
+            decompressed_.push_back(maybe_range->data);
+          }
+          member_offset_ = maybe_range->end;
+          continue;
+        }
+        if (task->no_member_start()) {
+          StopSpeculating();
+        }
+      }
+      RETURN_NOT_OK(serial_decoder_.Start(member_offset_));
+      in_member_ = true;
+    }
+    return true;
+  }
+
+  std::shared_ptr<ParallelDecompressionState> state_;
+  bool is_open_ = true;
+  // Whether ranges are still decompressed in parallel
+  bool speculating_ = true;
+  int64_t readahead_ = 0;
+  // The ranges being decompressed in parallel, by index
+  std::map<int64_t, std::shared_ptr<RangeDecompressionTask>> tasks_;
+  // The tasks which may still access the file, including those dropped from tasks_
+  std::vector<Future<>> launched_;
+  int64_t next_range_index_ = 0;
+  // Decompresses the members which aren't decompressed in parallel
+  MemberDecoder serial_decoder_;
+  std::shared_ptr<ResizableBuffer> serial_buffer_;
+  bool in_member_ = false;
+  // File offset of the next member, if not in a member
+  int64_t member_offset_ = 0;
+  std::deque<std::shared_ptr<Buffer>> decompressed_;
+  // Position in decompressed_.front()
+  int64_t decompressed_pos_ = 0;
+  // Total number of bytes decompressed
+  int64_t total_pos_ = 0;
+};
+
+bool ParallelCompressedInputStream::IsSupported(Compression::type compression) {
+  switch (compression) {
+    case Compression::GZIP:
+    case Compression::ZSTD:
+    case Compression::LZ4_FRAME:
+      return Codec::IsAvailable(compression);
+    default:
+      return false;
+  }
+}
+
+ParallelDecompressionOptions ParallelDecompressionOptions::Defaults() {
+  return ParallelDecompressionOptions();
+}
+
+Result<std::shared_ptr<ParallelCompressedInputStream>>
+ParallelCompressedInputStream::Make(Compression::type compression,
+                                    const std::shared_ptr<RandomAccessFile>& raw,
+                                    const ParallelDecompressionOptions& options) {
+  if (!IsSupported(compression)) {
+    return Status::NotImplemented("Parallel decompression of ",
+                                  Codec::GetCodecAsString(compression), " data");
+  }
+  if (options.block_size <= 0) {
+    return Status::Invalid("Block size must be positive");
+  }
+  if (options.max_buffered_bytes < 0) {
+    return Status::Invalid("Maximum buffered bytes must be non-negative");
+  }
+  auto state = std::make_shared<ParallelDecompressionState>();
+  state->compression = compression;
+  ARROW_ASSIGN_OR_RAISE(state->codec, Codec::Create(compression));
+  state->file = raw;
+  ARROW_ASSIGN_OR_RAISE(state->file_size, raw->GetSize());
+  state->block_size = options.block_size;
+  state->max_buffered_bytes = options.max_buffered_bytes;
+  state->io_context = options.io_context;
+  state->pool = options.io_context.pool();
+
+  std::shared_ptr<ParallelCompressedInputStream> res(new ParallelCompressedInputStream);
+  res->impl_.reset(new Impl(std::move(state)));
+  RETURN_NOT_OK(res->impl_->Init());
+  return res;
+}
+
+ParallelCompressedInputStream::~ParallelCompressedInputStream() {
+  internal::CloseFromDestructor(this);
+}
+
+Status ParallelCompressedInputStream::DoClose() { return impl_->Close(); }
+
+Status ParallelCompressedInputStream::DoAbort() { return impl_->Abort(); }
+
+bool ParallelCompressedInputStream::closed() const { return impl_->closed(); }
+
+Result<int64_t> ParallelCompressedInputStream::DoTell() const { return impl_->Tell(); }
+
+Result<int64_t> ParallelCompressedInputStream::DoRead(int64_t nbytes, void* out) {
+  return impl_->Read(nbytes, out);
+}
+
+Result<std::shared_ptr<Buffer>> ParallelCompressedInputStream::DoRead(int64_t nbytes) {
+  return impl_->Read(nbytes);
+}
+
+std::shared_ptr<RandomAccessFile> ParallelCompressedInputStream::raw() const {
+  return impl_->raw();
+}
+
+Result<std::shared_ptr<const KeyValueMetadata>>
+ParallelCompressedInputStream::ReadMetadata() {
+  return impl_->raw()->ReadMetadata();
+}
+
+Future<std::shared_ptr<const KeyValueMetadata>>
+ParallelCompressedInputStream::ReadMetadataAsync(const IOContext& io_context) {
+  return impl_->raw()->ReadMetadataAsync(io_context);
+}
+
 }  // namespace io
 }  // namespace arrow
@@ -24,6 +24,7 @@
 
 #include "arrow/io/concurrency.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -120,5 +121,80 @@ class ARROW_EXPORT CompressedInputStream
   std::unique_ptr<Impl> impl_;
 };
 
+/// \brief Options for ParallelCompressedInputStream
+struct ARROW_EXPORT ParallelDecompressionOptions {
+  static constexpr int64_t kDefaultBlockSize = 4 * 1024 * 1024;
+  static constexpr int64_t kDefaultMaxBufferedBytes = 128 * 1024 * 1024;
+
+  /// \brief The size of the ranges of compressed data decompressed by each task
+  int64_t block_size = kDefaultBlockSize;
+  /// \brief The maximum number of bytes held by the ranges decompressed ahead of
+  ///   the reader, counting both their compressed input and decompressed output.
+  ///   Ranges which would exceed it are decompressed serially instead.
+  int64_t max_buffered_bytes = kDefaultMaxBufferedBytes;
+  /// \brief The context used to read the compressed data, and to allocate the
+  ///   decompressed data
+  IOContext io_context;
+
+  static ParallelDecompressionOptions Defaults();
+};
+
+/// \brief An input stream decompressing several parts of a file concurrently
+///
+/// Compressed files are often made of independent members or frames: concatenated
+/// or blocked (BGZF) gzip files, multi-frame (e.g. seekable) zstd files or
+/// multi-frame LZ4 files.  This stream splits the file in ranges of `block_size`
+/// compressed bytes, reads them asynchronously ahead of the reader and decompresses
+/// the members starting in each range on the CPU thread pool.  Data is returned in
+/// order.
+///
+/// Member boundaries are found speculatively, by looking for valid headers, and
+/// only trusted once the previous members are decompressed up to them.  The parts
+/// of the file where that fails (for example single-member files) are decompressed
+/// serially, like CompressedInputStream does.  Speculation stops for good at the
+/// first range where no member starts, as members are then too large to be worth
+/// decompressing in parallel.
+class ARROW_EXPORT ParallelCompressedInputStream
+    : public internal::InputStreamConcurrencyWrapper<ParallelCompressedInputStream> {
+ public:
+  ~ParallelCompressedInputStream() override;
+
+  /// \brief Return whether parallel decompression is supported for the given
+  /// compression type (currently GZIP, ZSTD and LZ4_FRAME, if available)
+  static bool IsSupported(Compression::type compression);
+
+  /// \brief Create a parallel decompressing stream over the given file.
+  static Result<std::shared_ptr<ParallelCompressedInputStream>> Make(
+      Compression::type compression, const std::shared_ptr<RandomAccessFile>& raw,
+      const ParallelDecompressionOptions& options =
+          ParallelDecompressionOptions::Defaults());
+
+  // InputStream interface
+
+  bool closed() const override;
+  Result<std::shared_ptr<const KeyValueMetadata>> ReadMetadata() override;
+  Future<std::shared_ptr<const KeyValueMetadata>> ReadMetadataAsync(
+      const IOContext& io_context) override;
+
+  /// \brief Return the underlying raw file.
+  std::shared_ptr<RandomAccessFile> raw() const;
+
+ private:
+  friend InputStreamConcurrencyWrapper<ParallelCompressedInputStream>;
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ParallelCompressedInputStream);
+
+  ParallelCompressedInputStream() = default;
+
+  /// \brief Close the stream.  This implicitly closes the underlying raw file.
+  Status DoClose();
+  Status DoAbort() override;
+  Result<int64_t> DoTell() const;
+  Result<int64_t> DoRead(int64_t nbytes, void* out);
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes);
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace io
 }  // namespace arrow
@@ -197,4 +197,62 @@ BENCHMARK_TEMPLATE(CompressedInputStreamNonZeroCopyBufferReturnedByCallee,
     ->Apply(CompressedInputArguments);
 #endif
 
+#ifdef ARROW_WITH_ZLIB
+// Decompress a gzip file made of several members, serially or in parallel
+template <bool kParallel>
+static void MultiMemberGZipInputStream(::benchmark::State& state) {
+  const int64_t input_size = 32 * 1024 * 1024;
+  const int64_t member_size = state.range(0);
+  const int64_t batch_size = 1024 * 1024;
+
+  const std::vector<uint8_t> data = MakeCompressibleData(static_cast<int>(input_size));
+  auto codec = ::arrow::util::Codec::Create(Compression::GZIP).ValueOrDie();
+  BufferVector members;
+  for (int64_t start = 0; start < input_size; start += member_size) {
+    const int64_t length = std::min(member_size, input_size - start);
+    const int64_t max_compress_len =
+        codec->MaxCompressedLen(length, data.data() + start);
+    std::shared_ptr<ResizableBuffer> member =
+        ::arrow::AllocateResizableBuffer(max_compress_len).ValueOrDie();
+    const int64_t compressed_length =
+        codec
+            ->Compress(length, data.data() + start, max_compress_len,
+                       member->mutable_data())
+            .ValueOrDie();
+    ABORT_NOT_OK(member->Resize(compressed_length));
+    members.push_back(std::move(member));
+  }
+  auto compressed = ConcatenateBuffers(members).ValueOrDie();
+
+  for (auto _ : state) {
+    auto reader = std::make_shared<BufferReader>(compressed);
+    std::shared_ptr<InputStream> input_stream;
+    if constexpr (kParallel) {
+      input_stream =
+          ParallelCompressedInputStream::Make(Compression::GZIP, reader).ValueOrDie();
+    } else {
+      input_stream = CompressedInputStream::Make(codec.get(), reader).ValueOrDie();
+    }
+    auto remaining_size = input_size;
+    while (remaining_size > 0) {
+      auto value = input_stream->Read(batch_size);
+      ABORT_NOT_OK(value);
+      remaining_size -= value.ValueOrDie()->size();
+    }
+  }
+  state.SetBytesProcessed(input_size * state.iterations());
+}
+
+BENCHMARK_TEMPLATE(MultiMemberGZipInputStream, /*kParallel=*/false)
+    ->ArgName("member_size")
+    ->Arg(1024 * 1024)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(MultiMemberGZipInputStream, /*kParallel=*/true)
+    ->ArgName("member_size")
+    ->Arg(64 * 1024)
+    ->Arg(1024 * 1024)
+    ->Arg(32 * 1024 * 1024)
+    ->UseRealTime();
+#endif
+
 }  // namespace arrow::io
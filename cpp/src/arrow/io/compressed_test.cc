@@ -16,6 +16,7 @@
 // under the License.
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <memory>
 #include <random>
@@ -27,6 +28,7 @@
 
 #include "arrow/buffer.h"
 #include "arrow/io/compressed.h"
+#include "arrow/io/file.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/test_common.h"
 #include "arrow/status.h"
@@ -34,10 +36,13 @@
 #include "arrow/testing/util.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/config.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
 
+using ::arrow::internal::TemporaryDir;
 using ::arrow::util::Codec;
 
 #ifdef ARROW_VALGRIND
@@ -253,6 +258,343 @@ TEST_P(CompressedOutputStreamTest, RandomData) {
   CheckCompressedOutputStream(codec.get(), data, true /* do_flush */);
 }
 
+// ----------------------------------------------------------------------
+// ParallelCompressedInputStream tests
+
+class ParallelCompressedInputStreamTest
+    : public ::testing::TestWithParam<Compression::type> {
+ protected:
+  Compression::type GetCompression() { return GetParam(); }
+
+  std::unique_ptr<Codec> MakeCodec() { return *Codec::Create(GetCompression()); }
+
+  // Compress the data as `num_members` concatenated members
+  std::shared_ptr<Buffer> CompressMembers(const std::vector<uint8_t>& data,
+                                          int num_members) {
+    auto codec = MakeCodec();
+    BufferVector members;
+    const size_t member_size = data.size() / num_members + 1;
+    for (size_t start = 0; start < data.size(); start += member_size) {
+      const size_t end = std::min(start + member_size, data.size());
+      members.push_back(CompressDataOneShot(
+          codec.get(), std::vector<uint8_t>(data.begin() + start, data.begin() + end)));
+    }
+    return *ConcatenateBuffers(members);
+  }
+
+  Status RunParallelStream(std::shared_ptr<Buffer> compressed, int64_t block_size,
+                           std::vector<uint8_t>* out) {
+    auto options = ParallelDecompressionOptions::Defaults();
+    options.block_size = block_size;
+    return RunParallelStream(std::make_shared<BufferReader>(std::move(compressed)),
+                             options, out);
+  }
+
+  Status RunParallelStream(const std::shared_ptr<RandomAccessFile>& file,
+                           const ParallelDecompressionOptions& options,
+                           std::vector<uint8_t>* out) {
+    ARROW_ASSIGN_OR_RAISE(auto stream, ParallelCompressedInputStream::Make(
+                                           GetCompression(), file, options));
+    std::vector<uint8_t> decompressed;
+    const int64_t chunk_size = 1111;
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(auto buf, stream->Read(chunk_size));
+      if (buf->size() == 0) {
+        // EOF
+        break;
+      }
+      decompressed.insert(decompressed.end(), buf->data(), buf->data() + buf->size());
+    }
+    ARROW_ASSIGN_OR_RAISE(auto stream_pos, stream->Tell());
+    if (stream_pos != static_cast<int64_t>(decompressed.size())) {
+      return Status::Invalid("Unexpected stream position ", stream_pos);
+    }
+    RETURN_NOT_OK(stream->Close());
+    *out = std::move(decompressed);
+    return Status::OK();
+  }
+
+  void CheckParallelStream(std::shared_ptr<Buffer> compressed,
+                           const std::vector<uint8_t>& expected) {
+    for (int64_t block_size : {100, 4096, 100000, 10000000}) {
+      ARROW_SCOPED_TRACE("block_size = ", block_size);
+      std::vector<uint8_t> decompressed;
+      ASSERT_OK(RunParallelStream(compressed, block_size, &decompressed));
+      ASSERT_EQ(decompressed.size(), expected.size());
+      ASSERT_EQ(decompressed, expected);
+    }
+  }
+};
+
+TEST_P(ParallelCompressedInputStreamTest, SingleMember) {
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE / 4);
+  CheckParallelStream(CompressMembers(data, 1), data);
+}
+
+TEST_P(ParallelCompressedInputStreamTest, ManyMembers) {
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE / 4);
+  CheckParallelStream(CompressMembers(data, 10), data);
+  CheckParallelStream(CompressMembers(data, 1000), data);
+
+  data = MakeRandomData(RANDOM_DATA_SIZE / 4);
+  CheckParallelStream(CompressMembers(data, 100), data);
+}
+
+TEST_P(ParallelCompressedInputStreamTest, EmptyMembers) {
+  auto codec = MakeCodec();
+  auto data = MakeCompressibleData(10000);
+  auto compressed_empty = CompressDataOneShot(codec.get(), {});
+  auto compressed = CompressMembers(data, 5);
+
+  CheckParallelStream(Buffer::FromString(""), {});
+  CheckParallelStream(compressed_empty, {});
+  ASSERT_OK_AND_ASSIGN(auto concatenated,
+                       ConcatenateBuffers({compressed_empty, compressed, compressed_empty,
+                                           compressed_empty, compressed}));
+  std::vector<uint8_t> expected = data;
+  expected.insert(expected.end(), data.begin(), data.end());
+  CheckParallelStream(concatenated, expected);
+}
+
+TEST_P(ParallelCompressedInputStreamTest, FalseMemberStarts) {
+  // Incompressible data is stored as is, so member headers embedded in
+  // decompressed data appear in the compressed data.
+  auto codec = MakeCodec();
+  auto embedded = CompressMembers(MakeCompressibleData(1000), 3);
+  auto data = MakeRandomData(100000);
+  for (int64_t pos = 0; pos + embedded->size() < 100000; pos += 5000) {
+    std::memcpy(data.data() + pos, embedded->data(), embedded->size());
+  }
+  auto compressed = CompressMembers(data, 20);
+  CheckParallelStream(compressed, data);
+}
+
+// A buffer reader counting the asynchronous reads, which are only issued by the
+// parallel decompression tasks
+class AsyncReadCountingReader : public BufferReader {
+ public:
+  using BufferReader::BufferReader;
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const IOContext& io_context,
+                                            int64_t position, int64_t nbytes) override {
+    ++num_async_reads_;
+    return BufferReader::ReadAsync(io_context, position, nbytes);
+  }
+
+  int64_t num_async_reads() const { return num_async_reads_.load(); }
+
+ private:
+  std::atomic<int64_t> num_async_reads_{0};
+};
+
+TEST_P(ParallelCompressedInputStreamTest, MemoryLimit) {
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE / 4);
+  auto compressed = CompressMembers(data, 1000);
+
+  auto options = ParallelDecompressionOptions::Defaults();
+  options.block_size = 1000;
+  for (int64_t max_buffered_bytes : {0, 1000, 20000}) {
+    ARROW_SCOPED_TRACE("max_buffered_bytes = ", max_buffered_bytes);
+    options.max_buffered_bytes = max_buffered_bytes;
+    auto file = std::make_shared<AsyncReadCountingReader>(compressed);
+    std::vector<uint8_t> decompressed;
+    ASSERT_OK(RunParallelStream(file, options, &decompressed));
+    ASSERT_EQ(decompressed, data);
+    if (max_buffered_bytes <= options.block_size) {
+      // No range fits in the limit
+      ASSERT_EQ(file->num_async_reads(), 0);
+    }
+  }
+
+  options.max_buffered_bytes = -1;
+  ASSERT_RAISES(Invalid, ParallelCompressedInputStream::Make(
+                             GetCompression(), std::make_shared<BufferReader>(compressed),
+                             options));
+}
+
+TEST_P(ParallelCompressedInputStreamTest, LargeMembers) {
+  // Members spanning several ranges leave ranges without any member start,
+  // which stops the speculation
+  auto data = MakeRandomData(RANDOM_DATA_SIZE / 4);
+  auto compressed = CompressMembers(data, 10);
+
+  auto options = ParallelDecompressionOptions::Defaults();
+  options.block_size = 100;
+  auto file = std::make_shared<AsyncReadCountingReader>(compressed);
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunParallelStream(file, options, &decompressed));
+  ASSERT_EQ(decompressed, data);
+  // Only the ranges after the first member were speculated on
+  ASSERT_LE(file->num_async_reads(),
+            ::arrow::internal::GetCpuThreadPool()->GetCapacity());
+}
+
+// A file failing to close while it is being read, with reads slow enough to be
+// in progress when the stream is closed
+class CloseCheckingFile : public RandomAccessFile {
+ public:
+  explicit CloseCheckingFile(std::shared_ptr<RandomAccessFile> file)
+      : file_(std::move(file)) {}
+
+  Status Close() override {
+    if (reads_in_progress_.load() > 0) {
+      return Status::Invalid("File closed while being read");
+    }
+    return file_->Close();
+  }
+
+  bool closed() const override { return file_->closed(); }
+  Result<int64_t> Tell() const override { return file_->Tell(); }
+  Status Seek(int64_t position) override { return file_->Seek(position); }
+  Result<int64_t> GetSize() override { return file_->GetSize(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    return file_->Read(nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    return file_->Read(nbytes);
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    ++reads_in_progress_;
+    SleepFor(1e-3);
+    auto result = file_->ReadAt(position, nbytes, out);
+    --reads_in_progress_;
+    return result;
+  }
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    ++reads_in_progress_;
+    SleepFor(1e-3);
+    auto result = file_->ReadAt(position, nbytes);
+    --reads_in_progress_;
+    return result;
+  }
+
+ private:
+  std::shared_ptr<RandomAccessFile> file_;
+  std::atomic<int> reads_in_progress_{0};
+};
+
+TEST_P(ParallelCompressedInputStreamTest, CloseWhileDecompressing) {
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE / 4);
+  auto compressed = CompressMembers(data, 1000);
+  ASSERT_OK_AND_ASSIGN(auto temp_dir, TemporaryDir::Make("compressed-test-"));
+  ASSERT_OK_AND_ASSIGN(auto path, temp_dir->path().Join("data"));
+  {
+    ASSERT_OK_AND_ASSIGN(auto out, FileOutputStream::Open(path.ToString()));
+    ASSERT_OK(out->Write(compressed));
+    ASSERT_OK(out->Close());
+  }
+
+  auto options = ParallelDecompressionOptions::Defaults();
+  options.block_size = 1000;
+  for (bool abort : {false, true}) {
+    ARROW_SCOPED_TRACE("abort = ", abort);
+    ASSERT_OK_AND_ASSIGN(auto raw, ReadableFile::Open(path.ToString()));
+    auto file = std::make_shared<CloseCheckingFile>(raw);
+    ASSERT_OK_AND_ASSIGN(auto stream, ParallelCompressedInputStream::Make(
+                                          GetCompression(), file, options));
+    // Read past the first members, so that ranges are decompressed in parallel
+    ASSERT_OK_AND_ASSIGN(auto buf, stream->Read(10000));
+    ASSERT_EQ(buf->size(), 10000);
+    // The stream waits for the decompression tasks to stop reading the file
+    ASSERT_OK(abort ? stream->Abort() : stream->Close());
+    ASSERT_TRUE(raw->closed());
+  }
+}
+
+TEST_P(ParallelCompressedInputStreamTest, TruncatedData) {
+  auto data = MakeRandomData(100000);
+  auto compressed = CompressMembers(data, 10);
+  auto truncated = SliceBuffer(compressed, 0, compressed->size() - 3);
+
+  for (int64_t block_size : {100, 100000}) {
+    std::vector<uint8_t> decompressed;
+    ASSERT_RAISES(IOError, RunParallelStream(truncated, block_size, &decompressed));
+  }
+}
+
+TEST_P(ParallelCompressedInputStreamTest, InvalidData) {
+  auto data = MakeCompressibleData(100000);
+  auto compressed = CompressMembers(data, 10);
+  ASSERT_OK_AND_ASSIGN(auto invalid, ConcatenateBuffers({compressed,
+                                                         Buffer::FromString("garbage"),
+                                                         compressed}));
+  for (int64_t block_size : {100, 100000}) {
+    std::vector<uint8_t> decompressed;
+    ASSERT_RAISES(IOError, RunParallelStream(invalid, block_size, &decompressed));
+  }
+}
+
+#ifdef ARROW_WITH_ZLIB
+TEST(TestParallelGZipInputStream, BlockedGZip) {
+  // BGZF files are made of gzip members with their compressed size in an extra field
+  auto codec = *Codec::Create(Compression::GZIP);
+  auto data = MakeCompressibleData(100000);
+  BufferVector members;
+  for (int64_t start = 0; start < 100000; start += 10000) {
+    auto member = CompressDataOneShot(
+        codec.get(), std::vector<uint8_t>(data.begin() + start,
+                                          data.begin() + start + 10000));
+    ASSERT_EQ(member->data()[3], 0);  // FLG
+    const auto block_size = static_cast<uint16_t>(member->size() + 8 - 1);
+    std::string extra = {6, 0, 'B', 'C', 2, 0, static_cast<char>(block_size & 0xff),
+                         static_cast<char>(block_size >> 8)};
+    std::string header(reinterpret_cast<const char*>(member->data()), 10);
+    header[3] = 4;  // FEXTRA
+    members.push_back(Buffer::FromString(header + extra));
+    members.push_back(SliceBuffer(member, 10));
+  }
+  ASSERT_OK_AND_ASSIGN(auto compressed, ConcatenateBuffers(members));
+
+  for (int64_t block_size : {100, 10000, 100000}) {
+    auto options = ParallelDecompressionOptions::Defaults();
+    options.block_size = block_size;
+    auto buffer_reader = std::make_shared<BufferReader>(compressed);
+    ASSERT_OK_AND_ASSIGN(auto stream, ParallelCompressedInputStream::Make(
+                                          Compression::GZIP, buffer_reader, options));
+    ASSERT_OK_AND_ASSIGN(auto decompressed, stream->Read(200000));
+    ASSERT_EQ(decompressed->ToString(),
+              std::string(reinterpret_cast<const char*>(data.data()), data.size()));
+  }
+}
+#endif
+
+#ifdef ARROW_WITH_ZSTD
+TEST(TestParallelZSTDInputStream, SkippableFrames) {
+  // Skippable frames carry metadata such as the seek table of seekable zstd files
+  auto codec = *Codec::Create(Compression::ZSTD);
+  auto data = MakeCompressibleData(100000);
+  const std::string skippable_frame = {0x50, 0x2a, 0x4d, 0x18, 4, 0, 0, 0, 1, 2, 3, 4};
+  BufferVector frames;
+  for (int64_t start = 0; start < 100000; start += 10000) {
+    frames.push_back(CompressDataOneShot(
+        codec.get(), std::vector<uint8_t>(data.begin() + start,
+                                          data.begin() + start + 10000)));
+    frames.push_back(Buffer::FromString(skippable_frame));
+  }
+  ASSERT_OK_AND_ASSIGN(auto compressed, ConcatenateBuffers(frames));
+
+  for (int64_t block_size : {100, 10000, 100000}) {
+    auto options = ParallelDecompressionOptions::Defaults();
+    options.block_size = block_size;
+    auto buffer_reader = std::make_shared<BufferReader>(compressed);
+    ASSERT_OK_AND_ASSIGN(auto stream, ParallelCompressedInputStream::Make(
+                                          Compression::ZSTD, buffer_reader, options));
+    ASSERT_OK_AND_ASSIGN(auto decompressed, stream->Read(200000));
+    ASSERT_EQ(decompressed->ToString(),
+              std::string(reinterpret_cast<const char*>(data.data()), data.size()));
+  }
+}
+#endif
+
+TEST(TestParallelCompressedInputStream, NotImplemented) {
+  ASSERT_FALSE(ParallelCompressedInputStream::IsSupported(Compression::SNAPPY));
+  std::shared_ptr<RandomAccessFile> file = std::make_shared<BufferReader>("");
+  ASSERT_RAISES(NotImplemented,
+                ParallelCompressedInputStream::Make(Compression::SNAPPY, file));
+}
+
 // NOTES:
 // - Snappy doesn't support streaming decompression
 // - BZ2 doesn't support one-shot compression
@@ -280,11 +622,17 @@ GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(CompressedInputStreamTest);
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(CompressedOutputStreamTest);
 #endif
 
+#if !defined ARROW_WITH_ZLIB && !defined ARROW_WITH_LZ4 && !defined ARROW_WITH_ZSTD
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ParallelCompressedInputStreamTest);
+#endif
+
 #ifdef ARROW_WITH_ZLIB
 INSTANTIATE_TEST_SUITE_P(TestGZipInputStream, CompressedInputStreamTest,
                          ::testing::Values(Compression::GZIP));
 INSTANTIATE_TEST_SUITE_P(TestGZipOutputStream, CompressedOutputStreamTest,
                          ::testing::Values(Compression::GZIP));
+INSTANTIATE_TEST_SUITE_P(TestParallelGZipInputStream, ParallelCompressedInputStreamTest,
+                         ::testing::Values(Compression::GZIP));
 #endif
 
 #ifdef ARROW_WITH_BROTLI
@@ -299,6 +647,8 @@ INSTANTIATE_TEST_SUITE_P(TestLZ4InputStream, CompressedInputStreamTest,
                          ::testing::Values(Compression::LZ4_FRAME));
 INSTANTIATE_TEST_SUITE_P(TestLZ4OutputStream, CompressedOutputStreamTest,
                          ::testing::Values(Compression::LZ4_FRAME));
+INSTANTIATE_TEST_SUITE_P(TestParallelLZ4InputStream, ParallelCompressedInputStreamTest,
+                         ::testing::Values(Compression::LZ4_FRAME));
 #endif
 
 #ifdef ARROW_WITH_ZSTD
@@ -306,6 +656,8 @@ INSTANTIATE_TEST_SUITE_P(TestZSTDInputStream, CompressedInputStreamTest,
                          ::testing::Values(Compression::ZSTD));
 INSTANTIATE_TEST_SUITE_P(TestZSTDOutputStream, CompressedOutputStreamTest,
                          ::testing::Values(Compression::ZSTD));
+INSTANTIATE_TEST_SUITE_P(TestParallelZSTDInputStream, ParallelCompressedInputStreamTest,
+                         ::testing::Values(Compression::ZSTD));
 #endif
 
 }  // namespace io
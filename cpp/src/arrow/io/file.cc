@@ -48,11 +48,13 @@
 
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/io/util_internal.h"
 
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
@@ -338,6 +340,247 @@ Status ReadableFile::DoSeek(int64_t pos) { return impl_->Seek(pos); }
 
 int ReadableFile::file_descriptor() const { return impl_->fd(); }
 
+// ----------------------------------------------------------------------
+// UringReadableFile implementation
+
+UringReadableFile::UringReadableFile(MemoryPool* pool)
+    : ReadableFile(pool), pool_(pool) {}
+
+UringReadableFile::~UringReadableFile() {
+#ifndef _WIN32
+  if (uring_fd_ != -1) {
+    close(uring_fd_);
+  }
+#endif
+}
+
+bool UringReadableFile::IsAvailable() { return internal::IoUring::GetInstance().ok(); }
+
+Result<std::shared_ptr<UringReadableFile>> UringReadableFile::Open(
+    const std::string& path, MemoryPool* pool) {
+  RETURN_NOT_OK(internal::IoUring::GetInstance());
+  auto file = std::shared_ptr<UringReadableFile>(new UringReadableFile(pool));
+  RETURN_NOT_OK(file->impl_->Open(path));
+#ifndef _WIN32
+  file->uring_fd_ = fcntl(file->impl_->fd(), F_DUPFD_CLOEXEC, 0);
+  if (file->uring_fd_ == -1) {
+    return IOErrorFromErrno(errno, "Failed to duplicate file descriptor");
+  }
+#endif
+  return file;
+}
+
+Future<std::shared_ptr<Buffer>> UringReadableFile::ReadAsync(const IOContext& ctx,
+                                                             int64_t position,
+                                                             int64_t nbytes) {
+  return ReadManyAsync(ctx, {{position, nbytes}})[0];
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> UringReadableFile::ReadManyAsync(
+    const IOContext& ctx, const std::vector<ReadRange>& ranges) {
+  using BufferFuture = Future<std::shared_ptr<Buffer>>;
+  auto maybe_ring = internal::IoUring::GetInstance();
+  Status st = maybe_ring.status();
+  if (st.ok()) {
+    st = impl_->CheckClosed();
+  }
+  if (st.ok()) {
+    st = ctx.stop_token().Poll();
+  }
+  if (!st.ok()) {
+    return std::vector<BufferFuture>(ranges.size(), BufferFuture::MakeFinished(st));
+  }
+  std::vector<BufferFuture> futures(ranges.size());
+  std::vector<ReadRange> to_read;
+  std::vector<size_t> indices;
+  to_read.reserve(ranges.size());
+  indices.reserve(ranges.size());
+  const int64_t size = impl_->size();
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const auto& range = ranges[i];
+    st = internal::ValidateRange(range.offset, range.length);
+    if (!st.ok()) {
+      futures[i] = BufferFuture::MakeFinished(st);
+      continue;
+    }
+    // Like ReadAt(), return short reads past the end of the file
+    const int64_t length =
+        std::max<int64_t>(0, std::min(range.length, size - range.offset));
+    to_read.push_back({range.offset, length});
+    indices.push_back(i);
+  }
+  auto read_futures = (*maybe_ring)->ReadMany(uring_fd_, to_read, pool_, ctx.executor(),
+                                              shared_from_this());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    futures[indices[i]] = std::move(read_futures[i]);
+  }
+  return futures;
+}
+
+Status UringReadableFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  RETURN_NOT_OK(impl_->CheckClosed());
+  for (const auto& range : ranges) {
+    RETURN_NOT_OK(internal::ValidateRange(range.offset, range.length));
+  }
+  ARROW_ASSIGN_OR_RAISE(auto ring, internal::IoUring::GetInstance());
+  return ring->WillNeed(uring_fd_, ranges);
+}
+
+// ----------------------------------------------------------------------
+// DirectReadableFile implementation
+
+class DirectReadableFile::DirectReadableFileImpl : public OSFile {
+ public:
+  explicit DirectReadableFileImpl(MemoryPool* pool) : OSFile(), pool_(pool) {}
+
+  Status Open(const std::string& path) {
+    RETURN_NOT_OK(OpenReadable(path));
+#ifdef O_DIRECT
+    int flags = fcntl(fd(), F_GETFL);
+    if (flags == -1 || fcntl(fd(), F_SETFL, flags | O_DIRECT) == -1) {
+      if (errno == EINVAL) {
+        return Status::NotImplemented("Direct I/O is not supported for '", path, "'");
+      }
+      return IOErrorFromErrno(errno, "Failed to enable direct I/O for '", path, "'");
+    }
+    return Status::OK();
+#else
+    return Status::NotImplemented("Direct I/O is not supported on this platform");
+#endif
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadBufferAt(int64_t position, int64_t nbytes) {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(internal::ValidateRange(position, nbytes));
+    // Like ReadableFile, return short reads past the end of the file
+    nbytes = std::max<int64_t>(0, std::min(nbytes, size() - position));
+    if (nbytes == 0) {
+      return AllocateBuffer(0, pool_);
+    }
+    const int64_t start = bit_util::RoundDown(position, kAlignment);
+    const int64_t end = bit_util::RoundUp(position + nbytes, kAlignment);
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer,
+                          AllocateBuffer(end - start, kAlignment, pool_));
+    if (buffer->address() % kAlignment != 0) {
+      return Status::Invalid("Memory pool returned a buffer not aligned for direct I/O");
+    }
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                          ReadAligned(start, end - start, buffer->mutable_data()));
+    const int64_t offset = position - start;
+    return SliceBuffer(std::move(buffer), offset,
+                       std::max<int64_t>(0, std::min(nbytes, bytes_read - offset)));
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadBufferAt(position, nbytes));
+    std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    return buffer->size();
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadBuffer(int64_t nbytes) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadBufferAt(position_, nbytes));
+    position_ += buffer->size();
+    return buffer;
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(position_, nbytes, out));
+    position_ += bytes_read;
+    return bytes_read;
+  }
+
+  // The file position isn't used, as reads must be aligned
+  Status Seek(int64_t position) {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0) {
+      return Status::Invalid("Invalid position");
+    }
+    position_ = position;
+    return Status::OK();
+  }
+
+  Result<int64_t> Tell() const {
+    RETURN_NOT_OK(CheckClosed());
+    return position_;
+  }
+
+ private:
+  Result<int64_t> ReadAligned(int64_t position, int64_t nbytes, uint8_t* out) {
+#ifdef O_DIRECT
+    // Unlike FileReadAt(), issue a single read per chunk: resuming after a
+    // short read would use an unaligned offset, which direct I/O rejects.
+    // Chunks stay aligned, and a short read can only mean the end of file.
+    constexpr int64_t kMaxChunkSize = int64_t(1) << 30;
+    int64_t total_bytes_read = 0;
+    while (total_bytes_read < nbytes) {
+      const int64_t chunk_size = std::min(nbytes - total_bytes_read, kMaxChunkSize);
+      int64_t bytes_read;
+      do {
+        bytes_read = static_cast<int64_t>(
+            pread(fd(), out + total_bytes_read, static_cast<size_t>(chunk_size),
+                  static_cast<off_t>(position + total_bytes_read)));
+      } while (bytes_read == -1 && errno == EINTR);
+      if (bytes_read == -1) {
+        return IOErrorFromErrno(errno, "Error reading bytes from file");
+      }
+      total_bytes_read += bytes_read;
+      if (bytes_read < chunk_size) {
+        break;
+      }
+    }
+    return total_bytes_read;
+#else
+    return Status::NotImplemented("Direct I/O is not supported on this platform");
+#endif
+  }
+
+  MemoryPool* pool_;
+  int64_t position_ = 0;
+};
+
+DirectReadableFile::DirectReadableFile(MemoryPool* pool) {
+  impl_.reset(new DirectReadableFileImpl(pool));
+}
+
+DirectReadableFile::~DirectReadableFile() { internal::CloseFromDestructor(this); }
+
+Result<std::shared_ptr<DirectReadableFile>> DirectReadableFile::Open(
+    const std::string& path, MemoryPool* pool) {
+  auto file = std::shared_ptr<DirectReadableFile>(new DirectReadableFile(pool));
+  RETURN_NOT_OK(file->impl_->Open(path));
+  return file;
+}
+
+Status DirectReadableFile::DoClose() { return impl_->Close(); }
+
+bool DirectReadableFile::closed() const { return !impl_->is_open(); }
+
+Result<int64_t> DirectReadableFile::DoTell() const { return impl_->Tell(); }
+
+Result<int64_t> DirectReadableFile::DoRead(int64_t nbytes, void* out) {
+  return impl_->Read(nbytes, out);
+}
+
+Result<int64_t> DirectReadableFile::DoReadAt(int64_t position, int64_t nbytes,
+                                             void* out) {
+  return impl_->ReadAt(position, nbytes, out);
+}
+
+Result<std::shared_ptr<Buffer>> DirectReadableFile::DoReadAt(int64_t position,
+                                                             int64_t nbytes) {
+  return impl_->ReadBufferAt(position, nbytes);
+}
+
+Result<std::shared_ptr<Buffer>> DirectReadableFile::DoRead(int64_t nbytes) {
+  return impl_->ReadBuffer(nbytes);
+}
+
+Result<int64_t> DirectReadableFile::DoGetSize() { return impl_->size(); }
+
+Status DirectReadableFile::DoSeek(int64_t pos) { return impl_->Seek(pos); }
+
+int DirectReadableFile::file_descriptor() const { return impl_->fd(); }
+
 // ----------------------------------------------------------------------
 // FileOutputStream
 
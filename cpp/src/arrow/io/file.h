@@ -115,6 +115,7 @@ class ARROW_EXPORT ReadableFile
 
  private:
   friend RandomAccessFileConcurrencyWrapper<ReadableFile>;
+  friend class UringReadableFile;
 
   explicit ReadableFile(MemoryPool* pool);
 
@@ -136,6 +137,108 @@ class ARROW_EXPORT ReadableFile
   std::unique_ptr<ReadableFileImpl> impl_;
 };
 
+/// \brief An operating system file open in read-only mode, with asynchronous
+/// reads issued through io_uring.
+///
+/// ReadAsync() and ReadManyAsync() submit reads to a process-wide io_uring
+/// instance instead of running blocking reads on the IO thread pool, so that
+/// many reads can be in flight without as many threads.  ReadManyAsync()
+/// submits all its ranges at once.  The returned futures are marked finished
+/// on the IOContext's executor.  Other reads behave as in ReadableFile.
+///
+/// This requires Linux 5.6 or later, see IsAvailable().
+class ARROW_EXPORT UringReadableFile : public ReadableFile {
+ public:
+  ~UringReadableFile() override;
+
+  /// \brief Whether io_uring can be used in this process
+  static bool IsAvailable();
+
+  /// \brief Open a local file for reading
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] pool a MemoryPool for memory allocations
+  /// \return UringReadableFile instance
+  static Result<std::shared_ptr<UringReadableFile>> Open(
+      const std::string& path, MemoryPool* pool = default_memory_pool());
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const IOContext&, int64_t position,
+                                            int64_t nbytes) override;
+
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const IOContext&, const std::vector<ReadRange>& ranges) override;
+
+  Status WillNeed(const std::vector<ReadRange>& ranges) override;
+
+  /// \cond FALSE
+  using RandomAccessFile::ReadAsync;
+  using RandomAccessFile::ReadManyAsync;
+  /// \endcond
+
+ private:
+  explicit UringReadableFile(MemoryPool* pool);
+
+  MemoryPool* pool_;
+  // A duplicate of the file descriptor, so that reads in flight remain valid
+  // if the file is closed
+  int uring_fd_ = -1;
+};
+
+/// \brief An operating system file open in read-only mode, bypassing the
+/// page cache (O_DIRECT).
+///
+/// Reads are widened to the enclosing aligned blocks and done into aligned
+/// buffers allocated from the given pool.  Reads returning a Buffer expose
+/// the requested bytes as a zero-copy slice of it, while reads into
+/// caller-provided memory need an extra copy.
+///
+/// This is meant for large scans that shouldn't evict other data from the
+/// page cache.  Since nothing is cached, small reads should be coalesced
+/// or buffered by the caller.
+class ARROW_EXPORT DirectReadableFile
+    : public internal::RandomAccessFileConcurrencyWrapper<DirectReadableFile> {
+ public:
+  /// The alignment of file offsets, lengths and memory addresses of reads
+  static constexpr int64_t kAlignment = 4096;
+
+  ~DirectReadableFile() override;
+
+  /// \brief Open a local file for direct reading
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] pool a MemoryPool for the aligned read buffers
+  /// \return DirectReadableFile instance
+  ///
+  /// NotImplemented is returned if the platform or the filesystem holding
+  /// the file doesn't support direct I/O.
+  static Result<std::shared_ptr<DirectReadableFile>> Open(
+      const std::string& path, MemoryPool* pool = default_memory_pool());
+
+  bool closed() const override;
+
+  int file_descriptor() const;
+
+ private:
+  friend RandomAccessFileConcurrencyWrapper<DirectReadableFile>;
+
+  explicit DirectReadableFile(MemoryPool* pool);
+
+  Status DoClose();
+  Result<int64_t> DoTell() const;
+  Result<int64_t> DoRead(int64_t nbytes, void* buffer);
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes);
+
+  /// \brief Thread-safe implementation of ReadAt
+  Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out);
+
+  /// \brief Thread-safe implementation of ReadAt
+  Result<std::shared_ptr<Buffer>> DoReadAt(int64_t position, int64_t nbytes);
+
+  Result<int64_t> DoGetSize();
+  Status DoSeek(int64_t position);
+
+  class ARROW_NO_EXPORT DirectReadableFileImpl;
+  std::unique_ptr<DirectReadableFileImpl> impl_;
+};
+
 /// \brief A file interface that uses memory-mapped files for memory interactions
 ///
 /// This implementation supports zero-copy reads. The same class is used
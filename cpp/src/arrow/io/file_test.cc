@@ -20,6 +20,7 @@
 #include <unistd.h>
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <cstdio>
@@ -38,8 +39,10 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/io/stdio.h"
 #include "arrow/io/test_common.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/config.h"
@@ -523,6 +526,254 @@ TEST_F(TestReadableFile, ThreadSafety) {
   ASSERT_EQ(niter * 2, correct_count);
 }
 
+// ----------------------------------------------------------------------
+// io_uring file tests
+
+class TestUringReadableFile : public FileTestFixture {
+ public:
+  void SetUp() override {
+    if (!UringReadableFile::IsAvailable()) {
+      GTEST_SKIP() << "io_uring not available";
+    }
+    FileTestFixture::SetUp();
+  }
+
+  void MakeTestFile(const std::string& data = "testdata") {
+    std::ofstream stream;
+    stream.open(path_.c_str(), std::ios::binary);
+    stream << data;
+  }
+
+  void OpenFile(MemoryPool* pool = default_memory_pool()) {
+    ASSERT_OK_AND_ASSIGN(file_, UringReadableFile::Open(path_, pool));
+  }
+
+ protected:
+  std::shared_ptr<UringReadableFile> file_;
+};
+
+TEST_F(TestUringReadableFile, ReadAsync) {
+  MakeTestFile();
+  OpenFile();
+
+  auto fut1 = file_->ReadAsync({}, 1, 10);
+  auto fut2 = file_->ReadAsync({}, 0, 4);
+  auto fut3 = file_->ReadAsync({}, 20, 4);
+  auto fut4 = file_->ReadAsync({}, 2, 0);
+  ASSERT_OK_AND_ASSIGN(auto buf1, fut1.result());
+  ASSERT_OK_AND_ASSIGN(auto buf2, fut2.result());
+  ASSERT_OK_AND_ASSIGN(auto buf3, fut3.result());
+  ASSERT_OK_AND_ASSIGN(auto buf4, fut4.result());
+  AssertBufferEqual(*buf1, "estdata");
+  AssertBufferEqual(*buf2, "test");
+  AssertBufferEqual(*buf3, "");
+  AssertBufferEqual(*buf4, "");
+
+  ASSERT_FINISHES_AND_RAISES(Invalid, file_->ReadAsync({}, -1, 1));
+  // Synchronous reads are inherited from ReadableFile
+  ASSERT_OK_AND_ASSIGN(auto buffer, file_->ReadAt(4, 4));
+  AssertBufferEqual(*buffer, "data");
+}
+
+TEST_F(TestUringReadableFile, ReadManyAsync) {
+  // More ranges than can be in flight at once
+  std::string data;
+  for (int i = 0; i < 50000; ++i) {
+    data += std::to_string(i);
+  }
+  MakeTestFile(data);
+  OpenFile();
+
+  std::vector<ReadRange> ranges;
+  for (int64_t offset = 0; offset < static_cast<int64_t>(data.size()); offset += 37) {
+    ranges.push_back({offset, 50});
+  }
+  ranges.push_back({3, -1});
+  auto futs = file_->ReadManyAsync(ranges);
+
+  ASSERT_EQ(futs.size(), ranges.size());
+  for (size_t i = 0; i < ranges.size() - 1; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto buf, futs[i].result());
+    AssertBufferEqual(*buf, data.substr(ranges[i].offset, ranges[i].length));
+  }
+  ASSERT_FINISHES_AND_RAISES(Invalid, futs.back());
+}
+
+TEST_F(TestUringReadableFile, Close) {
+  MakeTestFile();
+  OpenFile();
+
+  auto fut = file_->ReadAsync({}, 0, 8);
+  ASSERT_OK(file_->Close());
+  ASSERT_TRUE(file_->closed());
+  // A read in flight isn't affected
+  ASSERT_OK_AND_ASSIGN(auto buffer, fut.result());
+  AssertBufferEqual(*buffer, "testdata");
+
+  ASSERT_FINISHES_AND_RAISES(Invalid, file_->ReadAsync({}, 0, 4));
+  ASSERT_RAISES(Invalid, file_->WillNeed({{0, 4}}));
+
+  // The file is kept alive by reads in flight
+  OpenFile();
+  fut = file_->ReadAsync({}, 4, 4);
+  file_.reset();
+  ASSERT_OK_AND_ASSIGN(buffer, fut.result());
+  AssertBufferEqual(*buffer, "data");
+}
+
+TEST_F(TestUringReadableFile, WillNeed) {
+  MakeTestFile();
+  OpenFile();
+
+  ASSERT_OK(file_->WillNeed({}));
+  ASSERT_OK(file_->WillNeed({{0, 3}, {4, 6}}));
+  ASSERT_OK(file_->WillNeed({{10, 0}}));
+
+  ASSERT_RAISES(Invalid, file_->WillNeed({{-1, -1}}));
+}
+
+TEST_F(TestUringReadableFile, CustomMemoryPool) {
+  MakeTestFile();
+
+  MyMemoryPool pool;
+  OpenFile(&pool);
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto buffer, file_->ReadAsync({}, 0, 4));
+  ASSERT_FINISHES_OK_AND_ASSIGN(buffer, file_->ReadAsync({}, 4, 8));
+
+  ASSERT_EQ(2, pool.num_allocations());
+
+  // The read tasks may still hold references to the buffers: let them finish
+  // before the pool is destroyed
+  buffer.reset();
+  file_.reset();
+  internal::GetIOThreadPool()->WaitForIdle();
+}
+
+// ----------------------------------------------------------------------
+// Direct I/O file tests
+
+class TestDirectReadableFile : public FileTestFixture {
+ public:
+  void SetUp() override {
+    FileTestFixture::SetUp();
+    // Not a multiple of the alignment
+    data_.resize(3 * DirectReadableFile::kAlignment + 100);
+    random_ascii(data_.size(), /*seed=*/0, reinterpret_cast<uint8_t*>(data_.data()));
+    std::ofstream stream;
+    stream.open(path_.c_str(), std::ios::binary);
+    stream << data_;
+    stream.close();
+
+    auto maybe_file = DirectReadableFile::Open(path_);
+    if (maybe_file.status().IsNotImplemented()) {
+      GTEST_SKIP() << maybe_file.status().ToString();
+    }
+    ASSERT_OK_AND_ASSIGN(file_, maybe_file);
+  }
+
+  void AssertReadAt(int64_t position, int64_t nbytes) {
+    ARROW_SCOPED_TRACE("position = ", position, ", nbytes = ", nbytes);
+    const auto expected = std::string_view(data_).substr(
+        std::min<size_t>(position, data_.size()), nbytes);
+    ASSERT_OK_AND_ASSIGN(auto buffer, file_->ReadAt(position, nbytes));
+    AssertBufferEqual(*buffer, expected);
+    if (buffer->size() > 0) {
+      // Zero-copy slice of an aligned read
+      ASSERT_EQ(buffer->address() % DirectReadableFile::kAlignment,
+                position % DirectReadableFile::kAlignment);
+    }
+
+    std::string out(nbytes, 'x');
+    ASSERT_OK_AND_EQ(static_cast<int64_t>(expected.size()),
+                     file_->ReadAt(position, nbytes, out.data()));
+    ASSERT_EQ(out.substr(0, expected.size()), expected);
+  }
+
+ protected:
+  std::string data_;
+  std::shared_ptr<DirectReadableFile> file_;
+};
+
+TEST_F(TestDirectReadableFile, ReadAt) {
+  const int64_t size = static_cast<int64_t>(data_.size());
+  ASSERT_OK_AND_EQ(size, file_->GetSize());
+  for (int64_t position : {int64_t(0), int64_t(1), DirectReadableFile::kAlignment - 1,
+                           DirectReadableFile::kAlignment, size - 10}) {
+    for (int64_t nbytes : {int64_t(0), int64_t(1), int64_t(17),
+                           DirectReadableFile::kAlignment, int64_t(10000)}) {
+      AssertReadAt(position, nbytes);
+    }
+  }
+  // Whole file and past the end
+  AssertReadAt(0, size);
+  AssertReadAt(size, 10);
+  AssertReadAt(size + 10000, 10);
+
+  ASSERT_RAISES(Invalid, file_->ReadAt(-1, 1));
+  ASSERT_RAISES(Invalid, file_->ReadAt(0, -1));
+}
+
+TEST_F(TestDirectReadableFile, Read) {
+  ASSERT_OK_AND_EQ(0, file_->Tell());
+  ASSERT_OK_AND_ASSIGN(auto buffer, file_->Read(10));
+  AssertBufferEqual(*buffer, data_.substr(0, 10));
+  ASSERT_OK_AND_EQ(10, file_->Tell());
+
+  std::string out(DirectReadableFile::kAlignment, 'x');
+  ASSERT_OK_AND_EQ(DirectReadableFile::kAlignment, file_->Read(out.size(), out.data()));
+  ASSERT_EQ(out, data_.substr(10, out.size()));
+
+  ASSERT_OK(file_->Seek(data_.size() - 5));
+  ASSERT_OK_AND_ASSIGN(buffer, file_->Read(10));
+  AssertBufferEqual(*buffer, data_.substr(data_.size() - 5));
+  ASSERT_OK_AND_EQ(static_cast<int64_t>(data_.size()), file_->Tell());
+  ASSERT_OK_AND_ASSIGN(buffer, file_->Read(10));
+  ASSERT_EQ(buffer->size(), 0);
+
+  ASSERT_RAISES(Invalid, file_->Seek(-1));
+}
+
+TEST_F(TestDirectReadableFile, ReadAsync) {
+  auto fut1 = file_->ReadAsync({}, 5, 5000);
+  auto fut2 = file_->ReadAsync({}, 0, 4);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto buf1, fut1);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto buf2, fut2);
+  AssertBufferEqual(*buf1, data_.substr(5, 5000));
+  AssertBufferEqual(*buf2, data_.substr(0, 4));
+}
+
+TEST_F(TestDirectReadableFile, Close) {
+  int fd = file_->file_descriptor();
+  ASSERT_FALSE(file_->closed());
+  ASSERT_OK(file_->Close());
+  ASSERT_TRUE(file_->closed());
+  ASSERT_TRUE(FileIsClosed(fd));
+  ASSERT_RAISES(Invalid, file_->ReadAt(0, 1));
+  ASSERT_RAISES(Invalid, file_->Read(1));
+
+  // Idempotent
+  ASSERT_OK(file_->Close());
+}
+
+TEST_F(TestDirectReadableFile, CustomMemoryPool) {
+  ProxyMemoryPool pool(default_memory_pool());
+  ASSERT_OK_AND_ASSIGN(file_, DirectReadableFile::Open(path_, &pool));
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, file_->ReadAt(0, 4));
+  ASSERT_OK_AND_ASSIGN(buffer, file_->ReadAt(4, 8));
+
+  ASSERT_EQ(2, pool.num_allocations());
+
+  // The pool must honor the requested alignment
+  MyMemoryPool unaligned_pool;
+  ASSERT_OK_AND_ASSIGN(file_, DirectReadableFile::Open(path_, &unaligned_pool));
+  auto result = file_->ReadAt(0, 4);
+  if (!result.ok()) {
+    ASSERT_RAISES(Invalid, result);
+  }
+}
+
 // ----------------------------------------------------------------------
 // Pipe I/O tests using FileOutputStream
 // (cannot test using ReadableFile as it currently requires seeking)
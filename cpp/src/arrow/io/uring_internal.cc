@@ -0,0 +1,597 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/uring_internal.h"
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define ARROW_HAVE_IO_URING
+#endif
+#endif
+
+#ifdef ARROW_HAVE_IO_URING
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <any>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/util/atfork_internal.h"
+#include "arrow/util/future.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::IOErrorFromErrno;
+
+namespace io {
+namespace internal {
+
+#ifdef ARROW_HAVE_IO_URING
+
+namespace {
+
+constexpr unsigned kSubmissionQueueEntries = 256;
+constexpr unsigned kCompletionQueueEntries = 4 * kSubmissionQueueEntries;
+// Larger reads are split (the kernel would return short reads anyway)
+constexpr int64_t kMaxReadSize = int64_t(1) << 30;
+
+int SysIoUringSetup(unsigned entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int SysIoUringEnter(int ring_fd, unsigned to_submit, unsigned min_complete,
+                    unsigned flags) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete,
+                                  flags, nullptr, 0));
+}
+
+struct Operation {
+  bool is_read;
+  int fd;
+  int64_t offset;
+  int64_t length;
+  int64_t bytes_read = 0;
+  std::shared_ptr<ResizableBuffer> buffer;
+  Future<std::shared_ptr<Buffer>> future;
+  ::arrow::internal::Executor* executor = nullptr;
+  std::shared_ptr<void> keep_alive;
+};
+
+}  // namespace
+
+class IoUring::Impl {
+ public:
+  ~Impl() {
+    // Only reached if Init() failed, the instance is never destroyed otherwise
+    if (sqes_ != nullptr) {
+      munmap(sqes_, sqes_size_);
+    }
+    if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+      munmap(cq_ring_, cq_ring_size_);
+    }
+    if (sq_ring_ != nullptr) {
+      munmap(sq_ring_, sq_ring_size_);
+    }
+    if (ring_fd_ >= 0) {
+      close(ring_fd_);
+    }
+  }
+
+  Status Init() {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = kCompletionQueueEntries;
+    ring_fd_ = SysIoUringSetup(kSubmissionQueueEntries, &params);
+    if (ring_fd_ < 0) {
+      return IOErrorFromErrno(errno, "io_uring_setup failed");
+    }
+    // IORING_OP_READ and IORING_OP_FADVISE came with this feature in Linux 5.6
+    if (!(params.features & IORING_FEAT_RW_CUR_POS)) {
+      return Status::NotImplemented("io_uring reads require Linux 5.6 or later");
+    }
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+    RETURN_NOT_OK(Map(sq_ring_size_, IORING_OFF_SQ_RING, &sq_ring_));
+    if (single_mmap) {
+      cq_ring_ = sq_ring_;
+    } else {
+      RETURN_NOT_OK(Map(cq_ring_size_, IORING_OFF_CQ_RING, &cq_ring_));
+    }
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = nullptr;
+    RETURN_NOT_OK(Map(sqes_size_, IORING_OFF_SQES, &sqes));
+    sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+    auto sq_field = [&](uint32_t offset) {
+      return reinterpret_cast<unsigned*>(static_cast<uint8_t*>(sq_ring_) + offset);
+    };
+    auto cq_field = [&](uint32_t offset) {
+      return reinterpret_cast<unsigned*>(static_cast<uint8_t*>(cq_ring_) + offset);
+    };
+    sq_head_ = sq_field(params.sq_off.head);
+    sq_tail_ = sq_field(params.sq_off.tail);
+    sq_mask_ = *sq_field(params.sq_off.ring_mask);
+    sq_array_ = sq_field(params.sq_off.array);
+    sq_entries_ = params.sq_entries;
+    cq_head_ = cq_field(params.cq_off.head);
+    cq_tail_ = cq_field(params.cq_off.tail);
+    cq_mask_ = *cq_field(params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(static_cast<uint8_t*>(cq_ring_) +
+                                            params.cq_off.cqes);
+    // Never let more operations be in flight than there are completion slots
+    max_in_flight_ = params.cq_entries;
+
+    // The instance is never destroyed: the completion thread runs until the ring
+    // fails, after failing all operations
+    std::thread(&Impl::ReapCompletions, this).detach();
+    return Status::OK();
+  }
+
+  // Submit operations, or fail them at once if the ring is unusable
+  Status Submit(std::vector<std::unique_ptr<Operation>> ops) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!failed_.ok()) {
+      Status st = failed_;
+      lock.unlock();
+      for (const auto& op : ops) {
+        Finish(op.get(), st);
+      }
+      return st;
+    }
+    for (auto& op : ops) {
+      pending_.push_back(std::move(op));
+    }
+    while (true) {
+      bool stalled = false;
+      Status st = SubmitPendingUnlocked(&stalled);
+      if (!st.ok()) {
+        auto failed = FailUnlocked(st);
+        lock.unlock();
+        FinishFailed(failed, st);
+        return st;
+      }
+      if (!stalled) {
+        return Status::OK();
+      }
+      // The kernel is transiently out of resources.  Retry without holding the
+      // lock, so that the completion thread can make progress meanwhile.
+      lock.unlock();
+      std::this_thread::yield();
+      lock.lock();
+      if (!failed_.ok()) {
+        return failed_;
+      }
+    }
+  }
+
+ private:
+  Status Map(size_t size, off_t offset, void** out) {
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                     ring_fd_, offset);
+    if (ptr == MAP_FAILED) {
+      return IOErrorFromErrno(errno, "io_uring mmap failed");
+    }
+    *out = ptr;
+    return Status::OK();
+  }
+
+  // Move pending operations to the submission queue and have the kernel consume
+  // them.  `stalled` is set if entries were left in the submission queue because
+  // the kernel was transiently unable to consume them.  An error means the ring is
+  // unusable.
+  Status SubmitPendingUnlocked(bool* stalled) {
+    unsigned tail = *sq_tail_;
+    unsigned queued = tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    while (!pending_.empty() && in_flight_.size() < max_in_flight_ &&
+           queued < sq_entries_) {
+      std::unique_ptr<Operation> op = std::move(pending_.front());
+      pending_.pop_front();
+      const unsigned index = tail & sq_mask_;
+      io_uring_sqe* sqe = &sqes_[index];
+      std::memset(sqe, 0, sizeof(*sqe));
+      sqe->fd = op->fd;
+      sqe->off = static_cast<uint64_t>(op->offset + op->bytes_read);
+      if (op->is_read) {
+        sqe->opcode = IORING_OP_READ;
+        uint8_t* out = op->buffer->mutable_data() + op->bytes_read;
+        sqe->addr = reinterpret_cast<uint64_t>(out);
+        sqe->len =
+            static_cast<uint32_t>(std::min(op->length - op->bytes_read, kMaxReadSize));
+      } else {
+        sqe->opcode = IORING_OP_FADVISE;
+        sqe->len = static_cast<uint32_t>(std::min(op->length, kMaxReadSize));
+        sqe->fadvise_advice = POSIX_FADV_WILLNEED;
+      }
+      sqe->user_data = reinterpret_cast<uint64_t>(op.get());
+      sq_array_[index] = index;
+      Operation* key = op.get();
+      in_flight_.emplace(key, std::move(op));
+      ++tail;
+      ++queued;
+    }
+    __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+
+    *stalled = false;
+    while (true) {
+      // The completion thread may submit entries concurrently
+      const unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+      if (tail == head) {
+        return Status::OK();
+      }
+      const int ret = SysIoUringEnter(ring_fd_, tail - head, 0, 0);
+      const int errnum = errno;
+      if (ret > 0) {
+        continue;
+      }
+      if (ret == 0) {
+        // Nothing consumed: either another thread submitted the entries, or the
+        // kernel can't take them right now
+        if (__atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) != head) {
+          continue;
+        }
+        *stalled = true;
+        return Status::OK();
+      }
+      if (errnum == EAGAIN || errnum == EBUSY) {
+        *stalled = true;
+        return Status::OK();
+      }
+      if (errnum != EINTR) {
+        return IOErrorFromErrno(errnum, "io_uring_enter failed");
+      }
+    }
+  }
+
+  // Mark the ring unusable and return the operations which will never complete.
+  // They are kept alive as the kernel may still be writing into their buffers.
+  std::vector<Operation*> FailUnlocked(const Status& st) {
+    std::vector<Operation*> failed;
+    if (!failed_.ok()) {
+      return failed;
+    }
+    failed_ = st;
+    for (auto& entry : in_flight_) {
+      failed.push_back(entry.first);
+      abandoned_.push_back(std::move(entry.second));
+    }
+    in_flight_.clear();
+    for (auto& op : pending_) {
+      failed.push_back(op.get());
+      abandoned_.push_back(std::move(op));
+    }
+    pending_.clear();
+    return failed;
+  }
+
+  static void FinishFailed(const std::vector<Operation*>& failed, const Status& st) {
+    if (!failed.empty()) {
+      ARROW_LOG(WARNING) << "io_uring is unusable, failing " << failed.size()
+                         << " operations: " << st;
+    }
+    for (Operation* op : failed) {
+      Finish(op, st);
+    }
+  }
+
+  // Run by the dedicated completion thread, until the ring fails
+  void ReapCompletions() {
+    std::vector<std::pair<std::unique_ptr<Operation>, int32_t>> completions;
+    std::vector<std::unique_ptr<Operation>> resubmit;
+    while (true) {
+      unsigned to_submit;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!failed_.ok()) {
+          return;
+        }
+        // Retry submitting the entries the kernel couldn't consume earlier
+        to_submit = *sq_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+      }
+      const int ret = SysIoUringEnter(ring_fd_, to_submit, 1, IORING_ENTER_GETEVENTS);
+      const int errnum = errno;
+      unsigned head = *cq_head_;
+      const unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+      if (ret < 0 && head == tail) {
+        if (errnum == EAGAIN || errnum == EBUSY) {
+          std::this_thread::yield();
+        } else if (errnum != EINTR) {
+          Status st = IOErrorFromErrno(errnum, "io_uring_enter failed");
+          std::vector<Operation*> failed;
+          {
+            std::lock_guard<std::mutex> lock(mutex_);
+            failed = FailUnlocked(st);
+          }
+          FinishFailed(failed, st);
+          return;
+        }
+        continue;
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (; head != tail; ++head) {
+          const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+          auto it = in_flight_.find(reinterpret_cast<Operation*>(cqe.user_data));
+          // Operations are only missing if the ring failed meanwhile
+          if (it != in_flight_.end()) {
+            completions.emplace_back(std::move(it->second), cqe.res);
+            in_flight_.erase(it);
+          }
+        }
+      }
+      __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+
+      for (auto& completion : completions) {
+        if (Complete(completion.first.get(), completion.second)) {
+          resubmit.push_back(std::move(completion.first));
+        }
+      }
+      Status failure;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (failed_.ok()) {
+          // Continuations of short reads go first
+          for (auto it = resubmit.rbegin(); it != resubmit.rend(); ++it) {
+            pending_.push_front(std::move(*it));
+          }
+          resubmit.clear();
+          // If the kernel stalls, the next iteration retries
+          bool stalled = false;
+          Status st = SubmitPendingUnlocked(&stalled);
+          if (!st.ok()) {
+            auto failed = FailUnlocked(st);
+            lock.unlock();
+            FinishFailed(failed, st);
+            return;
+          }
+        } else {
+          failure = failed_;
+        }
+      }
+      // If the ring failed meanwhile, short reads can't be continued
+      for (const auto& op : resubmit) {
+        Finish(op.get(), failure);
+      }
+      completions.clear();
+      resubmit.clear();
+    }
+  }
+
+  // Return whether the operation needs to be resubmitted
+  static bool Complete(Operation* op, int32_t res) {
+    if (!op->is_read) {
+      // Advice is best-effort
+      return false;
+    }
+    if (res < 0) {
+      if (res == -EAGAIN || res == -EINTR) {
+        return true;
+      }
+      Finish(op, IOErrorFromErrno(-res, "io_uring read failed"));
+      return false;
+    }
+    op->bytes_read += res;
+    if (res > 0 && op->bytes_read < op->length) {
+      return true;
+    }
+    Finish(op, Status::OK());
+    return false;
+  }
+
+  static void Finish(Operation* op, Status st) {
+    if (!op->is_read) {
+      return;
+    }
+    Result<std::shared_ptr<Buffer>> result;
+    if (st.ok() && op->bytes_read < op->length) {
+      st = op->buffer->Resize(op->bytes_read);
+      op->buffer->ZeroPadding();
+    }
+    if (st.ok()) {
+      result = std::move(op->buffer);
+    } else {
+      result = std::move(st);
+    }
+    // Don't run continuations on the completion thread.  The task moves the future
+    // and result out of the completion, so that no reference to the buffer remains
+    // once it is done: executors may destroy tasks long after running them, and the
+    // buffer must not outlive its memory pool.
+    struct Completion {
+      Future<std::shared_ptr<Buffer>> future;
+      Result<std::shared_ptr<Buffer>> result;
+    };
+    auto completion =
+        std::make_shared<Completion>(Completion{std::move(op->future), std::move(result)});
+    auto spawned = op->executor->Spawn([completion]() {
+      auto future = std::move(completion->future);
+      future.MarkFinished(std::move(completion->result));
+    });
+    if (!spawned.ok()) {
+      completion->future.MarkFinished(std::move(completion->result));
+    }
+  }
+
+  int ring_fd_ = -1;
+  void* sq_ring_ = nullptr;
+  void* cq_ring_ = nullptr;
+  io_uring_sqe* sqes_ = nullptr;
+  size_t sq_ring_size_ = 0;
+  size_t cq_ring_size_ = 0;
+  size_t sqes_size_ = 0;
+
+  unsigned* sq_head_;
+  unsigned* sq_tail_;
+  unsigned* sq_array_;
+  unsigned sq_mask_;
+  unsigned sq_entries_;
+  unsigned* cq_head_;
+  unsigned* cq_tail_;
+  io_uring_cqe* cqes_;
+  unsigned cq_mask_;
+
+  // Protects the submission queue and the fields below
+  std::mutex mutex_;
+  std::deque<std::unique_ptr<Operation>> pending_;
+  // The operations in the submission queue or in the kernel, by address
+  std::unordered_map<Operation*, std::unique_ptr<Operation>> in_flight_;
+  size_t max_in_flight_;
+  // Set if the ring is unusable, in which case all operations fail at once
+  Status failed_;
+  // The operations which were in flight when the ring failed
+  std::vector<std::unique_ptr<Operation>> abandoned_;
+};
+
+namespace {
+
+std::mutex instance_mutex;
+std::atomic<IoUring*> instance{nullptr};
+
+}  // namespace
+
+IoUring::IoUring() : impl_(new Impl()) {}
+
+IoUring::~IoUring() = default;
+
+Result<IoUring*> IoUring::GetInstance() {
+  IoUring* ring = instance.load(std::memory_order_acquire);
+  if (ring != nullptr) {
+    return ring;
+  }
+  std::lock_guard<std::mutex> lock(instance_mutex);
+  static Status init_status;
+  static auto atfork_handler =
+      std::make_shared<::arrow::internal::AtForkHandler>([](std::any) {
+        // The completion thread doesn't exist in the child, leak the parent's
+        // ring and create another one on demand
+        instance.store(nullptr);
+        init_status = Status::OK();
+      });
+  ring = instance.load(std::memory_order_acquire);
+  if (ring != nullptr) {
+    return ring;
+  }
+  RETURN_NOT_OK(init_status);
+  std::unique_ptr<IoUring> new_ring(new IoUring());
+  init_status = new_ring->impl_->Init();
+  RETURN_NOT_OK(init_status);
+  ::arrow::internal::RegisterAtFork(atfork_handler);
+  ring = new_ring.release();
+  instance.store(ring, std::memory_order_release);
+  return ring;
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> IoUring::ReadMany(
+    int fd, const std::vector<ReadRange>& ranges, MemoryPool* pool,
+    ::arrow::internal::Executor* executor, std::shared_ptr<void> keep_alive) {
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  std::vector<std::unique_ptr<Operation>> ops;
+  futures.reserve(ranges.size());
+  ops.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    auto maybe_buffer = AllocateResizableBuffer(range.length, pool);
+    if (!maybe_buffer.ok()) {
+      futures.push_back(Future<std::shared_ptr<Buffer>>::MakeFinished(
+          maybe_buffer.status()));
+      continue;
+    }
+    if (range.length == 0) {
+      futures.push_back(Future<std::shared_ptr<Buffer>>::MakeFinished(
+          std::shared_ptr<Buffer>(maybe_buffer.MoveValueUnsafe())));
+      continue;
+    }
+    auto op = std::make_unique<Operation>();
+    op->is_read = true;
+    op->fd = fd;
+    op->offset = range.offset;
+    op->length = range.length;
+    op->buffer = maybe_buffer.MoveValueUnsafe();
+    op->future = Future<std::shared_ptr<Buffer>>::Make();
+    op->executor = executor;
+    op->keep_alive = keep_alive;
+    futures.push_back(op->future);
+    ops.push_back(std::move(op));
+  }
+  // On failure, the futures are finished with the error
+  ARROW_UNUSED(impl_->Submit(std::move(ops)));
+  return futures;
+}
+
+Status IoUring::WillNeed(int fd, const std::vector<ReadRange>& ranges) {
+  std::vector<std::unique_ptr<Operation>> ops;
+  ops.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    auto op = std::make_unique<Operation>();
+    op->is_read = false;
+    op->fd = fd;
+    op->offset = range.offset;
+    op->length = range.length;
+    ops.push_back(std::move(op));
+  }
+  return impl_->Submit(std::move(ops));
+}
+
+#else  // !ARROW_HAVE_IO_URING
+
+class IoUring::Impl {};
+
+IoUring::IoUring() = default;
+
+IoUring::~IoUring() = default;
+
+Result<IoUring*> IoUring::GetInstance() {
+  return Status::NotImplemented("io_uring is not supported on this platform");
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> IoUring::ReadMany(
+    int fd, const std::vector<ReadRange>& ranges, MemoryPool* pool,
+    ::arrow::internal::Executor* executor, std::shared_ptr<void> keep_alive) {
+  return {};
+}
+
+Status IoUring::WillNeed(int fd, const std::vector<ReadRange>& ranges) {
+  return Status::NotImplemented("io_uring is not supported on this platform");
+}
+
+#endif  // ARROW_HAVE_IO_URING
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
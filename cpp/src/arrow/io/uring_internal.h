@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/type_fwd.h"
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+/// \brief A process-wide io_uring instance for asynchronous file reads
+///
+/// Reads may be submitted from any thread.  A dedicated thread waits for
+/// completions and marks the corresponding futures finished on the executor
+/// given along with the reads, so that continuations don't run on it.
+/// Short reads are resubmitted until EOF.
+///
+/// If the kernel reports an unrecoverable error on the ring itself, all queued
+/// and in-flight operations fail with it, and so do all later operations.
+///
+/// This talks to the kernel directly through the io_uring system calls and
+/// requires Linux 5.6 or later.
+class IoUring {
+ public:
+  ~IoUring();
+
+  /// \brief Return the process-wide instance
+  ///
+  /// An error is returned if io_uring isn't supported on this platform
+  /// (or allowed by the current security policy).
+  static Result<IoUring*> GetInstance();
+
+  /// \brief Read ranges of a file descriptor, submitting them together
+  ///
+  /// `keep_alive` is held until all reads are done.
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadMany(
+      int fd, const std::vector<ReadRange>& ranges, MemoryPool* pool,
+      ::arrow::internal::Executor* executor, std::shared_ptr<void> keep_alive);
+
+  /// \brief Advise the kernel that ranges of a file descriptor will be read
+  ///
+  /// This doesn't wait for the advice to be processed.
+  Status WillNeed(int fd, const std::vector<ReadRange>& ranges);
+
+ private:
+  IoUring();
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -80,6 +80,14 @@ bool HasValidityBitmap(Type::type type_id, MetadataVersion version);
 
 static constexpr const char* kArrowMagicBytes = "ARROW1";
 
+// Footer custom metadata key holding the per-batch statistics of an IPC file,
+// serialized as a base64-encoded IPC stream
+static constexpr const char* kBatchStatisticsKey = "ARROW:batch_statistics";
+
+// Record batch custom metadata key holding the base64-encoded zstd dictionary
+// used to compress this and all following messages of an IPC stream
+static constexpr const char* kZstdDictionaryKey = "ARROW:zstd_dictionary";
+
 struct FieldMetadata {
   int64_t length;
   int64_t null_count;
@@ -18,7 +18,10 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <optional>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "arrow/io/caching.h"
@@ -83,6 +86,51 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// prior to 12.0.0.
   std::optional<double> min_space_savings;
 
+  /// \brief Per-field compression codecs, keyed by top-level field name
+  ///
+  /// Overrides `codec` for the body buffers of the given top-level fields (including
+  /// their children) in record batches. The IPC format records a single compression
+  /// type per message, so each codec here must either be null, which leaves the
+  /// field uncompressed, or have the same compression type as `codec`, e.g. with a
+  /// different compression level. Dictionary batches always use `codec`.
+  /// If no codec was supplied, this option is ignored.
+  std::unordered_map<std::string, std::shared_ptr<util::Codec>> field_codecs;
+
+  /// \brief Decide per field whether compression is worthwhile
+  ///
+  /// If true and a codec was supplied, a sample of the body buffers of each
+  /// top-level field is compressed the first time the field has data. The field
+  /// is then left uncompressed by the writer for this and all subsequent record
+  /// batches if the sample saves less than `min_space_savings` (0.1 if unset), or
+  /// compresses slower than `adaptive_compression_min_throughput`.
+  ///
+  /// The decision is cached by stream and file writers; GetRecordBatchPayload
+  /// samples each record batch anew.
+  bool adaptive_compression = false;
+
+  /// \brief Minimum compression speed, in bytes per second, for adaptive compression
+  ///
+  /// Fields whose sample compresses slower than this are left uncompressed.
+  /// A value of 0 only considers space savings.
+  double adaptive_compression_min_throughput = 0;
+
+  /// \brief Number of record batches sampled to train a zstd dictionary
+  ///
+  /// If positive and `codec` is ZSTD, a stream writer compresses this many
+  /// record batches as usual while sampling their buffers, then trains a
+  /// compression dictionary of at most `zstd_dictionary_size` bytes. The
+  /// dictionary is sent once, in the custom metadata of the next record batch
+  /// message, and all subsequent messages are compressed with it. This improves
+  /// compression of streams made of small record batches. If training fails,
+  /// e.g. for lack of sample data, the stream goes on without a dictionary.
+  ///
+  /// Such streams can only be read by Arrow C++ 17.0.0 and later. This option is
+  /// ignored for the IPC file format, whose record batches may be read in any order.
+  int zstd_dictionary_training_batches = 0;
+
+  /// \brief Maximum size in bytes of the trained zstd dictionary
+  int64_t zstd_dictionary_size = 16 * 1024;
+
   /// \brief Use global CPU thread pool to parallelize any computational tasks
   /// like compression
   bool use_threads = true;
@@ -119,6 +167,26 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// and deltas.
   bool unify_dictionaries = false;
 
+  /// \brief Whether to store per-batch column statistics in the IPC file footer
+  ///
+  /// If true, the minimum, maximum and null count of each top-level column
+  /// of a supported type (boolean, integer, floating-point, temporal and
+  /// binary-like) are computed for each record batch, and stored in the
+  /// custom metadata of the file footer.  Readers can retrieve them with
+  /// RecordBatchFileReader::ReadBatchStatistics, e.g. to skip record batches
+  /// that cannot match a filter.
+  ///
+  /// This option is ignored for IPC streams.
+  bool write_batch_statistics = false;
+
+  /// \brief Maximum length in bytes of the binary and string bounds in the
+  /// batch statistics
+  ///
+  /// Longer minimums and maximums are truncated (the maximum being rounded
+  /// up) so that long values don't bloat the footer.  Truncation is disabled
+  /// if not positive.
+  int64_t batch_statistics_truncate_length = 64;
+
   /// \brief Format version to use for IPC messages and their metadata.
   ///
   /// Presently using V5 version (readable by 1.0.0 and later).
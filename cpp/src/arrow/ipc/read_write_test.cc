@@ -29,6 +29,7 @@
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/io/file.h"
@@ -41,14 +42,17 @@
 #include "arrow/ipc/test_common.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/testing/builder.h"
 #include "arrow/testing/extension_type.h"
 #include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/io_util.h"
@@ -837,6 +841,191 @@ TEST_F(TestWriteRecordBatch, WriteWithCompressionAndMinSavings) {
   }
 }
 
+TEST_F(TestWriteRecordBatch, WriteWithPerFieldCompression) {
+  constexpr int64_t kLength = 1000;
+  ASSERT_OK_AND_ASSIGN(auto a, MakeArrayFromScalar(Int64Scalar(42), kLength));
+  ASSERT_OK_AND_ASSIGN(auto b, MakeArrayFromScalar(Int64Scalar(7), kLength));
+  auto batch = RecordBatch::Make(schema({field("a", int64()), field("b", int64())}),
+                                 kLength, {a, b});
+
+  auto prefixed_size = [](const Buffer& buffer) -> int64_t {
+    return bit_util::FromLittleEndian(util::SafeLoadAs<int64_t>(buffer.data()));
+  };
+
+  for (auto codec : {Compression::LZ4_FRAME, Compression::ZSTD}) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    auto write_options = IpcWriteOptions::Defaults();
+    ASSERT_OK_AND_ASSIGN(write_options.codec, util::Codec::Create(codec));
+
+    // A null codec leaves the field uncompressed
+    write_options.field_codecs["b"] = nullptr;
+    IpcPayload payload;
+    ASSERT_OK(GetRecordBatchPayload(*batch, write_options, &payload));
+    ASSERT_EQ(payload.body_buffers.size(), 4);
+    ASSERT_EQ(prefixed_size(*payload.body_buffers[1]), kLength * sizeof(int64_t));
+    ASSERT_EQ(prefixed_size(*payload.body_buffers[3]), -1);
+    ASSERT_EQ(payload.body_buffers[3]->size(), sizeof(int64_t) * (kLength + 1));
+    CheckRoundtrip(*batch, write_options);
+
+    // A codec of the same type, e.g. with another level, is allowed
+    ASSERT_OK_AND_ASSIGN(auto other_level, util::Codec::Create(codec, 1));
+    write_options.field_codecs["b"] = std::move(other_level);
+    payload = IpcPayload();
+    ASSERT_OK(GetRecordBatchPayload(*batch, write_options, &payload));
+    ASSERT_EQ(prefixed_size(*payload.body_buffers[3]), kLength * sizeof(int64_t));
+    CheckRoundtrip(*batch, write_options);
+
+    // A message has a single compression type
+    auto other_type =
+        codec == Compression::ZSTD ? Compression::LZ4_FRAME : Compression::ZSTD;
+    if (util::Codec::IsAvailable(other_type)) {
+      ASSERT_OK_AND_ASSIGN(auto other_codec, util::Codec::Create(other_type));
+      write_options.field_codecs["b"] = std::move(other_codec);
+      ASSERT_RAISES(Invalid, SerializeRecordBatch(*batch, write_options));
+    }
+
+    write_options.field_codecs.clear();
+    write_options.field_codecs["c"] = nullptr;
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        Invalid, ::testing::HasSubstr("unknown field 'c'"),
+        SerializeRecordBatch(*batch, write_options));
+  }
+}
+
+TEST_F(TestWriteRecordBatch, WriteWithAdaptiveCompression) {
+  constexpr int64_t kLength = 1000;
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  auto schema = ::arrow::schema({field("compressible", int64()),
+                                 field("incompressible", int64())});
+  ASSERT_OK_AND_ASSIGN(auto constant, MakeArrayFromScalar(Int64Scalar(42), kLength));
+  auto noise = rg.Int64(kLength, std::numeric_limits<int64_t>::min(),
+                        std::numeric_limits<int64_t>::max(), /*null_probability=*/0);
+  auto mixed_batch = RecordBatch::Make(schema, kLength, {constant, noise});
+  auto constant_batch = RecordBatch::Make(schema, kLength, {constant, constant});
+
+  auto prefixed_size = [](const Buffer& buffer) -> int64_t {
+    return bit_util::FromLittleEndian(util::SafeLoadAs<int64_t>(buffer.data()));
+  };
+
+  for (auto codec : {Compression::LZ4_FRAME, Compression::ZSTD}) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    auto write_options = IpcWriteOptions::Defaults();
+    ASSERT_OK_AND_ASSIGN(write_options.codec, util::Codec::Create(codec));
+    write_options.adaptive_compression = true;
+
+    IpcPayload payload;
+    ASSERT_OK(GetRecordBatchPayload(*mixed_batch, write_options, &payload));
+    ASSERT_EQ(payload.body_buffers.size(), 4);
+    ASSERT_EQ(prefixed_size(*payload.body_buffers[1]), kLength * sizeof(int64_t));
+    ASSERT_EQ(prefixed_size(*payload.body_buffers[3]), -1);
+    CheckRoundtrip(*mixed_batch, write_options);
+
+    // An unreachable throughput leaves every field uncompressed
+    write_options.adaptive_compression_min_throughput = 1e30;
+    payload = IpcPayload();
+    ASSERT_OK(GetRecordBatchPayload(*mixed_batch, write_options, &payload));
+    ASSERT_EQ(prefixed_size(*payload.body_buffers[1]), -1);
+    ASSERT_EQ(prefixed_size(*payload.body_buffers[3]), -1);
+    write_options.adaptive_compression_min_throughput = 0;
+
+    // Writers keep the decision made on the first batch
+    auto write_stream = [&](const IpcWriteOptions& options) -> Result<int64_t> {
+      ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create());
+      ARROW_ASSIGN_OR_RAISE(auto writer, MakeStreamWriter(sink, schema, options));
+      RETURN_NOT_OK(writer->WriteRecordBatch(*mixed_batch));
+      const int64_t first_body_size = writer->stats().total_serialized_body_size;
+      RETURN_NOT_OK(writer->WriteRecordBatch(*constant_batch));
+      const int64_t second_body_size =
+          writer->stats().total_serialized_body_size - first_body_size;
+      RETURN_NOT_OK(writer->Close());
+      ARROW_ASSIGN_OR_RAISE(auto buffer, sink->Finish());
+      ARROW_ASSIGN_OR_RAISE(auto reader, RecordBatchStreamReader::Open(
+                                             std::make_shared<io::BufferReader>(buffer)));
+      ARROW_ASSIGN_OR_RAISE(auto table, reader->ToTable());
+      ARROW_ASSIGN_OR_RAISE(auto expected,
+                            Table::FromRecordBatches({mixed_batch, constant_batch}));
+      if (!table->Equals(*expected)) {
+        return Status::Invalid("Round-tripped table differs");
+      }
+      return second_body_size;
+    };
+    ASSERT_OK_AND_ASSIGN(auto adaptive_size, write_stream(write_options));
+    ASSERT_GT(adaptive_size, kLength * static_cast<int64_t>(sizeof(int64_t)));
+    write_options.adaptive_compression = false;
+    ASSERT_OK_AND_ASSIGN(auto uniform_size, write_stream(write_options));
+    ASSERT_LT(uniform_size, kLength * static_cast<int64_t>(sizeof(int64_t)));
+  }
+}
+
+TEST_F(TestWriteRecordBatch, WriteWithZstdDictionary) {
+  if (!util::Codec::IsAvailable(Compression::ZSTD)) {
+    GTEST_SKIP() << "Test requires ZSTD support";
+  }
+  constexpr int kNumBatches = 100;
+  constexpr int kTrainingBatches = 50;
+  auto schema = ::arrow::schema({field("email", utf8()), field("id", int64())});
+
+  // Small batches sharing a lot of structure, but little within each batch
+  RecordBatchVector batches;
+  for (int i = 0; i < kNumBatches; ++i) {
+    StringBuilder emails;
+    Int64Builder ids;
+    for (int j = 0; j < 20; ++j) {
+      const int64_t id = 1000003 * i + 7919 * j;
+      ASSERT_OK(emails.Append("customer." + std::to_string(id) + "@example.com"));
+      ASSERT_OK(ids.Append(id));
+    }
+    ASSERT_OK_AND_ASSIGN(auto email_array, emails.Finish());
+    ASSERT_OK_AND_ASSIGN(auto id_array, ids.Finish());
+    batches.push_back(RecordBatch::Make(schema, 20, {email_array, id_array}));
+  }
+  auto metadata = key_value_metadata({"key"}, {"value"});
+
+  // Return the body size of the record batches written after training
+  auto write_stream = [&](const IpcWriteOptions& options) -> Result<int64_t> {
+    ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create());
+    ARROW_ASSIGN_OR_RAISE(auto writer, MakeStreamWriter(sink, schema, options));
+    int64_t training_body_size = 0;
+    for (int i = 0; i < kNumBatches; ++i) {
+      if (i == kTrainingBatches) {
+        training_body_size = writer->stats().total_serialized_body_size;
+      }
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batches[i], metadata));
+    }
+    RETURN_NOT_OK(writer->Close());
+    ARROW_ASSIGN_OR_RAISE(auto buffer, sink->Finish());
+    ARROW_ASSIGN_OR_RAISE(auto reader, RecordBatchStreamReader::Open(
+                                           std::make_shared<io::BufferReader>(buffer)));
+    for (int i = 0; i < kNumBatches; ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto batch_with_metadata, reader->ReadNext());
+      if (batch_with_metadata.batch == nullptr ||
+          !batch_with_metadata.batch->Equals(*batches[i]) ||
+          !batch_with_metadata.custom_metadata->Equals(*metadata)) {
+        return Status::Invalid("Round-tripped batch ", i, " differs");
+      }
+    }
+    return writer->stats().total_serialized_body_size - training_body_size;
+  };
+
+  auto write_options = IpcWriteOptions::Defaults();
+  ASSERT_OK_AND_ASSIGN(write_options.codec, util::Codec::Create(Compression::ZSTD));
+  ASSERT_OK_AND_ASSIGN(auto plain_size, write_stream(write_options));
+
+  write_options.zstd_dictionary_training_batches = kTrainingBatches;
+  write_options.zstd_dictionary_size = 4096;
+  ASSERT_OK_AND_ASSIGN(auto dictionary_size, write_stream(write_options));
+  ASSERT_LT(dictionary_size, plain_size);
+
+  // Too little sample data to train on: the stream goes on without a dictionary
+  write_options.zstd_dictionary_training_batches = 1;
+  ASSERT_OK_AND_ASSIGN(auto untrained_size, write_stream(write_options));
+  ASSERT_EQ(untrained_size, plain_size);
+}
+
 TEST_F(TestWriteRecordBatch, SliceTruncatesBinaryOffsets) {
   // ARROW-6046
   std::shared_ptr<Array> array;
@@ -1950,6 +2139,222 @@ TEST(TestIpcFileFormat, ReaderToTable) {
   ASSERT_TABLES_EQUAL(*expected_table, *out_table);
 }
 
+TEST(TestIpcFileFormat, ReadRawMessages) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeDictionaryFlat(&batch));
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink, batch->schema()));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto file_contents, sink->Finish());
+
+  auto source = std::make_shared<io::BufferReader>(file_contents);
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(source));
+  ASSERT_EQ(2, reader->num_record_batches());
+  ASSERT_GT(reader->num_dictionaries(), 0);
+
+  // Concatenating the raw messages after a schema message yields a valid stream
+  ASSERT_OK_AND_ASSIGN(auto schema_buffer, SerializeSchema(*batch->schema()));
+  ASSERT_OK_AND_ASSIGN(auto stream, io::BufferOutputStream::Create());
+  ASSERT_OK(stream->Write(schema_buffer));
+  auto check_message = [&](const Message& message) {
+    // The message buffers are slices of the file, not copies
+    ASSERT_GE(message.body()->data(), file_contents->data());
+    ASSERT_LE(message.body()->data() + message.body()->size(),
+              file_contents->data() + file_contents->size());
+    int64_t output_length = 0;
+    ASSERT_OK(message.SerializeTo(stream.get(), IpcWriteOptions::Defaults(),
+                                  &output_length));
+  };
+  for (int i = 0; i < reader->num_dictionaries(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto message, reader->ReadDictionaryMessage(i));
+    ASSERT_EQ(MessageType::DICTIONARY_BATCH, message->type());
+    check_message(*message);
+  }
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto message, reader->ReadRecordBatchMessage(i));
+    ASSERT_EQ(MessageType::RECORD_BATCH, message->type());
+    check_message(*message);
+  }
+  ASSERT_RAISES(IndexError, reader->ReadRecordBatchMessage(2));
+  ASSERT_RAISES(IndexError, reader->ReadDictionaryMessage(-1));
+
+  ASSERT_OK_AND_ASSIGN(auto stream_contents, stream->Finish());
+  ASSERT_OK_AND_ASSIGN(auto stream_reader,
+                       RecordBatchStreamReader::Open(
+                           std::make_shared<io::BufferReader>(stream_contents)));
+  ASSERT_OK_AND_ASSIGN(auto batches, stream_reader->ToRecordBatches());
+  ASSERT_EQ(2, batches.size());
+  for (const auto& read_batch : batches) {
+    CompareBatch(*batch, *read_batch);
+  }
+}
+
+TEST(TestIpcFileFormat, BatchStatistics) {
+  auto schema = ::arrow::schema({field("i", int32()), field("f", float64()),
+                                 field("s", utf8()), field("l", list(int32()))});
+  auto batch1 = RecordBatchFromJSON(
+      schema, R"([[1, 1.5, "b", [1]], [null, 0.5, "a", null], [3, null, null, []]])");
+  auto batch2 = RecordBatchFromJSON(
+      schema, R"([[null, NaN, "z", null], [null, 2.0, "y", null]])");
+
+  auto write_file = [&](const IpcWriteOptions& options,
+                        const std::shared_ptr<const KeyValueMetadata>& metadata)
+      -> Result<std::shared_ptr<RecordBatchFileReader>> {
+    ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create());
+    ARROW_ASSIGN_OR_RAISE(auto writer, MakeFileWriter(sink, schema, options, metadata));
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch1));
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch2));
+    RETURN_NOT_OK(writer->Close());
+    ARROW_ASSIGN_OR_RAISE(auto contents, sink->Finish());
+    return RecordBatchFileReader::Open(std::make_shared<io::BufferReader>(contents));
+  };
+
+  auto options = IpcWriteOptions::Defaults();
+  options.write_batch_statistics = true;
+  auto metadata = key_value_metadata({"key"}, {"value"});
+  ASSERT_OK_AND_ASSIGN(auto reader, write_file(options, metadata));
+  ASSERT_OK_AND_ASSIGN(auto statistics, reader->ReadBatchStatistics());
+  ASSERT_NE(statistics, nullptr);
+  ASSERT_EQ("value", reader->metadata()->Get("key").ValueOrDie());
+
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[3, 2]"),
+                    *statistics->GetColumnByName("num_rows"));
+  auto columns =
+      checked_pointer_cast<StructArray>(statistics->GetColumnByName("columns"));
+  // No statistics for the list column
+  ASSERT_EQ(3, columns->num_fields());
+  auto check_column = [&](const std::string& name,
+                          const std::shared_ptr<DataType>& type, const char* min,
+                          const char* max, const char* null_count) {
+    ARROW_SCOPED_TRACE("column ", name);
+    auto column = checked_pointer_cast<StructArray>(columns->GetFieldByName(name));
+    ASSERT_NE(column, nullptr);
+    AssertArraysEqual(*ArrayFromJSON(type, min), *column->GetFieldByName("min"));
+    AssertArraysEqual(*ArrayFromJSON(type, max), *column->GetFieldByName("max"));
+    AssertArraysEqual(*ArrayFromJSON(int64(), null_count),
+                      *column->GetFieldByName("null_count"));
+  };
+  check_column("i", int32(), "[1, null]", "[3, null]", "[1, 2]");
+  // NaN values yield no bounds
+  check_column("f", float64(), "[0.5, null]", "[1.5, null]", "[1, 0]");
+  check_column("s", utf8(), R"(["a", "y"])", R"(["b", "z"])", "[1, 0]");
+
+  // No statistics by default, and stale ones in the footer metadata are dropped
+  auto stale_metadata = reader->metadata();
+  ASSERT_OK_AND_ASSIGN(reader, write_file(IpcWriteOptions::Defaults(), stale_metadata));
+  ASSERT_OK_AND_ASSIGN(statistics, reader->ReadBatchStatistics());
+  ASSERT_EQ(statistics, nullptr);
+  ASSERT_EQ("value", reader->metadata()->Get("key").ValueOrDie());
+}
+
+TEST(TestIpcFileFormat, BatchStatisticsTruncation) {
+  auto schema = ::arrow::schema(
+      {field("s", utf8()), field("b", binary()), field("c", large_binary())});
+  // "é" is two bytes long in UTF-8
+  auto s = ArrayFromJSON(utf8(), R"(["aaaaa", "aaaéz", "bcéd"])");
+  std::shared_ptr<Array> b, c;
+  ArrayFromVector<BinaryType, std::string>({"aaaaa", "aa\xff\xffz", "aaa"}, &b);
+  ArrayFromVector<LargeBinaryType, std::string>({"\xff\xff\xff\xff\xff", "\xff", "\xff"},
+                                                &c);
+  auto batch = RecordBatch::Make(schema, 3, {s, b, c});
+
+  auto read_statistics = [&](int64_t truncate_length) -> std::shared_ptr<StructArray> {
+    auto options = IpcWriteOptions::Defaults();
+    options.write_batch_statistics = true;
+    options.batch_statistics_truncate_length = truncate_length;
+    EXPECT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+    EXPECT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink, schema, options));
+    ARROW_EXPECT_OK(writer->WriteRecordBatch(*batch));
+    ARROW_EXPECT_OK(writer->Close());
+    EXPECT_OK_AND_ASSIGN(auto contents, sink->Finish());
+    EXPECT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(
+                                          std::make_shared<io::BufferReader>(contents)));
+    EXPECT_OK_AND_ASSIGN(auto statistics, reader->ReadBatchStatistics());
+    return checked_pointer_cast<StructArray>(statistics->GetColumnByName("columns"));
+  };
+  auto check_column = [&](const std::shared_ptr<StructArray>& columns,
+                          const std::string& name, const std::string& min,
+                          const std::string& max) {
+    ARROW_SCOPED_TRACE("column ", name);
+    auto column = checked_pointer_cast<StructArray>(columns->GetFieldByName(name));
+    ASSERT_NE(column, nullptr);
+    ASSERT_OK_AND_ASSIGN(auto min_scalar, column->GetFieldByName("min")->GetScalar(0));
+    ASSERT_OK_AND_ASSIGN(auto max_scalar, column->GetFieldByName("max")->GetScalar(0));
+    ASSERT_EQ(min, checked_cast<const BaseBinaryScalar&>(*min_scalar).view());
+    ASSERT_EQ(max, checked_cast<const BaseBinaryScalar&>(*max_scalar).view());
+  };
+
+  // Short values aren't truncated
+  auto columns = read_statistics(/*truncate_length=*/16);
+  check_column(columns, "s", "aaaaa", "bc\xc3\xa9" "d");
+  check_column(columns, "b", "aaa", "aa\xff\xffz");
+  check_column(columns, "c", "\xff", "\xff\xff\xff\xff\xff");
+
+  // Truncation doesn't split UTF-8 characters, the maximum is rounded up by
+  // incrementing its last ASCII character or byte below 0xff, and kept in full
+  // if it can't be
+  columns = read_statistics(/*truncate_length=*/4);
+  check_column(columns, "s", "aaaa", "bd");
+  check_column(columns, "b", "aaa", "ab");
+  check_column(columns, "c", "\xff", "\xff\xff\xff\xff\xff");
+
+  columns = read_statistics(/*truncate_length=*/3);
+  check_column(columns, "s", "aaa", "bd");
+
+  // Truncation is disabled if not positive
+  columns = read_statistics(/*truncate_length=*/0);
+  check_column(columns, "s", "aaaaa", "bc\xc3\xa9" "d");
+  check_column(columns, "b", "aaa", "aa\xff\xffz");
+}
+
+TEST(TestIpcFileFormat, RecordBatchGeneratorIndices) {
+  auto schema = ::arrow::schema(
+      {field("i", int32()), field("d", dictionary(int8(), utf8()))});
+  RecordBatchVector batches;
+  for (int i = 0; i < 4; ++i) {
+    batches.push_back(RecordBatchFromJSON(
+        schema, "[[" + std::to_string(i) + R"(, "a"], [null, "b"]])"));
+  }
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink, schema));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto contents, sink->Finish());
+
+  for (bool coalesce : {false, true}) {
+    for (bool select_fields : {false, true}) {
+      ARROW_SCOPED_TRACE("coalesce = ", coalesce, ", select_fields = ", select_fields);
+      auto options = IpcReadOptions::Defaults();
+      if (select_fields) options.included_fields = {1};
+      auto buf_reader = std::make_shared<NoZeroCopyBufferReader>(contents);
+      ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(buf_reader, options));
+
+      ASSERT_OK_AND_ASSIGN(auto generator,
+                           reader->GetRecordBatchGenerator({3, 1}, coalesce));
+      ASSERT_FINISHES_OK_AND_ASSIGN(auto read_batches, CollectAsyncGenerator(generator));
+      ASSERT_EQ(2, read_batches.size());
+      for (size_t i = 0; i < read_batches.size(); ++i) {
+        auto expected = batches[i == 0 ? 3 : 1];
+        if (select_fields) {
+          ASSERT_OK_AND_ASSIGN(expected, expected->SelectColumns({1}));
+        }
+        AssertBatchesEqual(*expected, *read_batches[i]);
+      }
+
+      ASSERT_OK_AND_ASSIGN(generator, reader->GetRecordBatchGenerator({}, coalesce));
+      ASSERT_FINISHES_OK_AND_ASSIGN(read_batches, CollectAsyncGenerator(generator));
+      ASSERT_EQ(0, read_batches.size());
+
+      ASSERT_RAISES(IndexError, reader->GetRecordBatchGenerator({4}, coalesce));
+    }
+  }
+}
+
 TEST_F(TestWriteRecordBatch, RawAndSerializedSizes) {
   // ARROW-8823: Recording total raw and serialized record batch sizes in WriteStats
   FileWriterHelper helper;
@@ -2198,6 +2603,70 @@ TEST(TestRecordBatchStreamReader, MalformedInput) {
   ASSERT_RAISES(Invalid, RecordBatchStreamReader::Open(&garbage_reader));
 }
 
+TEST(TestAsyncStreamWriter, RoundTrip) {
+  constexpr int kNumBatches = 20;
+  RecordBatchVector batches;
+  for (int i = 0; i < kNumBatches; ++i) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(MakeIntBatchSized(100 + i, &batch));
+    batches.push_back(batch);
+  }
+  auto schema = batches[0]->schema();
+  auto metadata = key_value_metadata({"key"}, {"value"});
+
+  for (bool compress : {false, true}) {
+    auto options = IpcWriteOptions::Defaults();
+    if (compress) {
+      if (!util::Codec::IsAvailable(Compression::ZSTD)) {
+        continue;
+      }
+      ASSERT_OK_AND_ASSIGN(options.codec, util::Codec::Create(Compression::ZSTD));
+    }
+    ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+    ASSERT_OK_AND_ASSIGN(auto writer, MakeAsyncStreamWriter(sink, schema, options,
+                                                            /*max_queued_batches=*/2));
+    for (const auto& batch : batches) {
+      ASSERT_FINISHES_OK(writer->WriteRecordBatch(batch, metadata));
+    }
+    ASSERT_FINISHES_OK(writer->Close());
+    ASSERT_RAISES(Invalid, writer->WriteRecordBatch(batches[0]).status());
+    ASSERT_EQ(writer->stats().num_record_batches, kNumBatches);
+
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+    ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchStreamReader::Open(
+                                          std::make_shared<io::BufferReader>(buffer)));
+    for (const auto& batch : batches) {
+      ASSERT_OK_AND_ASSIGN(auto batch_with_metadata, reader->ReadNext());
+      ASSERT_NE(batch_with_metadata.batch, nullptr);
+      AssertBatchesEqual(*batch, *batch_with_metadata.batch);
+      ASSERT_TRUE(batch_with_metadata.custom_metadata->Equals(*metadata));
+    }
+    ASSERT_OK_AND_ASSIGN(auto end, reader->ReadNext());
+    ASSERT_EQ(end.batch, nullptr);
+  }
+}
+
+TEST(TestAsyncStreamWriter, SinkError) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK(sink->Close());
+
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       MakeAsyncStreamWriter(sink, batch->schema(),
+                                             IpcWriteOptions::Defaults(),
+                                             /*max_queued_batches=*/1));
+  // The error surfaces through the future of the first batch, which has to wait
+  // for it to be written
+  ASSERT_FINISHES_AND_RAISES(IOError, writer->WriteRecordBatch(batch));
+  ASSERT_RAISES(IOError, writer->WriteRecordBatch(batch).status());
+  ASSERT_FINISHES_AND_RAISES(IOError, writer->Close());
+
+  ASSERT_RAISES(Invalid,
+                MakeAsyncStreamWriter(sink, batch->schema(), IpcWriteOptions::Defaults(),
+                                      /*max_queued_batches=*/0));
+}
+
 class EndlessCollectListener : public CollectListener {
  public:
   EndlessCollectListener() : CollectListener(), decoder_(nullptr) {}
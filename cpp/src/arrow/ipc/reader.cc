@@ -47,6 +47,7 @@
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/base64.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
@@ -132,6 +133,10 @@ struct IpcReadContext {
 
   Compression::type compression;
 
+  /// \brief Codec to decompress body buffers with, if it matches the compression
+  /// of the message. Used for codecs carrying stream state, e.g. a zstd dictionary.
+  util::Codec* codec = NULLPTR;
+
   /// \brief LoadRecordBatch() or LoadRecordBatchSubset() swaps endianness of elements
   /// if this flag is true
   const bool swap_endian;
@@ -544,7 +549,7 @@ Result<std::shared_ptr<Buffer>> DecompressBuffer(const std::shared_ptr<Buffer>&
 }
 
 Status DecompressBuffers(Compression::type compression, const IpcReadOptions& options,
-                         ArrayDataVector* fields) {
+                         ArrayDataVector* fields, util::Codec* codec = NULLPTR) {
   struct BufferAccumulator {
     using BufferPtrVector = std::vector<std::shared_ptr<Buffer>*>;
 
@@ -568,13 +573,15 @@ Status DecompressBuffers(Compression::type compression, const IpcReadOptions& op
   // Flatten all buffers
   auto buffers = BufferAccumulator{}.Get(*fields);
 
-  std::unique_ptr<util::Codec> codec;
-  ARROW_ASSIGN_OR_RAISE(codec, util::Codec::Create(compression));
+  std::unique_ptr<util::Codec> owned_codec;
+  if (codec == nullptr || codec->compression_type() != compression) {
+    ARROW_ASSIGN_OR_RAISE(owned_codec, util::Codec::Create(compression));
+    codec = owned_codec.get();
+  }
 
   return ::arrow::internal::OptionalParallelFor(
       options.use_threads, static_cast<int>(buffers.size()), [&](int i) {
-        ARROW_ASSIGN_OR_RAISE(*buffers[i],
-                              DecompressBuffer(*buffers[i], options, codec.get()));
+        ARROW_ASSIGN_OR_RAISE(*buffers[i], DecompressBuffer(*buffers[i], options, codec));
         return Status::OK();
       });
 }
@@ -624,8 +631,8 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
     filtered_columns = std::move(columns);
   }
   if (context.compression != Compression::UNCOMPRESSED) {
-    RETURN_NOT_OK(
-        DecompressBuffers(context.compression, context.options, &filtered_columns));
+    RETURN_NOT_OK(DecompressBuffers(context.compression, context.options,
+                                    &filtered_columns, context.codec));
   }
 
   // swap endian in a set of ArrayData if necessary (swap_endian == true)
@@ -840,7 +847,8 @@ Status ReadDictionary(const Buffer& metadata, const IpcReadContext& context,
 
   if (compression != Compression::UNCOMPRESSED) {
     ArrayDataVector dict_fields{dict_data};
-    RETURN_NOT_OK(DecompressBuffers(compression, context.options, &dict_fields));
+    RETURN_NOT_OK(
+        DecompressBuffers(compression, context.options, &dict_fields, context.codec));
   }
 
   // swap endian in dict_data if necessary (swap_endian == true)
@@ -1014,20 +1022,50 @@ class StreamDecoderInternal : public MessageDecoderListener {
     } else {
       CHECK_HAS_BODY(*message);
       ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+      const bool has_zstd_dictionary =
+          message->custom_metadata() != nullptr &&
+          message->custom_metadata()->Contains(internal::kZstdDictionaryKey);
+      if (has_zstd_dictionary) {
+        RETURN_NOT_OK(LoadZstdDictionary(*message->custom_metadata()));
+      }
       IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
+      context.codec = zstd_dictionary_codec_.get();
       ARROW_ASSIGN_OR_RAISE(
           auto batch_with_metadata,
           ReadRecordBatchInternal(*message->metadata(), schema_, field_inclusion_mask_,
                                   context, reader.get()));
+      if (has_zstd_dictionary) {
+        // The dictionary is a property of the stream, not of the record batch
+        auto custom_metadata = batch_with_metadata.custom_metadata->Copy();
+        RETURN_NOT_OK(custom_metadata->Delete(internal::kZstdDictionaryKey));
+        batch_with_metadata.custom_metadata = std::move(custom_metadata);
+      }
       ++stats_.num_record_batches;
       return listener_->OnRecordBatchWithMetadataDecoded(batch_with_metadata);
     }
   }
 
+  // Load the zstd dictionary sent by the writer (see
+  // IpcWriteOptions::zstd_dictionary_training_batches); it applies to all
+  // following messages of the stream
+  Status LoadZstdDictionary(const KeyValueMetadata& custom_metadata) {
+    ARROW_ASSIGN_OR_RAISE(auto encoded,
+                          custom_metadata.Get(internal::kZstdDictionaryKey));
+    util::ZstdCodecOptions codec_options;
+    codec_options.dictionary = Buffer::FromString(util::base64_decode(encoded));
+    if (codec_options.dictionary->size() == 0) {
+      return Status::Invalid("Invalid zstd dictionary in IPC stream");
+    }
+    ARROW_ASSIGN_OR_RAISE(zstd_dictionary_codec_,
+                          util::Codec::Create(Compression::ZSTD, codec_options));
+    return Status::OK();
+  }
+
   // Read dictionary from dictionary batch
   Status ReadDictionary(const Message& message) {
     DictionaryKind kind;
     IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
+    context.codec = zstd_dictionary_codec_.get();
     RETURN_NOT_OK(::arrow::ipc::ReadDictionary(message, context, &kind));
     ++stats_.num_dictionary_batches;
     switch (kind) {
@@ -1054,6 +1092,8 @@ class StreamDecoderInternal : public MessageDecoderListener {
   std::shared_ptr<Schema> filtered_schema_;
   ReadStats stats_;
   bool swap_endian_;
+  // Codec with the zstd dictionary of the stream, if any
+  std::shared_ptr<util::Codec> zstd_dictionary_codec_;
 };
 
 // ----------------------------------------------------------------------
@@ -1196,16 +1236,17 @@ class RecordBatchFileReaderImpl;
 
 /// A generator of record batches.
 ///
-/// All batches are yielded in order.
+/// The batches at the given indices are yielded in order.
 class ARROW_EXPORT WholeIpcFileRecordBatchGenerator {
  public:
   using Item = std::shared_ptr<RecordBatch>;
 
   explicit WholeIpcFileRecordBatchGenerator(
-      std::shared_ptr<RecordBatchFileReaderImpl> state,
+      std::shared_ptr<RecordBatchFileReaderImpl> state, std::vector<int> indices,
       std::shared_ptr<io::internal::ReadRangeCache> cached_source,
       const io::IOContext& io_context, arrow::internal::Executor* executor)
       : state_(std::move(state)),
+        indices_(std::move(indices)),
         cached_source_(std::move(cached_source)),
         io_context_(io_context),
         executor_(executor),
@@ -1222,6 +1263,7 @@ class ARROW_EXPORT WholeIpcFileRecordBatchGenerator {
 
  private:
   std::shared_ptr<RecordBatchFileReaderImpl> state_;
+  std::vector<int> indices_;
   std::shared_ptr<io::internal::ReadRangeCache> cached_source_;
   io::IOContext io_context_;
   arrow::internal::Executor* executor_;
@@ -1233,20 +1275,21 @@ class ARROW_EXPORT WholeIpcFileRecordBatchGenerator {
 /// A generator of record batches for use when reading
 /// a subset of columns from the file.
 ///
-/// All batches are yielded in order.
+/// The batches at the given indices are yielded in order.
 class ARROW_EXPORT SelectiveIpcFileRecordBatchGenerator {
  public:
   using Item = std::shared_ptr<RecordBatch>;
 
   explicit SelectiveIpcFileRecordBatchGenerator(
-      std::shared_ptr<RecordBatchFileReaderImpl> state)
-      : state_(std::move(state)), index_(0) {}
+      std::shared_ptr<RecordBatchFileReaderImpl> state, std::vector<int> indices)
+      : state_(std::move(state)), indices_(std::move(indices)), index_(0) {}
 
   Future<Item> operator()();
 
  private:
   std::shared_ptr<RecordBatchFileReaderImpl> state_;
-  int index_;
+  std::vector<int> indices_;
+  size_t index_;
 };
 
 class RecordBatchFileReaderImpl : public RecordBatchFileReader {
@@ -1257,6 +1300,10 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return static_cast<int>(internal::FlatBuffersVectorSize(footer_->recordBatches()));
   }
 
+  int num_dictionaries() const override {
+    return static_cast<int>(internal::FlatBuffersVectorSize(footer_->dictionaries()));
+  }
+
   MetadataVersion version() const override {
     return internal::GetMetadataVersion(footer_->version());
   }
@@ -1350,6 +1397,26 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return batch_with_metadata;
   }
 
+  Result<std::unique_ptr<Message>> ReadRecordBatchMessage(int i) override {
+    if (i < 0 || i >= num_record_batches()) {
+      return Status::IndexError("Record batch index ", i, " out of bounds");
+    }
+    ARROW_ASSIGN_OR_RAISE(auto message, ReadMessageFromBlock(GetRecordBatchBlock(i)));
+    CHECK_MESSAGE_TYPE(MessageType::RECORD_BATCH, message->type());
+    CHECK_HAS_BODY(*message);
+    return std::move(message);
+  }
+
+  Result<std::unique_ptr<Message>> ReadDictionaryMessage(int i) override {
+    if (i < 0 || i >= num_dictionaries()) {
+      return Status::IndexError("Dictionary batch index ", i, " out of bounds");
+    }
+    ARROW_ASSIGN_OR_RAISE(auto message, ReadMessageFromBlock(GetDictionaryBlock(i)));
+    CHECK_MESSAGE_TYPE(MessageType::DICTIONARY_BATCH, message->type());
+    CHECK_HAS_BODY(*message);
+    return std::move(message);
+  }
+
   Result<int64_t> CountRows() override {
     int64_t total = 0;
     for (int i = 0; i < num_record_batches(); i++) {
@@ -1439,6 +1506,20 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
       const bool coalesce, const io::IOContext& io_context,
       const io::CacheOptions cache_options,
       arrow::internal::Executor* executor) override {
+    return GetRecordBatchGenerator(AllIndices(), coalesce, io_context, cache_options,
+                                   executor);
+  }
+
+  Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> GetRecordBatchGenerator(
+      std::vector<int> indices, const bool coalesce, const io::IOContext& io_context,
+      const io::CacheOptions cache_options,
+      arrow::internal::Executor* executor) override {
+    for (int index : indices) {
+      if (index < 0 || index >= num_record_batches()) {
+        return Status::IndexError("Record batch index ", index, " out of bounds");
+      }
+    }
+    const bool all_batches = static_cast<int>(indices.size()) == num_record_batches();
     auto state = std::dynamic_pointer_cast<RecordBatchFileReaderImpl>(shared_from_this());
     // Prebuffering causes us to use a lot of futures which, at the moment,
     // can only slow things down when we are doing zero-copy in-memory reads.
@@ -1449,21 +1530,39 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     if (options_.included_fields.size() != 0 &&
         options_.included_fields.size() != schema_->fields().size() &&
         !file_->supports_zero_copy()) {
-      RETURN_NOT_OK(state->PreBufferMetadata({}));
-      return SelectiveIpcFileRecordBatchGenerator(std::move(state));
+      if (!indices.empty()) {
+        RETURN_NOT_OK(state->DoPreBufferMetadata(indices));
+      }
+      return SelectiveIpcFileRecordBatchGenerator(std::move(state), std::move(indices));
     }
 
     std::shared_ptr<io::internal::ReadRangeCache> cached_source;
     if (coalesce && !file_->supports_zero_copy()) {
       if (!owned_file_) return Status::Invalid("Cannot coalesce without an owned file");
-      // Since the user is asking for all fields then we can cache the entire
-      // file (up to the footer)
       cached_source = std::make_shared<io::internal::ReadRangeCache>(file_, io_context,
                                                                      cache_options);
-      RETURN_NOT_OK(cached_source->Cache({{0, footer_offset_}}));
+      if (all_batches) {
+        // Since the user is asking for all fields and batches then we can cache
+        // the entire file (up to the footer)
+        RETURN_NOT_OK(cached_source->Cache({{0, footer_offset_}}));
+      } else {
+        // Otherwise only cache the dictionaries and the requested batches, and let
+        // the cache coalesce them
+        std::vector<io::ReadRange> ranges;
+        for (int i = 0; i < num_dictionaries(); ++i) {
+          FileBlock block = GetDictionaryBlock(i);
+          ranges.push_back({block.offset, block.metadata_length + block.body_length});
+        }
+        for (int index : indices) {
+          FileBlock block = GetRecordBatchBlock(index);
+          ranges.push_back({block.offset, block.metadata_length + block.body_length});
+        }
+        RETURN_NOT_OK(cached_source->Cache(std::move(ranges)));
+      }
     }
-    return WholeIpcFileRecordBatchGenerator(std::move(state), std::move(cached_source),
-                                            io_context, executor);
+    return WholeIpcFileRecordBatchGenerator(std::move(state), std::move(indices),
+                                            std::move(cached_source), io_context,
+                                            executor);
   }
 
   Status DoPreBufferMetadata(const std::vector<int>& indices) {
@@ -1839,10 +1938,6 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
         });
   }
 
-  int num_dictionaries() const {
-    return static_cast<int>(internal::FlatBuffersVectorSize(footer_->dictionaries()));
-  }
-
   io::RandomAccessFile* file_;
   IpcReadOptions options_;
   std::vector<bool> field_inclusion_mask_;
@@ -1945,13 +2040,33 @@ Result<std::shared_ptr<Table>> RecordBatchFileReader::ToTable() {
   return Table::FromRecordBatches(schema(), std::move(batches));
 }
 
+Result<std::shared_ptr<RecordBatch>> RecordBatchFileReader::ReadBatchStatistics() {
+  auto footer_metadata = metadata();
+  const int index =
+      footer_metadata ? footer_metadata->FindKey(internal::kBatchStatisticsKey) : -1;
+  if (index < 0) {
+    return nullptr;
+  }
+  auto serialized =
+      Buffer::FromString(util::base64_decode(footer_metadata->value(index)));
+  ARROW_ASSIGN_OR_RAISE(auto reader, RecordBatchStreamReader::Open(
+                                         std::make_shared<io::BufferReader>(serialized)));
+  ARROW_ASSIGN_OR_RAISE(auto batches, reader->ToRecordBatches());
+  const auto& schema = *reader->schema();
+  if (batches.size() != 1 || batches[0]->num_rows() != num_record_batches() ||
+      schema.num_fields() != 2 || schema.field(0)->type()->id() != Type::INT64 ||
+      schema.field(1)->type()->id() != Type::STRUCT) {
+    return Status::Invalid("Invalid batch statistics in IPC file footer");
+  }
+  return batches[0];
+}
+
 Future<SelectiveIpcFileRecordBatchGenerator::Item>
 SelectiveIpcFileRecordBatchGenerator::operator()() {
-  int index = index_++;
-  if (index >= state_->num_record_batches()) {
+  if (index_ >= indices_.size()) {
     return IterationEnd<SelectiveIpcFileRecordBatchGenerator::Item>();
   }
-  return state_->ReadRecordBatchAsync(index);
+  return state_->ReadRecordBatchAsync(indices_[index_++]);
 }
 
 Future<WholeIpcFileRecordBatchGenerator::Item>
@@ -1973,10 +2088,11 @@ WholeIpcFileRecordBatchGenerator::operator()() {
           return ReadDictionaries(state.get(), std::move(messages));
         });
   }
-  if (index_ >= state_->num_record_batches()) {
+  if (index_ >= static_cast<int>(indices_.size())) {
     return Future<Item>::MakeFinished(IterationTraits<Item>::End());
   }
-  auto block = FileBlockFromFlatbuffer(state->footer_->recordBatches()->Get(index_++));
+  auto block =
+      FileBlockFromFlatbuffer(state->footer_->recordBatches()->Get(indices_[index_++]));
   auto read_message = ReadBlock(block);
   auto read_messages = read_dictionaries_.Then([read_message]() { return read_message; });
   // Force transfer. This may be wasteful in some cases, but ensures we get off the
@@ -197,6 +197,31 @@ class ARROW_EXPORT RecordBatchFileReader
   /// \return a struct containing the read batch and its custom metadata
   virtual Result<RecordBatchWithMetadata> ReadRecordBatchWithCustomMetadata(int i) = 0;
 
+  /// \brief Returns the number of dictionary batches in the file
+  virtual int num_dictionaries() const = 0;
+
+  /// \brief Read the encapsulated IPC message of a particular record batch
+  /// without decoding it.
+  ///
+  /// The message is returned as it is laid out in the file, including any
+  /// buffer compression; field selection and endianness conversion from the
+  /// IpcReadOptions are not applied. Does not copy memory if the input source
+  /// supports zero-copy.
+  ///
+  /// \param[in] i the index of the record batch to return
+  /// \return the encapsulated message
+  virtual Result<std::unique_ptr<Message>> ReadRecordBatchMessage(int i) = 0;
+
+  /// \brief Read the encapsulated IPC message of a particular dictionary batch
+  /// without decoding it.
+  ///
+  /// Dictionary batches are numbered in file order. As with
+  /// ReadRecordBatchMessage, the message is returned as laid out in the file.
+  ///
+  /// \param[in] i the index of the dictionary batch to return
+  /// \return the encapsulated message
+  virtual Result<std::unique_ptr<Message>> ReadDictionaryMessage(int i) = 0;
+
   /// \brief Return current read statistics
   virtual ReadStats stats() const = 0;
 
@@ -230,11 +255,46 @@ class ARROW_EXPORT RecordBatchFileReader
       const io::CacheOptions cache_options = io::CacheOptions::LazyDefaults(),
       arrow::internal::Executor* executor = NULLPTR) = 0;
 
+  /// \brief Get a reentrant generator of the record batches at the given indices.
+  ///
+  /// The batches are yielded in the order of the indices. Only the selected
+  /// batches (and the dictionaries) are read from the file.
+  ///
+  /// \param[in] indices The indices of the record batches to read.
+  /// \param[in] coalesce If true, enable I/O coalescing.
+  /// \param[in] io_context The IOContext to use (controls which thread pool
+  ///     is used for I/O).
+  /// \param[in] cache_options Options for coalescing (if enabled).
+  /// \param[in] executor Optionally, an executor to use for decoding record
+  ///     batches.
+  virtual Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> GetRecordBatchGenerator(
+      std::vector<int> indices, const bool coalesce = false,
+      const io::IOContext& io_context = io::default_io_context(),
+      const io::CacheOptions cache_options = io::CacheOptions::LazyDefaults(),
+      arrow::internal::Executor* executor = NULLPTR) = 0;
+
   /// \brief Collect all batches as a vector of record batches
   Result<RecordBatchVector> ToRecordBatches();
 
   /// \brief Collect all batches and concatenate as arrow::Table
   Result<std::shared_ptr<Table>> ToTable();
+
+  /// \brief Read the per-batch statistics stored in the file footer
+  ///
+  /// See IpcWriteOptions::write_batch_statistics. The returned record batch
+  /// has one row per record batch of the file, and two columns:
+  /// - "num_rows" (int64): the number of rows of the record batch
+  /// - "columns" (struct): one field per column with statistics, named after
+  ///   the column, of type struct<min: T, max: T, null_count: int64> where T
+  ///   is the column type. min and max are null if the column has no non-null
+  ///   values or contains NaNs.
+  ///
+  /// min and max of binary and string columns may be truncated (see
+  /// IpcWriteOptions::batch_statistics_truncate_length), in which case they are
+  /// bounds rather than actual values.
+  ///
+  /// \return the statistics, or null if the file has none
+  Result<std::shared_ptr<RecordBatch>> ReadBatchStatistics();
 };
 
 /// \brief A general listener class to receive events.
@@ -18,19 +18,27 @@
 #include "arrow/ipc/writer.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <iomanip>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/builder_base.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
 #include "arrow/buffer.h"
 #include "arrow/device.h"
 #include "arrow/extension_type.h"
@@ -47,15 +55,19 @@
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/base64.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/endian.h"
+#include "arrow/util/future.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/parallel.h"
+#include "arrow/util/stopwatch.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visit_array_inline.h"
 #include "arrow/visit_data_inline.h"
 #include "arrow/visit_type_inline.h"
@@ -128,14 +140,182 @@ static inline bool NeedTruncate(int64_t offset, const Buffer* buffer,
   return offset != 0 || min_length < buffer->size();
 }
 
+// Selects the codec for the body buffers of each top-level column of record
+// batches, following IpcWriteOptions::field_codecs and adaptive_compression.
+// Adaptive decisions are made once per column and reused for later batches.
+class ColumnCompressor {
+ public:
+  static bool IsNeeded(const IpcWriteOptions& options) {
+    return options.codec != nullptr &&
+           (!options.field_codecs.empty() || options.adaptive_compression);
+  }
+
+  static Result<std::unique_ptr<ColumnCompressor>> Make(const Schema& schema,
+                                                        const IpcWriteOptions& options) {
+    DCHECK(IsNeeded(options));
+    std::vector<std::shared_ptr<util::Codec>> codecs(schema.num_fields(), options.codec);
+    for (const auto& [name, codec] : options.field_codecs) {
+      if (codec != nullptr &&
+          codec->compression_type() != options.codec->compression_type()) {
+        return Status::Invalid("Codec for field '", name, "' (", codec->name(),
+                               ") doesn't match the IPC codec (", options.codec->name(),
+                               ")");
+      }
+      auto indices = schema.GetAllFieldIndices(name);
+      if (indices.empty()) {
+        return Status::Invalid("field_codecs refers to unknown field '", name, "'");
+      }
+      for (int i : indices) {
+        codecs[i] = codec;
+      }
+    }
+    if (options.adaptive_compression_min_throughput < 0) {
+      return Status::Invalid("adaptive_compression_min_throughput must be non-negative");
+    }
+    return std::unique_ptr<ColumnCompressor>(
+        new ColumnCompressor(std::move(codecs), options));
+  }
+
+  /// Return the codec for the given column, or null to leave it uncompressed
+  Result<util::Codec*> GetCodec(int column,
+                                const std::shared_ptr<Buffer>* buffers,
+                                int64_t num_buffers) {
+    util::Codec* codec = codecs_[column].get();
+    if (codec == nullptr || !adaptive_) return codec;
+    if (!compress_[column].has_value()) {
+      ARROW_ASSIGN_OR_RAISE(compress_[column],
+                            SampleCompression(codec, buffers, num_buffers));
+      // An empty sample can't tell, keep compressing until data shows up
+      if (!compress_[column].has_value()) return codec;
+    }
+    return *compress_[column] ? codec : nullptr;
+  }
+
+ private:
+  // Upper bound on the number of bytes of each buffer compressed for sampling
+  static constexpr int64_t kSampleSize = 64 * 1024;
+
+  ColumnCompressor(std::vector<std::shared_ptr<util::Codec>> codecs,
+                   const IpcWriteOptions& options)
+      : codecs_(std::move(codecs)),
+        compress_(codecs_.size()),
+        adaptive_(options.adaptive_compression),
+        min_space_savings_(options.min_space_savings.value_or(0.1)),
+        min_throughput_(options.adaptive_compression_min_throughput),
+        pool_(options.memory_pool) {}
+
+  Result<std::optional<bool>> SampleCompression(util::Codec* codec,
+                                                const std::shared_ptr<Buffer>* buffers,
+                                                int64_t num_buffers) {
+    int64_t uncompressed_size = 0;
+    int64_t compressed_size = 0;
+    uint64_t elapsed_ns = 0;
+    std::unique_ptr<ResizableBuffer> scratch;
+    for (int64_t i = 0; i < num_buffers; ++i) {
+      if (buffers[i] == nullptr || buffers[i]->size() == 0) continue;
+      const int64_t size = std::min(buffers[i]->size(), kSampleSize);
+      const uint8_t* data = buffers[i]->data();
+      const int64_t max_length = codec->MaxCompressedLen(size, data);
+      if (scratch == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(scratch, AllocateResizableBuffer(max_length, pool_));
+      } else {
+        RETURN_NOT_OK(scratch->Resize(max_length, /*shrink_to_fit=*/false));
+      }
+      ::arrow::internal::StopWatch watch;
+      watch.Start();
+      ARROW_ASSIGN_OR_RAISE(
+          auto length, codec->Compress(size, data, max_length, scratch->mutable_data()));
+      elapsed_ns += watch.Stop();
+      uncompressed_size += size;
+      compressed_size += length;
+    }
+    if (uncompressed_size == 0) return std::nullopt;
+
+    const double space_savings =
+        1.0 - static_cast<double>(compressed_size) / uncompressed_size;
+    if (space_savings < min_space_savings_) return false;
+    if (min_throughput_ > 0 && elapsed_ns > 0) {
+      const double throughput = uncompressed_size * 1e9 / elapsed_ns;
+      if (throughput < min_throughput_) return false;
+    }
+    return true;
+  }
+
+  std::vector<std::shared_ptr<util::Codec>> codecs_;
+  // Cached adaptive decision for each column
+  std::vector<std::optional<bool>> compress_;
+  bool adaptive_;
+  double min_space_savings_;
+  double min_throughput_;
+  MemoryPool* pool_;
+};
+
+// Samples the buffers of the first record batches of an IPC stream to train a
+// zstd dictionary (see IpcWriteOptions::zstd_dictionary_training_batches)
+class ZstdDictionaryTrainer {
+ public:
+  static bool IsNeeded(const IpcWriteOptions& options, bool is_file_format) {
+    return !is_file_format && options.zstd_dictionary_training_batches > 0 &&
+           options.codec != nullptr &&
+           options.codec->compression_type() == Compression::ZSTD;
+  }
+
+  explicit ZstdDictionaryTrainer(int64_t max_dictionary_size)
+      : max_dictionary_size_(max_dictionary_size) {}
+
+  void Sample(const RecordBatch& batch) {
+    for (const auto& column : batch.column_data()) {
+      Sample(*column);
+    }
+  }
+
+  // Return the trained dictionary, or null if training failed
+  std::shared_ptr<Buffer> Train() {
+    auto maybe_dictionary = util::TrainZstdDictionary(samples_, max_dictionary_size_);
+    if (!maybe_dictionary.ok()) {
+      ARROW_LOG(DEBUG) << "Not using a zstd dictionary: "
+                       << maybe_dictionary.status().ToString();
+      return nullptr;
+    }
+    return maybe_dictionary.MoveValueUnsafe();
+  }
+
+ private:
+  // Bounds on the size of a single sample and of all samples, the latter
+  // following the zstd recommendation of ~100x the dictionary size
+  static constexpr int64_t kMaxSampleSize = 64 * 1024;
+  static constexpr int64_t kSampleToDictionaryRatio = 100;
+
+  void Sample(const ArrayData& data) {
+    for (const auto& buffer : data.buffers) {
+      if (buffer == nullptr || buffer->size() == 0) continue;
+      const int64_t size = std::min(buffer->size(), kMaxSampleSize);
+      if (sampled_size_ + size > max_dictionary_size_ * kSampleToDictionaryRatio) {
+        return;
+      }
+      samples_.push_back(SliceBuffer(buffer, 0, size));
+      sampled_size_ += size;
+    }
+    for (const auto& child : data.child_data) {
+      Sample(*child);
+    }
+  }
+
+  const int64_t max_dictionary_size_;
+  std::vector<std::shared_ptr<Buffer>> samples_;
+  int64_t sampled_size_ = 0;
+};
+
 class RecordBatchSerializer {
  public:
   RecordBatchSerializer(int64_t buffer_start_offset,
                         const std::shared_ptr<const KeyValueMetadata>& custom_metadata,
-                        const IpcWriteOptions& options, IpcPayload* out)
+                        const IpcWriteOptions& options, IpcPayload* out,
+                        ColumnCompressor* compressor = NULLPTR)
       : out_(out),
         custom_metadata_(custom_metadata),
         options_(options),
+        compressor_(compressor),
         max_recursion_depth_(options.max_recursion_depth),
         buffer_start_offset_(buffer_start_offset) {
     DCHECK_GT(max_recursion_depth_, 0);
@@ -190,6 +370,19 @@ class RecordBatchSerializer {
 
   Status CompressBuffer(const Buffer& buffer, util::Codec* codec,
                         std::shared_ptr<Buffer>* out) {
+    if (codec == nullptr) {
+      // Leave the body uncompressed, a size of -1 indicates this to the reader
+      ARROW_ASSIGN_OR_RAISE(
+          auto result,
+          AllocateResizableBuffer(buffer.size() + sizeof(int64_t), options_.memory_pool));
+      *reinterpret_cast<int64_t*>(result->mutable_data()) = bit_util::ToLittleEndian(-1);
+      std::memcpy(result->mutable_data() + sizeof(int64_t), buffer.data(),
+                  static_cast<size_t>(buffer.size()));
+      result->ZeroPadding();
+      *out = std::move(result);
+      return Status::OK();
+    }
+
     // Convert buffer to uncompressed-length-prefixed buffer. The actual body may or may
     // not be compressed, depending on user-preference and projected size reduction.
     int64_t maximum_length = codec->MaxCompressedLen(buffer.size(), buffer.data());
@@ -229,14 +422,30 @@ class RecordBatchSerializer {
     return Status::OK();
   }
 
-  Status CompressBodyBuffers() {
+  Status CompressBodyBuffers(const std::vector<size_t>& column_buffer_offsets) {
     RETURN_NOT_OK(
         internal::CheckCompressionSupported(options_.codec->compression_type()));
 
+    // Resolve the codec of each body buffer from the column it belongs to
+    std::vector<util::Codec*> codecs(out_->body_buffers.size(), options_.codec.get());
+    if (compressor_ != nullptr) {
+      for (size_t i = 0; i < column_buffer_offsets.size(); ++i) {
+        const size_t begin = column_buffer_offsets[i];
+        const size_t end = i + 1 < column_buffer_offsets.size()
+                               ? column_buffer_offsets[i + 1]
+                               : out_->body_buffers.size();
+        ARROW_ASSIGN_OR_RAISE(
+            auto codec, compressor_->GetCodec(static_cast<int>(i),
+                                              out_->body_buffers.data() + begin,
+                                              static_cast<int64_t>(end - begin)));
+        std::fill(codecs.begin() + begin, codecs.begin() + end, codec);
+      }
+    }
+
     auto CompressOne = [&](size_t i) {
       if (out_->body_buffers[i]->size() > 0) {
-        RETURN_NOT_OK(CompressBuffer(*out_->body_buffers[i], options_.codec.get(),
-                                     &out_->body_buffers[i]));
+        RETURN_NOT_OK(
+            CompressBuffer(*out_->body_buffers[i], codecs[i], &out_->body_buffers[i]));
       }
       return Status::OK();
     };
@@ -253,7 +462,9 @@ class RecordBatchSerializer {
     }
 
     // Perform depth-first traversal of the row-batch
+    std::vector<size_t> column_buffer_offsets(batch.num_columns());
     for (int i = 0; i < batch.num_columns(); ++i) {
+      column_buffer_offsets[i] = out_->body_buffers.size();
       RETURN_NOT_OK(VisitArray(*batch.column(i)));
     }
 
@@ -275,7 +486,7 @@ class RecordBatchSerializer {
               std::setprecision(std::numeric_limits<double>::max_digits10), percentage);
         }
       }
-      RETURN_NOT_OK(CompressBodyBuffers());
+      RETURN_NOT_OK(CompressBodyBuffers(column_buffer_offsets));
     }
 
     // The position for the start of a buffer relative to the passed frame of
@@ -701,6 +912,7 @@ class RecordBatchSerializer {
   std::vector<int64_t> variadic_counts_;
 
   const IpcWriteOptions& options_;
+  ColumnCompressor* compressor_;
   int64_t max_recursion_depth_;
   int64_t buffer_start_offset_;
 };
@@ -794,21 +1006,42 @@ Status GetRecordBatchPayload(const RecordBatch& batch, const IpcWriteOptions& op
   return GetRecordBatchPayload(batch, NULLPTR, options, out);
 }
 
-Status GetRecordBatchPayload(
+namespace {
+
+Status AssembleRecordBatchPayload(
     const RecordBatch& batch,
     const std::shared_ptr<const KeyValueMetadata>& custom_metadata,
-    const IpcWriteOptions& options, IpcPayload* out) {
+    const IpcWriteOptions& options, ColumnCompressor* compressor, IpcPayload* out) {
   out->type = MessageType::RECORD_BATCH;
   RecordBatchSerializer assembler(/*buffer_start_offset=*/0, custom_metadata, options,
-                                  out);
+                                  out, compressor);
   return assembler.Assemble(batch);
 }
 
+}  // namespace
+
+Status GetRecordBatchPayload(
+    const RecordBatch& batch,
+    const std::shared_ptr<const KeyValueMetadata>& custom_metadata,
+    const IpcWriteOptions& options, IpcPayload* out) {
+  std::unique_ptr<ColumnCompressor> compressor;
+  if (ColumnCompressor::IsNeeded(options)) {
+    ARROW_ASSIGN_OR_RAISE(compressor, ColumnCompressor::Make(*batch.schema(), options));
+  }
+  return AssembleRecordBatchPayload(batch, custom_metadata, options, compressor.get(),
+                                    out);
+}
+
 Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
                         io::OutputStream* dst, int32_t* metadata_length,
                         int64_t* body_length, const IpcWriteOptions& options) {
+  std::unique_ptr<ColumnCompressor> compressor;
+  if (ColumnCompressor::IsNeeded(options)) {
+    ARROW_ASSIGN_OR_RAISE(compressor, ColumnCompressor::Make(*batch.schema(), options));
+  }
   IpcPayload payload;
-  RecordBatchSerializer assembler(buffer_start_offset, NULLPTR, options, &payload);
+  RecordBatchSerializer assembler(buffer_start_offset, NULLPTR, options, &payload,
+                                  compressor.get());
   RETURN_NOT_OK(assembler.Assemble(batch));
 
   // TODO: it's a rough edge that the metadata and body length here are
@@ -1152,23 +1385,245 @@ IpcPayloadWriter::~IpcPayloadWriter() {}
 
 Status IpcPayloadWriter::Start() { return Status::OK(); }
 
+namespace {
+
+template <typename T>
+using has_batch_statistics = std::integral_constant<
+    bool, (has_c_type<T>::value && !is_interval_type<T>::value &&
+           !std::is_same<T, HalfFloatType>::value) ||
+              is_base_binary_type<T>::value>;
+
+bool IsUtf8Continuation(char c) { return (static_cast<uint8_t>(c) & 0xC0) == 0x80; }
+
+// Truncate a binary value to at most `length` bytes, without splitting a
+// UTF-8 character if `utf8` is true.  The result is a lower bound of the value.
+std::string_view TruncateLowerBound(std::string_view value, int64_t length, bool utf8) {
+  if (static_cast<int64_t>(value.size()) <= length) return value;
+  auto end = static_cast<size_t>(length);
+  while (utf8 && end > 0 && IsUtf8Continuation(value[end])) --end;
+  return value.substr(0, end);
+}
+
+// Truncate a binary value to at most `length` bytes, then increment the last
+// byte that can be (dropping the following ones) so that the result is an
+// upper bound of the value.  In UTF-8, only ASCII characters are incremented.
+// Returns nullopt if the value needn't or can't be truncated.
+std::optional<std::string> TruncateUpperBound(std::string_view value, int64_t length,
+                                              bool utf8) {
+  if (static_cast<int64_t>(value.size()) <= length) return std::nullopt;
+  std::string bound(TruncateLowerBound(value, length, utf8));
+  const uint8_t max_byte = utf8 ? 0x7E : 0xFE;
+  while (!bound.empty()) {
+    const auto last = static_cast<uint8_t>(bound.back());
+    if (last <= max_byte) {
+      bound.back() = static_cast<char>(last + 1);
+      return bound;
+    }
+    bound.pop_back();
+    if (utf8 && last >= 0x80) {
+      // Drop the rest of the multi-byte character
+      while (!bound.empty() && IsUtf8Continuation(bound.back())) bound.pop_back();
+      if (!bound.empty()) bound.pop_back();
+    }
+  }
+  return std::nullopt;
+}
+
+// Appends the minimum and maximum non-null values of an array to the given
+// builders, or nulls if there are none.  Floating-point arrays containing NaN
+// get null bounds, as no ordering can describe them.  Binary bounds longer
+// than `truncate_length` bytes are truncated, as Parquet does for its
+// column indexes.
+struct MinMaxAppender {
+  template <typename T>
+  enable_if_t<has_batch_statistics<T>::value, Status> Visit(const T&) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    using BuilderType = typename TypeTraits<T>::BuilderType;
+    using ValueType = decltype(std::declval<ArrayType>().GetView(0));
+
+    bool has_values = false;
+    bool has_nan = false;
+    ValueType min{}, max{};
+    VisitArraySpanInline<T>(
+        *span,
+        [&](ValueType value) {
+          if constexpr (is_floating_type<T>::value) {
+            has_nan |= std::isnan(value);
+          }
+          if (!has_values) {
+            min = max = value;
+            has_values = true;
+          } else {
+            min = std::min(min, value);
+            max = std::max(max, value);
+          }
+        },
+        [] {});
+    if (!has_values || has_nan) {
+      RETURN_NOT_OK(min_builder->AppendNull());
+      return max_builder->AppendNull();
+    }
+    std::optional<std::string> truncated_max;
+    if constexpr (is_base_binary_type<T>::value) {
+      if (truncate_length > 0) {
+        constexpr bool kUtf8 = is_string_type<T>::value;
+        min = TruncateLowerBound(min, truncate_length, kUtf8);
+        truncated_max = TruncateUpperBound(max, truncate_length, kUtf8);
+        if (truncated_max) max = *truncated_max;
+      }
+    }
+    RETURN_NOT_OK(checked_cast<BuilderType*>(min_builder)->Append(min));
+    return checked_cast<BuilderType*>(max_builder)->Append(max);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Batch statistics for type ", type);
+  }
+
+  const ArraySpan* span;
+  ArrayBuilder* min_builder;
+  ArrayBuilder* max_builder;
+  int64_t truncate_length;
+};
+
+struct HasBatchStatisticsVisitor {
+  template <typename T>
+  Status Visit(const T&) {
+    result = has_batch_statistics<T>::value;
+    return Status::OK();
+  }
+
+  bool result = false;
+};
+
+}  // namespace
+
+bool HasBatchStatistics(const DataType& type) {
+  HasBatchStatisticsVisitor visitor;
+  DCHECK_OK(VisitTypeInline(type, &visitor));
+  return visitor.result;
+}
+
+/// Collects the per-batch statistics written in the IPC file footer
+/// (see IpcWriteOptions::write_batch_statistics)
+class BatchStatisticsCollector {
+ public:
+  static Result<std::shared_ptr<BatchStatisticsCollector>> Make(
+      const Schema& schema, const IpcWriteOptions& options) {
+    MemoryPool* pool = options.memory_pool;
+    auto collector = std::make_shared<BatchStatisticsCollector>(
+        pool, options.batch_statistics_truncate_length);
+    for (int i = 0; i < schema.num_fields(); ++i) {
+      const auto& field = schema.field(i);
+      // Statistics are looked up by column name, which must be unambiguous
+      if (!HasBatchStatistics(*field->type()) ||
+          schema.GetFieldIndex(field->name()) != i) {
+        continue;
+      }
+      Column column;
+      column.index = i;
+      column.field = field;
+      ARROW_ASSIGN_OR_RAISE(column.min, MakeBuilder(field->type(), pool));
+      ARROW_ASSIGN_OR_RAISE(column.max, MakeBuilder(field->type(), pool));
+      column.null_count = std::make_unique<Int64Builder>(pool);
+      collector->columns_.push_back(std::move(column));
+    }
+    return collector;
+  }
+
+  BatchStatisticsCollector(MemoryPool* pool, int64_t truncate_length)
+      : pool_(pool), truncate_length_(truncate_length), num_rows_builder_(pool) {}
+
+  Status Append(const RecordBatch& batch) {
+    RETURN_NOT_OK(num_rows_builder_.Append(batch.num_rows()));
+    for (auto& column : columns_) {
+      const ArrayData& data = *batch.column_data(column.index);
+      ArraySpan span(data);
+      MinMaxAppender appender{&span, column.min.get(), column.max.get(),
+                              truncate_length_};
+      RETURN_NOT_OK(VisitTypeInline(*data.type, &appender));
+      RETURN_NOT_OK(column.null_count->Append(data.GetNullCount()));
+    }
+    return Status::OK();
+  }
+
+  /// Return the statistics as a serialized IPC stream containing a single
+  /// record batch, with one row per record batch of the file
+  Result<std::shared_ptr<Buffer>> Finish() {
+    ARROW_ASSIGN_OR_RAISE(auto num_rows, num_rows_builder_.Finish());
+    const int64_t num_batches = num_rows->length();
+    ArrayVector column_stats;
+    FieldVector column_fields;
+    for (auto& column : columns_) {
+      const auto& type = column.field->type();
+      ARROW_ASSIGN_OR_RAISE(auto min, column.min->Finish());
+      ARROW_ASSIGN_OR_RAISE(auto max, column.max->Finish());
+      ARROW_ASSIGN_OR_RAISE(auto null_count, column.null_count->Finish());
+      ARROW_ASSIGN_OR_RAISE(
+          auto stats, StructArray::Make({min, max, null_count},
+                                        {field("min", type), field("max", type),
+                                         field("null_count", int64(), false)}));
+      column_fields.push_back(field(column.field->name(), stats->type(), false));
+      column_stats.push_back(std::move(stats));
+    }
+    auto columns = std::make_shared<StructArray>(struct_(std::move(column_fields)),
+                                                 num_batches, std::move(column_stats));
+    auto statistics_schema = schema({field("num_rows", int64(), false),
+                                     field("columns", columns->type(), false)});
+    auto batch = RecordBatch::Make(statistics_schema, num_batches,
+                                   {std::move(num_rows), std::move(columns)});
+
+    auto options = IpcWriteOptions::Defaults();
+    options.memory_pool = pool_;
+    ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create(1024, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto writer,
+                          MakeStreamWriter(sink, statistics_schema, options));
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    RETURN_NOT_OK(writer->Close());
+    return sink->Finish();
+  }
+
+ private:
+  struct Column {
+    int index;
+    std::shared_ptr<Field> field;
+    std::unique_ptr<ArrayBuilder> min;
+    std::unique_ptr<ArrayBuilder> max;
+    std::unique_ptr<Int64Builder> null_count;
+  };
+
+  MemoryPool* pool_;
+  int64_t truncate_length_;
+  std::vector<Column> columns_;
+  Int64Builder num_rows_builder_;
+};
+
 class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
  public:
   // A RecordBatchWriter implementation that writes to a IpcPayloadWriter.
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
                   const Schema& schema, const IpcWriteOptions& options,
-                  bool is_file_format)
+                  bool is_file_format,
+                  std::shared_ptr<BatchStatisticsCollector> statistics = NULLPTR)
       : payload_writer_(std::move(payload_writer)),
         schema_(schema),
         mapper_(schema),
         is_file_format_(is_file_format),
-        options_(options) {}
+        statistics_(std::move(statistics)),
+        options_(options) {
+    if (ZstdDictionaryTrainer::IsNeeded(options_, is_file_format_)) {
+      dictionary_trainer_ =
+          std::make_unique<ZstdDictionaryTrainer>(options_.zstd_dictionary_size);
+    }
+  }
 
   // A Schema-owning constructor variant
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
                   const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options,
-                  bool is_file_format)
-      : IpcFormatWriter(std::move(payload_writer), *schema, options, is_file_format) {
+                  bool is_file_format,
+                  std::shared_ptr<BatchStatisticsCollector> statistics = NULLPTR)
+      : IpcFormatWriter(std::move(payload_writer), *schema, options, is_file_format,
+                        std::move(statistics)) {
     shared_schema_ = schema;
   }
 
@@ -1190,10 +1645,27 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
 
     RETURN_NOT_OK(WriteDictionaries(batch));
 
+    std::shared_ptr<const KeyValueMetadata> batch_metadata = custom_metadata;
+    if (dictionary_trainer_ != nullptr) {
+      if (stats_.num_record_batches < options_.zstd_dictionary_training_batches) {
+        dictionary_trainer_->Sample(batch);
+      } else {
+        ARROW_ASSIGN_OR_RAISE(batch_metadata, StartZstdDictionary(custom_metadata));
+      }
+    }
+
+    if (compressor_ == nullptr && ColumnCompressor::IsNeeded(options_)) {
+      ARROW_ASSIGN_OR_RAISE(compressor_, ColumnCompressor::Make(schema_, options_));
+    }
+
     IpcPayload payload;
-    RETURN_NOT_OK(GetRecordBatchPayload(batch, custom_metadata, options_, &payload));
+    RETURN_NOT_OK(AssembleRecordBatchPayload(batch, batch_metadata, options_,
+                                             compressor_.get(), &payload));
     RETURN_NOT_OK(WritePayload(payload));
     ++stats_.num_record_batches;
+    if (statistics_) {
+      RETURN_NOT_OK(statistics_->Append(batch));
+    }
 
     stats_.total_raw_body_size += payload.raw_body_length;
     stats_.total_serialized_body_size += payload.body_length;
@@ -1313,11 +1785,52 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  // Train a zstd dictionary on the sampled record batches and compress all
+  // following messages with it. Returns the custom metadata of the current
+  // record batch, which transmits the dictionary to the reader.
+  Result<std::shared_ptr<const KeyValueMetadata>> StartZstdDictionary(
+      const std::shared_ptr<const KeyValueMetadata>& custom_metadata) {
+    auto trainer = std::move(dictionary_trainer_);
+    auto dictionary = trainer->Train();
+    if (dictionary == nullptr) {
+      return custom_metadata;
+    }
+
+    util::ZstdCodecOptions codec_options;
+    codec_options.compression_level = options_.codec->compression_level();
+    codec_options.dictionary = dictionary;
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<util::Codec> codec,
+                          util::Codec::Create(Compression::ZSTD, codec_options));
+    // Every compressed buffer must use the dictionary from now on, so it
+    // replaces per-field codecs as well (their level is lost)
+    options_.codec = codec;
+    for (auto& [name, field_codec] : options_.field_codecs) {
+      if (field_codec != nullptr) {
+        field_codec = codec;
+      }
+    }
+    compressor_.reset();
+
+    auto metadata = custom_metadata ? custom_metadata->Copy()
+                                    : std::make_shared<KeyValueMetadata>();
+    metadata->Append(internal::kZstdDictionaryKey,
+                     util::base64_encode(std::string_view(
+                         reinterpret_cast<const char*>(dictionary->data()),
+                         static_cast<size_t>(dictionary->size()))));
+    return metadata;
+  }
+
   std::unique_ptr<IpcPayloadWriter> payload_writer_;
   std::shared_ptr<Schema> shared_schema_;
   const Schema& schema_;
   const DictionaryFieldMapper mapper_;
   const bool is_file_format_;
+  // Per-batch statistics for the file footer, if requested
+  std::shared_ptr<BatchStatisticsCollector> statistics_;
+  // Per-column codec selection, if requested
+  std::unique_ptr<ColumnCompressor> compressor_;
+  // Sampling for the zstd dictionary of an IPC stream, until it is trained
+  std::unique_ptr<ZstdDictionaryTrainer> dictionary_trainer_;
 
   // A map of last-written dictionaries by id.
   // This is required to avoid the same dictionary again and again,
@@ -1417,14 +1930,20 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
  public:
   PayloadFileWriter(const IpcWriteOptions& options, const std::shared_ptr<Schema>& schema,
                     const std::shared_ptr<const KeyValueMetadata>& metadata,
-                    io::OutputStream* sink)
-      : StreamBookKeeper(options, sink), schema_(schema), metadata_(metadata) {}
+                    io::OutputStream* sink,
+                    std::shared_ptr<BatchStatisticsCollector> statistics = NULLPTR)
+      : StreamBookKeeper(options, sink),
+        schema_(schema),
+        metadata_(metadata),
+        statistics_(std::move(statistics)) {}
   PayloadFileWriter(const IpcWriteOptions& options, const std::shared_ptr<Schema>& schema,
                     const std::shared_ptr<const KeyValueMetadata>& metadata,
-                    std::shared_ptr<io::OutputStream> sink)
+                    std::shared_ptr<io::OutputStream> sink,
+                    std::shared_ptr<BatchStatisticsCollector> statistics = NULLPTR)
       : StreamBookKeeper(options, std::move(sink)),
         schema_(schema),
-        metadata_(metadata) {}
+        metadata_(metadata),
+        statistics_(std::move(statistics)) {}
 
   ~PayloadFileWriter() override = default;
 
@@ -1468,14 +1987,16 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
   }
 
   Status Close() override {
+    ARROW_ASSIGN_OR_RAISE(auto footer_metadata, GetFooterMetadata());
+
     // Write 0 EOS message for compatibility with sequential readers
     RETURN_NOT_OK(WriteEOS());
 
     // Write file footer
     RETURN_NOT_OK(UpdatePosition());
     int64_t initial_position = position_;
-    RETURN_NOT_OK(
-        WriteFileFooter(*schema_, dictionaries_, record_batches_, metadata_, sink_));
+    RETURN_NOT_OK(WriteFileFooter(*schema_, dictionaries_, record_batches_,
+                                  footer_metadata, sink_));
 
     // Write footer length
     RETURN_NOT_OK(UpdatePosition());
@@ -1493,8 +2014,27 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
   }
 
  protected:
+  Result<std::shared_ptr<const KeyValueMetadata>> GetFooterMetadata() {
+    if (!statistics_ && !(metadata_ && metadata_->Contains(kBatchStatisticsKey))) {
+      return metadata_;
+    }
+    auto metadata =
+        metadata_ ? metadata_->Copy() : std::make_shared<KeyValueMetadata>();
+    if (statistics_) {
+      ARROW_ASSIGN_OR_RAISE(auto serialized, statistics_->Finish());
+      RETURN_NOT_OK(metadata->Set(kBatchStatisticsKey,
+                                  util::base64_encode(std::string_view(*serialized))));
+    } else {
+      // Don't carry over statistics that don't describe this file, e.g. when
+      // the footer metadata of another file is reused
+      RETURN_NOT_OK(metadata->Delete(kBatchStatisticsKey));
+    }
+    return metadata;
+  }
+
   std::shared_ptr<Schema> schema_;
   std::shared_ptr<const KeyValueMetadata> metadata_;
+  std::shared_ptr<BatchStatisticsCollector> statistics_;
   std::vector<FileBlock> dictionaries_;
   std::vector<FileBlock> record_batches_;
 };
@@ -1523,23 +2063,38 @@ Result<std::shared_ptr<RecordBatchWriter>> NewStreamWriter(
   return MakeStreamWriter(sink, schema, options);
 }
 
+namespace {
+
+Result<std::shared_ptr<internal::BatchStatisticsCollector>> MakeBatchStatisticsCollector(
+    const Schema& schema, const IpcWriteOptions& options) {
+  if (!options.write_batch_statistics) {
+    return nullptr;
+  }
+  return internal::BatchStatisticsCollector::Make(schema, options);
+}
+
+}  // namespace
+
 Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  ARROW_ASSIGN_OR_RAISE(auto statistics, MakeBatchStatisticsCollector(*schema, options));
   return std::make_shared<internal::IpcFormatWriter>(
-      std::make_unique<internal::PayloadFileWriter>(options, schema, metadata, sink),
-      schema, options, /*is_file_format=*/true);
+      std::make_unique<internal::PayloadFileWriter>(options, schema, metadata, sink,
+                                                    statistics),
+      schema, options, /*is_file_format=*/true, statistics);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  ARROW_ASSIGN_OR_RAISE(auto statistics, MakeBatchStatisticsCollector(*schema, options));
   return std::make_shared<internal::IpcFormatWriter>(
       std::make_unique<internal::PayloadFileWriter>(options, schema, metadata,
-                                                    std::move(sink)),
-      schema, options, /*is_file_format=*/true);
+                                                    std::move(sink), statistics),
+      schema, options, /*is_file_format=*/true, statistics);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> NewFileWriter(
@@ -1578,6 +2133,270 @@ Result<std::unique_ptr<IpcPayloadWriter>> MakePayloadFileWriter(
 
 }  // namespace internal
 
+// ----------------------------------------------------------------------
+// Asynchronous stream writer
+
+AsyncRecordBatchWriter::~AsyncRecordBatchWriter() = default;
+
+namespace {
+
+// An AsyncRecordBatchWriter pipelining two stages, each of which runs on the
+// executor one task at a time: the encode stage assembles (and compresses)
+// the IPC payloads of the queued record batches, and the write stage writes
+// them to the sink.
+class AsyncStreamWriter : public AsyncRecordBatchWriter,
+                          public std::enable_shared_from_this<AsyncStreamWriter> {
+ public:
+  AsyncStreamWriter(std::shared_ptr<io::OutputStream> sink,
+                    const IpcWriteOptions& options, int max_queued_batches,
+                    ::arrow::internal::Executor* executor)
+      : sink_(std::move(sink)),
+        payload_writer_(sink_.get(), options),
+        max_queued_batches_(max_queued_batches),
+        executor_(executor),
+        closed_(Future<>::Make()) {}
+
+  Status Init(const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options) {
+    format_writer_ = std::make_unique<internal::IpcFormatWriter>(
+        std::make_unique<QueuedPayloadWriter>(this), schema, options,
+        /*is_file_format=*/false);
+    return Status::OK();
+  }
+
+  Future<> WriteRecordBatch(
+      std::shared_ptr<RecordBatch> batch,
+      std::shared_ptr<const KeyValueMetadata> custom_metadata) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (close_requested_) {
+      return Status::Invalid("Destination already closed");
+    }
+    RETURN_NOT_OK(status_);
+    encode_queue_.push_back({std::move(batch), std::move(custom_metadata)});
+    ++queued_batches_;
+    Future<> ready = Future<>::MakeFinished();
+    if (queued_batches_ >= max_queued_batches_) {
+      if (!ready_.is_valid()) {
+        ready_ = Future<>::Make();
+      }
+      ready = ready_;
+    }
+    Status st = ScheduleEncode();
+    lock.unlock();
+    if (!st.ok()) {
+      Fail(st);
+    }
+    return ready;
+  }
+
+  Future<> Close() override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!close_requested_) {
+      close_requested_ = true;
+      // A null batch stands for the end of the stream
+      encode_queue_.push_back({});
+      Status st = ScheduleEncode();
+      lock.unlock();
+      if (!st.ok()) {
+        Fail(st);
+        closed_.MarkFinished(st);
+      }
+    }
+    return closed_;
+  }
+
+  WriteStats stats() const override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+ private:
+  struct EncodeTask {
+    std::shared_ptr<RecordBatch> batch;
+    std::shared_ptr<const KeyValueMetadata> custom_metadata;
+  };
+
+  struct WriteTask {
+    enum Kind { kPayload, kEndOfBatch, kEndOfStream };
+
+    Kind kind;
+    IpcPayload payload;
+  };
+
+  // Forwards the payloads of the format writer to the write stage
+  class QueuedPayloadWriter : public internal::IpcPayloadWriter {
+   public:
+    explicit QueuedPayloadWriter(AsyncStreamWriter* owner) : owner_(owner) {}
+
+    Status WritePayload(const IpcPayload& payload) override {
+      return owner_->QueueWrite({WriteTask::kPayload, payload});
+    }
+
+    // The write stage finishes the stream upon WriteTask::kEndOfStream
+    Status Close() override { return Status::OK(); }
+
+   private:
+    AsyncStreamWriter* owner_;
+  };
+
+  // Start the encode stage if idle. Must be called with the lock held.
+  Status ScheduleEncode() {
+    if (encoding_) {
+      return Status::OK();
+    }
+    encoding_ = true;
+    return executor_->Spawn([self = shared_from_this()] { self->Encode(); });
+  }
+
+  // Start the write stage if idle. Must be called with the lock held.
+  Status ScheduleWrite() {
+    if (writing_) {
+      return Status::OK();
+    }
+    writing_ = true;
+    return executor_->Spawn([self = shared_from_this()] { self->Write(); });
+  }
+
+  Status QueueWrite(WriteTask task) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    write_queue_.push_back(std::move(task));
+    return ScheduleWrite();
+  }
+
+  void Encode() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!encode_queue_.empty()) {
+      EncodeTask task = std::move(encode_queue_.front());
+      encode_queue_.pop_front();
+      Status st = status_;
+      lock.unlock();
+
+      // Once an error occurred, tasks are only forwarded to release the
+      // writer's futures
+      if (st.ok()) {
+        st = task.batch != nullptr
+                 ? format_writer_->WriteRecordBatch(*task.batch, task.custom_metadata)
+                 : format_writer_->Close();
+      }
+      if (st.ok()) {
+        st = QueueWrite({task.batch != nullptr ? WriteTask::kEndOfBatch
+                                               : WriteTask::kEndOfStream});
+      }
+      if (!st.ok()) {
+        Fail(st);
+        if (task.batch == nullptr) {
+          closed_.MarkFinished(st);
+        }
+      }
+
+      lock.lock();
+      stats_ = format_writer_->stats();
+    }
+    encoding_ = false;
+  }
+
+  void Write() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!write_queue_.empty()) {
+      // Write all queued payloads at once
+      std::deque<WriteTask> tasks;
+      tasks.swap(write_queue_);
+      Status st = status_;
+      lock.unlock();
+
+      Future<> ready;
+      for (auto& task : tasks) {
+        switch (task.kind) {
+          case WriteTask::kPayload:
+            if (st.ok()) {
+              st = payload_writer_.WritePayload(task.payload);
+            }
+            break;
+          case WriteTask::kEndOfBatch: {
+            std::lock_guard<std::mutex> guard(mutex_);
+            if (--queued_batches_ < max_queued_batches_ && ready_.is_valid()) {
+              ready = std::move(ready_);
+              ready_ = Future<>();
+            }
+            break;
+          }
+          case WriteTask::kEndOfStream:
+            if (st.ok()) {
+              st = payload_writer_.Close();
+            }
+            closed_.MarkFinished(st);
+            break;
+        }
+      }
+      if (!st.ok()) {
+        Fail(st);
+      }
+      if (ready.is_valid()) {
+        ready.MarkFinished(st);
+      }
+
+      lock.lock();
+    }
+    writing_ = false;
+  }
+
+  // Record the first error, and report it to a producer waiting for room in
+  // the queue
+  void Fail(const Status& st) {
+    Future<> ready;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (status_.ok()) {
+        status_ = st;
+      }
+      ready = std::move(ready_);
+      ready_ = Future<>();
+    }
+    if (ready.is_valid()) {
+      ready.MarkFinished(st);
+    }
+  }
+
+  std::shared_ptr<io::OutputStream> sink_;
+  internal::PayloadStreamWriter payload_writer_;
+  std::unique_ptr<internal::IpcFormatWriter> format_writer_;
+  const int max_queued_batches_;
+  ::arrow::internal::Executor* executor_;
+
+  mutable std::mutex mutex_;
+  std::deque<EncodeTask> encode_queue_;
+  std::deque<WriteTask> write_queue_;
+  bool encoding_ = false;
+  bool writing_ = false;
+  bool close_requested_ = false;
+  // Number of record batches queued and not yet written
+  int queued_batches_ = 0;
+  // Finished when the number of queued batches falls below the maximum
+  Future<> ready_;
+  Future<> closed_;
+  Status status_;
+  WriteStats stats_;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<AsyncRecordBatchWriter>> MakeAsyncStreamWriter(
+    std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
+    const IpcWriteOptions& options, int max_queued_batches,
+    const io::IOContext& io_context) {
+  if (schema == nullptr) {
+    return Status::Invalid("nullptr for Schema not allowed");
+  }
+  if (max_queued_batches < 1) {
+    return Status::Invalid("max_queued_batches must be at least 1, got ",
+                           max_queued_batches);
+  }
+  auto writer = std::make_shared<AsyncStreamWriter>(std::move(sink), options,
+                                                    max_queued_batches,
+                                                    io_context.executor());
+  RETURN_NOT_OK(writer->Init(schema, options));
+  return writer;
+}
+
 // ----------------------------------------------------------------------
 // Serialization public APIs
 
@@ -23,10 +23,12 @@
 #include <memory>
 #include <vector>
 
+#include "arrow/io/type_fwd.h"
 #include "arrow/ipc/dictionary.h"  // IWYU pragma: export
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/options.h"
 #include "arrow/result.h"
+#include "arrow/type_fwd.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
@@ -127,6 +129,38 @@ class ARROW_EXPORT RecordBatchWriter {
   virtual WriteStats stats() const = 0;
 };
 
+/// \class AsyncRecordBatchWriter
+/// \brief Abstract interface for writing a stream of record batches in the
+/// background
+///
+/// Record batches are encoded, compressed and written in the order they are
+/// submitted, while the caller goes on producing the next ones. A bounded
+/// number of record batches may be queued: the future returned by
+/// WriteRecordBatch finishes once there is room for another one.
+class ARROW_EXPORT AsyncRecordBatchWriter {
+ public:
+  virtual ~AsyncRecordBatchWriter();
+
+  /// \brief Queue a record batch, with optional custom metadata, for writing
+  ///
+  /// \param[in] batch the record batch to write to the stream
+  /// \param[in] custom_metadata the record batch's custom metadata, optional
+  /// \return a future finishing when the writer can accept another record
+  /// batch, or failing if writing a previous record batch failed
+  virtual Future<> WriteRecordBatch(
+      std::shared_ptr<RecordBatch> batch,
+      std::shared_ptr<const KeyValueMetadata> custom_metadata = NULLPTR) = 0;
+
+  /// \brief Finish the stream once all queued record batches are written
+  ///
+  /// \return a future finishing when the end of the stream has been written,
+  /// with the first error that occurred if any
+  virtual Future<> Close() = 0;
+
+  /// \brief Return write statistics of the record batches encoded so far
+  virtual WriteStats stats() const = 0;
+};
+
 /// \defgroup record-batch-writer-factories Functions for creating RecordBatchWriter
 /// instances
 ///
@@ -156,6 +190,28 @@ Result<std::shared_ptr<RecordBatchWriter>> MakeStreamWriter(
     std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options = IpcWriteOptions::Defaults());
 
+/// Create a new asynchronous IPC stream writer from stream sink and schema.
+/// User is responsible for closing the actual OutputStream.
+///
+/// The payloads of each record batch are assembled and written by tasks
+/// running one at a time on the IOContext's executor, so that encoding a record
+/// batch overlaps with writing the previous ones. Buffers are compressed in
+/// parallel on the CPU thread pool if options.use_threads is true.
+///
+/// \param[in] sink output stream to write to
+/// \param[in] schema the schema of the record batches to be written
+/// \param[in] options options for serialization
+/// \param[in] max_queued_batches maximum number of record batches queued
+/// before the caller is asked to wait
+/// \param[in] io_context the IOContext whose executor runs the writer's tasks
+/// \return Result<std::shared_ptr<AsyncRecordBatchWriter>>
+ARROW_EXPORT
+Result<std::shared_ptr<AsyncRecordBatchWriter>> MakeAsyncStreamWriter(
+    std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
+    const IpcWriteOptions& options = IpcWriteOptions::Defaults(),
+    int max_queued_batches = 4,
+    const io::IOContext& io_context = io::default_io_context());
+
 /// Create a new IPC file writer from stream sink and schema
 ///
 /// \param[in] sink output stream to write to
@@ -421,6 +477,12 @@ namespace internal {
 
 // These internal APIs may change without warning or deprecation
 
+/// \brief Whether per-batch statistics can be written for columns of the given type
+///
+/// See IpcWriteOptions::write_batch_statistics.
+ARROW_EXPORT
+bool HasBatchStatistics(const DataType& type);
+
 class ARROW_EXPORT IpcPayloadWriter {
  public:
   virtual ~IpcPayloadWriter();
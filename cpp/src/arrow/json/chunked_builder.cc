@@ -82,6 +82,11 @@ class TypedChunkedArrayBuilder
     if (chunks_.size() <= static_cast<size_t>(block_index)) {
       chunks_.resize(static_cast<size_t>(block_index) + 1, nullptr);
     }
+    if (unconverted->type()->Equals(converter_->out_type())) {
+      // Already converted while parsing (see BlockParser::MakeTyped)
+      chunks_[block_index] = unconverted;
+      return;
+    }
     lock.unlock();
 
     auto self = shared_from_this();
@@ -53,6 +53,14 @@ struct ARROW_EXPORT ParseOptions {
   /// How JSON fields outside of explicit_schema (if given) are treated
   UnexpectedFieldBehavior unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
 
+  /// Whether to tokenize blocks using a SIMD structural index
+  ///
+  /// If true, the positions of the structural characters of each block are first
+  /// found many bytes at a time and the JSON grammar is then checked on those
+  /// tokens, rather than byte by byte. This is usually faster, especially for long
+  /// strings. Blocks must also be valid UTF-8.
+  bool use_structural_index = false;
+
   /// Create parsing options with default values
   static ParseOptions Defaults();
 };
@@ -20,6 +20,7 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <string>
 #include <string_view>
 #include <tuple>
 #include <unordered_map>
@@ -28,17 +29,26 @@
 #include <vector>
 
 #include "arrow/json/rapidjson_defs.h"
+#include "arrow/json/structural_index_internal.h"
 #include "rapidjson/error/en.h"
 #include "rapidjson/reader.h"
 
 #include "arrow/array.h"
+#include "arrow/array/builder_base.h"
 #include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_decimal.h"
+#include "arrow/array/builder_nested.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/builder_time.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
 #include "arrow/util/bitset_stack.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/trie.h"
+#include "arrow/util/value_parsing.h"
 #include "arrow/visit_type_inline.h"
 
 namespace arrow {
@@ -644,14 +654,62 @@ class RawBuilderSet {
       arenas_;
 };
 
+/// \brief Feed each row of a block of JSON to a rapidjson handler
+///
+/// num_rows is incremented for each row parsed and is used to locate errors.
+template <typename Handler, typename Stream>
+Status ParseRows(Handler& handler, Stream&& json, size_t json_size, int32_t* num_rows) {
+  constexpr auto parse_flags = rj::kParseIterativeFlag | rj::kParseNanAndInfFlag |
+                               rj::kParseStopWhenDoneFlag |
+                               rj::kParseNumbersAsStringsFlag;
+
+  rj::Reader reader;
+  // ensure that the loop can exit when the block too large.
+  for (; *num_rows < std::numeric_limits<int32_t>::max(); ++*num_rows) {
+    auto ok = reader.Parse<parse_flags>(json, handler);
+    switch (ok.Code()) {
+      case rj::kParseErrorNone:
+        // parse the next object
+        continue;
+      case rj::kParseErrorDocumentEmpty:
+        if (json.Tell() < json_size) {
+          return ParseError(rj::GetParseError_En(ok.Code()));
+        }
+        // parsed all objects, finish
+        return Status::OK();
+      case rj::kParseErrorTermination:
+        // handler emitted an error
+        return handler.Error();
+      default:
+        // rj emitted an error
+        return ParseError(rj::GetParseError_En(ok.Code()), " in row ", *num_rows);
+    }
+  }
+  return Status::Invalid("Row count overflowed int32_t");
+}
+
+template <typename Handler>
+Status ParseRows(Handler& handler, const std::shared_ptr<Buffer>& json,
+                 bool use_structural_index, MemoryPool* pool, int32_t* num_rows) {
+  if (use_structural_index && json->size() <= internal::StructuralIndex::kMaxSize) {
+    internal::StructuralIndex index(pool);
+    RETURN_NOT_OK(index.Build(reinterpret_cast<const char*>(json->data()), json->size()));
+    return internal::ReplayRows(handler, index, num_rows);
+  }
+  rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
+  using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
+  return ParseRows(handler, InputStream(ms), static_cast<size_t>(json->size()), num_rows);
+}
+
 /// Three implementations are provided for BlockParser, one for each
 /// UnexpectedFieldBehavior. However most of the logic is identical in each
 /// case, so the majority of the implementation is in this base class
 class HandlerBase : public BlockParser,
                     public rj::BaseReaderHandler<rj::UTF8<>, HandlerBase> {
  public:
-  explicit HandlerBase(MemoryPool* pool)
+  HandlerBase(MemoryPool* pool, bool use_structural_index)
       : BlockParser(pool),
+        use_structural_index_(use_structural_index),
         builder_set_(pool),
         field_index_(-1),
         scalar_values_builder_(pool) {}
@@ -762,43 +820,10 @@ class HandlerBase : public BlockParser,
   }
 
  protected:
-  template <typename Handler, typename Stream>
-  Status DoParse(Handler& handler, Stream&& json, size_t json_size) {
-    constexpr auto parse_flags = rj::kParseIterativeFlag | rj::kParseNanAndInfFlag |
-                                 rj::kParseStopWhenDoneFlag |
-                                 rj::kParseNumbersAsStringsFlag;
-
-    rj::Reader reader;
-    // ensure that the loop can exit when the block too large.
-    for (; num_rows_ < std::numeric_limits<int32_t>::max(); ++num_rows_) {
-      auto ok = reader.Parse<parse_flags>(json, handler);
-      switch (ok.Code()) {
-        case rj::kParseErrorNone:
-          // parse the next object
-          continue;
-        case rj::kParseErrorDocumentEmpty:
-          if (json.Tell() < json_size) {
-            return ParseError(rj::GetParseError_En(ok.Code()));
-          }
-          // parsed all objects, finish
-          return Status::OK();
-        case rj::kParseErrorTermination:
-          // handler emitted an error
-          return handler.Error();
-        default:
-          // rj emitted an error
-          return ParseError(rj::GetParseError_En(ok.Code()), " in row ", num_rows_);
-      }
-    }
-    return Status::Invalid("Row count overflowed int32_t");
-  }
-
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
     RETURN_NOT_OK(ReserveScalarStorage(json->size()));
-    rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
-    using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
-    return DoParse(handler, InputStream(ms), static_cast<size_t>(json->size()));
+    return ParseRows(handler, json, use_structural_index_, pool_, &num_rows_);
   }
 
   /// \defgroup handlerbase-append-methods append non-nested values
@@ -928,6 +953,7 @@ class HandlerBase : public BlockParser,
     return scalar_values_builder_.ReserveData(size - available_storage);
   }
 
+  const bool use_structural_index_;
   Status status_;
   RawBuilderSet builder_set_;
   BuilderPtr builder_;
@@ -1169,6 +1195,641 @@ class Handler<UnexpectedFieldBehavior::InferType> : public HandlerBase {
   }
 };
 
+/// \brief Column of a schema-directed parse, appending to a typed ArrayBuilder
+///
+/// When every field of the explicit schema has a type which can be built directly,
+/// TypedHandler converts each value as it is parsed instead of storing it in a
+/// RawBuilderSet for a later pass through a Converter.
+class TypedColumn {
+ public:
+  TypedColumn(Kind::type kind, bool nullable) : kind_(kind), nullable_(nullable) {}
+  virtual ~TypedColumn() = default;
+
+  /// The json kind expected for values of this column
+  Kind::type kind() const { return kind_; }
+
+  Status AppendNull() {
+    if (ARROW_PREDICT_FALSE(!nullable_)) {
+      return ParseError("a required field was null");
+    }
+    return DoAppendNull();
+  }
+
+  /// Append a boolean, only called if kind() is Kind::kBoolean
+  virtual Status AppendBool(bool) {
+    return Status::NotImplemented("invalid column kind");
+  }
+
+  /// Append a number or string, only called if kind() admits that json kind
+  virtual Status AppendScalar(std::string_view) {
+    return Status::NotImplemented("invalid column kind");
+  }
+
+  bool nullable() const { return nullable_; }
+
+ protected:
+  virtual Status DoAppendNull() = 0;
+
+  const Kind::type kind_;
+  const bool nullable_;
+};
+
+template <typename... Args>
+static Status TypedConversionError(const DataType& type, Args&&... args) {
+  return Status::Invalid("Failed to convert JSON to ", type, std::forward<Args>(args)...);
+}
+
+class NullColumn : public TypedColumn {
+ public:
+  NullColumn(Kind::type kind, bool nullable, ArrayBuilder* builder)
+      : TypedColumn(kind, nullable), builder_(checked_cast<NullBuilder*>(builder)) {}
+
+ protected:
+  Status DoAppendNull() override { return builder_->AppendNull(); }
+
+  NullBuilder* builder_;
+};
+
+class BooleanColumn : public TypedColumn {
+ public:
+  BooleanColumn(Kind::type kind, bool nullable, ArrayBuilder* builder)
+      : TypedColumn(kind, nullable), builder_(checked_cast<BooleanBuilder*>(builder)) {}
+
+  Status AppendBool(bool value) override { return builder_->Append(value); }
+
+ protected:
+  Status DoAppendNull() override { return builder_->AppendNull(); }
+
+  BooleanBuilder* builder_;
+};
+
+/// \brief Column of integers, floating point numbers or timestamps
+template <typename T>
+class NumericColumn : public TypedColumn {
+ public:
+  using BuilderType = typename TypeTraits<T>::BuilderType;
+
+  NumericColumn(Kind::type kind, bool nullable, ArrayBuilder* builder)
+      : TypedColumn(kind, nullable),
+        builder_(checked_cast<BuilderType*>(builder)),
+        type_(checked_cast<const T&>(*builder->type())) {}
+
+  Status AppendScalar(std::string_view repr) override {
+    typename T::c_type value;
+    if (ARROW_PREDICT_FALSE(
+            !arrow::internal::ParseValue(type_, repr.data(), repr.size(), &value))) {
+      return TypedConversionError(type_, ", couldn't parse:", repr);
+    }
+    return builder_->Append(value);
+  }
+
+ protected:
+  Status DoAppendNull() override { return builder_->AppendNull(); }
+
+  BuilderType* builder_;
+  const T& type_;
+};
+
+/// \brief Column of dates or times, which are parsed from their integer representation
+template <typename T>
+class DateTimeColumn : public TypedColumn {
+ public:
+  using BuilderType = typename TypeTraits<T>::BuilderType;
+  using ReprType = typename CTypeTraits<typename T::c_type>::ArrowType;
+
+  DateTimeColumn(Kind::type kind, bool nullable, ArrayBuilder* builder)
+      : TypedColumn(kind, nullable), builder_(checked_cast<BuilderType*>(builder)) {}
+
+  Status AppendScalar(std::string_view repr) override {
+    typename T::c_type value;
+    if (ARROW_PREDICT_FALSE(!arrow::internal::ParseValue<ReprType>(
+            repr.data(), repr.size(), &value))) {
+      return TypedConversionError(*TypeTraits<ReprType>::type_singleton(),
+                                  ", couldn't parse:", repr);
+    }
+    return builder_->Append(value);
+  }
+
+ protected:
+  Status DoAppendNull() override { return builder_->AppendNull(); }
+
+  BuilderType* builder_;
+};
+
+template <typename T>
+class DecimalColumn : public TypedColumn {
+ public:
+  using BuilderType = typename TypeTraits<T>::BuilderType;
+  using ValueType = typename BuilderType::ValueType;
+
+  DecimalColumn(Kind::type kind, bool nullable, ArrayBuilder* builder)
+      : TypedColumn(kind, nullable),
+        builder_(checked_cast<BuilderType*>(builder)),
+        type_(checked_cast<const DecimalType&>(*builder->type())) {}
+
+  Status AppendScalar(std::string_view repr) override {
+    ValueType value;
+    int32_t precision, scale;
+    RETURN_NOT_OK(ValueType::FromString(repr, &value, &precision, &scale));
+    if (precision > type_.precision()) {
+      return TypedConversionError(type_, ": ", repr, " requires precision ", precision);
+    }
+    if (scale != type_.scale()) {
+      auto result = value.Rescale(scale, type_.scale());
+      if (ARROW_PREDICT_FALSE(!result.ok())) {
+        return TypedConversionError(type_, ": ", repr, " requires scale ", scale);
+      }
+      value = result.MoveValueUnsafe();
+    }
+    return builder_->Append(value);
+  }
+
+ protected:
+  Status DoAppendNull() override { return builder_->AppendNull(); }
+
+  BuilderType* builder_;
+  const DecimalType& type_;
+};
+
+template <typename T>
+class BinaryColumn : public TypedColumn {
+ public:
+  using BuilderType = typename TypeTraits<T>::BuilderType;
+
+  BinaryColumn(Kind::type kind, bool nullable, ArrayBuilder* builder)
+      : TypedColumn(kind, nullable), builder_(checked_cast<BuilderType*>(builder)) {}
+
+  Status AppendScalar(std::string_view repr) override { return builder_->Append(repr); }
+
+ protected:
+  Status DoAppendNull() override { return builder_->AppendNull(); }
+
+  BuilderType* builder_;
+};
+
+class ListColumn : public TypedColumn {
+ public:
+  ListColumn(Kind::type kind, bool nullable, ArrayBuilder* builder,
+             std::unique_ptr<TypedColumn> value_column)
+      : TypedColumn(kind, nullable),
+        builder_(checked_cast<ListBuilder*>(builder)),
+        value_column_(std::move(value_column)) {}
+
+  /// Start a new list; its values are then appended to value_column()
+  Status Append() { return builder_->Append(); }
+
+  TypedColumn* value_column() const { return value_column_.get(); }
+
+ protected:
+  Status DoAppendNull() override { return builder_->AppendNull(); }
+
+  ListBuilder* builder_;
+  std::unique_ptr<TypedColumn> value_column_;
+};
+
+class StructColumn : public TypedColumn {
+ public:
+  StructColumn(Kind::type kind, bool nullable, ArrayBuilder* builder,
+               std::vector<std::string> names,
+               std::vector<std::unique_ptr<TypedColumn>> field_columns)
+      : TypedColumn(kind, nullable),
+        builder_(checked_cast<StructBuilder*>(builder)),
+        names_(std::move(names)),
+        field_columns_(std::move(field_columns)) {
+    for (int i = 0; i < num_fields(); ++i) {
+      name_to_index_.emplace(names_[i], i);
+    }
+  }
+
+  /// Start a new object; each of its fields must then be appended to exactly once
+  Status Append() { return builder_->Append(); }
+
+  /// \brief Look up the index of a field, or -1 if it isn't in the schema
+  ///
+  /// As in RawArrayBuilder<Kind::kObject>, the next index is predicted
+  /// in case the fields are consistently ordered.
+  int GetFieldIndex(std::string_view name) {
+    if (ARROW_PREDICT_FALSE(num_fields() == 0)) {
+      return -1;
+    }
+    if (next_index_ != -1) {
+      if (next_index_ == num_fields()) {
+        next_index_ = 0;
+      }
+      if (ARROW_PREDICT_TRUE(name == names_[next_index_])) {
+        return next_index_++;
+      }
+    }
+    auto it = name_to_index_.find(name);
+    if (it == name_to_index_.end()) {
+      // Unexpected fields are skipped and don't disturb the prediction
+      return -1;
+    }
+    next_index_ = -1;
+    return it->second;
+  }
+
+  int num_fields() const { return static_cast<int>(field_columns_.size()); }
+
+  const std::string& field_name(int index) const { return names_[index]; }
+
+  TypedColumn* field_column(int index) const { return field_columns_[index].get(); }
+
+ protected:
+  Status DoAppendNull() override {
+    for (const auto& field_column : field_columns_) {
+      RETURN_NOT_OK(field_column->AppendNull());
+    }
+    return builder_->Append(false);
+  }
+
+  StructBuilder* builder_;
+  std::vector<std::string> names_;
+  std::vector<std::unique_ptr<TypedColumn>> field_columns_;
+  std::unordered_map<std::string_view, int> name_to_index_;
+  int next_index_ = 0;
+};
+
+/// \brief Check that values of type can be converted while parsing, as
+/// MakeTypedColumn would, without making any builder
+Status CheckTypedColumn(const DataType& type) {
+  Kind::type kind;
+  RETURN_NOT_OK(Kind::ForType(type, &kind));
+
+  switch (type.id()) {
+    case Type::NA:
+    case Type::BOOL:
+    case Type::INT8:
+    case Type::INT16:
+    case Type::INT32:
+    case Type::INT64:
+    case Type::UINT8:
+    case Type::UINT16:
+    case Type::UINT32:
+    case Type::UINT64:
+    case Type::FLOAT:
+    case Type::DOUBLE:
+    case Type::TIMESTAMP:
+    case Type::TIME32:
+    case Type::TIME64:
+    case Type::DATE32:
+    case Type::DATE64:
+    case Type::BINARY:
+    case Type::STRING:
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+    case Type::BINARY_VIEW:
+    case Type::STRING_VIEW:
+    case Type::DECIMAL128:
+    case Type::DECIMAL256:
+      return Status::OK();
+    case Type::LIST:
+      return CheckTypedColumn(*checked_cast<const ListType&>(type).value_type());
+    case Type::STRUCT:
+      for (const auto& f : type.fields()) {
+        RETURN_NOT_OK(CheckTypedColumn(*f->type()));
+      }
+      return Status::OK();
+    default:
+      return Status::NotImplemented("JSON conversion to ", type,
+                                    " while parsing is not supported");
+  }
+}
+
+/// \brief Check that ParseOptions are supported by BlockParser::MakeTyped
+Status CheckTypedOptions(const ParseOptions& options) {
+  if (options.explicit_schema == nullptr ||
+      options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType) {
+    return Status::Invalid(
+        "Converting JSON while parsing requires an explicit schema and "
+        "unexpected fields to be ignored or rejected");
+  }
+  for (const auto& f : options.explicit_schema->fields()) {
+    RETURN_NOT_OK(CheckTypedColumn(*f->type()));
+  }
+  return Status::OK();
+}
+
+/// \brief Make a TypedColumn appending to builder, which was made for type
+Status MakeTypedColumn(const DataType& type, bool nullable, ArrayBuilder* builder,
+                       std::unique_ptr<TypedColumn>* out) {
+  Kind::type kind;
+  RETURN_NOT_OK(Kind::ForType(type, &kind));
+
+  switch (type.id()) {
+#define TYPED_COLUMN_CASE(TYPE_ID, COLUMN_TYPE)                    \
+  case TYPE_ID:                                                    \
+    *out = std::make_unique<COLUMN_TYPE>(kind, nullable, builder); \
+    return Status::OK()
+    TYPED_COLUMN_CASE(Type::NA, NullColumn);
+    TYPED_COLUMN_CASE(Type::BOOL, BooleanColumn);
+    TYPED_COLUMN_CASE(Type::INT8, NumericColumn<Int8Type>);
+    TYPED_COLUMN_CASE(Type::INT16, NumericColumn<Int16Type>);
+    TYPED_COLUMN_CASE(Type::INT32, NumericColumn<Int32Type>);
+    TYPED_COLUMN_CASE(Type::INT64, NumericColumn<Int64Type>);
+    TYPED_COLUMN_CASE(Type::UINT8, NumericColumn<UInt8Type>);
+    TYPED_COLUMN_CASE(Type::UINT16, NumericColumn<UInt16Type>);
+    TYPED_COLUMN_CASE(Type::UINT32, NumericColumn<UInt32Type>);
+    TYPED_COLUMN_CASE(Type::UINT64, NumericColumn<UInt64Type>);
+    TYPED_COLUMN_CASE(Type::FLOAT, NumericColumn<FloatType>);
+    TYPED_COLUMN_CASE(Type::DOUBLE, NumericColumn<DoubleType>);
+    TYPED_COLUMN_CASE(Type::TIMESTAMP, NumericColumn<TimestampType>);
+    TYPED_COLUMN_CASE(Type::TIME32, DateTimeColumn<Time32Type>);
+    TYPED_COLUMN_CASE(Type::TIME64, DateTimeColumn<Time64Type>);
+    TYPED_COLUMN_CASE(Type::DATE32, DateTimeColumn<Date32Type>);
+    TYPED_COLUMN_CASE(Type::DATE64, DateTimeColumn<Date64Type>);
+    TYPED_COLUMN_CASE(Type::BINARY, BinaryColumn<BinaryType>);
+    TYPED_COLUMN_CASE(Type::STRING, BinaryColumn<StringType>);
+    TYPED_COLUMN_CASE(Type::LARGE_BINARY, BinaryColumn<LargeBinaryType>);
+    TYPED_COLUMN_CASE(Type::LARGE_STRING, BinaryColumn<LargeStringType>);
+    TYPED_COLUMN_CASE(Type::BINARY_VIEW, BinaryColumn<BinaryViewType>);
+    TYPED_COLUMN_CASE(Type::STRING_VIEW, BinaryColumn<StringViewType>);
+    TYPED_COLUMN_CASE(Type::DECIMAL128, DecimalColumn<Decimal128Type>);
+    TYPED_COLUMN_CASE(Type::DECIMAL256, DecimalColumn<Decimal256Type>);
+#undef TYPED_COLUMN_CASE
+
+    case Type::LIST: {
+      const auto& list_type = checked_cast<const ListType&>(type);
+      std::unique_ptr<TypedColumn> value_column;
+      RETURN_NOT_OK(MakeTypedColumn(*list_type.value_type(),
+                                    list_type.value_field()->nullable(),
+                                    checked_cast<ListBuilder*>(builder)->value_builder(),
+                                    &value_column));
+      *out = std::make_unique<ListColumn>(kind, nullable, builder,
+                                          std::move(value_column));
+      return Status::OK();
+    }
+    case Type::STRUCT: {
+      auto struct_builder = checked_cast<StructBuilder*>(builder);
+      std::vector<std::string> names;
+      std::vector<std::unique_ptr<TypedColumn>> field_columns(type.num_fields());
+      for (int i = 0; i < type.num_fields(); ++i) {
+        const auto& f = type.field(i);
+        names.push_back(f->name());
+        RETURN_NOT_OK(MakeTypedColumn(*f->type(), f->nullable(),
+                                      struct_builder->field_builder(i),
+                                      &field_columns[i]));
+      }
+      *out = std::make_unique<StructColumn>(kind, nullable, builder, std::move(names),
+                                            std::move(field_columns));
+      return Status::OK();
+    }
+    default:
+      return Status::NotImplemented("JSON conversion to ", type,
+                                    " while parsing is not supported");
+  }
+}
+
+/// \brief BlockParser which converts values while parsing them
+///
+/// Only fields of the explicit schema are parsed; unexpected fields are skipped
+/// without being stored (or raise an error, per UnexpectedFieldBehavior). The
+/// parsed array already has the converted types of the explicit schema.
+class TypedHandler : public BlockParser,
+                     public rj::BaseReaderHandler<rj::UTF8<>, TypedHandler> {
+ public:
+  TypedHandler(MemoryPool* pool, UnexpectedFieldBehavior unexpected_field_behavior,
+               bool use_structural_index)
+      : BlockParser(pool),
+        ignore_unexpected_fields_(unexpected_field_behavior ==
+                                  UnexpectedFieldBehavior::Ignore),
+        use_structural_index_(use_structural_index) {}
+
+  /// \brief Set up columns for the expected Schema
+  Status Initialize(const std::shared_ptr<Schema>& s) {
+    auto type = struct_(s->fields());
+    RETURN_NOT_OK(MakeBuilder(pool_, type, &builder_));
+    RETURN_NOT_OK(MakeTypedColumn(*type, /*nullable=*/false, builder_.get(), &column_));
+    row_column_ = column_.get();
+    current_ = row_column_;
+    return Status::OK();
+  }
+
+  /// Values are appended directly to typed builders, so there is no scalar storage
+  Status ReserveScalarStorage(int64_t) override { return Status::OK(); }
+
+  Status Parse(const std::shared_ptr<Buffer>& json) override {
+    return ParseRows(*this, json, use_structural_index_, pool_, &num_rows_);
+  }
+
+  Status Finish(std::shared_ptr<Array>* parsed) override {
+    return builder_->Finish(parsed);
+  }
+
+  /// Accessor for a stored error Status
+  Status Error() { return status_; }
+
+  /// \defgroup typed-handler-interface functions expected by rj::Reader
+  ///
+  /// @{
+  bool Null() {
+    if (Skipping()) {
+      return true;
+    }
+    if (ARROW_PREDICT_FALSE(current_ == row_column_)) {
+      status_ = IllegallyChangedTo(Kind::kNull);
+      return false;
+    }
+    status_ = current_->AppendNull();
+    return status_.ok();
+  }
+
+  bool Bool(bool value) {
+    if (Skipping()) {
+      return true;
+    }
+    if (ARROW_PREDICT_FALSE(current_->kind() != Kind::kBoolean)) {
+      status_ = IllegallyChangedTo(Kind::kBoolean);
+      return false;
+    }
+    status_ = current_->AppendBool(value);
+    return status_.ok();
+  }
+
+  bool RawNumber(const char* data, rj::SizeType size, ...) {
+    if (Skipping()) {
+      return true;
+    }
+    status_ = AppendScalar(Kind::kNumber, std::string_view(data, size));
+    return status_.ok();
+  }
+
+  bool String(const char* data, rj::SizeType size, ...) {
+    if (Skipping()) {
+      return true;
+    }
+    status_ = AppendScalar(Kind::kString, std::string_view(data, size));
+    return status_.ok();
+  }
+
+  bool StartObject() {
+    ++depth_;
+    if (Skipping()) {
+      return true;
+    }
+    status_ = StartObjectImpl();
+    return status_.ok();
+  }
+
+  /// if an unexpected field is encountered, either skip until its value has been
+  /// consumed or emit a parse error and bail
+  bool Key(const char* key, rj::SizeType len, ...) {
+    MaybeStopSkipping();
+    if (Skipping()) {
+      return true;
+    }
+    auto parent = checked_cast<StructColumn*>(stack_.back());
+    field_index_ = parent->GetFieldIndex(std::string_view(key, len));
+    if (ARROW_PREDICT_FALSE(field_index_ == -1)) {
+      if (ignore_unexpected_fields_) {
+        skip_depth_ = depth_;
+        return true;
+      }
+      status_ = ParseError("unexpected field");
+      return false;
+    }
+    if (ARROW_PREDICT_FALSE(!absent_fields_stack_[field_index_])) {
+      status_ = ParseError("Column(", Path(), ") was specified twice in row ", num_rows_);
+      return false;
+    }
+    absent_fields_stack_[field_index_] = false;
+    current_ = parent->field_column(field_index_);
+    return true;
+  }
+
+  bool EndObject(...) {
+    MaybeStopSkipping();
+    --depth_;
+    if (Skipping()) {
+      return true;
+    }
+    status_ = EndObjectImpl();
+    return status_.ok();
+  }
+
+  bool StartArray() {
+    if (Skipping()) {
+      return true;
+    }
+    if (ARROW_PREDICT_FALSE(current_->kind() != Kind::kArray)) {
+      status_ = IllegallyChangedTo(Kind::kArray);
+      return false;
+    }
+    auto list_column = checked_cast<ListColumn*>(current_);
+    StartNested();
+    current_ = list_column->value_column();
+    status_ = list_column->Append();
+    return status_.ok();
+  }
+
+  bool EndArray(rj::SizeType) {
+    if (Skipping()) {
+      return true;
+    }
+    EndNested();
+    return true;
+  }
+  /// @}
+
+ private:
+  Status AppendScalar(Kind::type kind, std::string_view repr) {
+    if (ARROW_PREDICT_FALSE(current_->kind() != kind &&
+                            current_->kind() != Kind::kNumberOrString)) {
+      return IllegallyChangedTo(kind);
+    }
+    return current_->AppendScalar(repr);
+  }
+
+  Status StartObjectImpl() {
+    if (ARROW_PREDICT_FALSE(current_->kind() != Kind::kObject)) {
+      return IllegallyChangedTo(Kind::kObject);
+    }
+    auto struct_column = checked_cast<StructColumn*>(current_);
+    absent_fields_stack_.Push(struct_column->num_fields(), true);
+    StartNested();
+    return struct_column->Append();
+  }
+
+  Status EndObjectImpl() {
+    auto parent = checked_cast<StructColumn*>(stack_.back());
+    for (int i = 0; i < absent_fields_stack_.TopSize(); ++i) {
+      if (!absent_fields_stack_[i]) {
+        continue;
+      }
+      auto field_column = parent->field_column(i);
+      if (ARROW_PREDICT_FALSE(!field_column->nullable())) {
+        return ParseError("a required field was absent");
+      }
+      RETURN_NOT_OK(field_column->AppendNull());
+    }
+    absent_fields_stack_.Pop();
+    EndNested();
+    return Status::OK();
+  }
+
+  void StartNested() {
+    field_index_stack_.push_back(field_index_);
+    field_index_ = -1;
+    stack_.push_back(current_);
+  }
+
+  void EndNested() {
+    field_index_ = field_index_stack_.back();
+    field_index_stack_.pop_back();
+    current_ = stack_.back();
+    stack_.pop_back();
+  }
+
+  /// \brief Emit path of current field for debugging purposes
+  std::string Path() {
+    std::string path;
+    for (size_t i = 0; i < stack_.size(); ++i) {
+      if (stack_[i]->kind() == Kind::kArray) {
+        path += "/[]";
+      } else {
+        auto field_index = field_index_;
+        if (i + 1 < field_index_stack_.size()) {
+          field_index = field_index_stack_[i + 1];
+        }
+        path += "/" + checked_cast<StructColumn*>(stack_[i])->field_name(field_index);
+      }
+    }
+    return path;
+  }
+
+  Status IllegallyChangedTo(Kind::type illegally_changed_to) {
+    return ParseError("Column(", Path(), ") changed from ", Kind::Name(current_->kind()),
+                      " to ", Kind::Name(illegally_changed_to), " in row ", num_rows_);
+  }
+
+  bool Skipping() { return depth_ >= skip_depth_; }
+
+  void MaybeStopSkipping() {
+    if (skip_depth_ == depth_) {
+      skip_depth_ = std::numeric_limits<int>::max();
+    }
+  }
+
+  const bool ignore_unexpected_fields_;
+  const bool use_structural_index_;
+  Status status_;
+  std::unique_ptr<ArrayBuilder> builder_;
+  std::unique_ptr<TypedColumn> column_;
+  TypedColumn* row_column_ = nullptr;
+  // column to which the next value will be appended
+  TypedColumn* current_ = nullptr;
+  // top of this stack is the parent of current_
+  std::vector<TypedColumn*> stack_;
+  // top of this stack refers to the fields of the highest StructColumn in stack_
+  BitsetStack absent_fields_stack_;
+  // index of current_ within its parent
+  int field_index_ = -1;
+  // top of this stack == field_index_
+  std::vector<int> field_index_stack_;
+  int depth_ = 0;
+  int skip_depth_ = std::numeric_limits<int>::max();
+};
+
 Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
                          std::unique_ptr<BlockParser>* out) {
   DCHECK(options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType ||
@@ -1176,20 +1837,37 @@ Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
 
   switch (options.unexpected_field_behavior) {
     case UnexpectedFieldBehavior::Ignore: {
-      *out = std::make_unique<Handler<UnexpectedFieldBehavior::Ignore>>(pool);
+      *out = std::make_unique<Handler<UnexpectedFieldBehavior::Ignore>>(
+          pool, options.use_structural_index);
       break;
     }
     case UnexpectedFieldBehavior::Error: {
-      *out = std::make_unique<Handler<UnexpectedFieldBehavior::Error>>(pool);
+      *out = std::make_unique<Handler<UnexpectedFieldBehavior::Error>>(
+          pool, options.use_structural_index);
       break;
     }
     case UnexpectedFieldBehavior::InferType:
-      *out = std::make_unique<Handler<UnexpectedFieldBehavior::InferType>>(pool);
+      *out = std::make_unique<Handler<UnexpectedFieldBehavior::InferType>>(
+          pool, options.use_structural_index);
       break;
   }
   return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema);
 }
 
+Status BlockParser::MakeTyped(MemoryPool* pool, const ParseOptions& options,
+                              std::unique_ptr<BlockParser>* out) {
+  RETURN_NOT_OK(CheckTypedOptions(options));
+  auto handler = std::make_unique<TypedHandler>(
+      pool, options.unexpected_field_behavior, options.use_structural_index);
+  RETURN_NOT_OK(handler->Initialize(options.explicit_schema));
+  *out = std::move(handler);
+  return Status::OK();
+}
+
+bool BlockParser::CanMakeTyped(const ParseOptions& options) {
+  return CheckTypedOptions(options).ok();
+}
+
 Status BlockParser::Make(const ParseOptions& options, std::unique_ptr<BlockParser>* out) {
   return BlockParser::Make(default_memory_pool(), options, out);
 }
@@ -94,6 +94,28 @@ class ARROW_EXPORT BlockParser {
 
   static Status Make(const ParseOptions& options, std::unique_ptr<BlockParser>* out);
 
+  /// \brief Construct a BlockParser which converts values while parsing
+  ///
+  /// Rather than extracting unconverted strings, values are appended directly to
+  /// builders of the types in ParseOptions::explicit_schema and the parsed array
+  /// needs no Converter. Fields outside the schema are skipped without being stored
+  /// (or raise an error, per ParseOptions::unexpected_field_behavior).
+  ///
+  /// Requires an explicit schema and UnexpectedFieldBehavior::Ignore or
+  /// UnexpectedFieldBehavior::Error. Returns NotImplemented if the schema contains
+  /// a type which can't be converted while parsing (such as a dictionary).
+  ///
+  /// \param[in] pool MemoryPool to use when constructing parsed array
+  /// \param[in] options ParseOptions to use when parsing JSON
+  /// \param[out] out constructed BlockParser
+  static Status MakeTyped(MemoryPool* pool, const ParseOptions& options,
+                          std::unique_ptr<BlockParser>* out);
+
+  /// \brief Whether MakeTyped supports the given ParseOptions
+  ///
+  /// This only inspects the options, without constructing a BlockParser.
+  static bool CanMakeTyped(const ParseOptions& options);
+
  protected:
   ARROW_DISALLOW_COPY_AND_ASSIGN(BlockParser);
 
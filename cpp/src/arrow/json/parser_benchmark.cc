@@ -19,6 +19,7 @@
 
 #include <unordered_set>
 
+#include "arrow/json/chunked_builder.h"
 #include "arrow/json/chunker.h"
 #include "arrow/json/options.h"
 #include "arrow/json/parser.h"
@@ -26,6 +27,7 @@
 #include "arrow/json/test_common.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/task_group.h"
 
 namespace arrow {
 namespace json {
@@ -143,6 +145,7 @@ static void ParseJSONBlockWithSchema(
   auto options = ParseOptions::Defaults();
   options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
   options.explicit_schema = schema(TestFields());
+  options.use_structural_index = state.range(0) != 0;
 
   auto json = GenerateTestData(options.explicit_schema, num_rows);
   BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), options);
@@ -218,9 +221,55 @@ static void ParseJSONFields(benchmark::State& state) {  // NOLINT non-const refe
   BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), parse_options);
 }
 
+static void ParseJSONProjectedFields(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto num_fields = static_cast<int>(state.range(0));
+  const auto num_projected = static_cast<int>(state.range(1));
+  const bool convert_while_parsing = !!state.range(2);
+
+  // As in ParseJSONFields, generate at least 400 kB of JSON data
+  int32_t num_rows = std::max<int32_t>(static_cast<int32_t>(2e4 / num_fields), 200);
+
+  auto fields = GenerateTestFields(num_fields, 10);
+  auto json = GenerateTestData(fields, num_rows);
+  auto buffer = std::make_shared<Buffer>(json);
+
+  // Only the first few fields are requested, the rest are skipped
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.explicit_schema =
+      schema(FieldVector(fields.begin(), fields.begin() + num_projected));
+  parse_options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  auto type = struct_(parse_options.explicit_schema->fields());
+
+  for (auto _ : state) {
+    std::unique_ptr<BlockParser> parser;
+    std::shared_ptr<Array> parsed;
+    if (convert_while_parsing) {
+      ABORT_NOT_OK(
+          BlockParser::MakeTyped(default_memory_pool(), parse_options, &parser));
+      ABORT_NOT_OK(parser->Parse(buffer));
+      ABORT_NOT_OK(parser->Finish(&parsed));
+    } else {
+      ABORT_NOT_OK(BlockParser::Make(parse_options, &parser));
+      ABORT_NOT_OK(parser->Parse(buffer));
+      ABORT_NOT_OK(parser->Finish(&parsed));
+
+      std::shared_ptr<ChunkedArrayBuilder> builder;
+      ABORT_NOT_OK(MakeChunkedArrayBuilder(internal::TaskGroup::MakeSerial(),
+                                           default_memory_pool(), nullptr, type,
+                                           &builder));
+      builder->Insert(0, field("", parsed->type()), parsed);
+      std::shared_ptr<ChunkedArray> converted;
+      ABORT_NOT_OK(builder->Finish(&converted));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+  state.counters["json_size"] = static_cast<double>(json.size());
+}
+
 BENCHMARK(ChunkJSONPrettyPrinted);
 BENCHMARK(ChunkJSONLineDelimited);
-BENCHMARK(ParseJSONBlockWithSchema);
+BENCHMARK(ParseJSONBlockWithSchema)->ArgName("structural_index")->DenseRange(0, 1);
 
 BENCHMARK(ReadJSONBlockWithSchemaSingleThread);
 BENCHMARK(ReadJSONBlockWithSchemaMultiThread)->UseRealTime();
@@ -230,5 +279,9 @@ BENCHMARK(ParseJSONFields)
     ->ArgNames({"ordered", "schema", "sparsity", "num_fields"})
     ->ArgsProduct({{1, 0}, {1, 0}, {0, 10, 90}, {10, 100, 1000}});
 
+BENCHMARK(ParseJSONProjectedFields)
+    ->ArgNames({"num_fields", "num_projected", "convert_while_parsing"})
+    ->ArgsProduct({{100, 1000}, {1, 10}, {0, 1}});
+
 }  // namespace json
 }  // namespace arrow
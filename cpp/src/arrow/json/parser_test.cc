@@ -20,6 +20,7 @@
 #include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 
+#include <random>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -235,6 +236,144 @@ TEST(BlockParserWithSchema, FailOnIncompleteJson) {
   ASSERT_RAISES(Invalid, ParseFromString(options, "{\"a\":0, \"b\"", &parsed));
 }
 
+Status ParseTypedFromString(ParseOptions options, string_view src_str,
+                            std::shared_ptr<Array>* parsed) {
+  auto src = std::make_shared<Buffer>(src_str);
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::MakeTyped(default_memory_pool(), options, &parser));
+  RETURN_NOT_OK(parser->Parse(src));
+  return parser->Finish(parsed);
+}
+
+void AssertParseTyped(ParseOptions options, string_view src_str,
+                      const std::string& expected_json) {
+  std::shared_ptr<Array> parsed;
+  ASSERT_OK(ParseTypedFromString(options, src_str, &parsed));
+  ASSERT_OK(parsed->ValidateFull());
+  auto type = struct_(options.explicit_schema->fields());
+  auto expected = ArrayFromJSON(type, expected_json);
+  AssertArraysEqual(*expected, *parsed, /*verbose=*/true);
+}
+
+TEST(BlockParserTyped, Basics) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema =
+      schema({field("hello", float64()), field("world", boolean()), field("yo", utf8())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  AssertParseTyped(options, scalars_only_src(), R"([
+    {"hello": 3.5, "world": false, "yo": "thing"},
+    {"hello": 3.25, "world": null, "yo": null},
+    {"hello": 3.125, "world": null, "yo": "忍"},
+    {"hello": 0.0, "world": true, "yo": null}
+  ])");
+  AssertParseTyped(options, "", "[]");
+}
+
+TEST(BlockParserTyped, SkipFieldsOutsideSchema) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema({field("b", int64()), field("e", utf8())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  AssertParseTyped(options, R"(
+    {"a": 1, "b": 2, "c": {"d": [1, {"b": true}], "e": {}}, "e": "x", "f": [[]]}
+    {"e": "y", "a": null, "b": 3}
+    {"c": {"b": "z"}, "f": [{"e": 0}]}
+  )",
+                   R"([{"b": 2, "e": "x"}, {"b": 3, "e": "y"}, {"b": null, "e": null}])");
+}
+
+TEST(BlockParserTyped, Nested) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema({field("yo", utf8()), field("arr", list(int32())),
+                                    field("nuf", struct_({field("ps", int32())}))});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  AssertParseTyped(options, nested_src(), R"([
+    {"yo": "thing", "arr": [1, 2, 3], "nuf": {"ps": null}},
+    {"yo": null, "arr": [2], "nuf": null},
+    {"yo": "忍", "arr": [], "nuf": {"ps": 78}},
+    {"yo": null, "arr": null, "nuf": {"ps": 90}}
+  ])");
+}
+
+TEST(BlockParserTyped, TimestampAndDecimal) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema =
+      schema({field("price", decimal(9, 2)), field("cost", decimal256(9, 3)),
+              field("t", timestamp(TimeUnit::SECOND)), field("d", date32())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  AssertParseTyped(options, R"(
+    {"price": 30.04, "cost": 30.001, "t": "1970-01-01", "d": 1}
+    {"price": "1.2", "cost": "1.229", "t": "2018-11-13 17:11:10", "d": null}
+  )",
+                   R"([
+    {"price": "30.04", "cost": "30.001", "t": 0, "d": 1},
+    {"price": "1.20", "cost": "1.229", "t": 1542129070, "d": null}
+  ])");
+}
+
+TEST(BlockParserTyped, Errors) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema({field("a", int32()), field("b", utf8(), false)});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  std::shared_ptr<Array> parsed;
+
+  Status error = ParseTypedFromString(options, "{\"a\":0, \"b\":\"\", \"c\":1}", &parsed);
+  ASSERT_RAISES(Invalid, error);
+  EXPECT_THAT(error.message(), testing::StartsWith("JSON parse error: unexpected field"));
+
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  error = ParseTypedFromString(options, "{\"a\":0, \"b\":\"\"}\n{\"a\":true}", &parsed);
+  ASSERT_RAISES(Invalid, error);
+  EXPECT_THAT(
+      error.message(),
+      testing::StartsWith(
+          "JSON parse error: Column(/a) changed from number to boolean in row 1"));
+
+  error = ParseTypedFromString(options, "{\"a\":0, \"b\":\"\", \"a\":1}", &parsed);
+  ASSERT_RAISES(Invalid, error);
+  EXPECT_THAT(
+      error.message(),
+      testing::StartsWith("JSON parse error: Column(/a) was specified twice in row 0"));
+
+  error = ParseTypedFromString(options, "{\"a\":1.5, \"b\":\"\"}", &parsed);
+  ASSERT_RAISES(Invalid, error);
+  EXPECT_THAT(error.message(),
+              testing::StartsWith("Failed to convert JSON to int32, couldn't parse:1.5"));
+
+  error = ParseTypedFromString(options, "{\"a\":1}", &parsed);
+  ASSERT_RAISES(Invalid, error);
+  EXPECT_THAT(error.message(),
+              testing::StartsWith("JSON parse error: a required field was absent"));
+
+  error = ParseTypedFromString(options, "{\"a\":1, \"b\":null}", &parsed);
+  ASSERT_RAISES(Invalid, error);
+  EXPECT_THAT(error.message(),
+              testing::StartsWith("JSON parse error: a required field was null"));
+}
+
+TEST(BlockParserTyped, RequiresConvertibleSchema) {
+  auto options = ParseOptions::Defaults();
+  std::unique_ptr<BlockParser> parser;
+  ASSERT_FALSE(BlockParser::CanMakeTyped(options));
+  ASSERT_RAISES(Invalid, BlockParser::MakeTyped(default_memory_pool(), options, &parser));
+
+  options.explicit_schema = schema({field("a", dictionary(int32(), utf8()))});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  ASSERT_FALSE(BlockParser::CanMakeTyped(options));
+  ASSERT_RAISES(NotImplemented,
+                BlockParser::MakeTyped(default_memory_pool(), options, &parser));
+
+  options.explicit_schema =
+      schema({field("a", list(struct_({field("b", dictionary(int32(), utf8()))})))});
+  ASSERT_FALSE(BlockParser::CanMakeTyped(options));
+  ASSERT_RAISES(NotImplemented,
+                BlockParser::MakeTyped(default_memory_pool(), options, &parser));
+
+  options.explicit_schema =
+      schema({field("a", list(struct_({field("b", utf8())}))), field("c", int64())});
+  ASSERT_TRUE(BlockParser::CanMakeTyped(options));
+  ASSERT_OK(BlockParser::MakeTyped(default_memory_pool(), options, &parser));
+}
+
 TEST(BlockParser, Basics) {
   auto options = ParseOptions::Defaults();
   options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
@@ -321,5 +460,151 @@ TEST(BlockParser, AdHoc) {
        R"([{"c":true, "d": "1991-02-03"}, {"c":false, "d":"2019-04-01"}])"});
 }
 
+// Parse with and without the structural index and check that the results (or
+// errors) are identical
+void AssertStructuralIndexMatches(ParseOptions options, string_view src_str,
+                                  bool typed = false) {
+  auto parse = typed ? ParseTypedFromString
+                     : static_cast<Status (*)(ParseOptions, string_view,
+                                              std::shared_ptr<Array>*)>(ParseFromString);
+  std::shared_ptr<Array> expected, actual;
+  options.use_structural_index = false;
+  auto expected_status = parse(options, src_str, &expected);
+  options.use_structural_index = true;
+  auto actual_status = parse(options, src_str, &actual);
+  ASSERT_EQ(expected_status.ToString(), actual_status.ToString()) << src_str;
+  if (expected_status.ok()) {
+    AssertArraysEqual(*expected, *actual, /*verbose=*/true);
+  }
+}
+
+TEST(BlockParserStructuralIndex, Basics) {
+  auto options = ParseOptions::Defaults();
+  for (const auto& src : {scalars_only_src(), nested_src(), null_src()}) {
+    AssertStructuralIndexMatches(options, src);
+  }
+  AssertStructuralIndexMatches(options, "");
+  AssertStructuralIndexMatches(options, "  \n\t ");
+  AssertStructuralIndexMatches(options, R"({}{"a":[]}{"a":[[], [1, [{}]]]} {"b":{}})");
+  AssertStructuralIndexMatches(
+      options, R"({"n": [0, -0, 1.5, -2.5e10, 3E-2, 4e+1, NaN, Inf, -Infinity]})");
+
+  options.explicit_schema = schema({field("hello", float64()), field("yo", utf8())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  AssertStructuralIndexMatches(options, nested_src());
+  AssertStructuralIndexMatches(options, nested_src(), /*typed=*/true);
+}
+
+TEST(BlockParserStructuralIndex, PrettyPrinted) {
+  auto options = ParseOptions::Defaults();
+  std::string src;
+  for (const auto& row :
+       {R"({"a": [1, 2], "b": {"c": "d"}})", R"({"a": [], "b": null})"}) {
+    src += PrettyPrint(row) + "\n";
+  }
+  AssertStructuralIndexMatches(options, src);
+}
+
+TEST(BlockParserStructuralIndex, Strings) {
+  auto options = ParseOptions::Defaults();
+  AssertStructuralIndexMatches(options, R"({"a": "x\"y\\z\/\b\f\n\r\t", "b": "\\"}
+{"a": "é忍😀", "b": "\u0000"}
+{"a": "café caf)"
+                                        "\xc3\xa9"
+                                        R"(", "b": "{[:,]}"}
+{"\"a\"": 1}
+)");
+
+  // Strings and runs of backslashes across the 64 byte blocks of the index
+  for (int length = 55; length < 75; ++length) {
+    for (int num_backslashes = 1; num_backslashes < 4; ++num_backslashes) {
+      std::string value(length, 'x');
+      value += std::string(2 * num_backslashes, '\\') + "\\\"" + value;
+      AssertStructuralIndexMatches(options, "{\"a\": \"" + value + "\"}\n{\"a\": \"\"}");
+    }
+  }
+}
+
+TEST(BlockParserStructuralIndex, Errors) {
+  auto options = ParseOptions::Defaults();
+  auto assert_error = [&](std::string_view src, const std::string& message) {
+    // Same error as rapidjson's reader...
+    AssertStructuralIndexMatches(options, src);
+    // ...which is the expected one
+    auto index_options = options;
+    index_options.use_structural_index = true;
+    std::shared_ptr<Array> parsed;
+    auto status = ParseFromString(index_options, src, &parsed);
+    ASSERT_RAISES(Invalid, status) << src;
+    EXPECT_EQ(status.message(), "JSON parse error: " + message) << src;
+  };
+
+  const std::string invalid_value = "Invalid value. in row 0";
+  const std::string missing_comma_in_object =
+      "Missing a comma or '}' after an object member. in row 0";
+  const std::string missing_comma_in_array =
+      "Missing a comma or ']' after an array element. in row 0";
+  assert_error(R"({"a": tru})", invalid_value);
+  assert_error(R"({"a": nul)", invalid_value);
+  assert_error(R"({"a": -})", invalid_value);
+  assert_error(R"({"a": Infinit})", invalid_value);
+  assert_error(R"({"a": ]})", invalid_value);
+  assert_error(R"({"a": [1,]})", invalid_value);
+  assert_error(R"({"a": 1x})", missing_comma_in_object);
+  assert_error(R"({"a": 12-3})", missing_comma_in_object);
+  assert_error(R"({"a": "b"c})", missing_comma_in_object);
+  assert_error(R"({"a": 1 "b": 2})", missing_comma_in_object);
+  assert_error(R"({"a": [1 2]})", missing_comma_in_array);
+  assert_error(R"({"a": [1})", missing_comma_in_array);
+  assert_error(R"({"a" 1})", "Missing a colon after a name of object member. in row 0");
+  assert_error(R"({"a": 1,})", "Missing a name for object member. in row 0");
+  assert_error(R"({1: 1})", "Missing a name for object member. in row 0");
+  assert_error(R"({"a": 1.})", "Miss fraction part in number. in row 0");
+  assert_error(R"({"a": 1.e3})", "Miss fraction part in number. in row 0");
+  assert_error(R"({"a": 1e})", "Miss exponent in number. in row 0");
+  assert_error(R"({"a": "\q"})", "Invalid escape character in string. in row 0");
+  assert_error("{\"a\": \"\\\x01\"}", "Invalid escape character in string. in row 0");
+  assert_error(R"({"a": "\u12G4"})",
+               "Incorrect hex digit after \\u escape in string. in row 0");
+  assert_error(R"({"a": "\ud800"})", "The surrogate pair in string is invalid. in row 0");
+  assert_error(R"({"a": "\udc00"})", "The surrogate pair in string is invalid. in row 0");
+  assert_error("{\"a\": \"line\nbreak\"}", "Invalid encoding in string. in row 0");
+  assert_error("{}\n{\"a\": \"unterminated}",
+               "Missing a closing quotation mark in string. in row 1");
+  assert_error("{}\n{}\nx", "Invalid value. in row 2");
+  assert_error("{}\n}", "The document is empty.");
+
+  // Unlike rapidjson's reader, invalid UTF-8 is rejected
+  options.use_structural_index = true;
+  std::shared_ptr<Array> parsed;
+  auto status = ParseFromString(options, "{\"a\": \"\xff\"}", &parsed);
+  ASSERT_RAISES(Invalid, status);
+  EXPECT_EQ(status.message(), "JSON parse error: Invalid encoding in string.");
+}
+
+TEST(BlockParserStructuralIndex, RandomData) {
+  FieldVector fields = {
+      field("s", utf8()), field("f", float64()), field("l", list(utf8())),
+      field("st", struct_({field("b", boolean()), field("s", utf8())}))};
+  auto generate_options = GenerateOptions::Defaults();
+  generate_options.field_probability = 0.8;
+  generate_options.randomize_field_order = true;
+  std::default_random_engine engine(0x5eed);
+  std::string src;
+  for (int i = 0; i < 1000; ++i) {
+    StringBuffer string_buffer;
+    Writer writer(string_buffer);
+    ABORT_NOT_OK(Generate(fields, engine, &writer, generate_options));
+    src += string_buffer.GetString();
+    src += i % 3 == 0 ? "\n" : " ";
+  }
+
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema(fields);
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  AssertStructuralIndexMatches(options, src);
+  AssertStructuralIndexMatches(options, src, /*typed=*/true);
+}
+
 }  // namespace json
 }  // namespace arrow
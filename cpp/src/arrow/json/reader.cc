@@ -103,6 +103,9 @@ class DecodeContext {
         parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
             ? GetPromotionGraph()
             : nullptr;
+    // Without type inference, values can usually be converted while parsing
+    convert_while_parsing_ =
+        promotion_graph_ == nullptr && BlockParser::CanMakeTyped(parse_options_);
   }
 
   void SetSchema(std::shared_ptr<Schema> explicit_schema,
@@ -130,18 +133,29 @@ class DecodeContext {
     return conversion_type_;
   }
 
+  // If values are converted while parsing, the parsed array already has the
+  // conversion_type() and is passed through the ChunkedArrayBuilder unchanged
+  Status MakeBlockParser(std::unique_ptr<BlockParser>* out) const {
+    if (convert_while_parsing_) {
+      return BlockParser::MakeTyped(pool_, parse_options_, out);
+    }
+    return BlockParser::Make(pool_, parse_options_, out);
+  }
+
  private:
   ParseOptions parse_options_;
   std::shared_ptr<DataType> conversion_type_;
   const PromotionGraph* promotion_graph_;
+  bool convert_while_parsing_;
   MemoryPool* pool_;
 };
 
 Result<std::shared_ptr<Array>> ParseBlock(const ChunkedBlock& block,
-                                          const ParseOptions& parse_options,
-                                          MemoryPool* pool, int64_t* out_size = nullptr) {
+                                          const DecodeContext& context,
+                                          int64_t* out_size = nullptr) {
+  auto pool = context.pool();
   std::unique_ptr<BlockParser> parser;
-  RETURN_NOT_OK(BlockParser::Make(pool, parse_options, &parser));
+  RETURN_NOT_OK(context.MakeBlockParser(&parser));
 
   int64_t size = block.partial->size() + block.completion->size() + block.whole->size();
   RETURN_NOT_OK(parser->ReserveScalarStorage(size));
@@ -284,8 +298,7 @@ class TableReaderImpl : public TableReader,
   }
 
   Status ParseAndInsert(const ChunkedBlock& block) {
-    ARROW_ASSIGN_OR_RAISE(auto parsed, ParseBlock(block, decode_context_.parse_options(),
-                                                  decode_context_.pool()));
+    ARROW_ASSIGN_OR_RAISE(auto parsed, ParseBlock(block, decode_context_));
     builder_->Insert(block.index, field("", parsed->type()), parsed);
     return Status::OK();
   }
@@ -306,8 +319,7 @@ class DecodingOperator {
 
   Result<DecodedBlock> operator()(const ChunkedBlock& block) const {
     int64_t num_bytes;
-    ARROW_ASSIGN_OR_RAISE(auto unconverted, ParseBlock(block, context_->parse_options(),
-                                                       context_->pool(), &num_bytes));
+    ARROW_ASSIGN_OR_RAISE(auto unconverted, ParseBlock(block, *context_, &num_bytes));
 
     std::shared_ptr<ChunkedArrayBuilder> builder;
     RETURN_NOT_OK(MakeChunkedArrayBuilder(TaskGroup::MakeSerial(), context_->pool(),
@@ -539,7 +551,7 @@ Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
   DecodeContext context(std::move(options));
 
   std::unique_ptr<BlockParser> parser;
-  RETURN_NOT_OK(BlockParser::Make(context.parse_options(), &parser));
+  RETURN_NOT_OK(context.MakeBlockParser(&parser));
   RETURN_NOT_OK(parser->Parse(json));
   std::shared_ptr<Array> parsed;
   RETURN_NOT_OK(parser->Finish(&parsed));
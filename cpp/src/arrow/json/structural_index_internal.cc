@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/structural_index_internal.h"
+
+#include <cstring>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/byte_classifier_internal.h"
+#include "arrow/util/utf8.h"
+
+namespace arrow {
+namespace json {
+namespace internal {
+
+namespace {
+
+using ::arrow::internal::ByteClassifier;
+
+constexpr int64_t kBlockSize = ByteClassifier::kBlockSize;
+
+// The characters of interest in 64 bytes of JSON, in the order of the classes
+// of MakeClassifier()
+struct BlockMasks {
+  uint64_t quotes;
+  uint64_t backslashes;
+  // {}[]:,
+  uint64_t operators;
+  uint64_t whitespace;
+  // Bytes below 0x20
+  uint64_t controls;
+  // Bytes above 0x7F
+  uint64_t non_ascii;
+};
+
+ByteClassifier MakeClassifier() {
+  return ByteClassifier({ByteClassifier::Chars("\""), ByteClassifier::Chars("\\"),
+                         ByteClassifier::Chars("{}[]:,"),
+                         ByteClassifier::Chars(" \t\n\r"),
+                         ByteClassifier::Range(0x00, 0x1F),
+                         ByteClassifier::Range(0x80, 0xFF)});
+}
+
+void ComputeMasks(const ByteClassifier& classifier, const char* data,
+                  BlockMasks* masks) {
+  uint64_t classes[6];
+  classifier.Classify(data, classes);
+  *masks = {classes[0], classes[1], classes[2], classes[3], classes[4], classes[5]};
+}
+
+class Indexer {
+ public:
+  explicit Indexer(const ByteClassifier& classifier) : classifier_(classifier) {}
+
+  // Return a mask of the characters escaped by a backslash
+  uint64_t FindEscaped(uint64_t backslashes) {
+    if (backslashes == 0 && escaped_carry_ == 0) {
+      return 0;
+    }
+    // A backslash escaped at the end of the previous block isn't an escape
+    backslashes &= ~escaped_carry_;
+    const uint64_t follows_escape = (backslashes << 1) | escaped_carry_;
+    // Runs of backslashes starting on an odd position escape the character after
+    // them iff they end on an even position, and conversely. Adding the starts
+    // of the odd-started runs to the backslashes carries through each of them.
+    constexpr uint64_t kEvenBits = 0x5555555555555555ULL;
+    const uint64_t odd_starts = backslashes & ~kEvenBits & ~follows_escape;
+    const uint64_t even_started = odd_starts + backslashes;
+    escaped_carry_ = even_started < odd_starts ? 1 : 0;
+    const uint64_t invert_mask = even_started << 1;
+    return (kEvenBits ^ invert_mask) & follows_escape;
+  }
+
+  // Classify a block, returning the mask of tokens and setting
+  // *controls_in_strings to the mask of unescaped control characters in strings.
+  uint64_t Classify(const BlockMasks& masks, uint64_t* controls_in_strings) {
+    const uint64_t escaped = FindEscaped(masks.backslashes);
+    const uint64_t quotes = masks.quotes & ~escaped;
+    // Characters preceded by an odd number of quotes are inside strings (this
+    // includes the opening quotes but not the closing ones)
+    const uint64_t in_string = classifier_.PrefixXor(quotes) ^ in_string_carry_;
+    in_string_carry_ = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+    const uint64_t scalars = ~(masks.operators | masks.whitespace | quotes);
+    const uint64_t scalar_starts = scalars & ~((scalars << 1) | scalar_carry_);
+    scalar_carry_ = scalars >> 63;
+
+    *controls_in_strings = masks.controls & in_string & ~escaped;
+    return ((masks.operators | scalar_starts) & ~in_string) | quotes;
+  }
+
+ private:
+  const ByteClassifier& classifier_;
+  uint64_t escaped_carry_ = 0;
+  // All ones if the end of the previous block was inside a string
+  uint64_t in_string_carry_ = 0;
+  uint64_t scalar_carry_ = 0;
+};
+
+}  // namespace
+
+Status StructuralIndex::Build(const char* data, int64_t size) {
+  if (size > kMaxSize) {
+    return Status::Invalid("JSON block too large to index: ", size, " bytes");
+  }
+  data_ = data;
+  size_ = size;
+  first_control_in_string_ = size;
+  // Each character is at most one token, plus the sentinel
+  const int64_t capacity = (size + 1) * static_cast<int64_t>(sizeof(uint32_t));
+  if (positions_ == NULLPTR) {
+    ARROW_ASSIGN_OR_RAISE(positions_, AllocateResizableBuffer(capacity, pool_));
+  } else if (positions_->size() < capacity) {
+    RETURN_NOT_OK(positions_->Resize(capacity, /*shrink_to_fit=*/false));
+  }
+  uint32_t* const begin = positions_->mutable_data_as<uint32_t>();
+  uint32_t* out = begin;
+
+  static const ByteClassifier classifier = MakeClassifier();
+  Indexer indexer(classifier);
+  uint64_t non_ascii = 0;
+  for (int64_t offset = 0; offset < size; offset += kBlockSize) {
+    BlockMasks masks;
+    if (ARROW_PREDICT_TRUE(size - offset >= kBlockSize)) {
+      ComputeMasks(classifier, data + offset, &masks);
+    } else {
+      // Pad the last block with whitespace
+      char padded[kBlockSize];
+      std::memset(padded, ' ', kBlockSize);
+      std::memcpy(padded, data + offset, static_cast<size_t>(size - offset));
+      ComputeMasks(classifier, padded, &masks);
+    }
+    non_ascii |= masks.non_ascii;
+
+    uint64_t controls_in_strings;
+    uint64_t tokens = indexer.Classify(masks, &controls_in_strings);
+    if (ARROW_PREDICT_FALSE(controls_in_strings != 0) &&
+        first_control_in_string_ == size) {
+      first_control_in_string_ =
+          offset + bit_util::CountTrailingZeros(controls_in_strings);
+    }
+    while (tokens != 0) {
+      *out++ = static_cast<uint32_t>(offset + bit_util::CountTrailingZeros(tokens));
+      tokens &= tokens - 1;
+    }
+  }
+  *out++ = static_cast<uint32_t>(size);
+  num_positions_ = out - begin;
+
+  if (ARROW_PREDICT_FALSE(non_ascii != 0)) {
+    util::InitializeUTF8();
+    if (!util::ValidateUTF8(reinterpret_cast<const uint8_t*>(data), size)) {
+      return Status::Invalid("JSON parse error: Invalid encoding in string.");
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace internal
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,525 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace json {
+namespace internal {
+
+//
+// Two-stage tokenization: rather than running a character-at-a-time state
+// machine, classify 64 bytes at a time into bitmasks of quotes, backslashes,
+// structural characters and whitespace, and extract the positions of the tokens
+// (stage 1). The parser then walks these positions, validating the grammar and
+// replaying the same events as a rapidjson SAX reader (stage 2).
+//
+
+/// \brief Stage 1: the positions of the tokens of a block of JSON
+///
+/// The index holds, in order, the positions of:
+/// - the structural characters `{}[]:,` outside of strings
+/// - the opening and closing (unescaped) quotes of strings
+/// - the first character of scalars (numbers, literals) outside of strings
+/// followed by a sentinel equal to the size of the block.
+class ARROW_EXPORT StructuralIndex {
+ public:
+  /// The largest block which can be indexed
+  static constexpr int64_t kMaxSize = std::numeric_limits<uint32_t>::max() - 1;
+
+  explicit StructuralIndex(MemoryPool* pool = default_memory_pool()) : pool_(pool) {}
+
+  /// \brief Index a block of JSON
+  ///
+  /// Also validates that the block is valid UTF-8.
+  Status Build(const char* data, int64_t size);
+
+  const char* data() const { return data_; }
+  int64_t size() const { return size_; }
+  const uint32_t* positions() const {
+    return positions_ ? positions_->data_as<uint32_t>() : NULLPTR;
+  }
+  int64_t num_positions() const { return num_positions_; }
+
+  /// \brief The position of the first unescaped control character inside a
+  /// string, or size() if there is none
+  int64_t first_control_in_string() const { return first_control_in_string_; }
+
+ private:
+  MemoryPool* pool_;
+  const char* data_ = NULLPTR;
+  int64_t size_ = 0;
+  std::unique_ptr<ResizableBuffer> positions_;
+  int64_t num_positions_ = 0;
+  int64_t first_control_in_string_ = 0;
+};
+
+/// \brief Stage 2: feed each row of an indexed block to a rapidjson handler
+///
+/// Events are emitted as rapidjson's iterative reader would with the
+/// kParseNanAndInfFlag, kParseStopWhenDoneFlag and kParseNumbersAsStringsFlag
+/// flags, and errors have the same messages. num_rows is incremented for each
+/// row parsed and is used to locate errors.
+template <typename Handler>
+class TokenReplayer {
+ public:
+  TokenReplayer(Handler& handler, const StructuralIndex& index)
+      : handler_(handler),
+        data_(index.data()),
+        size_(index.size()),
+        positions_(index.positions()),
+        first_control_in_string_(index.first_control_in_string()) {}
+
+  Status ReplayRows(int32_t* num_rows) {
+    num_rows_ = num_rows;
+    for (; *num_rows_ < std::numeric_limits<int32_t>::max(); ++*num_rows_) {
+      const int64_t pos = Next();
+      if (pos == size_) {
+        // parsed all rows, finish
+        return Status::OK();
+      }
+      switch (data_[pos]) {
+        case ':':
+        case ',':
+        case ']':
+        case '}':
+        case '\0':
+          // Not the start of a value
+          return Status::Invalid("JSON parse error: The document is empty.");
+        default:
+          break;
+      }
+      RETURN_NOT_OK(ReplayValue(pos));
+    }
+    return Status::Invalid("Row count overflowed int32_t");
+  }
+
+ private:
+  struct Frame {
+    bool is_object;
+    uint32_t size;
+  };
+
+  // The position of the next token, or size_ at the end of the block
+  int64_t Next() {
+    if (ARROW_PREDICT_FALSE(pending_ >= 0)) {
+      const int64_t pos = pending_;
+      pending_ = -1;
+      return pos;
+    }
+    return positions_[next_++];
+  }
+
+  char CharAt(int64_t pos) const { return pos < size_ ? data_[pos] : '\0'; }
+
+  static bool IsScalarChar(char c) {
+    switch (c) {
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+      case '"':
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\r':
+        return false;
+      default:
+        return true;
+    }
+  }
+
+  Status Error(const char* message) const {
+    return Status::Invalid("JSON parse error: ", message, " in row ", *num_rows_);
+  }
+
+  Status ReplayValue(int64_t pos) {
+    stack_.clear();
+    while (true) {
+      // Parse a value starting at pos
+      switch (CharAt(pos)) {
+        case '{':
+          if (ARROW_PREDICT_FALSE(!handler_.StartObject())) {
+            return handler_.Error();
+          }
+          pos = Next();
+          if (CharAt(pos) == '}') {
+            if (ARROW_PREDICT_FALSE(!handler_.EndObject(0))) {
+              return handler_.Error();
+            }
+            break;
+          }
+          stack_.push_back({true, 0});
+          RETURN_NOT_OK(ReplayKey(pos));
+          pos = Next();
+          continue;
+        case '[':
+          if (ARROW_PREDICT_FALSE(!handler_.StartArray())) {
+            return handler_.Error();
+          }
+          pos = Next();
+          if (CharAt(pos) == ']') {
+            if (ARROW_PREDICT_FALSE(!handler_.EndArray(0))) {
+              return handler_.Error();
+            }
+            break;
+          }
+          stack_.push_back({false, 0});
+          continue;
+        case '"': {
+          const char* str = NULLPTR;
+          uint32_t length = 0;
+          RETURN_NOT_OK(ReplayString(pos, &str, &length));
+          if (ARROW_PREDICT_FALSE(!handler_.String(str, length, true))) {
+            return handler_.Error();
+          }
+          break;
+        }
+        default:
+          RETURN_NOT_OK(ReplayScalar(pos));
+          break;
+      }
+
+      // A value was completed: close the containers which end here and
+      // find the start of the next value
+      while (true) {
+        if (stack_.empty()) {
+          return Status::OK();
+        }
+        Frame& frame = stack_.back();
+        ++frame.size;
+        pos = Next();
+        const char c = CharAt(pos);
+        if (c == ',') {
+          pos = Next();
+          if (frame.is_object) {
+            RETURN_NOT_OK(ReplayKey(pos));
+            pos = Next();
+          }
+          break;
+        }
+        if (frame.is_object) {
+          if (ARROW_PREDICT_FALSE(c != '}')) {
+            return Error("Missing a comma or '}' after an object member.");
+          }
+          if (ARROW_PREDICT_FALSE(!handler_.EndObject(frame.size))) {
+            return handler_.Error();
+          }
+        } else {
+          if (ARROW_PREDICT_FALSE(c != ']')) {
+            return Error("Missing a comma or ']' after an array element.");
+          }
+          if (ARROW_PREDICT_FALSE(!handler_.EndArray(frame.size))) {
+            return handler_.Error();
+          }
+        }
+        stack_.pop_back();
+      }
+      // pos is now the start of a member value or array element; tokens which
+      // can't start a value are rejected by ScanNumber()
+    }
+  }
+
+  // Parse an object key at pos and the colon following it
+  Status ReplayKey(int64_t pos) {
+    if (ARROW_PREDICT_FALSE(CharAt(pos) != '"')) {
+      return Error("Missing a name for object member.");
+    }
+    const char* str = NULLPTR;
+    uint32_t length = 0;
+    RETURN_NOT_OK(ReplayString(pos, &str, &length));
+    if (ARROW_PREDICT_FALSE(!handler_.Key(str, length, true))) {
+      return handler_.Error();
+    }
+    if (ARROW_PREDICT_FALSE(CharAt(Next()) != ':')) {
+      return Error("Missing a colon after a name of object member.");
+    }
+    return Status::OK();
+  }
+
+  // Parse the string whose opening quote is at pos
+  Status ReplayString(int64_t pos, const char** out, uint32_t* length) {
+    const int64_t begin = pos + 1;
+    const int64_t end = Next();
+    if (ARROW_PREDICT_FALSE(first_control_in_string_ < end)) {
+      return Error(data_[first_control_in_string_] == '\0'
+                       ? "Missing a closing quotation mark in string."
+                       : "Invalid encoding in string.");
+    }
+    if (ARROW_PREDICT_FALSE(end == size_)) {
+      return Error("Missing a closing quotation mark in string.");
+    }
+    const char* str = data_ + begin;
+    const auto str_length = static_cast<size_t>(end - begin);
+    if (ARROW_PREDICT_TRUE(std::memchr(str, '\\', str_length) == NULLPTR)) {
+      *out = str;
+      *length = static_cast<uint32_t>(str_length);
+      return Status::OK();
+    }
+    RETURN_NOT_OK(Unescape(str, str + str_length));
+    *out = scratch_.data();
+    *length = static_cast<uint32_t>(scratch_.size());
+    return Status::OK();
+  }
+
+  static int HexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+  }
+
+  // Parse the 4 hex digits of a \u escape
+  static bool ParseHex4(const char* p, const char* end, uint32_t* out) {
+    if (end - p < 4) {
+      return false;
+    }
+    uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) {
+      const int digit = HexValue(p[i]);
+      if (digit < 0) {
+        return false;
+      }
+      value = (value << 4) | static_cast<uint32_t>(digit);
+    }
+    *out = value;
+    return true;
+  }
+
+  void AppendUTF8(uint32_t codepoint) {
+    if (codepoint < 0x80) {
+      scratch_.push_back(static_cast<char>(codepoint));
+    } else if (codepoint < 0x800) {
+      scratch_.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+      scratch_.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    } else if (codepoint < 0x10000) {
+      scratch_.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+      scratch_.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+      scratch_.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    } else {
+      scratch_.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+      scratch_.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+      scratch_.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+      scratch_.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    }
+  }
+
+  Status Unescape(const char* p, const char* end) {
+    scratch_.clear();
+    while (p < end) {
+      const char* backslash =
+          static_cast<const char*>(std::memchr(p, '\\', static_cast<size_t>(end - p)));
+      if (backslash == NULLPTR) {
+        scratch_.append(p, end);
+        break;
+      }
+      scratch_.append(p, backslash);
+      // The closing quote can't be escaped, so there is a character after the
+      // backslash
+      p = backslash + 2;
+      switch (backslash[1]) {
+        case '"':
+        case '\\':
+        case '/':
+          scratch_.push_back(backslash[1]);
+          break;
+        case 'b':
+          scratch_.push_back('\b');
+          break;
+        case 'f':
+          scratch_.push_back('\f');
+          break;
+        case 'n':
+          scratch_.push_back('\n');
+          break;
+        case 'r':
+          scratch_.push_back('\r');
+          break;
+        case 't':
+          scratch_.push_back('\t');
+          break;
+        case 'u': {
+          uint32_t codepoint;
+          if (!ParseHex4(p, end, &codepoint)) {
+            return Error("Incorrect hex digit after \\u escape in string.");
+          }
+          p += 4;
+          if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+            // A high surrogate must be followed by an escaped low surrogate
+            uint32_t low;
+            if (end - p < 2 || p[0] != '\\' || p[1] != 'u') {
+              return Error("The surrogate pair in string is invalid.");
+            }
+            if (!ParseHex4(p + 2, end, &low)) {
+              return Error("Incorrect hex digit after \\u escape in string.");
+            }
+            if (low < 0xDC00 || low > 0xDFFF) {
+              return Error("The surrogate pair in string is invalid.");
+            }
+            p += 6;
+            codepoint = (((codepoint - 0xD800) << 10) | (low - 0xDC00)) + 0x10000;
+          } else if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+            return Error("The surrogate pair in string is invalid.");
+          }
+          AppendUTF8(codepoint);
+          break;
+        }
+        default:
+          return Error("Invalid escape character in string.");
+      }
+    }
+    return Status::OK();
+  }
+
+  static bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+  bool ConsumeLiteral(int64_t* pos, const char* literal, int64_t length) const {
+    if (size_ - *pos < length ||
+        std::memcmp(data_ + *pos, literal, static_cast<size_t>(length)) != 0) {
+      return false;
+    }
+    *pos += length;
+    return true;
+  }
+
+  // Parse a number or literal starting at pos
+  Status ReplayScalar(int64_t pos) {
+    int64_t end = pos;
+    bool ok;
+    switch (CharAt(pos)) {
+      case 't':
+        if (!ConsumeLiteral(&end, "true", 4)) {
+          return Error("Invalid value.");
+        }
+        ok = handler_.Bool(true);
+        break;
+      case 'f':
+        if (!ConsumeLiteral(&end, "false", 5)) {
+          return Error("Invalid value.");
+        }
+        ok = handler_.Bool(false);
+        break;
+      case 'n':
+        if (!ConsumeLiteral(&end, "null", 4)) {
+          return Error("Invalid value.");
+        }
+        ok = handler_.Null();
+        break;
+      default:
+        RETURN_NOT_OK(ScanNumber(&end));
+        ok = handler_.RawNumber(data_ + pos, static_cast<uint32_t>(end - pos), true);
+        break;
+    }
+    if (ARROW_PREDICT_FALSE(!ok)) {
+      return handler_.Error();
+    }
+    if (ARROW_PREDICT_FALSE(end < size_ && IsScalarChar(data_[end]))) {
+      // Trailing characters aren't part of the scalar (and weren't indexed as
+      // the start of a token); make them the next token so that they are
+      // reported in the context of the enclosing value.
+      pending_ = end;
+    }
+    return Status::OK();
+  }
+
+  Status ScanNumber(int64_t* pos) const {
+    int64_t p = *pos;
+    if (CharAt(p) == '-') {
+      ++p;
+    }
+    const char first = CharAt(p);
+    if (first == '0') {
+      ++p;
+    } else if (first >= '1' && first <= '9') {
+      while (IsDigit(CharAt(++p))) {
+      }
+    } else if (first == 'N') {
+      if (!ConsumeLiteral(&p, "NaN", 3)) {
+        return Error("Invalid value.");
+      }
+      *pos = p;
+      return Status::OK();
+    } else if (first == 'I') {
+      if (!ConsumeLiteral(&p, "Inf", 3) ||
+          (CharAt(p) == 'i' && !ConsumeLiteral(&p, "inity", 5))) {
+        return Error("Invalid value.");
+      }
+      *pos = p;
+      return Status::OK();
+    } else {
+      return Error("Invalid value.");
+    }
+    if (CharAt(p) == '.') {
+      if (!IsDigit(CharAt(++p))) {
+        return Error("Miss fraction part in number.");
+      }
+      while (IsDigit(CharAt(++p))) {
+      }
+    }
+    if (CharAt(p) == 'e' || CharAt(p) == 'E') {
+      ++p;
+      if (CharAt(p) == '+' || CharAt(p) == '-') {
+        ++p;
+      }
+      if (!IsDigit(CharAt(p))) {
+        return Error("Miss exponent in number.");
+      }
+      while (IsDigit(CharAt(++p))) {
+      }
+    }
+    *pos = p;
+    return Status::OK();
+  }
+
+  Handler& handler_;
+  const char* data_;
+  const int64_t size_;
+  const uint32_t* positions_;
+  const int64_t first_control_in_string_;
+  int64_t next_ = 0;
+  // A position to return from Next() before resuming with the index
+  int64_t pending_ = -1;
+  int32_t* num_rows_ = NULLPTR;
+  std::vector<Frame> stack_;
+  std::string scratch_;
+};
+
+/// \brief Feed each row of a block of JSON to a rapidjson handler, using a
+/// structural index
+template <typename Handler>
+Status ReplayRows(Handler& handler, const StructuralIndex& index, int32_t* num_rows) {
+  return TokenReplayer<Handler>(handler, index).ReplayRows(num_rows);
+}
+
+}  // namespace internal
+}  // namespace json
+}  // namespace arrow
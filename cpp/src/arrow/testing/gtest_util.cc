@@ -389,6 +389,16 @@ std::shared_ptr<Array> DictArrayFromJSON(const std::shared_ptr<DataType>& type,
   return out;
 }
 
+std::shared_ptr<Array> RunEndEncodedArrayFromJSON(
+    int64_t length, const std::shared_ptr<DataType>& run_end_type,
+    std::string_view run_ends_json, const std::shared_ptr<DataType>& value_type,
+    std::string_view values_json) {
+  EXPECT_OK_AND_ASSIGN(auto out, RunEndEncodedArray::Make(
+                                     length, ArrayFromJSON(run_end_type, run_ends_json),
+                                     ArrayFromJSON(value_type, values_json)));
+  return out;
+}
+
 std::shared_ptr<ChunkedArray> ChunkedArrayFromJSON(const std::shared_ptr<DataType>& type,
                                                    const std::vector<std::string>& json) {
   std::shared_ptr<ChunkedArray> out;
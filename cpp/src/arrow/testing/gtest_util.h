@@ -333,6 +333,12 @@ std::shared_ptr<Array> DictArrayFromJSON(const std::shared_ptr<DataType>& type,
                                          std::string_view indices_json,
                                          std::string_view dictionary_json);
 
+ARROW_TESTING_EXPORT
+std::shared_ptr<Array> RunEndEncodedArrayFromJSON(
+    int64_t length, const std::shared_ptr<DataType>& run_end_type,
+    std::string_view run_ends_json, const std::shared_ptr<DataType>& value_type,
+    std::string_view values_json);
+
 ARROW_TESTING_EXPORT
 std::shared_ptr<RecordBatch> RecordBatchFromJSON(const std::shared_ptr<Schema>&,
                                                  std::string_view);
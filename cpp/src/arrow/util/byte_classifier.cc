@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/byte_classifier_internal.h"
+
+#include "arrow/util/dispatch.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+void ClassifyBytesDefault(const ByteClassSpec& spec, const char* data,
+                          uint64_t* masks) {
+  for (int k = 0; k < spec.num_classes; ++k) {
+    masks[k] = 0;
+  }
+  for (int i = 0; i < ByteClassifier::kBlockSize; ++i) {
+    const uint8_t classes = spec.table[static_cast<uint8_t>(data[i])];
+    if (classes != 0) {
+      for (int k = 0; k < spec.num_classes; ++k) {
+        masks[k] |= static_cast<uint64_t>((classes >> k) & 1) << i;
+      }
+    }
+  }
+}
+
+#if defined(ARROW_HAVE_SSE4_2)
+void ClassifyBytesSse42(const ByteClassSpec& spec, const char* data, uint64_t* masks) {
+  __m128i v[4];
+  for (int j = 0; j < 4; ++j) {
+    v[j] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * j));
+  }
+  for (int k = 0; k < spec.num_classes; ++k) {
+    __m128i match[4] = {_mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128(),
+                        _mm_setzero_si128()};
+    for (int c = 0; c < spec.num_chars[k]; ++c) {
+      const __m128i needle = _mm_set1_epi8(spec.chars[k][c]);
+      for (int j = 0; j < 4; ++j) {
+        match[j] = _mm_or_si128(match[j], _mm_cmpeq_epi8(v[j], needle));
+      }
+    }
+    if (spec.has_range[k]) {
+      const __m128i min = _mm_set1_epi8(static_cast<char>(spec.range_min[k]));
+      const __m128i max = _mm_set1_epi8(static_cast<char>(spec.range_max[k]));
+      for (int j = 0; j < 4; ++j) {
+        const __m128i in_range =
+            _mm_and_si128(_mm_cmpeq_epi8(_mm_max_epu8(v[j], min), v[j]),
+                          _mm_cmpeq_epi8(_mm_min_epu8(v[j], max), v[j]));
+        match[j] = _mm_or_si128(match[j], in_range);
+      }
+    }
+    uint64_t mask = 0;
+    for (int j = 0; j < 4; ++j) {
+      mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(match[j])))
+              << (16 * j);
+    }
+    masks[k] = mask;
+  }
+}
+#endif
+
+struct ClassifyBytesDynamicFunction {
+  using FunctionType = ByteClassifier::ClassifyFunction;
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, ClassifyBytesDefault}
+#if defined(ARROW_HAVE_SSE4_2)
+            ,
+            {DispatchLevel::SSE4_2, ClassifyBytesSse42}
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+            ,
+            {DispatchLevel::AVX2, avx2::ClassifyBytes}
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+            ,
+            {DispatchLevel::AVX512, avx512::ClassifyBytes}
+#endif
+    };
+  }
+};
+
+struct PrefixXorDynamicFunction {
+  using FunctionType = ByteClassifier::PrefixXorFunction;
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, PrefixXorPortable}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+            ,
+            {DispatchLevel::AVX2, avx2::PrefixXor}
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+            ,
+            {DispatchLevel::AVX512, avx512::PrefixXor}
+#endif
+    };
+  }
+};
+
+const DynamicDispatch<ClassifyBytesDynamicFunction>& ClassifyBytesDispatch() {
+  static DynamicDispatch<ClassifyBytesDynamicFunction> dispatch;
+  return dispatch;
+}
+
+const DynamicDispatch<PrefixXorDynamicFunction>& PrefixXorDispatch() {
+  static DynamicDispatch<PrefixXorDynamicFunction> dispatch;
+  return dispatch;
+}
+
+}  // namespace
+
+ByteClassifier::ByteClassifier(const std::vector<ByteClass>& classes)
+    : classify_(ClassifyBytesDispatch().func), prefix_xor_(PrefixXorDispatch().func) {
+  DCHECK_LE(classes.size(), static_cast<size_t>(ByteClassSpec::kMaxClasses));
+  spec_.num_classes = static_cast<int>(classes.size());
+  for (int k = 0; k < spec_.num_classes; ++k) {
+    const ByteClass& cls = classes[k];
+    DCHECK_LE(cls.chars.size(), static_cast<size_t>(ByteClassSpec::kMaxChars));
+    spec_.num_chars[k] = static_cast<int>(cls.chars.size());
+    for (int c = 0; c < spec_.num_chars[k]; ++c) {
+      spec_.chars[k][c] = cls.chars[c];
+      spec_.table[static_cast<uint8_t>(cls.chars[c])] |= static_cast<uint8_t>(1 << k);
+    }
+    spec_.has_range[k] = cls.has_range;
+    spec_.range_min[k] = cls.range_min;
+    spec_.range_max[k] = cls.range_max;
+    if (cls.has_range) {
+      for (int b = cls.range_min; b <= cls.range_max; ++b) {
+        spec_.table[b] |= static_cast<uint8_t>(1 << k);
+      }
+    }
+  }
+}
+
+bool ByteClassifier::IsVectorized() {
+  return ClassifyBytesDispatch().func != ClassifyBytesDefault;
+}
+
+}  // namespace internal
+}  // namespace arrow
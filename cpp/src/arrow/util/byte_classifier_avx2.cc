@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "arrow/util/byte_classifier_internal.h"
+
+namespace arrow {
+namespace internal {
+namespace avx2 {
+
+namespace {
+
+uint64_t ToMask(__m256i lo, __m256i hi) {
+  const auto lo_bits = static_cast<uint32_t>(_mm256_movemask_epi8(lo));
+  const auto hi_bits = static_cast<uint32_t>(_mm256_movemask_epi8(hi));
+  return static_cast<uint64_t>(lo_bits) | (static_cast<uint64_t>(hi_bits) << 32);
+}
+
+}  // namespace
+
+void ClassifyBytes(const ByteClassSpec& spec, const char* data, uint64_t* masks) {
+  const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+  const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32));
+  for (int k = 0; k < spec.num_classes; ++k) {
+    __m256i lo_match = _mm256_setzero_si256();
+    __m256i hi_match = _mm256_setzero_si256();
+    for (int c = 0; c < spec.num_chars[k]; ++c) {
+      const __m256i needle = _mm256_set1_epi8(spec.chars[k][c]);
+      lo_match = _mm256_or_si256(lo_match, _mm256_cmpeq_epi8(lo, needle));
+      hi_match = _mm256_or_si256(hi_match, _mm256_cmpeq_epi8(hi, needle));
+    }
+    if (spec.has_range[k]) {
+      const __m256i min = _mm256_set1_epi8(static_cast<char>(spec.range_min[k]));
+      const __m256i max = _mm256_set1_epi8(static_cast<char>(spec.range_max[k]));
+      auto in_range = [&](__m256i v) {
+        return _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_max_epu8(v, min), v),
+                                _mm256_cmpeq_epi8(_mm256_min_epu8(v, max), v));
+      };
+      lo_match = _mm256_or_si256(lo_match, in_range(lo));
+      hi_match = _mm256_or_si256(hi_match, in_range(hi));
+    }
+    masks[k] = ToMask(lo_match, hi_match);
+  }
+}
+
+uint64_t PrefixXor(uint64_t bits) {
+#if defined(__PCLMUL__)
+  // Carry-less multiplication by all ones
+  return static_cast<uint64_t>(_mm_cvtsi128_si64(_mm_clmulepi64_si128(
+      _mm_set_epi64x(0, static_cast<int64_t>(bits)), _mm_set1_epi8(-1), 0)));
+#else
+  return PrefixXorPortable(bits);
+#endif
+}
+
+}  // namespace avx2
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,54 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "arrow/util/byte_classifier_internal.h"
+
+namespace arrow {
+namespace internal {
+namespace avx512 {
+
+void ClassifyBytes(const ByteClassSpec& spec, const char* data, uint64_t* masks) {
+  const __m512i v = _mm512_loadu_si512(data);
+  for (int k = 0; k < spec.num_classes; ++k) {
+    __mmask64 match = 0;
+    for (int c = 0; c < spec.num_chars[k]; ++c) {
+      match |= _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8(spec.chars[k][c]));
+    }
+    if (spec.has_range[k]) {
+      const __m512i min = _mm512_set1_epi8(static_cast<char>(spec.range_min[k]));
+      const __m512i max = _mm512_set1_epi8(static_cast<char>(spec.range_max[k]));
+      match |= _mm512_cmpge_epu8_mask(v, min) & _mm512_cmple_epu8_mask(v, max);
+    }
+    masks[k] = match;
+  }
+}
+
+uint64_t PrefixXor(uint64_t bits) {
+#if defined(__PCLMUL__)
+  // Carry-less multiplication by all ones
+  return static_cast<uint64_t>(_mm_cvtsi128_si64(_mm_clmulepi64_si128(
+      _mm_set_epi64x(0, static_cast<int64_t>(bits)), _mm_set1_epi8(-1), 0)));
+#else
+  return PrefixXorPortable(bits);
+#endif
+}
+
+}  // namespace avx512
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief The classes of bytes looked for by a ByteClassifier
+///
+/// Class i is made of the first num_chars[i] characters of chars[i], and of
+/// the byte values between range_min[i] and range_max[i] if has_range[i].
+struct ByteClassSpec {
+  static constexpr int kMaxClasses = 8;
+  static constexpr int kMaxChars = 8;
+
+  int num_classes = 0;
+  int num_chars[kMaxClasses] = {};
+  char chars[kMaxClasses][kMaxChars] = {};
+  bool has_range[kMaxClasses] = {};
+  uint8_t range_min[kMaxClasses] = {};
+  uint8_t range_max[kMaxClasses] = {};
+  // For each byte value, the bitmap of the classes it belongs to
+  uint8_t table[256] = {};
+};
+
+/// \brief Classify blocks of 64 bytes into bitmasks, one per class of bytes,
+/// with the best instruction set available at runtime
+///
+/// This is the first stage of the structural indexes used by the text parsers
+/// (CSV, JSON): special characters are found 64 bytes at a time, then
+/// processed with bitwise operations.
+class ARROW_EXPORT ByteClassifier {
+ public:
+  static constexpr int64_t kBlockSize = 64;
+
+  /// \brief A class of bytes
+  struct ByteClass {
+    /// Up to ByteClassSpec::kMaxChars characters
+    std::string chars;
+    /// If true, the byte values between range_min and range_max (inclusive)
+    /// also belong to the class
+    bool has_range = false;
+    uint8_t range_min = 0;
+    uint8_t range_max = 0;
+  };
+
+  static ByteClass Chars(std::string chars) { return {std::move(chars)}; }
+  static ByteClass Range(uint8_t min, uint8_t max) { return {"", true, min, max}; }
+
+  /// \brief Create a classifier for up to ByteClassSpec::kMaxClasses classes
+  explicit ByteClassifier(const std::vector<ByteClass>& classes);
+
+  /// \brief Set masks[i] to the bitmask of the bytes of data[0, 64) in class i
+  void Classify(const char* data, uint64_t* masks) const {
+    classify_(spec_, data, masks);
+  }
+
+  /// \brief Return a mask with each bit set iff an odd number of bits are set
+  /// at or below its position in `bits`
+  uint64_t PrefixXor(uint64_t bits) const { return prefix_xor_(bits); }
+
+  /// \brief Whether a SIMD implementation is available on this CPU
+  static bool IsVectorized();
+
+  using ClassifyFunction = void (*)(const ByteClassSpec&, const char*, uint64_t*);
+  using PrefixXorFunction = uint64_t (*)(uint64_t);
+
+ private:
+  ByteClassSpec spec_;
+  ClassifyFunction classify_;
+  PrefixXorFunction prefix_xor_;
+};
+
+/// \brief Portable implementation of ByteClassifier::PrefixXor
+inline uint64_t PrefixXorPortable(uint64_t bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+namespace avx2 {
+void ClassifyBytes(const ByteClassSpec& spec, const char* data, uint64_t* masks);
+uint64_t PrefixXor(uint64_t bits);
+}  // namespace avx2
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+namespace avx512 {
+void ClassifyBytes(const ByteClassSpec& spec, const char* data, uint64_t* masks);
+uint64_t PrefixXor(uint64_t bits);
+}  // namespace avx512
+#endif
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/byte_classifier_internal.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace arrow {
+namespace internal {
+
+TEST(ByteClassifier, Classify) {
+  ByteClassifier classifier({ByteClassifier::Chars(","), ByteClassifier::Chars("\r\n"),
+                             ByteClassifier::Chars(""), ByteClassifier::Range(0, 0x1f),
+                             ByteClassifier::Range(0x80, 0xff)});
+  auto expected_classes = [](uint8_t c) {
+    return std::vector<bool>{c == ',', c == '\r' || c == '\n', false, c < 0x20,
+                             c >= 0x80};
+  };
+
+  std::default_random_engine rng(42);
+  std::uniform_int_distribution<int> byte_dist(0, 255);
+  for (int iteration = 0; iteration < 100; ++iteration) {
+    char data[ByteClassifier::kBlockSize];
+    for (auto& c : data) {
+      c = static_cast<char>(byte_dist(rng));
+    }
+    uint64_t masks[5];
+    classifier.Classify(data, masks);
+    for (int i = 0; i < ByteClassifier::kBlockSize; ++i) {
+      const auto expected = expected_classes(static_cast<uint8_t>(data[i]));
+      for (int k = 0; k < 5; ++k) {
+        ASSERT_EQ(expected[k], ((masks[k] >> i) & 1) != 0)
+            << "class " << k << ", byte " << static_cast<int>(data[i]);
+      }
+    }
+  }
+}
+
+TEST(ByteClassifier, PrefixXor) {
+  ByteClassifier classifier({});
+  ASSERT_EQ(classifier.PrefixXor(0), 0);
+  ASSERT_EQ(classifier.PrefixXor(1), ~uint64_t{0});
+  ASSERT_EQ(classifier.PrefixXor(0b1001000), 0b0111000);
+
+  std::default_random_engine rng(42);
+  std::uniform_int_distribution<uint64_t> dist;
+  for (int iteration = 0; iteration < 100; ++iteration) {
+    const uint64_t bits = dist(rng);
+    uint64_t expected = 0;
+    bool parity = false;
+    for (int i = 0; i < 64; ++i) {
+      parity ^= ((bits >> i) & 1) != 0;
+      expected |= static_cast<uint64_t>(parity) << i;
+    }
+    ASSERT_EQ(classifier.PrefixXor(bits), expected);
+    ASSERT_EQ(PrefixXorPortable(bits), expected);
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
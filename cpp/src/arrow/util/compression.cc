@@ -20,6 +20,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -200,11 +201,14 @@ Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
       codec = internal::MakeLz4HadoopRawCodec();
 #endif
       break;
-    case Compression::ZSTD:
+    case Compression::ZSTD: {
 #ifdef ARROW_WITH_ZSTD
-      codec = internal::MakeZSTDCodec(compression_level);
+      auto opt = dynamic_cast<const ZstdCodecOptions*>(&codec_options);
+      codec = internal::MakeZSTDCodec(compression_level,
+                                      opt ? opt->dictionary : nullptr);
 #endif
       break;
+    }
     case Compression::BZ2:
 #ifdef ARROW_WITH_BZ2
       codec = internal::MakeBZ2Codec(compression_level);
@@ -274,5 +278,14 @@ bool Codec::IsAvailable(Compression::type codec_type) {
   }
 }
 
+Result<std::shared_ptr<Buffer>> TrainZstdDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_dictionary_size) {
+#ifdef ARROW_WITH_ZSTD
+  return internal::TrainZSTDDictionary(samples, max_dictionary_size);
+#else
+  return Status::NotImplemented("Support for codec 'zstd' not built");
+#endif
+}
+
 }  // namespace util
 }  // namespace arrow
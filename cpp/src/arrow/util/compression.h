@@ -22,9 +22,11 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/type_fwd.h"
 #include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
@@ -142,6 +144,30 @@ class ARROW_EXPORT BrotliCodecOptions : public CodecOptions {
   std::optional<int> window_bits;
 };
 
+// ----------------------------------------------------------------------
+// zstd codec options implementation
+
+class ARROW_EXPORT ZstdCodecOptions : public CodecOptions {
+ public:
+  /// \brief A compression dictionary, e.g. trained with TrainZstdDictionary
+  ///
+  /// Data compressed with a dictionary can only be decompressed by a codec
+  /// created with the same dictionary.
+  std::shared_ptr<Buffer> dictionary;
+};
+
+/// \brief Train a zstd compression dictionary from samples of typical data
+///
+/// Dictionaries mostly help compressing small inputs, which otherwise don't
+/// provide enough history for good compression ratios.
+///
+/// \param[in] samples the sample data; many small samples work best
+/// \param[in] max_dictionary_size the maximum size of the dictionary in bytes
+/// \return the dictionary, to be passed in ZstdCodecOptions
+ARROW_EXPORT
+Result<std::shared_ptr<Buffer>> TrainZstdDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_dictionary_size);
+
 /// \brief Compression codec
 class ARROW_EXPORT Codec {
  public:
@@ -26,6 +26,7 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
@@ -517,6 +518,59 @@ TEST(TestCodecMisc, SpecifyCodecOptionsBrotli) {
   }
 }
 
+TEST(TestCodecMisc, SpecifyCodecOptionsZstdDictionary) {
+  if (!Codec::IsAvailable(Compression::ZSTD)) {
+    GTEST_SKIP() << "ZSTD support not built";
+  }
+  // Many small, similar records: the typical use case for dictionaries
+  auto make_record = [](int i) {
+    std::string record = "{\"id\": " + std::to_string(i * 7919 % 10007) +
+                         ", \"name\": \"user_" + std::to_string(i % 97) +
+                         "\", \"active\": " + (i % 3 ? "true" : "false") + "}";
+    return record;
+  };
+  std::vector<std::shared_ptr<Buffer>> samples;
+  for (int i = 0; i < 1000; ++i) {
+    samples.push_back(Buffer::FromString(make_record(i)));
+  }
+  ASSERT_OK_AND_ASSIGN(auto dictionary,
+                       TrainZstdDictionary(samples, /*max_dictionary_size=*/4096));
+  ASSERT_GT(dictionary->size(), 0);
+  ASSERT_LE(dictionary->size(), 4096);
+
+  ZstdCodecOptions codec_options;
+  codec_options.dictionary = dictionary;
+  ASSERT_OK_AND_ASSIGN(auto c1, Codec::Create(Compression::ZSTD, codec_options));
+  ASSERT_OK_AND_ASSIGN(auto c2, Codec::Create(Compression::ZSTD, codec_options));
+  ASSERT_OK_AND_ASSIGN(auto plain, Codec::Create(Compression::ZSTD));
+
+  auto record = make_record(1234);
+  std::vector<uint8_t> data(record.begin(), record.end());
+  CheckCodecRoundtrip(c1, c2, data);
+  CheckStreamingCompressor(c1.get(), data);
+  CheckStreamingDecompressor(c1.get(), data);
+  CheckStreamingRoundtrip(c1.get(), data);
+
+  // The dictionary improves compression of small inputs...
+  auto compress = [&](Codec* codec, std::vector<uint8_t>* out) {
+    out->resize(codec->MaxCompressedLen(data.size(), data.data()));
+    ASSERT_OK_AND_ASSIGN(auto size, codec->Compress(data.size(), data.data(),
+                                                    out->size(), out->data()));
+    out->resize(size);
+  };
+  std::vector<uint8_t> with_dictionary, without_dictionary;
+  compress(c1.get(), &with_dictionary);
+  compress(plain.get(), &without_dictionary);
+  ASSERT_LT(with_dictionary.size(), without_dictionary.size());
+
+  // ...but is required to decompress
+  std::vector<uint8_t> decompressed(data.size());
+  ASSERT_RAISES(IOError, plain->Decompress(with_dictionary.size(), with_dictionary.data(),
+                                           decompressed.size(), decompressed.data()));
+
+  ASSERT_RAISES(Invalid, TrainZstdDictionary({}, 4096));
+}
+
 TEST_P(CodecTest, MinMaxCompressionLevel) {
   auto type = GetCompression();
   ASSERT_OK_AND_ASSIGN(auto codec, Codec::Create(type));
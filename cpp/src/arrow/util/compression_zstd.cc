@@ -20,9 +20,13 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include <zdict.h>
 #include <zstd.h>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
@@ -40,12 +44,17 @@ Status ZSTDError(size_t ret, const char* prefix_msg) {
   return Status::IOError(prefix_msg, ZSTD_getErrorName(ret));
 }
 
+// Digested dictionaries are shared by a codec and its streaming (de)compressors
+using ZSTDCDictPtr = std::shared_ptr<ZSTD_CDict>;
+using ZSTDDDictPtr = std::shared_ptr<ZSTD_DDict>;
+
 // ----------------------------------------------------------------------
 // ZSTD decompressor implementation
 
 class ZSTDDecompressor : public Decompressor {
  public:
-  ZSTDDecompressor() : stream_(ZSTD_createDStream()) {}
+  explicit ZSTDDecompressor(ZSTDDDictPtr dictionary = nullptr)
+      : stream_(ZSTD_createDStream()), dictionary_(std::move(dictionary)) {}
 
   ~ZSTDDecompressor() override { ZSTD_freeDStream(stream_); }
 
@@ -54,9 +63,14 @@ class ZSTDDecompressor : public Decompressor {
     size_t ret = ZSTD_initDStream(stream_);
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
-    } else {
-      return Status::OK();
     }
+    if (dictionary_) {
+      ret = ZSTD_DCtx_refDDict(stream_, dictionary_.get());
+      if (ZSTD_isError(ret)) {
+        return ZSTDError(ret, "ZSTD init failed: ");
+      }
+    }
+    return Status::OK();
   }
 
   Result<DecompressResult> Decompress(int64_t input_len, const uint8_t* input,
@@ -88,6 +102,7 @@ class ZSTDDecompressor : public Decompressor {
 
  protected:
   ZSTD_DStream* stream_;
+  ZSTDDDictPtr dictionary_;
   bool finished_;
 };
 
@@ -96,8 +111,10 @@ class ZSTDDecompressor : public Decompressor {
 
 class ZSTDCompressor : public Compressor {
  public:
-  explicit ZSTDCompressor(int compression_level)
-      : stream_(ZSTD_createCStream()), compression_level_(compression_level) {}
+  explicit ZSTDCompressor(int compression_level, ZSTDCDictPtr dictionary = nullptr)
+      : stream_(ZSTD_createCStream()),
+        compression_level_(compression_level),
+        dictionary_(std::move(dictionary)) {}
 
   ~ZSTDCompressor() override { ZSTD_freeCStream(stream_); }
 
@@ -105,9 +122,15 @@ class ZSTDCompressor : public Compressor {
     size_t ret = ZSTD_initCStream(stream_, compression_level_);
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
-    } else {
-      return Status::OK();
     }
+    if (dictionary_) {
+      // The compression level of the digested dictionary applies
+      ret = ZSTD_CCtx_refCDict(stream_, dictionary_.get());
+      if (ZSTD_isError(ret)) {
+        return ZSTDError(ret, "ZSTD init failed: ");
+      }
+    }
+    return Status::OK();
   }
 
   Result<CompressResult> Compress(int64_t input_len, const uint8_t* input,
@@ -166,6 +189,7 @@ class ZSTDCompressor : public Compressor {
 
  private:
   int compression_level_;
+  ZSTDCDictPtr dictionary_;
 };
 
 // ----------------------------------------------------------------------
@@ -173,10 +197,26 @@ class ZSTDCompressor : public Compressor {
 
 class ZSTDCodec : public Codec {
  public:
-  explicit ZSTDCodec(int compression_level)
+  ZSTDCodec(int compression_level, std::shared_ptr<Buffer> dictionary)
       : compression_level_(compression_level == kUseDefaultCompressionLevel
                                ? kZSTDDefaultCompressionLevel
-                               : compression_level) {}
+                               : compression_level),
+        dictionary_(std::move(dictionary)) {}
+
+  Status Init() override {
+    if (dictionary_ == nullptr) {
+      return Status::OK();
+    }
+    // Digest the dictionary once for all (de)compression calls
+    const auto size = static_cast<size_t>(dictionary_->size());
+    cdict_ = ZSTDCDictPtr(
+        ZSTD_createCDict(dictionary_->data(), size, compression_level_), ZSTD_freeCDict);
+    ddict_ = ZSTDDDictPtr(ZSTD_createDDict(dictionary_->data(), size), ZSTD_freeDDict);
+    if (cdict_ == nullptr || ddict_ == nullptr) {
+      return Status::Invalid("Failed to load ZSTD dictionary");
+    }
+    return Status::OK();
+  }
 
   Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer) override {
@@ -188,8 +228,17 @@ class ZSTDCodec : public Codec {
       output_buffer = &empty_buffer;
     }
 
-    size_t ret = ZSTD_decompress(output_buffer, static_cast<size_t>(output_buffer_len),
-                                 input, static_cast<size_t>(input_len));
+    size_t ret;
+    if (ddict_) {
+      std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> context(ZSTD_createDCtx(),
+                                                                   ZSTD_freeDCtx);
+      ret = ZSTD_decompress_usingDDict(context.get(), output_buffer,
+                                       static_cast<size_t>(output_buffer_len), input,
+                                       static_cast<size_t>(input_len), ddict_.get());
+    } else {
+      ret = ZSTD_decompress(output_buffer, static_cast<size_t>(output_buffer_len), input,
+                            static_cast<size_t>(input_len));
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD decompression failed: ");
     }
@@ -207,8 +256,17 @@ class ZSTDCodec : public Codec {
 
   Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output_buffer) override {
-    size_t ret = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len),
-                               input, static_cast<size_t>(input_len), compression_level_);
+    size_t ret;
+    if (cdict_) {
+      std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> context(ZSTD_createCCtx(),
+                                                                   ZSTD_freeCCtx);
+      ret = ZSTD_compress_usingCDict(context.get(), output_buffer,
+                                     static_cast<size_t>(output_buffer_len), input,
+                                     static_cast<size_t>(input_len), cdict_.get());
+    } else {
+      ret = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len), input,
+                          static_cast<size_t>(input_len), compression_level_);
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD compression failed: ");
     }
@@ -216,13 +274,13 @@ class ZSTDCodec : public Codec {
   }
 
   Result<std::shared_ptr<Compressor>> MakeCompressor() override {
-    auto ptr = std::make_shared<ZSTDCompressor>(compression_level_);
+    auto ptr = std::make_shared<ZSTDCompressor>(compression_level_, cdict_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
 
   Result<std::shared_ptr<Decompressor>> MakeDecompressor() override {
-    auto ptr = std::make_shared<ZSTDDecompressor>();
+    auto ptr = std::make_shared<ZSTDDecompressor>(ddict_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -236,12 +294,44 @@ class ZSTDCodec : public Codec {
 
  private:
   const int compression_level_;
+  std::shared_ptr<Buffer> dictionary_;
+  ZSTDCDictPtr cdict_;
+  ZSTDDDictPtr ddict_;
 };
 
 }  // namespace
 
-std::unique_ptr<Codec> MakeZSTDCodec(int compression_level) {
-  return std::make_unique<ZSTDCodec>(compression_level);
+std::unique_ptr<Codec> MakeZSTDCodec(int compression_level,
+                                     std::shared_ptr<Buffer> dictionary) {
+  return std::make_unique<ZSTDCodec>(compression_level, std::move(dictionary));
+}
+
+Result<std::shared_ptr<Buffer>> TrainZSTDDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_dictionary_size) {
+  BufferVector nonempty_samples;
+  std::vector<size_t> sample_sizes;
+  for (const auto& sample : samples) {
+    if (sample != nullptr && sample->size() > 0) {
+      nonempty_samples.push_back(sample);
+      sample_sizes.push_back(static_cast<size_t>(sample->size()));
+    }
+  }
+  if (nonempty_samples.empty()) {
+    return Status::Invalid("Cannot train a ZSTD dictionary without samples");
+  }
+  if (max_dictionary_size <= 0) {
+    return Status::Invalid("ZSTD dictionary size must be positive");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto data, ConcatenateBuffers(nonempty_samples));
+  ARROW_ASSIGN_OR_RAISE(auto dictionary, AllocateResizableBuffer(max_dictionary_size));
+  size_t ret = ZDICT_trainFromBuffer(
+      dictionary->mutable_data(), static_cast<size_t>(max_dictionary_size), data->data(),
+      sample_sizes.data(), static_cast<unsigned>(sample_sizes.size()));
+  if (ZDICT_isError(ret)) {
+    return Status::Invalid("ZSTD dictionary training failed: ", ZDICT_getErrorName(ret));
+  }
+  RETURN_NOT_OK(dictionary->Resize(static_cast<int64_t>(ret)));
+  return std::shared_ptr<Buffer>(std::move(dictionary));
 }
 
 }  // namespace internal
@@ -42,6 +42,7 @@
 #cmakedefine ARROW_DATASET
 #cmakedefine ARROW_FILESYSTEM
 #cmakedefine ARROW_FLIGHT
+#cmakedefine ARROW_FLIGHT_SHM
 #cmakedefine ARROW_FLIGHT_SQL
 #cmakedefine ARROW_IPC
 #cmakedefine ARROW_JEMALLOC
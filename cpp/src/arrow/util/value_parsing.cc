@@ -23,6 +23,8 @@
 #include <utility>
 
 #include "arrow/util/float16.h"
+#include "arrow/util/simd.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/vendored/fast_float/fast_float.h"
 
 using arrow::util::Float16;
@@ -60,6 +62,171 @@ bool StringToFloat(const char* s, size_t length, char decimal_point, uint16_t* o
   return ok;
 }
 
+// ----------------------------------------------------------------------
+// ISO-8601 parsing
+
+namespace detail {
+
+namespace {
+
+#if defined(ARROW_HAVE_SSE4_2)
+
+// The mask of the bytes of `digits` (characters minus '0') which are digits
+inline int DigitMask(__m128i digits) {
+  return _mm_movemask_epi8(
+      _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits));
+}
+
+// Combine pairs of digits into 16-bit values
+inline __m128i DigitPairs(__m128i digits) {
+  return _mm_maddubs_epi16(digits, _mm_set1_epi16(0x010A));
+}
+
+// "YYYY-MM-DD", without reading past the 10 characters
+bool DecodeDate(const char* s, DateTimeFields* out) {
+  const auto day = util::SafeLoadAs<uint16_t>(reinterpret_cast<const uint8_t*>(s + 8));
+  const __m128i v =
+      _mm_insert_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(s)), day, 4);
+  const __m128i digits = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+  constexpr int kDigits = 0b1101101111;
+  constexpr int kSeparators = 0b0010010000;
+  const __m128i separators =
+      _mm_setr_epi8(0, 0, 0, 0, '-', 0, 0, '-', 0, 0, 0, 0, 0, 0, 0, 0);
+  const int ok = (DigitMask(digits) & kDigits) |
+                 (_mm_movemask_epi8(_mm_cmpeq_epi8(v, separators)) & kSeparators);
+  if (ARROW_PREDICT_FALSE(ok != (kDigits | kSeparators))) {
+    return false;
+  }
+  // {YY, YY, MM, DD}
+  const __m128i fields = DigitPairs(_mm_shuffle_epi8(
+      digits, _mm_setr_epi8(0, 1, 2, 3, 5, 6, 8, 9, -1, -1, -1, -1, -1, -1, -1, -1)));
+  out->year = static_cast<uint16_t>(_mm_extract_epi16(fields, 0) * 100 +
+                                    _mm_extract_epi16(fields, 1));
+  out->month = static_cast<uint8_t>(_mm_extract_epi16(fields, 2));
+  out->day = static_cast<uint8_t>(_mm_extract_epi16(fields, 3));
+  return true;
+}
+
+// "YYYY-MM-DD[ T]hh:mm:ss", as "YYYY-MM-DD?hh:mm" and the end of a second,
+// overlapping load
+bool DecodeDateTimeSeconds(const char* s, DateTimeFields* out) {
+  const __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+  const __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 3));
+  const __m128i head_digits = _mm_sub_epi8(head, _mm_set1_epi8('0'));
+  const __m128i tail_digits = _mm_sub_epi8(tail, _mm_set1_epi8('0'));
+  const __m128i is_head_separator = _mm_or_si128(
+      _mm_cmpeq_epi8(head, _mm_setr_epi8(0, 0, 0, 0, '-', 0, 0, '-', 0, 0, 'T', 0, 0,
+                                         ':', 0, 0)),
+      _mm_cmpeq_epi8(head, _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, ' ', 0, 0, 0,
+                                         0, 0)));
+  const __m128i is_tail_separator = _mm_cmpeq_epi8(tail, _mm_set1_epi8(':'));
+  constexpr int kHeadDigits = 0b1101101101101111;
+  constexpr int kTailDigits = 0b1100000000000000;
+  constexpr int kTailSeparator = 0b0010000000000000;
+  const int head_ok = (DigitMask(head_digits) & kHeadDigits) |
+                      (_mm_movemask_epi8(is_head_separator) & ~kHeadDigits & 0xFFFF);
+  const int tail_ok = (DigitMask(tail_digits) & kTailDigits) |
+                      (_mm_movemask_epi8(is_tail_separator) & kTailSeparator);
+  if (ARROW_PREDICT_FALSE((head_ok != 0xFFFF) |
+                          (tail_ok != (kTailDigits | kTailSeparator)))) {
+    return false;
+  }
+  // {YY, YY, MM, DD, hh, mm, ss}
+  const __m128i head_pairs = _mm_shuffle_epi8(
+      head_digits, _mm_setr_epi8(0, 1, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, -1, -1, -1, -1));
+  const __m128i tail_pair = _mm_shuffle_epi8(
+      tail_digits, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 14, 15,
+                                 -1, -1));
+  const __m128i fields = DigitPairs(_mm_or_si128(head_pairs, tail_pair));
+  const int hours = _mm_extract_epi16(fields, 4);
+  const int minutes = _mm_extract_epi16(fields, 5);
+  const int seconds = _mm_extract_epi16(fields, 6);
+  if (ARROW_PREDICT_FALSE((hours >= 24) | (minutes >= 60) | (seconds >= 60))) {
+    return false;
+  }
+  out->year = static_cast<uint16_t>(_mm_extract_epi16(fields, 0) * 100 +
+                                    _mm_extract_epi16(fields, 1));
+  out->month = static_cast<uint8_t>(_mm_extract_epi16(fields, 2));
+  out->day = static_cast<uint8_t>(_mm_extract_epi16(fields, 3));
+  out->hours = static_cast<uint8_t>(hours);
+  out->minutes = static_cast<uint8_t>(minutes);
+  out->seconds = static_cast<uint8_t>(seconds);
+  return true;
+}
+
+// The last 1 to 9 characters of a string of at least 16 characters
+bool DecodeSubSeconds(const char* end, int num_digits, uint32_t* out) {
+  const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(end - 16));
+  const __m128i digits = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+  const int lanes = 0xFFFF & ~((1 << (16 - num_digits)) - 1);
+  if (ARROW_PREDICT_FALSE((DigitMask(digits) & lanes) != lanes)) {
+    return false;
+  }
+  // Zero the other lanes and combine the digits into two 8-digit values
+  const __m128i keep =
+      _mm_cmpgt_epi8(_mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                     _mm_set1_epi8(static_cast<char>(15 - num_digits)));
+  const __m128i pairs = DigitPairs(_mm_and_si128(digits, keep));
+  const __m128i quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00010064));
+  const __m128i octets =
+      _mm_madd_epi16(_mm_packus_epi32(quads, quads), _mm_set1_epi32(0x00012710));
+  *out = static_cast<uint32_t>(_mm_cvtsi128_si32(octets)) * 100000000 +
+         static_cast<uint32_t>(_mm_extract_epi32(octets, 1));
+  return true;
+}
+
+#else
+
+bool DecodeDate(const char* s, DateTimeFields* out) {
+  return ARROW_PREDICT_TRUE(s[4] == '-') && ARROW_PREDICT_TRUE(s[7] == '-') &&
+         ParseUnsigned(s + 0, 4, &out->year) && ParseUnsigned(s + 5, 2, &out->month) &&
+         ParseUnsigned(s + 8, 2, &out->day);
+}
+
+bool DecodeDateTimeSeconds(const char* s, DateTimeFields* out) {
+  if (ARROW_PREDICT_FALSE(!DecodeDate(s, out)) ||
+      ARROW_PREDICT_FALSE(s[10] != ' ' && s[10] != 'T') ||
+      ARROW_PREDICT_FALSE(s[13] != ':') || ARROW_PREDICT_FALSE(s[16] != ':') ||
+      ARROW_PREDICT_FALSE(!ParseUnsigned(s + 11, 2, &out->hours)) ||
+      ARROW_PREDICT_FALSE(!ParseUnsigned(s + 14, 2, &out->minutes)) ||
+      ARROW_PREDICT_FALSE(!ParseUnsigned(s + 17, 2, &out->seconds))) {
+    return false;
+  }
+  return out->hours < 24 && out->minutes < 60 && out->seconds < 60;
+}
+
+bool DecodeSubSeconds(const char* end, int num_digits, uint32_t* out) {
+  return ParseUnsigned(end - num_digits, num_digits, out);
+}
+
+#endif
+
+}  // namespace
+
+bool DecodeDateTime(const char* s, size_t length, DateTimeFields* out) {
+  out->hours = out->minutes = out->seconds = 0;
+  out->num_subsecond_digits = 0;
+  out->subseconds = 0;
+  if (length == 10) {
+    return DecodeDate(s, out);
+  }
+  if (ARROW_PREDICT_FALSE(length < 19) || ARROW_PREDICT_FALSE(length == 20) ||
+      ARROW_PREDICT_FALSE(length > 29) ||
+      ARROW_PREDICT_FALSE(!DecodeDateTimeSeconds(s, out))) {
+    return false;
+  }
+  if (length == 19) {
+    return true;
+  }
+  if (ARROW_PREDICT_FALSE(s[19] != '.')) {
+    return false;
+  }
+  out->num_subsecond_digits = static_cast<uint8_t>(length - 20);
+  return DecodeSubSeconds(s + length, out->num_subsecond_digits, &out->subseconds);
+}
+
+}  // namespace detail
+
 // ----------------------------------------------------------------------
 // strptime-like parsing
 
@@ -69,6 +236,14 @@ class StrptimeTimestampParser : public TimestampParser {
  public:
   explicit StrptimeTimestampParser(std::string format)
       : format_(std::move(format)), have_zone_offset_(false) {
+    // Fixed-width ISO-8601 layouts are parsed without going through strptime,
+    // which is comparatively slow
+    if (format_ == "%Y-%m-%d") {
+      iso_length_ = 10;
+    } else if (format_ == "%Y-%m-%dT%H:%M:%S" || format_ == "%Y-%m-%d %H:%M:%S") {
+      iso_length_ = 19;
+      iso_separator_ = format_[8];
+    }
     // Check for use of %z
     size_t cur = 0;
     while (cur < format_.size()) {
@@ -88,6 +263,11 @@ class StrptimeTimestampParser : public TimestampParser {
     if (out_zone_offset_present) {
       *out_zone_offset_present = have_zone_offset_;
     }
+    if (length == iso_length_ && ParseISO8601(s, out_unit, out)) {
+      return true;
+    }
+    // Fall back on strptime, which is more lenient (e.g. about whitespace or
+    // out-of-range days)
     return ParseTimestampStrptime(s, length, format_.c_str(),
                                   /*ignore_time_in_day=*/false,
                                   /*allow_trailing_chars=*/false, out_unit, out);
@@ -98,8 +278,29 @@ class StrptimeTimestampParser : public TimestampParser {
   const char* format() const override { return format_.c_str(); }
 
  private:
+  bool ParseISO8601(const char* s, TimeUnit::type out_unit, int64_t* out) const {
+    using seconds_type = std::chrono::duration<TimestampType::c_type>;
+
+    detail::DateTimeFields fields;
+    seconds_type since_epoch;
+    if ((iso_length_ != 10 && s[10] != iso_separator_) ||
+        !detail::DecodeDateTime(s, iso_length_, &fields) ||
+        !detail::DateSinceEpoch(fields.year, fields.month, fields.day, &since_epoch)) {
+      return false;
+    }
+    since_epoch += std::chrono::hours(fields.hours) +
+                   std::chrono::minutes(fields.minutes) +
+                   std::chrono::seconds(fields.seconds);
+    *out = util::CastSecondsToUnit(out_unit, since_epoch.count());
+    return true;
+  }
+
   std::string format_;
   bool have_zone_offset_;
+  // The length of the strings matching format_, if it is a fixed-width ISO-8601
+  // layout
+  size_t iso_length_ = 0;
+  char iso_separator_ = 0;
 };
 
 class ISO8601Parser : public TimestampParser {
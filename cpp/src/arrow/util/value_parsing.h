@@ -550,11 +550,10 @@ static inline bool ParseHH_MM_SS(const char* s, Duration* out) {
   return true;
 }
 
-static inline bool ParseSubSeconds(const char* s, size_t length, TimeUnit::type unit,
-                                   uint32_t* out) {
-  // The decimal point has been peeled off at this point
-
-  // Fail if number of decimal places provided exceeds what the unit can hold.
+// Scale `length` decimal places of a fraction of a second to the given unit,
+// failing if they exceed what the unit can hold
+static inline bool ScaleSubSeconds(uint32_t subseconds, size_t length,
+                                   TimeUnit::type unit, uint32_t* out) {
   // Calculate how many trailing decimal places are omitted for the unit
   // e.g. if 4 decimal places are provided and unit is MICRO, 2 are missing
   size_t omitted = 0;
@@ -563,91 +562,46 @@ static inline bool ParseSubSeconds(const char* s, size_t length, TimeUnit::type
       if (ARROW_PREDICT_FALSE(length > 3)) {
         return false;
       }
-      if (length < 3) {
-        omitted = 3 - length;
-      }
+      omitted = 3 - length;
       break;
     case TimeUnit::MICRO:
       if (ARROW_PREDICT_FALSE(length > 6)) {
         return false;
       }
-      if (length < 6) {
-        omitted = 6 - length;
-      }
+      omitted = 6 - length;
       break;
     case TimeUnit::NANO:
       if (ARROW_PREDICT_FALSE(length > 9)) {
         return false;
       }
-      if (length < 9) {
-        omitted = 9 - length;
-      }
+      omitted = 9 - length;
       break;
     default:
       return false;
   }
 
-  if (ARROW_PREDICT_TRUE(omitted == 0)) {
-    return ParseUnsigned(s, length, out);
-  } else {
-    uint32_t subseconds = 0;
-    bool success = ParseUnsigned(s, length, &subseconds);
-    if (ARROW_PREDICT_TRUE(success)) {
-      switch (omitted) {
-        case 1:
-          *out = subseconds * 10;
-          break;
-        case 2:
-          *out = subseconds * 100;
-          break;
-        case 3:
-          *out = subseconds * 1000;
-          break;
-        case 4:
-          *out = subseconds * 10000;
-          break;
-        case 5:
-          *out = subseconds * 100000;
-          break;
-        case 6:
-          *out = subseconds * 1000000;
-          break;
-        case 7:
-          *out = subseconds * 10000000;
-          break;
-        case 8:
-          *out = subseconds * 100000000;
-          break;
-        default:
-          // Impossible case
-          break;
-      }
-      return true;
-    } else {
-      return false;
-    }
-  }
+  static constexpr uint32_t kPowersOfTen[] = {1,      10,      100,      1000,     10000,
+                                              100000, 1000000, 10000000, 100000000};
+  *out = subseconds * kPowersOfTen[omitted];
+  return true;
 }
 
-}  // namespace detail
+static inline bool ParseSubSeconds(const char* s, size_t length, TimeUnit::type unit,
+                                   uint32_t* out) {
+  // The decimal point has been peeled off at this point
 
-template <typename Duration>
-static inline bool ParseYYYY_MM_DD(const char* s, Duration* since_epoch) {
-  uint16_t year = 0;
-  uint8_t month = 0;
-  uint8_t day = 0;
-  if (ARROW_PREDICT_FALSE(s[4] != '-') || ARROW_PREDICT_FALSE(s[7] != '-')) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 4, &year))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 5, 2, &month))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 8, 2, &day))) {
+  // Fail early if number of decimal places provided exceeds what the unit can hold
+  uint32_t subseconds = 0;
+  if (ARROW_PREDICT_FALSE(length > 9) ||
+      ARROW_PREDICT_FALSE(!ParseUnsigned(s, length, &subseconds))) {
     return false;
   }
+  return ScaleSubSeconds(subseconds, length, unit, out);
+}
+
+template <typename Duration>
+static inline bool DateSinceEpoch(uint16_t year, uint8_t month, uint8_t day,
+                                  Duration* since_epoch) {
   arrow_vendored::date::year_month_day ymd{arrow_vendored::date::year{year},
                                            arrow_vendored::date::month{month},
                                            arrow_vendored::date::day{day}};
@@ -658,6 +612,36 @@ static inline bool ParseYYYY_MM_DD(const char* s, Duration* since_epoch) {
   return true;
 }
 
+/// \brief The fields of a "YYYY-MM-DD" or "YYYY-MM-DD[ T]hh:mm:ss[.s{1,9}]" value
+struct DateTimeFields {
+  uint16_t year;
+  uint8_t month;
+  uint8_t day;
+  uint8_t hours;
+  uint8_t minutes;
+  uint8_t seconds;
+  uint8_t num_subsecond_digits;
+  uint32_t subseconds;
+};
+
+/// \brief Decode a "YYYY-MM-DD" value of 10 characters, or a
+/// "YYYY-MM-DD[ T]hh:mm:ss[.s{1,9}]" value of 19 or 21 to 29 characters
+///
+/// Checks the layout and the range of the time of day, but not the date.
+/// Uses SIMD instructions where available.
+ARROW_EXPORT bool DecodeDateTime(const char* s, size_t length, DateTimeFields* out);
+
+}  // namespace detail
+
+template <typename Duration>
+static inline bool ParseYYYY_MM_DD(const char* s, Duration* since_epoch) {
+  detail::DateTimeFields fields;
+  if (ARROW_PREDICT_FALSE(!detail::DecodeDateTime(s, 10, &fields))) {
+    return false;
+  }
+  return detail::DateSinceEpoch(fields.year, fields.month, fields.day, since_epoch);
+}
+
 static inline bool ParseTimestampISO8601(const char* s, size_t length,
                                          TimeUnit::type unit, TimestampType::c_type* out,
                                          bool* out_zone_offset_present = NULLPTR) {
@@ -689,11 +673,10 @@ static inline bool ParseTimestampISO8601(const char* s, size_t length,
   if (ARROW_PREDICT_FALSE(length < 10)) return false;
 
   seconds_type seconds_since_epoch;
-  if (ARROW_PREDICT_FALSE(!ParseYYYY_MM_DD(s, &seconds_since_epoch))) {
-    return false;
-  }
-
   if (length == 10) {
+    if (ARROW_PREDICT_FALSE(!ParseYYYY_MM_DD(s, &seconds_since_epoch))) {
+      return false;
+    }
     *out = util::CastSecondsToUnit(unit, seconds_since_epoch.count());
     return true;
   }
@@ -737,14 +720,17 @@ static inline bool ParseTimestampISO8601(const char* s, size_t length,
   }
 
   seconds_type seconds_since_midnight;
+  uint32_t subseconds = 0;
   switch (length) {
     case 13:  // YYYY-MM-DD[ T]hh
-      if (ARROW_PREDICT_FALSE(!detail::ParseHH(s + 11, &seconds_since_midnight))) {
+      if (ARROW_PREDICT_FALSE(!ParseYYYY_MM_DD(s, &seconds_since_epoch)) ||
+          ARROW_PREDICT_FALSE(!detail::ParseHH(s + 11, &seconds_since_midnight))) {
         return false;
       }
       break;
     case 16:  // YYYY-MM-DD[ T]hh:mm
-      if (ARROW_PREDICT_FALSE(!detail::ParseHH_MM(s + 11, &seconds_since_midnight))) {
+      if (ARROW_PREDICT_FALSE(!ParseYYYY_MM_DD(s, &seconds_since_epoch)) ||
+          ARROW_PREDICT_FALSE(!detail::ParseHH_MM(s + 11, &seconds_since_midnight))) {
         return false;
       }
       break;
@@ -758,10 +744,23 @@ static inline bool ParseTimestampISO8601(const char* s, size_t length,
     case 27:  // YYYY-MM-DD[ T]hh:mm:ss.sssssss
     case 28:  // YYYY-MM-DD[ T]hh:mm:ss.ssssssss
     case 29:  // YYYY-MM-DD[ T]hh:mm:ss.sssssssss
-      if (ARROW_PREDICT_FALSE(!detail::ParseHH_MM_SS(s + 11, &seconds_since_midnight))) {
+    {
+      detail::DateTimeFields fields;
+      if (ARROW_PREDICT_FALSE(!detail::DecodeDateTime(s, length, &fields)) ||
+          ARROW_PREDICT_FALSE(!detail::DateSinceEpoch(
+              fields.year, fields.month, fields.day, &seconds_since_epoch))) {
+        return false;
+      }
+      seconds_since_midnight = std::chrono::duration_cast<seconds_type>(
+          std::chrono::hours(fields.hours) + std::chrono::minutes(fields.minutes) +
+          std::chrono::seconds(fields.seconds));
+      if (fields.num_subsecond_digits > 0 &&
+          ARROW_PREDICT_FALSE(!detail::ScaleSubSeconds(
+              fields.subseconds, fields.num_subsecond_digits, unit, &subseconds))) {
         return false;
       }
       break;
+    }
     default:
       return false;
   }
@@ -769,21 +768,6 @@ static inline bool ParseTimestampISO8601(const char* s, size_t length,
   seconds_since_epoch += seconds_since_midnight;
   seconds_since_epoch += zone_offset;
 
-  if (length <= 19) {
-    *out = util::CastSecondsToUnit(unit, seconds_since_epoch.count());
-    return true;
-  }
-
-  if (ARROW_PREDICT_FALSE(s[19] != '.')) {
-    return false;
-  }
-
-  uint32_t subseconds = 0;
-  if (ARROW_PREDICT_FALSE(
-          !detail::ParseSubSeconds(s + 20, length - 20, unit, &subseconds))) {
-    return false;
-  }
-
   *out = util::CastSecondsToUnit(unit, seconds_since_epoch.count()) + subseconds;
   return true;
 }
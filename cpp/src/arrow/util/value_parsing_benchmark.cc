@@ -98,6 +98,33 @@ static std::vector<std::string> MakeTimestampStrings(int32_t num_items) {
   return strings;
 }
 
+// Timestamps with as many fractional digits as `unit` allows and a zone offset
+static std::vector<std::string> MakeFractionalTimestampStrings(int32_t num_items,
+                                                               TimeUnit::type unit) {
+  static const std::string kDigits = "123456789";
+  const size_t num_digits = unit == TimeUnit::MILLI ? 3 : unit == TimeUnit::MICRO ? 6 : 9;
+  const std::string fraction = "." + kDigits.substr(0, num_digits);
+  std::vector<std::string> base_strings = {"2018-11-13T17:11:10" + fraction + "Z",
+                                           "2018-11-13T11:22:33" + fraction + "+01:00",
+                                           "2016-02-29T11:22:33" + fraction + "Z"};
+
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
+static std::vector<std::string> MakeDateStrings(int32_t num_items) {
+  std::vector<std::string> base_strings = {"2018-11-13", "1970-01-01", "2016-02-29"};
+
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
 template <typename c_int, typename c_int_limits = std::numeric_limits<c_int>>
 static typename std::enable_if<c_int_limits::is_signed, std::vector<c_int>>::type
 MakeInts(int32_t num_items) {
@@ -182,12 +209,10 @@ static void FloatParsing(benchmark::State& state) {  // NOLINT non-const referen
 }
 
 static void BenchTimestampParsing(
-    benchmark::State& state, TimeUnit::type unit,
-    const TimestampParser& parser) {  // NOLINT non-const reference
+    benchmark::State& state, TimeUnit::type unit, const TimestampParser& parser,
+    const std::vector<std::string>& strings) {  // NOLINT non-const reference
   using c_type = TimestampType::c_type;
 
-  auto strings = MakeTimestampStrings(1000);
-
   for (auto _ : state) {
     c_type total = 0;
     for (const auto& s : strings) {
@@ -207,14 +232,54 @@ template <TimeUnit::type UNIT>
 static void TimestampParsingISO8601(
     benchmark::State& state) {  // NOLINT non-const reference
   auto parser = TimestampParser::MakeISO8601();
-  BenchTimestampParsing(state, UNIT, *parser);
+  BenchTimestampParsing(state, UNIT, *parser, MakeTimestampStrings(1000));
+}
+
+template <TimeUnit::type UNIT>
+static void TimestampParsingISO8601Fractional(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto parser = TimestampParser::MakeISO8601();
+  BenchTimestampParsing(state, UNIT, *parser, MakeFractionalTimestampStrings(1000, UNIT));
 }
 
 template <TimeUnit::type UNIT>
 static void TimestampParsingStrptime(
     benchmark::State& state) {  // NOLINT non-const reference
   auto parser = TimestampParser::MakeStrptime("%Y-%m-%d %H:%M:%S");
-  BenchTimestampParsing(state, UNIT, *parser);
+  BenchTimestampParsing(state, UNIT, *parser, MakeTimestampStrings(1000));
+}
+
+template <TimeUnit::type UNIT>
+static void TimestampParsingStrptimeCustom(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // A format that doesn't match the ISO-8601 layout
+  auto parser = TimestampParser::MakeStrptime("%Y/%m/%d %H:%M:%S");
+  std::vector<std::string> strings = MakeTimestampStrings(1000);
+  for (auto& s : strings) {
+    std::replace(s.begin(), s.end(), '-', '/');
+  }
+  BenchTimestampParsing(state, UNIT, *parser, strings);
+}
+
+template <typename ARROW_TYPE>
+static void DateParsing(benchmark::State& state) {  // NOLINT non-const reference
+  using c_type = typename ARROW_TYPE::c_type;
+
+  auto strings = MakeDateStrings(1000);
+
+  for (auto _ : state) {
+    c_type total = 0;
+    for (const auto& s : strings) {
+      c_type value;
+      if (!ParseValue<ARROW_TYPE>(s.data(), s.length(), &value)) {
+        std::cerr << "Conversion failed for '" << s << "'";
+        std::abort();
+      }
+      total += value;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
 struct DummyAppender {
@@ -285,7 +350,14 @@ BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::SECOND);
 BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::MILLI);
 BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::MICRO);
 BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::NANO);
+BENCHMARK_TEMPLATE(TimestampParsingISO8601Fractional, TimeUnit::MILLI);
+BENCHMARK_TEMPLATE(TimestampParsingISO8601Fractional, TimeUnit::MICRO);
+BENCHMARK_TEMPLATE(TimestampParsingISO8601Fractional, TimeUnit::NANO);
 BENCHMARK_TEMPLATE(TimestampParsingStrptime, TimeUnit::MILLI);
+BENCHMARK_TEMPLATE(TimestampParsingStrptimeCustom, TimeUnit::MILLI);
+
+BENCHMARK_TEMPLATE(DateParsing, Date32Type);
+BENCHMARK_TEMPLATE(DateParsing, Date64Type);
 
 BENCHMARK_TEMPLATE(IntegerFormatting, Int8Type);
 BENCHMARK_TEMPLATE(IntegerFormatting, Int16Type);
@@ -576,6 +576,11 @@ TEST(StringConversion, ToTimestampDate_ISO8601) {
     AssertConversionFails(type, "1970/01/01");
     AssertConversionFails(type, "1970-01-01 ");
     AssertConversionFails(type, "1970-01-01Z");
+    AssertConversionFails(type, "1970-01-0a");
+    AssertConversionFails(type, "197a-01-01");
+    AssertConversionFails(type, "1970-0/-01");
+    AssertConversionFails(type, "1970 01-01");
+    AssertConversionFails(type, "+970-01-01");
 
     // Invalid dates
     AssertConversionFails(type, "1970-00-01");
@@ -793,6 +798,13 @@ TEST(StringConversion, ToTimestampDateTime_ISO8601) {
 
     // Invalid subseconds
     AssertConversionFails(type, "1900-02-28 12:34:56.1234567890");
+    AssertConversionFails(type, "1900-02-28 12:34:56.");
+    AssertConversionFails(type, "1900-02-28 12:34:56,123");
+    AssertConversionFails(type, "1900-02-28 12:34:56.a");
+    AssertConversionFails(type, "1900-02-28 12:34:56.12345678a");
+    AssertConversionFails(type, "1900-02-28 12:34:56.1234 5678");
+    AssertConversionFails(type, "1900-02-28 12:34:56.-12345678");
+    AssertConversionFails(type, "1900-02-28 12:34:56.12:45678Z");
   }
 }
 
@@ -826,6 +838,48 @@ TEST(TimestampParser, StrptimeParser) {
   }
 }
 
+TEST(TimestampParser, StrptimeParserISO8601Format) {
+  // These formats are parsed without calling strptime when possible
+  struct Case {
+    std::string format;
+    std::string value;
+    std::string iso8601;
+  };
+
+  std::vector<Case> cases = {
+      {"%Y-%m-%d", "2000-05-31", "2000-05-31"},
+      {"%Y-%m-%d", "1900-02-28", "1900-02-28"},
+      {"%Y-%m-%d %H:%M:%S", "2000-05-31 12:34:56", "2000-05-31 12:34:56"},
+      {"%Y-%m-%d %H:%M:%S", "1969-12-31 23:59:59", "1969-12-31 23:59:59"},
+      {"%Y-%m-%dT%H:%M:%S", "2000-05-31T12:34:56", "2000-05-31 12:34:56"},
+  };
+  for (auto unit : TimeUnit::values()) {
+    for (const auto& case_ : cases) {
+      ARROW_SCOPED_TRACE("format = '", case_.format, "', value = '", case_.value, "'");
+      auto parser = TimestampParser::MakeStrptime(case_.format);
+      int64_t converted, expected;
+      ASSERT_TRUE((*parser)(case_.value.c_str(), case_.value.size(), unit, &converted));
+      ASSERT_TRUE(ParseTimestampISO8601(case_.iso8601.c_str(), case_.iso8601.size(), unit,
+                                        &expected));
+      ASSERT_EQ(expected, converted);
+    }
+  }
+
+  std::vector<Case> unparseables = {
+      {"%Y-%m-%d", "2000-13-01", ""},
+      {"%Y-%m-%d %H:%M:%S", "2000-05-31T12:34:56", ""},
+      {"%Y-%m-%dT%H:%M:%S", "2000-05-31 12:34:56", ""},
+      {"%Y-%m-%dT%H:%M:%S", "2000-05-31T24:34:56", ""},
+  };
+  for (const auto& case_ : unparseables) {
+    ARROW_SCOPED_TRACE("format = '", case_.format, "', value = '", case_.value, "'");
+    auto parser = TimestampParser::MakeStrptime(case_.format);
+    int64_t dummy;
+    ASSERT_FALSE(
+        (*parser)(case_.value.c_str(), case_.value.size(), TimeUnit::SECOND, &dummy));
+  }
+}
+
 TEST(TimestampParser, StrptimeZoneOffset) {
   if (!kStrptimeSupportsZone) {
     GTEST_SKIP() << "strptime does not support %z on this platform";